@@ -106,17 +106,46 @@ BoardShim::BoardShim (int board_id, struct BrainFlowInputParams params)
     serialized_params = params_to_string (params);
     this->params = params;
     this->board_id = board_id;
+    session_handle = -1;
 }
 
 void BoardShim::prepare_session ()
 {
-    int res = ::prepare_session (board_id, serialized_params.c_str ());
+    int res = ::prepare_session_with_handle (board_id, serialized_params.c_str (), &session_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to prepare session", res);
     }
 }
 
+int BoardShim::get_session_handle ()
+{
+    // session may be prepared by another BoardShim object with the same params
+    if (session_handle < 0)
+    {
+        int handle = -1;
+        if (::get_session_handle (board_id, serialized_params.c_str (), &handle) ==
+            (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            session_handle = handle;
+        }
+    }
+    return session_handle;
+}
+
+int BoardShim::call_with_session_handle (std::function<int (int)> func)
+{
+    int res = func (get_session_handle ());
+    // another object or release_all_sessions may release the session and prepare it again, cached
+    // handle is rejected then, resolve it once more
+    if ((res == (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR) && (session_handle >= 0))
+    {
+        session_handle = -1;
+        res = func (get_session_handle ());
+    }
+    return res;
+}
+
 bool BoardShim::is_prepared ()
 {
     int prepared = 0;
@@ -170,6 +199,7 @@ void BoardShim::stop_stream ()
 void BoardShim::release_session ()
 {
     int res = ::release_session (board_id, serialized_params.c_str ());
+    session_handle = -1;
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to release session", res);
@@ -179,7 +209,8 @@ void BoardShim::release_session ()
 int BoardShim::get_board_data_count (int preset)
 {
     int data_count = 0;
-    int res = ::get_board_data_count (preset, &data_count, board_id, serialized_params.c_str ());
+    int res = call_with_session_handle ([&] (int handle)
+        { return ::get_board_data_count_by_handle (preset, &data_count, handle); });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to get board data count", res);
@@ -187,6 +218,22 @@ int BoardShim::get_board_data_count (int preset)
     return data_count;
 }
 
+int BoardShim::wait_for_board_data (int min_samples, int timeout_ms, int preset)
+{
+    int data_count = 0;
+    int res = call_with_session_handle ([&] (int handle)
+        {
+            return ::wait_for_board_data_by_handle (
+                min_samples, timeout_ms, preset, &data_count, handle);
+        });
+    if ((res != (int)BrainFlowExitCodes::STATUS_OK) &&
+        (res != (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR))
+    {
+        throw BrainFlowException ("failed to wait for board data", res);
+    }
+    return data_count;
+}
+
 BrainFlowArray<double, 2> BoardShim::get_board_data (int preset)
 {
     return get_board_data (get_board_data_count (preset), preset);
@@ -201,15 +248,17 @@ BrainFlowArray<double, 2> BoardShim::get_board_data (int num_datapoints, int pre
     }
     int num_samples = std::min (get_board_data_count (preset), num_datapoints);
     int num_data_channels = get_num_rows (get_board_id (), preset);
-    double *buf = new double[num_samples * num_data_channels];
-    int res = ::get_board_data (num_samples, preset, buf, board_id, serialized_params.c_str ());
+    // board controller writes channel major data, fill the matrix directly
+    BrainFlowArray<double, 2> matrix (num_data_channels, num_samples);
+    int res = call_with_session_handle ([&] (int handle)
+        {
+            return ::get_board_data_by_handle (
+                num_samples, preset, matrix.get_raw_ptr (), handle);
+        });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        delete[] buf;
         throw BrainFlowException ("failed to get board data", res);
     }
-    BrainFlowArray<double, 2> matrix (buf, num_data_channels, num_samples);
-    delete[] buf;
     return matrix;
 }
 
@@ -218,8 +267,8 @@ BrainFlowArray<double, 2> BoardShim::get_current_board_data (int num_samples, in
     int num_data_channels = BoardShim::get_num_rows (get_board_id (), preset);
     double *buf = new double[num_samples * num_data_channels];
     int len = 0;
-    int res = ::get_current_board_data (
-        num_samples, preset, buf, &len, board_id, serialized_params.c_str ());
+    int res = call_with_session_handle ([&] (int handle)
+        { return ::get_current_board_data_by_handle (num_samples, preset, buf, &len, handle); });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         delete[] buf;
@@ -230,6 +279,44 @@ BrainFlowArray<double, 2> BoardShim::get_current_board_data (int num_samples, in
     return matrix;
 }
 
+std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 2>>
+BoardShim::acquire_board_data_view (int max_samples, int preset)
+{
+    int num_data_channels = get_num_rows (get_board_id (), preset);
+    double *first_span = NULL;
+    double *second_span = NULL;
+    int first_span_len = 0;
+    int second_span_len = 0;
+    int channel_stride = 0;
+    int sample_stride = 0;
+    int res = call_with_session_handle ([&] (int handle)
+        {
+            return ::acquire_board_data_view_by_handle (max_samples, preset, &first_span,
+                &first_span_len, &second_span, &second_span_len, &channel_stride, &sample_stride,
+                handle);
+        });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to acquire board data view", res);
+    }
+    std::array<int, 2> strides = make_array (channel_stride, sample_stride);
+    BrainFlowArray<double, 2> first = BrainFlowArray<double, 2>::view (
+        first_span, make_array (num_data_channels, first_span_len), strides);
+    BrainFlowArray<double, 2> second = BrainFlowArray<double, 2>::view (
+        second_span, make_array (num_data_channels, second_span_len), strides);
+    return std::make_pair (std::move (first), std::move (second));
+}
+
+void BoardShim::release_board_data_view (int preset)
+{
+    int res = call_with_session_handle ([&] (int handle)
+        { return ::release_board_data_view_by_handle (preset, handle); });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release board data view", res);
+    }
+}
+
 std::string BoardShim::config_board (std::string config)
 {
     int response_len = 0;
@@ -256,7 +343,8 @@ void BoardShim::config_board_with_bytes (const char *bytes, int len)
 
 void BoardShim::insert_marker (double value, int preset)
 {
-    int res = ::insert_marker (value, preset, board_id, serialized_params.c_str ());
+    int res = call_with_session_handle (
+        [&] (int handle) { return ::insert_marker_by_handle (value, preset, handle); });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to insert marker", res);
@@ -285,8 +373,8 @@ int BoardShim::get_board_id ()
 int BoardShim::get_board_sampling_rate (int preset)
 {
     int sampling_rate = -1;
-    int res =
-        ::get_board_sampling_rate (preset, &sampling_rate, board_id, serialized_params.c_str ());
+    int res = call_with_session_handle ([&] (int handle)
+        { return ::get_board_sampling_rate_by_handle (preset, &sampling_rate, handle); });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to get board sampling rate", res);
@@ -7,6 +7,28 @@
 #include "data_handler.h"
 
 
+// in-place methods pass raw pointer of the array to the library
+static void check_contiguous (const BrainFlowArray<double, 2> &data)
+{
+    if (data.is_view ())
+    {
+        throw BrainFlowException ("data must be contiguous, copy the view first",
+            (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+}
+
+// read only methods copy views, returns pointer to contiguous data
+static double *get_contiguous_ptr (
+    const BrainFlowArray<double, 2> &data, BrainFlowArray<double, 2> &copy)
+{
+    if (data.is_view ())
+    {
+        copy = data;
+        return copy.get_raw_ptr ();
+    }
+    return const_cast<double *> (data.get_raw_ptr ());
+}
+
 double DataFilter::get_oxygen_level (double *ppg_ir, double *ppg_red, int data_len,
     int sampling_rate, double coef1, double coef2, double coef3)
 {
@@ -75,6 +97,102 @@ void DataFilter::perform_bandstop (double *data, int data_len, int sampling_rate
     }
 }
 
+void DataFilter::perform_lowpass (BrainFlowArray<double, 2> &data, int sampling_rate,
+    double cutoff, int order, int filter_type, double ripple)
+{
+    check_contiguous (data);
+    int res = ::perform_lowpass_2d (data.get_raw_ptr (), data.get_size (0), data.get_size (1),
+        sampling_rate, cutoff, order, filter_type, ripple);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+void DataFilter::perform_highpass (BrainFlowArray<double, 2> &data, int sampling_rate,
+    double cutoff, int order, int filter_type, double ripple)
+{
+    check_contiguous (data);
+    int res = ::perform_highpass_2d (data.get_raw_ptr (), data.get_size (0), data.get_size (1),
+        sampling_rate, cutoff, order, filter_type, ripple);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+void DataFilter::perform_bandpass (BrainFlowArray<double, 2> &data, int sampling_rate,
+    double start_freq, double stop_freq, int order, int filter_type, double ripple)
+{
+    check_contiguous (data);
+    int res = ::perform_bandpass_2d (data.get_raw_ptr (), data.get_size (0), data.get_size (1),
+        sampling_rate, start_freq, stop_freq, order, filter_type, ripple);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+void DataFilter::perform_bandstop (BrainFlowArray<double, 2> &data, int sampling_rate,
+    double start_freq, double stop_freq, int order, int filter_type, double ripple)
+{
+    check_contiguous (data);
+    int res = ::perform_bandstop_2d (data.get_raw_ptr (), data.get_size (0), data.get_size (1),
+        sampling_rate, start_freq, stop_freq, order, filter_type, ripple);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+int DataFilter::create_streaming_filter (int filter_operation, int num_channels,
+    int sampling_rate, double start_freq, double stop_freq, int order, int filter_type,
+    double ripple)
+{
+    int filter_id = -1;
+    int res = ::create_streaming_filter (filter_operation, num_channels, sampling_rate, start_freq,
+        stop_freq, order, filter_type, ripple, &filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create streaming filter", res);
+    }
+    return filter_id;
+}
+
+void DataFilter::process_streaming_filter (
+    int filter_id, double *data, int num_channels, int data_len)
+{
+    int res = ::process_streaming_filter (filter_id, data, num_channels, data_len);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+void DataFilter::process_streaming_filter (int filter_id, BrainFlowArray<double, 2> &data)
+{
+    check_contiguous (data);
+    process_streaming_filter (filter_id, data.get_raw_ptr (), data.get_size (0), data.get_size (1));
+}
+
+void DataFilter::reset_streaming_filter (int filter_id)
+{
+    int res = ::reset_streaming_filter (filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to reset streaming filter", res);
+    }
+}
+
+void DataFilter::release_streaming_filter (int filter_id)
+{
+    int res = ::release_streaming_filter (filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release streaming filter", res);
+    }
+}
+
 void DataFilter::remove_environmental_noise (
     double *data, int data_len, int sampling_rate, int noise_type)
 {
@@ -85,6 +203,18 @@ void DataFilter::remove_environmental_noise (
     }
 }
 
+void DataFilter::remove_environmental_noise (
+    BrainFlowArray<double, 2> &data, int sampling_rate, int noise_type)
+{
+    check_contiguous (data);
+    int res = ::remove_environmental_noise_2d (
+        data.get_raw_ptr (), data.get_size (0), data.get_size (1), sampling_rate, noise_type);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to remove environmental noise", res);
+    }
+}
+
 void DataFilter::restore_data_from_wavelet_detailed_coeffs (double *data, int data_len, int wavelet,
     int decomposition_level, int level_to_restore, double *output)
 {
@@ -106,6 +236,45 @@ void DataFilter::detect_peaks_z_score (
     }
 }
 
+int DataFilter::create_peaks_detector (int lag, double threshold, double influence)
+{
+    int detector_id = -1;
+    int res = ::create_peaks_detector (lag, threshold, influence, &detector_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create peaks detector", res);
+    }
+    return detector_id;
+}
+
+void DataFilter::process_peaks_detector (
+    int detector_id, double *data, int data_len, double *output)
+{
+    int res = ::process_peaks_detector (detector_id, data, data_len, output);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to detect", res);
+    }
+}
+
+void DataFilter::reset_peaks_detector (int detector_id)
+{
+    int res = ::reset_peaks_detector (detector_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to reset peaks detector", res);
+    }
+}
+
+void DataFilter::release_peaks_detector (int detector_id)
+{
+    int res = ::release_peaks_detector (detector_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release peaks detector", res);
+    }
+}
+
 void DataFilter::perform_rolling_filter (double *data, int data_len, int period, int agg_operation)
 {
     int res = ::perform_rolling_filter (data, data_len, period, agg_operation);
@@ -115,6 +284,18 @@ void DataFilter::perform_rolling_filter (double *data, int data_len, int period,
     }
 }
 
+void DataFilter::perform_rolling_filter (
+    BrainFlowArray<double, 2> &data, int period, int agg_operation)
+{
+    check_contiguous (data);
+    int res = ::perform_rolling_filter_2d (
+        data.get_raw_ptr (), data.get_size (0), data.get_size (1), period, agg_operation);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
 double *DataFilter::perform_downsampling (
     double *data, int data_len, int period, int agg_operation, int *filtered_size)
 {
@@ -134,6 +315,26 @@ double *DataFilter::perform_downsampling (
     return filtered_data;
 }
 
+BrainFlowArray<double, 2> DataFilter::perform_downsampling (
+    const BrainFlowArray<double, 2> &data, int period, int agg_operation)
+{
+    if ((data.empty ()) || (period <= 0) || (data.get_size (1) / period == 0))
+    {
+        throw BrainFlowException (
+            "invalid input params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    BrainFlowArray<double, 2> copy;
+    double *data_ptr = get_contiguous_ptr (data, copy);
+    BrainFlowArray<double, 2> filtered_data (data.get_size (0), data.get_size (1) / period);
+    int res = ::perform_downsampling_2d (data_ptr, data.get_size (0), data.get_size (1), period,
+        agg_operation, filtered_data.get_raw_ptr ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+    return filtered_data;
+}
+
 std::pair<double *, int *> DataFilter::perform_wavelet_transform (
     double *data, int data_len, int wavelet, int decomposition_level, int extension_type)
 {
@@ -189,6 +390,20 @@ void DataFilter::perform_wavelet_denoising (double *data, int data_len, int wave
     }
 }
 
+void DataFilter::perform_wavelet_denoising (BrainFlowArray<double, 2> &data, int wavelet,
+    int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type,
+    int noise_level)
+{
+    check_contiguous (data);
+    int res = ::perform_wavelet_denoising_2d (data.get_raw_ptr (), data.get_size (0),
+        data.get_size (1), wavelet, decomposition_level, wavelet_denoising, threshold,
+        extenstion_type, noise_level);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to perform wavelet denoising", res);
+    }
+}
+
 std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 1>> DataFilter::get_csp (
     const BrainFlowArray<double, 3> &data, const BrainFlowArray<double, 1> &labels)
 {
@@ -265,6 +480,17 @@ void DataFilter::detrend (double *data, int data_len, int detrend_operation)
     }
 }
 
+void DataFilter::detrend (BrainFlowArray<double, 2> &data, int detrend_operation)
+{
+    check_contiguous (data);
+    int res = ::detrend_2d (
+        data.get_raw_ptr (), data.get_size (0), data.get_size (1), detrend_operation);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to detrend", res);
+    }
+}
+
 std::pair<double *, double *> DataFilter::get_psd (
     double *data, int data_len, int sampling_rate, int window, int *psd_len)
 {
@@ -307,6 +533,27 @@ std::pair<double *, double *> DataFilter::get_psd_welch (
     return std::make_pair (ampl, freq);
 }
 
+std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 1>> DataFilter::get_psd_welch (
+    const BrainFlowArray<double, 2> &data, int nfft, int overlap, int sampling_rate, int window)
+{
+    if ((data.empty ()) || (nfft < 2) || (nfft % 2 == 1))
+    {
+        throw BrainFlowException (
+            "nfft must be even", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    BrainFlowArray<double, 2> copy;
+    double *data_ptr = get_contiguous_ptr (data, copy);
+    BrainFlowArray<double, 2> ampl (data.get_size (0), nfft / 2 + 1);
+    BrainFlowArray<double, 1> freq (nfft / 2 + 1);
+    int res = ::get_psd_welch_2d (data_ptr, data.get_size (0), data.get_size (1), nfft, overlap,
+        sampling_rate, window, ampl.get_raw_ptr (), freq.get_raw_ptr ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get_psd_welch", res);
+    }
+    return std::make_pair (std::move (ampl), std::move (freq));
+}
+
 std::pair<double *, double *> DataFilter::get_avg_band_powers (
     const BrainFlowArray<double, 2> &data, std::vector<int> channels, int sampling_rate,
     bool apply_filters)
@@ -365,6 +612,79 @@ std::pair<double *, double *> DataFilter::get_custom_band_powers (
     return std::make_pair (avg_bands, stddev_bands);
 }
 
+int DataFilter::create_band_power_stream (int num_channels, int sampling_rate, int window_len,
+    int hop, std::vector<std::pair<double, double>> bands, bool apply_filters)
+{
+    if (bands.empty ())
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    std::vector<double> start_freqs (bands.size ());
+    std::vector<double> stop_freqs (bands.size ());
+    for (int i = 0; i < (int)bands.size (); i++)
+    {
+        start_freqs[i] = std::get<0> (bands[i]);
+        stop_freqs[i] = std::get<1> (bands[i]);
+    }
+    int stream_id = -1;
+    int res = ::create_band_power_stream (num_channels, sampling_rate, window_len, hop,
+        start_freqs.data (), stop_freqs.data (), (int)bands.size (), (int)apply_filters,
+        &stream_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create band power stream", res);
+    }
+    return stream_id;
+}
+
+bool DataFilter::process_band_power_stream (int stream_id, const BrainFlowArray<double, 2> &data,
+    std::vector<int> channels, int num_bands, double *avg_band_powers,
+    double *stddev_band_powers)
+{
+    if ((data.empty ()) || (channels.empty ()))
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    int cols = data.get_size (1);
+    int channels_len = (int)channels.size ();
+    std::vector<double> data_1d ((size_t)cols * channels_len);
+    for (int i = 0; i < channels_len; i++)
+    {
+        for (int j = 0; j < cols; j++)
+        {
+            data_1d[j + cols * i] = data.at (channels[i], j);
+        }
+    }
+    int is_updated = 0;
+    int res = ::process_band_power_stream (stream_id, data_1d.data (), channels_len, cols,
+        num_bands, avg_band_powers, stddev_band_powers, &is_updated);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to process band power stream", res);
+    }
+    return is_updated != 0;
+}
+
+void DataFilter::reset_band_power_stream (int stream_id)
+{
+    int res = ::reset_band_power_stream (stream_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to reset band power stream", res);
+    }
+}
+
+void DataFilter::release_band_power_stream (int stream_id)
+{
+    int res = ::release_band_power_stream (stream_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release band power stream", res);
+    }
+}
+
 double DataFilter::get_band_power (
     std::pair<double *, double *> psd, int data_len, double freq_start, double freq_end)
 {
@@ -465,6 +785,26 @@ void DataFilter::set_log_level (int log_level)
     }
 }
 
+void DataFilter::set_num_threads (int num_threads)
+{
+    int res = set_num_threads_data_handler (num_threads);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to set number of threads", res);
+    }
+}
+
+int DataFilter::get_num_threads ()
+{
+    int num_threads = 0;
+    int res = get_num_threads_data_handler (&num_threads);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get number of threads", res);
+    }
+    return num_threads;
+}
+
 void DataFilter::enable_data_logger ()
 {
     DataFilter::set_log_level ((int)LogLevels::LEVEL_INFO);
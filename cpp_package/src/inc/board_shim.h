@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdarg>
+#include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 // include it here to allow user include only this single file
@@ -21,6 +23,12 @@ class BoardShim
 {
     std::string serialized_params;
     struct BrainFlowInputParams params;
+    // handle of prepared session, data methods use it to skip lookup by serialized_params
+    int session_handle;
+
+    int get_session_handle ();
+    // calls func with session handle, returns its BrainFlowExitCodes
+    int call_with_session_handle (std::function<int (int)> func);
 
 public:
     /// disable BrainFlow loggers
@@ -266,10 +274,27 @@ public:
     int get_board_sampling_rate (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     /// get number of packages in ringbuffer
     int get_board_data_count (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /// block until ringbuffer has at least min_samples packages, a marker arrives or timeout
+    /// expires, returns number of packages in ringbuffer, timeout is not an error
+    int wait_for_board_data (
+        int min_samples, int timeout_ms, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     /// get all collected data and flush it from internal buffer
     BrainFlowArray<double, 2> get_board_data (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     /// get required amount of datapoints or less and flush it from internal buffer
     BrainFlowArray<double, 2> get_board_data (int num_datapoints, int preset);
+    /**
+     * get up to max_samples datapoints and flush them from internal buffer without copying
+     * @return pair of views into internal buffer, datapoints from the second one follow the first
+     * one. Views are valid until release_board_data_view is called for this preset, only one pair
+     * can be acquired at a time, new datapoints are dropped if they would overwrite held ones.
+     * Copy views which are needed later before releasing them, release_session and start_stream
+     * fail while views are held. With interleaved buffer layout rows of views are strided,
+     * get_address throws for them and they should be copied before passing rows to DataFilter
+     */
+    std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 2>> acquire_board_data_view (
+        int max_samples, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /// release views returned by acquire_board_data_view, they must not be used after this call
+    void release_board_data_view (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     /// send string to a board, use it carefully and only if you understand what you are doing
     std::string config_board (std::string config);
     /// send raw bytes to a board, not implemented for majority of devices, not recommended to use
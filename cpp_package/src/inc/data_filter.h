@@ -27,6 +27,10 @@ public:
     static void set_log_file (std::string log_file);
     /// write user defined string to BrainFlow logger
     static void log_message (int log_level, const char *format, ...);
+    /// set number of threads for multichannel methods, 0 means number of hardware threads
+    static void set_num_threads (int num_threads);
+    /// get number of threads used by multichannel methods
+    static int get_num_threads ();
 
     /// perform low pass filter in-place
     static void perform_lowpass (double *data, int data_len, int sampling_rate, double cutoff,
@@ -40,14 +44,47 @@ public:
     /// perform bandstop filter in-place
     static void perform_bandstop (double *data, int data_len, int sampling_rate, double start_freq,
         double stop_freq, int order, int filter_type, double ripple);
+    /// perform low pass filter for each row of data in-place, rows are processed in parallel
+    static void perform_lowpass (BrainFlowArray<double, 2> &data, int sampling_rate, double cutoff,
+        int order, int filter_type, double ripple);
+    /// perform high pass filter for each row of data in-place, rows are processed in parallel
+    static void perform_highpass (BrainFlowArray<double, 2> &data, int sampling_rate,
+        double cutoff, int order, int filter_type, double ripple);
+    /// perform bandpass filter for each row of data in-place, rows are processed in parallel
+    static void perform_bandpass (BrainFlowArray<double, 2> &data, int sampling_rate,
+        double start_freq, double stop_freq, int order, int filter_type, double ripple);
+    /// perform bandstop filter for each row of data in-place, rows are processed in parallel
+    static void perform_bandstop (BrainFlowArray<double, 2> &data, int sampling_rate,
+        double start_freq, double stop_freq, int order, int filter_type, double ripple);
+    /// create filter which keeps coefficients and state between calls, returns filter id
+    static int create_streaming_filter (int filter_operation, int num_channels, int sampling_rate,
+        double start_freq, double stop_freq, int order, int filter_type, double ripple);
+    /// filter num_channels x data_len matrix in-place continuing from the previous chunk
+    static void process_streaming_filter (
+        int filter_id, double *data, int num_channels, int data_len);
+    /// filter rows of data in-place continuing from the previous chunk
+    static void process_streaming_filter (int filter_id, BrainFlowArray<double, 2> &data);
+    /// drop filter state, next chunk is filtered as a new signal
+    static void reset_streaming_filter (int filter_id);
+    /// release streaming filter
+    static void release_streaming_filter (int filter_id);
     /// apply notch filter to remove env noise
     static void remove_environmental_noise (
         double *data, int data_len, int sampling_rate, int noise_type);
+    /// apply notch filter to remove env noise for each row of data
+    static void remove_environmental_noise (
+        BrainFlowArray<double, 2> &data, int sampling_rate, int noise_type);
     /// perform moving average or moving median filter in-place
     static void perform_rolling_filter (double *data, int data_len, int period, int agg_operation);
+    /// perform moving average or moving median filter for each row of data in-place
+    static void perform_rolling_filter (
+        BrainFlowArray<double, 2> &data, int period, int agg_operation);
     /// perform data downsampling, it just aggregates several data points
     static double *perform_downsampling (
         double *data, int data_len, int period, int agg_operation, int *filtered_size);
+    /// perform downsampling for each row of data, returns rows x (cols / period) array
+    static BrainFlowArray<double, 2> perform_downsampling (
+        const BrainFlowArray<double, 2> &data, int period, int agg_operation);
     // clang-format off
     /**
      * perform wavelet transform
@@ -85,12 +122,27 @@ public:
         int threshold = (int)ThresholdTypes::HARD,
         int extenstion_type = (int)WaveletExtensionTypes::SYMMETRIC,
         int noise_level = (int)NoiseEstimationLevelTypes::FIRST_LEVEL);
+    /// perform wavelet denoising for each row of data in-place, rows are processed in parallel
+    static void perform_wavelet_denoising (BrainFlowArray<double, 2> &data, int wavelet,
+        int decomposition_level, int wavelet_denoising = (int)WaveletDenoisingTypes::SURESHRINK,
+        int threshold = (int)ThresholdTypes::HARD,
+        int extenstion_type = (int)WaveletExtensionTypes::SYMMETRIC,
+        int noise_level = (int)NoiseEstimationLevelTypes::FIRST_LEVEL);
     /// restore data from selected detailed coeffs
     static void restore_data_from_wavelet_detailed_coeffs (double *data, int data_len, int wavelet,
         int decomposition_level, int level_to_restore, double *output);
     /// z score peak detection, more info https://stackoverflow.com/a/22640362
     static void detect_peaks_z_score (
         double *data, int data_len, int lag, double threshold, double influence, double *output);
+    /// create z score peaks detector which keeps state between calls, returns detector id
+    static int create_peaks_detector (int lag, double threshold, double influence);
+    /// detect peaks in the next chunk, output may point to data
+    static void process_peaks_detector (
+        int detector_id, double *data, int data_len, double *output);
+    /// drop detector state, next chunk is processed as a new signal
+    static void reset_peaks_detector (int detector_id);
+    /// release peaks detector
+    static void release_peaks_detector (int detector_id);
     // clang-format off
     /**
     * calculate filters and the corresponding eigenvalues using the Common Spatial Patterns
@@ -148,8 +200,22 @@ public:
      * @param detrend_operation use DetrendOperations enum
      */
     static void detrend (double *data, int data_len, int detrend_operation);
+    /// subtract trend from each row of data in-place, rows are processed in parallel
+    static void detrend (BrainFlowArray<double, 2> &data, int detrend_operation);
     static std::pair<double *, double *> get_psd_welch (double *data, int data_len, int nfft,
         int overlap, int sampling_rate, int window, int *psd_len);
+    /**
+     * calculate PSD using Welch method for each row of data, rows are processed in parallel
+     * @param data input 2d array, rows are channels
+     * @param nfft FFT size, power of 2
+     * @param overlap overlap of FFT windows
+     * @param sampling_rate sampling rate
+     * @param window window function
+     * @return pair of rows x (nfft / 2 + 1) amplitudes and nfft / 2 + 1 frequencies
+     */
+    static std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 1>> get_psd_welch (
+        const BrainFlowArray<double, 2> &data, int nfft, int overlap, int sampling_rate,
+        int window);
     /**
      * calculate band power
      * @param psd psd calculated using get_psd
@@ -184,6 +250,30 @@ public:
     static std::pair<double *, double *> get_custom_band_powers (
         const BrainFlowArray<double, 2> &data, std::vector<std::pair<double, double>> bands,
         std::vector<int> channels, int sampling_rate, bool apply_filters);
+    /**
+     * create band power stream which keeps filter state and spectra of seen welch segments
+     * @param num_channels number of channels passed to process_band_power_stream
+     * @param sampling_rate sampling rate
+     * @param window_len band powers are calculated for the last window_len samples
+     * @param hop band powers are updated every hop samples
+     * @param bands bands to calculate
+     * @param apply_filters set to true to apply causal bandpass and bandstop filters
+     * @return stream id
+     */
+    static int create_band_power_stream (int num_channels, int sampling_rate, int window_len,
+        int hop, std::vector<std::pair<double, double>> bands, bool apply_filters);
+    /**
+     * feed the next chunk, rows of data listed in channels are used
+     * @param avg_band_powers, stddev_band_powers arrays with num_bands elements
+     * @return true if band powers were updated in this chunk
+     */
+    static bool process_band_power_stream (int stream_id, const BrainFlowArray<double, 2> &data,
+        std::vector<int> channels, int num_bands, double *avg_band_powers,
+        double *stddev_band_powers);
+    /// drop stream state, next chunk is processed as a new signal
+    static void reset_band_power_stream (int stream_id);
+    /// release band power stream
+    static void release_band_power_stream (int stream_id);
     /**
      * calculate oxygen level
      * @param ppg_ir input 1d array
@@ -0,0 +1,87 @@
+package brainflow;
+
+import java.nio.DoubleBuffer;
+
+/**
+ * datapoints removed from internal ringbuffer but not copied, returned by
+ * BoardShim.acquire_board_data_view and valid until BoardShim.release_board_data_view
+ */
+public class BoardDataView
+{
+    private DoubleBuffer first_span;
+    private DoubleBuffer second_span;
+    private int first_span_len;
+    private int second_span_len;
+    private int channel_stride;
+    private int sample_stride;
+    private int num_rows;
+
+    BoardDataView (DoubleBuffer first_span, int first_span_len, DoubleBuffer second_span,
+            int second_span_len, int channel_stride, int sample_stride, int num_rows)
+    {
+        this.first_span = first_span;
+        this.first_span_len = first_span_len;
+        this.second_span = second_span;
+        this.second_span_len = second_span_len;
+        this.channel_stride = channel_stride;
+        this.sample_stride = sample_stride;
+        this.num_rows = num_rows;
+    }
+
+    /**
+     * get number of rows, same as BoardShim.get_num_rows
+     */
+    public int get_num_rows ()
+    {
+        return num_rows;
+    }
+
+    /**
+     * get number of datapoints in this view
+     */
+    public int get_num_samples ()
+    {
+        return first_span_len + second_span_len;
+    }
+
+    /**
+     * get value from row for datapoint
+     */
+    public double get (int row, int sample)
+    {
+        if ((row < 0) || (row >= num_rows) || (sample < 0) || (sample >= get_num_samples ()))
+        {
+            throw new IndexOutOfBoundsException ("invalid row or sample");
+        }
+        if (sample < first_span_len)
+        {
+            return first_span.get (row * channel_stride + sample * sample_stride);
+        }
+        return second_span.get (row * channel_stride + (sample - first_span_len) * sample_stride);
+    }
+
+    /**
+     * copy row to a java array
+     */
+    public double[] get_row (int row)
+    {
+        double[] result = new double[get_num_samples ()];
+        if ((channel_stride != 1) && (sample_stride == 1))
+        {
+            // channel major storage, each span row is continuous
+            first_span.position (row * channel_stride);
+            first_span.get (result, 0, first_span_len);
+            if (second_span_len > 0)
+            {
+                second_span.position (row * channel_stride);
+                second_span.get (result, first_span_len, second_span_len);
+            }
+            return result;
+        }
+        for (int i = 0; i < result.length; i++)
+        {
+            result[i] = get (row, i);
+        }
+        return result;
+    }
+}
@@ -1,6 +1,8 @@
 package brainflow;
 
 import java.io.IOException;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
 import java.nio.file.Path;
 import java.util.Arrays;
 import java.util.Collections;
@@ -11,6 +13,8 @@ import com.google.gson.Gson;
 import com.sun.jna.JNIEnv;
 import com.sun.jna.Library;
 import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+import com.sun.jna.ptr.PointerByReference;
 
 /**
  * BoardShim class to communicate with a board
@@ -45,8 +49,17 @@ public class BoardShim
 
         int get_board_data_count (int preset, int[] result, int board_id, String params);
 
+        int wait_for_board_data (int min_samples, int timeout_ms, int preset, int[] data_count, int board_id,
+                String params);
+
         int get_board_data (int data_count, int preset, double[] data_buf, int board_id, String params);
 
+        int acquire_board_data_view (int max_samples, int preset, PointerByReference first_span,
+                int[] first_span_len, PointerByReference second_span, int[] second_span_len, int[] channel_stride,
+                int[] sample_stride, int board_id, String params);
+
+        int release_board_data_view (int preset, int board_id, String params);
+
         int set_log_level_board_controller (int log_level);
 
         int log_message_board_controller (int log_level, String message);
@@ -1590,6 +1603,36 @@ public class BoardShim
         return get_board_data_count (BrainFlowPresets.DEFAULT_PRESET);
     }
 
+    /**
+     * block until ringbuffer has at least min_samples packages, a marker arrives or
+     * timeout expires, expired timeout is not an error
+     *
+     * @return number of packages in ringbuffer
+     */
+    public int wait_for_board_data (int min_samples, int timeout_ms, BrainFlowPresets preset) throws BrainFlowError
+    {
+        int[] res = new int[1];
+        int ec = instance.wait_for_board_data (min_samples, timeout_ms, preset.get_code (), res, board_id,
+                input_json);
+        if ((ec != BrainFlowExitCode.STATUS_OK.get_code ())
+                && (ec != BrainFlowExitCode.SYNC_TIMEOUT_ERROR.get_code ()))
+        {
+            throw new BrainFlowError ("Error in wait_for_board_data", ec);
+        }
+        return res[0];
+    }
+
+    /**
+     * block until ringbuffer has at least min_samples packages, a marker arrives or
+     * timeout expires, expired timeout is not an error
+     *
+     * @return number of packages in ringbuffer
+     */
+    public int wait_for_board_data (int min_samples, int timeout_ms) throws BrainFlowError
+    {
+        return wait_for_board_data (min_samples, timeout_ms, BrainFlowPresets.DEFAULT_PRESET);
+    }
+
     /**
      * insert marker to data stream
      */
@@ -1715,4 +1758,78 @@ public class BoardShim
     {
         return get_board_data (num_datapoints, BrainFlowPresets.DEFAULT_PRESET);
     }
+
+    /**
+     * get up to max_samples datapoints and flush them from ringbuffer without copying, view is
+     * valid until release_board_data_view, new datapoints are dropped if they would overwrite it.
+     * Copy data which is needed later before releasing the view, release_session and start_stream
+     * fail while a view is held
+     */
+    public BoardDataView acquire_board_data_view (int max_samples, BrainFlowPresets preset) throws BrainFlowError
+    {
+        if (max_samples < 0)
+        {
+            throw new BrainFlowError ("max_samples should be greater than 0",
+                    BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int num_rows = BoardShim.get_num_rows (master_board_id, preset);
+        PointerByReference first_span = new PointerByReference ();
+        PointerByReference second_span = new PointerByReference ();
+        int[] first_span_len = new int[1];
+        int[] second_span_len = new int[1];
+        int[] channel_stride = new int[1];
+        int[] sample_stride = new int[1];
+        int ec = instance.acquire_board_data_view (max_samples, preset.get_code (), first_span, first_span_len,
+                second_span, second_span_len, channel_stride, sample_stride, board_id, input_json);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Error in acquire_board_data_view", ec);
+        }
+        return new BoardDataView (
+                wrap_span (first_span.getValue (), first_span_len[0], num_rows, channel_stride[0], sample_stride[0]),
+                first_span_len[0],
+                wrap_span (second_span.getValue (), second_span_len[0], num_rows, channel_stride[0], sample_stride[0]),
+                second_span_len[0], channel_stride[0], sample_stride[0], num_rows);
+    }
+
+    /**
+     * get up to max_samples datapoints and flush them from ringbuffer without copying
+     */
+    public BoardDataView acquire_board_data_view (int max_samples) throws BrainFlowError
+    {
+        return acquire_board_data_view (max_samples, BrainFlowPresets.DEFAULT_PRESET);
+    }
+
+    /**
+     * release view returned by acquire_board_data_view, it and buffers obtained from it must not
+     * be used after this call
+     */
+    public void release_board_data_view (BrainFlowPresets preset) throws BrainFlowError
+    {
+        int ec = instance.release_board_data_view (preset.get_code (), board_id, input_json);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Error in release_board_data_view", ec);
+        }
+    }
+
+    /**
+     * release view returned by acquire_board_data_view, it and buffers obtained from it must not
+     * be used after this call
+     */
+    public void release_board_data_view () throws BrainFlowError
+    {
+        release_board_data_view (BrainFlowPresets.DEFAULT_PRESET);
+    }
+
+    private static DoubleBuffer wrap_span (Pointer span, int span_len, int num_rows, int channel_stride,
+            int sample_stride)
+    {
+        if ((span == null) || (span_len == 0))
+        {
+            return DoubleBuffer.allocate (0);
+        }
+        long extent = (long) (num_rows - 1) * channel_stride + (long) (span_len - 1) * sample_stride + 1;
+        return span.getByteBuffer (0, extent * 8).order (ByteOrder.nativeOrder ()).asDoubleBuffer ();
+    }
 }
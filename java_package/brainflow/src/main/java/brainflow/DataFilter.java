@@ -48,8 +48,53 @@ public class DataFilter
         int detect_peaks_z_score (double[] data, int data_len, int lag, double threshold, double influence,
                 double[] output);
 
+        int create_peaks_detector (int lag, double threshold, double influence, int[] detector_id);
+
+        int process_peaks_detector (int detector_id, double[] data, int data_len, double[] output);
+
+        int reset_peaks_detector (int detector_id);
+
+        int release_peaks_detector (int detector_id);
+
         int remove_environmental_noise (double[] data, int data_len, int sampling_rate, int noise_type);
 
+        int create_streaming_filter (int filter_operation, int num_channels, int sampling_rate, double start_freq,
+                double stop_freq, int order, int filter_type, double ripple, int[] filter_id);
+
+        int process_streaming_filter (int filter_id, double[] data, int num_channels, int data_len);
+
+        int reset_streaming_filter (int filter_id);
+
+        int release_streaming_filter (int filter_id);
+
+        int perform_lowpass_2d (double[] data, int num_channels, int data_len, int sampling_rate, double cutoff,
+                int order, int filter_type, double ripple);
+
+        int perform_highpass_2d (double[] data, int num_channels, int data_len, int sampling_rate, double cutoff,
+                int order, int filter_type, double ripple);
+
+        int perform_bandpass_2d (double[] data, int num_channels, int data_len, int sampling_rate, double start_freq,
+                double stop_freq, int order, int filter_type, double ripple);
+
+        int perform_bandstop_2d (double[] data, int num_channels, int data_len, int sampling_rate, double start_freq,
+                double stop_freq, int order, int filter_type, double ripple);
+
+        int remove_environmental_noise_2d (double[] data, int num_channels, int data_len, int sampling_rate,
+                int noise_type);
+
+        int perform_rolling_filter_2d (double[] data, int num_channels, int data_len, int period, int operation);
+
+        int perform_downsampling_2d (double[] data, int num_channels, int data_len, int period, int operation,
+                double[] output_data);
+
+        int perform_wavelet_denoising_2d (double[] data, int num_channels, int data_len, int wavelet,
+                int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type, int noise_level);
+
+        int detrend_2d (double[] data, int num_channels, int data_len, int operation);
+
+        int get_psd_welch_2d (double[] data, int num_channels, int data_len, int nfft, int overlap, int sampling_rate,
+                int window, double[] output_ampl, double[] output_freq);
+
         int perform_wavelet_transform (double[] data, int data_len, int wavelet, int decomposition_level, int extention,
                 double[] output_data, int[] decomposition_lengths);
 
@@ -74,6 +119,10 @@ public class DataFilter
 
         int set_log_level_data_handler (int log_level);
 
+        int set_num_threads_data_handler (int num_threads);
+
+        int get_num_threads_data_handler (int[] num_threads);
+
         int set_log_file_data_handler (String log_file);
 
         int calc_stddev (double[] data, int start_pos, int end_pos, double[] output);
@@ -92,6 +141,16 @@ public class DataFilter
         int get_custom_band_powers (double[] data, int rows, int cols, double[] start_freqs, double[] stop_freqs,
                 int num_bands, int sampling_rate, int apply_filters, double[] avgs, double[] stddevs);
 
+        int create_band_power_stream (int num_channels, int sampling_rate, int window_len, int hop,
+                double[] start_freqs, double[] stop_freqs, int num_bands, int apply_filters, int[] stream_id);
+
+        int process_band_power_stream (int stream_id, double[] data, int num_channels, int data_len, int num_bands,
+                double[] avgs, double[] stddevs, int[] is_updated);
+
+        int reset_band_power_stream (int stream_id);
+
+        int release_band_power_stream (int stream_id);
+
         int get_band_power (double[] ampls, double[] freqs, int len, double start_freq, double stop_freq,
                 double[] output);
 
@@ -299,6 +358,33 @@ public class DataFilter
         set_log_level (log_level.get_code ());
     }
 
+    /**
+     * set number of threads used by multichannel methods, 0 means number of
+     * hardware threads
+     */
+    public static void set_num_threads (int num_threads) throws BrainFlowError
+    {
+        int ec = instance.set_num_threads_data_handler (num_threads);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Error in set_num_threads", ec);
+        }
+    }
+
+    /**
+     * get number of threads used by multichannel methods
+     */
+    public static int get_num_threads () throws BrainFlowError
+    {
+        int[] num_threads = new int[1];
+        int ec = instance.get_num_threads_data_handler (num_threads);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Error in get_num_threads", ec);
+        }
+        return num_threads[0];
+    }
+
     /**
      * perform lowpass filter in-place
      */
@@ -493,6 +579,60 @@ public class DataFilter
         return peaks;
     }
 
+    /**
+     * create z score peaks detector which keeps its state between calls,
+     * consecutive chunks give the same result as detect_peaks_z_score for the whole
+     * signal
+     */
+    public static int create_peaks_detector (int lag, double threshold, double influence) throws BrainFlowError
+    {
+        int[] detector_id = new int[1];
+        int ec = instance.create_peaks_detector (lag, threshold, influence, detector_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create peaks detector", ec);
+        }
+        return detector_id[0];
+    }
+
+    /**
+     * detect peaks in the next chunk
+     */
+    public static double[] process_peaks_detector (int detector_id, double[] data) throws BrainFlowError
+    {
+        double[] peaks = new double[data.length];
+        int ec = instance.process_peaks_detector (detector_id, data, data.length, peaks);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to detect peaks", ec);
+        }
+        return peaks;
+    }
+
+    /**
+     * drop detector state, next chunk is processed as a new signal
+     */
+    public static void reset_peaks_detector (int detector_id) throws BrainFlowError
+    {
+        int ec = instance.reset_peaks_detector (detector_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to reset peaks detector", ec);
+        }
+    }
+
+    /**
+     * release peaks detector
+     */
+    public static void release_peaks_detector (int detector_id) throws BrainFlowError
+    {
+        int ec = instance.release_peaks_detector (detector_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to release peaks detector", ec);
+        }
+    }
+
     /**
      * perform data downsampling, it doesnt apply lowpass filter for you, it just
      * aggregates several data points
@@ -525,6 +665,378 @@ public class DataFilter
         remove_environmental_noise (data, sampling_rate, noise_type.get_code ());
     }
 
+    /**
+     * create filter which keeps its state between calls, zero phase filter types are
+     * not supported
+     */
+    public static int create_streaming_filter (int filter_operation, int num_channels, int sampling_rate,
+            double start_freq, double stop_freq, int order, int filter_type, double ripple) throws BrainFlowError
+    {
+        int[] filter_id = new int[1];
+        int ec = instance.create_streaming_filter (filter_operation, num_channels, sampling_rate, start_freq,
+                stop_freq, order, filter_type, ripple, filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create streaming filter", ec);
+        }
+        return filter_id[0];
+    }
+
+    /**
+     * create filter which keeps its state between calls, zero phase filter types are
+     * not supported
+     */
+    public static int create_streaming_filter (FilterOperations filter_operation, int num_channels,
+            int sampling_rate, double start_freq, double stop_freq, int order, FilterTypes filter_type,
+            double ripple) throws BrainFlowError
+    {
+        return create_streaming_filter (filter_operation.get_code (), num_channels, sampling_rate, start_freq,
+                stop_freq, order, filter_type.get_code (), ripple);
+    }
+
+    /**
+     * filter next chunk in-place, each row is a channel
+     */
+    public static void process_streaming_filter (int filter_id, double[][] data) throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.process_streaming_filter (filter_id, flat, data.length, data[0].length);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to filter data", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * drop filter state, next chunk is filtered as a new signal
+     */
+    public static void reset_streaming_filter (int filter_id) throws BrainFlowError
+    {
+        int ec = instance.reset_streaming_filter (filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to reset streaming filter", ec);
+        }
+    }
+
+    /**
+     * release streaming filter
+     */
+    public static void release_streaming_filter (int filter_id) throws BrainFlowError
+    {
+        int ec = instance.release_streaming_filter (filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to release streaming filter", ec);
+        }
+    }
+
+    // library methods take channels x samples matrix as a single row major array
+    private static double[] to_flat (double[][] data) throws BrainFlowError
+    {
+        if ((data.length == 0) || (data[0].length == 0))
+        {
+            throw new BrainFlowError ("Empty data", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int data_len = data[0].length;
+        double[] flat = new double[data.length * data_len];
+        for (int i = 0; i < data.length; i++)
+        {
+            if (data[i].length != data_len)
+            {
+                throw new BrainFlowError ("All rows must have the same size",
+                        BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+            }
+            System.arraycopy (data[i], 0, flat, i * data_len, data_len);
+        }
+        return flat;
+    }
+
+    private static void from_flat (double[] flat, double[][] data)
+    {
+        int data_len = flat.length / data.length;
+        for (int i = 0; i < data.length; i++)
+        {
+            System.arraycopy (flat, i * data_len, data[i], 0, data_len);
+        }
+    }
+
+    /**
+     * perform lowpass filter for each row in-place, rows are processed in parallel
+     */
+    public static void perform_lowpass (double[][] data, int sampling_rate, double cutoff, int order, int filter_type,
+            double ripple) throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.perform_lowpass_2d (flat, data.length, data[0].length, sampling_rate, cutoff, order,
+                filter_type, ripple);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to apply filter", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * perform lowpass filter for each row in-place, rows are processed in parallel
+     */
+    public static void perform_lowpass (double[][] data, int sampling_rate, double cutoff, int order,
+            FilterTypes filter_type, double ripple) throws BrainFlowError
+    {
+        perform_lowpass (data, sampling_rate, cutoff, order, filter_type.get_code (), ripple);
+    }
+
+    /**
+     * perform highpass filter for each row in-place, rows are processed in parallel
+     */
+    public static void perform_highpass (double[][] data, int sampling_rate, double cutoff, int order,
+            int filter_type, double ripple) throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.perform_highpass_2d (flat, data.length, data[0].length, sampling_rate, cutoff, order,
+                filter_type, ripple);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to apply filter", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * perform highpass filter for each row in-place, rows are processed in parallel
+     */
+    public static void perform_highpass (double[][] data, int sampling_rate, double cutoff, int order,
+            FilterTypes filter_type, double ripple) throws BrainFlowError
+    {
+        perform_highpass (data, sampling_rate, cutoff, order, filter_type.get_code (), ripple);
+    }
+
+    /**
+     * perform bandpass filter for each row in-place, rows are processed in parallel
+     */
+    public static void perform_bandpass (double[][] data, int sampling_rate, double start_freq, double stop_freq,
+            int order, int filter_type, double ripple) throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.perform_bandpass_2d (flat, data.length, data[0].length, sampling_rate, start_freq,
+                stop_freq, order, filter_type, ripple);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to apply filter", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * perform bandpass filter for each row in-place, rows are processed in parallel
+     */
+    public static void perform_bandpass (double[][] data, int sampling_rate, double start_freq, double stop_freq,
+            int order, FilterTypes filter_type, double ripple) throws BrainFlowError
+    {
+        perform_bandpass (data, sampling_rate, start_freq, stop_freq, order, filter_type.get_code (), ripple);
+    }
+
+    /**
+     * perform bandstop filter for each row in-place, rows are processed in parallel
+     */
+    public static void perform_bandstop (double[][] data, int sampling_rate, double start_freq, double stop_freq,
+            int order, int filter_type, double ripple) throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.perform_bandstop_2d (flat, data.length, data[0].length, sampling_rate, start_freq,
+                stop_freq, order, filter_type, ripple);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to apply filter", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * perform bandstop filter for each row in-place, rows are processed in parallel
+     */
+    public static void perform_bandstop (double[][] data, int sampling_rate, double start_freq, double stop_freq,
+            int order, FilterTypes filter_type, double ripple) throws BrainFlowError
+    {
+        perform_bandstop (data, sampling_rate, start_freq, stop_freq, order, filter_type.get_code (), ripple);
+    }
+
+    /**
+     * removes noise from each row using notch filter
+     */
+    public static void remove_environmental_noise (double[][] data, int sampling_rate, int noise_type)
+            throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.remove_environmental_noise_2d (flat, data.length, data[0].length, sampling_rate,
+                noise_type);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to remove noise", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * removes noise from each row using notch filter
+     */
+    public static void remove_environmental_noise (double[][] data, int sampling_rate, NoiseTypes noise_type)
+            throws BrainFlowError
+    {
+        remove_environmental_noise (data, sampling_rate, noise_type.get_code ());
+    }
+
+    /**
+     * perform moving average or moving median filter for each row in-place
+     */
+    public static void perform_rolling_filter (double[][] data, int period, int operation) throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.perform_rolling_filter_2d (flat, data.length, data[0].length, period, operation);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to apply filter", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * perform moving average or moving median filter for each row in-place
+     */
+    public static void perform_rolling_filter (double[][] data, int period, AggOperations operation)
+            throws BrainFlowError
+    {
+        perform_rolling_filter (data, period, operation.get_code ());
+    }
+
+    /**
+     * perform downsampling of each row, it just aggregates several data points
+     */
+    public static double[][] perform_downsampling (double[][] data, int period, int operation) throws BrainFlowError
+    {
+        if (period <= 0)
+        {
+            throw new BrainFlowError ("Invalid period", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        double[] flat = to_flat (data);
+        int output_len = data[0].length / period;
+        if (output_len <= 0)
+        {
+            throw new BrainFlowError ("Invalid data size", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        double[] flat_output = new double[data.length * output_len];
+        int ec = instance.perform_downsampling_2d (flat, data.length, data[0].length, period, operation,
+                flat_output);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to perform downsampling", ec);
+        }
+        double[][] downsampled_data = new double[data.length][output_len];
+        from_flat (flat_output, downsampled_data);
+        return downsampled_data;
+    }
+
+    /**
+     * perform downsampling of each row, it just aggregates several data points
+     */
+    public static double[][] perform_downsampling (double[][] data, int period, AggOperations operation)
+            throws BrainFlowError
+    {
+        return perform_downsampling (data, period, operation.get_code ());
+    }
+
+    /**
+     * perform wavelet based denoising for each row in-place, rows are processed in
+     * parallel
+     */
+    public static void perform_wavelet_denoising (double[][] data, int wavelet, int decomposition_level,
+            int wavelet_denoising, int threshold, int extenstion_type, int noise_level) throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.perform_wavelet_denoising_2d (flat, data.length, data[0].length, wavelet,
+                decomposition_level, wavelet_denoising, threshold, extenstion_type, noise_level);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to perform denoising", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * perform wavelet based denoising for each row in-place, rows are processed in
+     * parallel
+     */
+    public static void perform_wavelet_denoising (double[][] data, WaveletTypes wavelet, int decomposition_level,
+            WaveletDenoisingTypes wavelet_denoising, ThresholdTypes threshold, WaveletExtensionTypes extenstion_type,
+            NoiseEstimationLevelTypes noise_level) throws BrainFlowError
+    {
+        perform_wavelet_denoising (data, wavelet.get_code (), decomposition_level, wavelet_denoising.get_code (),
+                threshold.get_code (), extenstion_type.get_code (), noise_level.get_code ());
+    }
+
+    /**
+     * subtract trend from each row in-place, rows are processed in parallel
+     */
+    public static void detrend (double[][] data, int operation) throws BrainFlowError
+    {
+        double[] flat = to_flat (data);
+        int ec = instance.detrend_2d (flat, data.length, data[0].length, operation);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to detrend", ec);
+        }
+        from_flat (flat, data);
+    }
+
+    /**
+     * subtract trend from each row in-place, rows are processed in parallel
+     */
+    public static void detrend (double[][] data, DetrendOperations operation) throws BrainFlowError
+    {
+        detrend (data, operation.get_code ());
+    }
+
+    /**
+     * get PSD using Welch Method for each row, rows are processed in parallel
+     *
+     * @param data          data to process
+     * @param nfft          size of FFT, must be even
+     * @param overlap       overlap between FFT Windows, must be between 0 and nfft
+     * @param sampling_rate sampling rate
+     * @param window        window function
+     * @return pair of ampls with nfft / 2 + 1 values per row and freq array
+     */
+    public static Pair<double[][], double[]> get_psd_welch (double[][] data, int nfft, int overlap,
+            int sampling_rate, int window) throws BrainFlowError
+    {
+        if (nfft % 2 == 1)
+        {
+            throw new BrainFlowError ("nfft must be even", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        double[] flat = to_flat (data);
+        double[] flat_ampls = new double[data.length * (nfft / 2 + 1)];
+        double[] freqs = new double[nfft / 2 + 1];
+        int ec = instance.get_psd_welch_2d (flat, data.length, data[0].length, nfft, overlap, sampling_rate, window,
+                flat_ampls, freqs);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to get_psd_welch", ec);
+        }
+        double[][] ampls = new double[data.length][nfft / 2 + 1];
+        from_flat (flat_ampls, ampls);
+        return new MutablePair<double[][], double[]> (ampls, freqs);
+    }
+
+    /**
+     * get PSD using Welch Method for each row, rows are processed in parallel
+     */
+    public static Pair<double[][], double[]> get_psd_welch (double[][] data, int nfft, int overlap,
+            int sampling_rate, WindowOperations window) throws BrainFlowError
+    {
+        return get_psd_welch (data, nfft, overlap, sampling_rate, window.get_code ());
+    }
+
     /**
      * perform wavelet based denoising in-place
      */
@@ -832,6 +1344,111 @@ public class DataFilter
         return res;
     }
 
+    /**
+     * create band power stream which keeps filter state and spectra of seen welch
+     * segments, band powers of the last window_len samples are updated every hop
+     * samples
+     * 
+     * @param num_channels  number of channels passed to process_band_power_stream
+     * @param sampling_rate sampling rate
+     * @param window_len    number of samples used in calculation
+     * @param hop           band powers are updated every hop samples
+     * @param bands         bands to calculate
+     * @param apply_filters apply causal bandpass and bandstop filters
+     * @return stream id
+     */
+    public static int create_band_power_stream (int num_channels, int sampling_rate, int window_len, int hop,
+            List<Pair<Double, Double>> bands, boolean apply_filters) throws BrainFlowError
+    {
+        if ((bands == null) || (bands.isEmpty ()))
+        {
+            throw new BrainFlowError ("bands are empty", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        double[] start_freqs = new double[bands.size ()];
+        double[] stop_freqs = new double[bands.size ()];
+        for (int i = 0; i < bands.size (); i++)
+        {
+            start_freqs[i] = bands.get (i).getKey ();
+            stop_freqs[i] = bands.get (i).getValue ();
+        }
+        int[] stream_id = new int[1];
+        int filters = (apply_filters) ? 1 : 0;
+        int ec = instance.create_band_power_stream (num_channels, sampling_rate, window_len, hop, start_freqs,
+                stop_freqs, bands.size (), filters, stream_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create band power stream", ec);
+        }
+        return stream_id[0];
+    }
+
+    /**
+     * feed the next chunk to band power stream
+     * 
+     * @param stream_id id returned by create_band_power_stream
+     * @param data      next chunk
+     * @param channels  rows of data arrays which should be used in calculation
+     * @param num_bands number of bands used to create the stream
+     * @return pair of avgs and stddevs for bandpowers or null if there was no
+     *         update in this chunk
+     */
+    public static Pair<double[], double[]> process_band_power_stream (int stream_id, double[][] data,
+            int[] channels, int num_bands) throws BrainFlowError
+    {
+        if ((data == null) || (channels == null) || (channels.length == 0))
+        {
+            throw new BrainFlowError ("data or channels are null",
+                    BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int data_len = data[channels[0]].length;
+        double[] data_1d = new double[channels.length * data_len];
+        for (int i = 0; i < channels.length; i++)
+        {
+            for (int j = 0; j < data_len; j++)
+            {
+                data_1d[j + i * data_len] = data[channels[i]][j];
+            }
+        }
+        double[] avgs = new double[num_bands];
+        double[] stddevs = new double[num_bands];
+        int[] is_updated = new int[1];
+        int ec = instance.process_band_power_stream (stream_id, data_1d, channels.length, data_len, num_bands,
+                avgs, stddevs, is_updated);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to process band power stream", ec);
+        }
+        if (is_updated[0] == 0)
+        {
+            return null;
+        }
+        return new MutablePair<double[], double[]> (avgs, stddevs);
+    }
+
+    /**
+     * drop stream state, next chunk is processed as a new signal
+     */
+    public static void reset_band_power_stream (int stream_id) throws BrainFlowError
+    {
+        int ec = instance.reset_band_power_stream (stream_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to reset band power stream", ec);
+        }
+    }
+
+    /**
+     * release band power stream
+     */
+    public static void release_band_power_stream (int stream_id) throws BrainFlowError
+    {
+        int ec = instance.release_band_power_stream (stream_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to release band power stream", ec);
+        }
+    }
+
     /**
      * Calculates ICA
      * 
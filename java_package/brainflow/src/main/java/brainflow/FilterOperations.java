@@ -0,0 +1,48 @@
+package brainflow;
+
+import java.util.HashMap;
+import java.util.Map;
+
+/**
+ * enum to store all possible filter operations
+ */
+public enum FilterOperations
+{
+
+    LOWPASS (0),
+    HIGHPASS (1),
+    BANDPASS (2),
+    BANDSTOP (3);
+
+    private final int filter_operation;
+    private static final Map<Integer, FilterOperations> fo_map = new HashMap<Integer, FilterOperations> ();
+
+    public int get_code ()
+    {
+        return filter_operation;
+    }
+
+    public static String string_from_code (final int code)
+    {
+        return from_code (code).name ();
+    }
+
+    public static FilterOperations from_code (final int code)
+    {
+        final FilterOperations element = fo_map.get (code);
+        return element;
+    }
+
+    FilterOperations (final int code)
+    {
+        filter_operation = code;
+    }
+
+    static
+    {
+        for (final FilterOperations fo : FilterOperations.values ())
+        {
+            fo_map.put (fo.get_code (), fo);
+        }
+    }
+}
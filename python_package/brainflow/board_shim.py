@@ -306,6 +306,40 @@ class BoardControllerDLL(object):
             ctypes.c_char_p
         ]
 
+        self.wait_for_board_data = self.lib.wait_for_board_data
+        self.wait_for_board_data.restype = ctypes.c_int
+        self.wait_for_board_data.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
+        self.acquire_board_data_view = self.lib.acquire_board_data_view
+        self.acquire_board_data_view.restype = ctypes.c_int
+        self.acquire_board_data_view.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.POINTER(ctypes.POINTER(ctypes.c_double)),
+            ndpointer(ctypes.c_int32),
+            ctypes.POINTER(ctypes.POINTER(ctypes.c_double)),
+            ndpointer(ctypes.c_int32),
+            ndpointer(ctypes.c_int32),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
+        self.release_board_data_view = self.lib.release_board_data_view
+        self.release_board_data_view.restype = ctypes.c_int
+        self.release_board_data_view.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
         self.set_log_level_board_controller = self.lib.set_log_level_board_controller
         self.set_log_level_board_controller.restype = ctypes.c_int
         self.set_log_level_board_controller.argtypes = [
@@ -1380,6 +1414,28 @@ class BoardShim(object):
             raise BrainFlowError('unable to obtain buffer size', res)
         return data_size[0]
 
+    def wait_for_board_data(self, min_samples: int, timeout_ms: int,
+                            preset: int = BrainFlowPresets.DEFAULT_PRESET) -> int:
+        """Block until ringbuffer has at least min_samples elements, a marker arrives or timeout expires
+
+        :param min_samples: number of elements to wait for
+        :type min_samples: int
+        :param timeout_ms: timeout in milliseconds, expired timeout is not an error
+        :type timeout_ms: int
+        :param preset: preset
+        :type preset: int
+        :return: number of elements in ring buffer
+        :rtype: int
+        """
+
+        data_size = numpy.zeros(1).astype(numpy.int32)
+
+        res = BoardControllerDLL.get_instance().wait_for_board_data(min_samples, timeout_ms, preset, data_size,
+                                                                    self.board_id, self.input_json)
+        if res != BrainFlowExitCodes.STATUS_OK.value and res != BrainFlowExitCodes.SYNC_TIMEOUT_ERROR.value:
+            raise BrainFlowError('unable to wait for data', res)
+        return data_size[0]
+
     def get_board_id(self) -> int:
         """Get's the actual board id, can be different than provided
 
@@ -1459,6 +1515,62 @@ class BoardShim(object):
 
         return data_arr.reshape(package_length, data_size)
 
+    def acquire_board_data_view(self, max_samples: int, preset: int = BrainFlowPresets.DEFAULT_PRESET):
+        """Get up to max_samples packages and remove them from ringbuffer without copying,
+        arrays point to internal ringbuffer and stay valid until release_board_data_view is called.
+        Only one view per preset can be acquired at a time, new packages are dropped if they would overwrite it.
+        Copy arrays (e.g. numpy.copy) if they are needed after release_board_data_view, release_session and
+        start_stream fail while a view is held. With interleaved buffer layout rows are strided and DataFilter
+        rejects them, copy rows before filtering
+
+        :param max_samples: max number of packages to get
+        :type max_samples: int
+        :param preset: preset
+        :type preset: int
+        :return: two arrays, packages from the second one follow packages from the first one
+        :rtype: Tuple[NDArray[Shape["*, *"], Float64], NDArray[Shape["*, *"], Float64]]
+        """
+
+        if max_samples < 0:
+            raise BrainFlowError('invalid max_samples', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        package_length = BoardShim.get_num_rows(self._master_board_id, preset)
+        first_span = ctypes.POINTER(ctypes.c_double)()
+        second_span = ctypes.POINTER(ctypes.c_double)()
+        first_span_len = numpy.zeros(1).astype(numpy.int32)
+        second_span_len = numpy.zeros(1).astype(numpy.int32)
+        channel_stride = numpy.zeros(1).astype(numpy.int32)
+        sample_stride = numpy.zeros(1).astype(numpy.int32)
+
+        res = BoardControllerDLL.get_instance().acquire_board_data_view(
+            max_samples, preset, ctypes.byref(first_span), first_span_len, ctypes.byref(second_span),
+            second_span_len, channel_stride, sample_stride, self.board_id, self.input_json)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to acquire board data view', res)
+
+        def _wrap(span, span_len):
+            if span_len == 0 or not span:
+                return numpy.zeros((package_length, 0), dtype=numpy.float64)
+            extent = (package_length - 1) * channel_stride[0] + (span_len - 1) * sample_stride[0] + 1
+            flat = numpy.ctypeslib.as_array(span, shape=(extent,))
+            item_size = flat.itemsize
+            return numpy.lib.stride_tricks.as_strided(
+                flat, shape=(package_length, span_len),
+                strides=(channel_stride[0] * item_size, sample_stride[0] * item_size))
+
+        return _wrap(first_span, first_span_len[0]), _wrap(second_span, second_span_len[0])
+
+    def release_board_data_view(self, preset: int = BrainFlowPresets.DEFAULT_PRESET) -> None:
+        """Release arrays returned by acquire_board_data_view, they and all numpy views created from them
+        must not be used after this call, copy them before if data is needed later
+
+        :param preset: preset
+        :type preset: int
+        """
+
+        res = BoardControllerDLL.get_instance().release_board_data_view(preset, self.board_id, self.input_json)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to release board data view', res)
+
     def config_board(self, config) -> str:
         """Use this method carefully and only if you understand what you are doing, do NOT use it to start or stop streaming
 
@@ -23,6 +23,15 @@ class FilterTypes(enum.IntEnum):
     BESSEL_ZERO_PHASE = 5  #:
 
 
+class FilterOperations(enum.IntEnum):
+    """Enum to store all supported filter operations"""
+
+    LOWPASS = 0  #:
+    HIGHPASS = 1  #:
+    BANDPASS = 2  #:
+    BANDSTOP = 3  #:
+
+
 class AggOperations(enum.IntEnum):
     """Enum to store all supported aggregation operations"""
 
@@ -229,6 +238,163 @@ class DataHandlerDLL(object):
             ctypes.c_double
         ]
 
+        self.create_streaming_filter = self.lib.create_streaming_filter
+        self.create_streaming_filter.restype = ctypes.c_int
+        self.create_streaming_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.process_streaming_filter = self.lib.process_streaming_filter
+        self.process_streaming_filter.restype = ctypes.c_int
+        self.process_streaming_filter.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.reset_streaming_filter = self.lib.reset_streaming_filter
+        self.reset_streaming_filter.restype = ctypes.c_int
+        self.reset_streaming_filter.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.release_streaming_filter = self.lib.release_streaming_filter
+        self.release_streaming_filter.restype = ctypes.c_int
+        self.release_streaming_filter.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.perform_lowpass_2d = self.lib.perform_lowpass_2d
+        self.perform_lowpass_2d.restype = ctypes.c_int
+        self.perform_lowpass_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double
+        ]
+
+        self.perform_highpass_2d = self.lib.perform_highpass_2d
+        self.perform_highpass_2d.restype = ctypes.c_int
+        self.perform_highpass_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double
+        ]
+
+        self.perform_bandpass_2d = self.lib.perform_bandpass_2d
+        self.perform_bandpass_2d.restype = ctypes.c_int
+        self.perform_bandpass_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double
+        ]
+
+        self.perform_bandstop_2d = self.lib.perform_bandstop_2d
+        self.perform_bandstop_2d.restype = ctypes.c_int
+        self.perform_bandstop_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double
+        ]
+
+        self.remove_environmental_noise_2d = self.lib.remove_environmental_noise_2d
+        self.remove_environmental_noise_2d.restype = ctypes.c_int
+        self.remove_environmental_noise_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.perform_rolling_filter_2d = self.lib.perform_rolling_filter_2d
+        self.perform_rolling_filter_2d.restype = ctypes.c_int
+        self.perform_rolling_filter_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.perform_downsampling_2d = self.lib.perform_downsampling_2d
+        self.perform_downsampling_2d.restype = ctypes.c_int
+        self.perform_downsampling_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double)
+        ]
+
+        self.perform_wavelet_denoising_2d = self.lib.perform_wavelet_denoising_2d
+        self.perform_wavelet_denoising_2d.restype = ctypes.c_int
+        self.perform_wavelet_denoising_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.detrend_2d = self.lib.detrend_2d
+        self.detrend_2d.restype = ctypes.c_int
+        self.detrend_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.get_psd_welch_2d = self.lib.get_psd_welch_2d
+        self.get_psd_welch_2d.restype = ctypes.c_int
+        self.get_psd_welch_2d.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double)
+        ]
+
         self.get_oxygen_level = self.lib.get_oxygen_level
         self.get_oxygen_level.restype = ctypes.c_int
         self.get_oxygen_level.argtypes = [
@@ -307,6 +473,18 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_double)
         ]
 
+        self.set_num_threads_data_handler = self.lib.set_num_threads_data_handler
+        self.set_num_threads_data_handler.restype = ctypes.c_int
+        self.set_num_threads_data_handler.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.get_num_threads_data_handler = self.lib.get_num_threads_data_handler
+        self.get_num_threads_data_handler.restype = ctypes.c_int
+        self.get_num_threads_data_handler.argtypes = [
+            ndpointer(ctypes.c_int32)
+        ]
+
         self.set_log_level_data_handler = self.lib.set_log_level_data_handler
         self.set_log_level_data_handler.restype = ctypes.c_int
         self.set_log_level_data_handler.argtypes = [
@@ -368,6 +546,36 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_double)
         ]
 
+        self.create_peaks_detector = self.lib.create_peaks_detector
+        self.create_peaks_detector.restype = ctypes.c_int
+        self.create_peaks_detector.argtypes = [
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.process_peaks_detector = self.lib.process_peaks_detector
+        self.process_peaks_detector.restype = ctypes.c_int
+        self.process_peaks_detector.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ndpointer(ctypes.c_double)
+        ]
+
+        self.reset_peaks_detector = self.lib.reset_peaks_detector
+        self.reset_peaks_detector.restype = ctypes.c_int
+        self.reset_peaks_detector.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.release_peaks_detector = self.lib.release_peaks_detector
+        self.release_peaks_detector.restype = ctypes.c_int
+        self.release_peaks_detector.argtypes = [
+            ctypes.c_int
+        ]
+
         self.restore_data_from_wavelet_detailed_coeffs = self.lib.restore_data_from_wavelet_detailed_coeffs
         self.restore_data_from_wavelet_detailed_coeffs.restype = ctypes.c_int
         self.restore_data_from_wavelet_detailed_coeffs.argtypes = [
@@ -493,6 +701,45 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_double),
         ]
 
+        self.create_band_power_stream = self.lib.create_band_power_stream
+        self.create_band_power_stream.restype = ctypes.c_int
+        self.create_band_power_stream.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.process_band_power_stream = self.lib.process_band_power_stream
+        self.process_band_power_stream.restype = ctypes.c_int
+        self.process_band_power_stream.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.reset_band_power_stream = self.lib.reset_band_power_stream
+        self.reset_band_power_stream.restype = ctypes.c_int
+        self.reset_band_power_stream.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.release_band_power_stream = self.lib.release_band_power_stream
+        self.release_band_power_stream.restype = ctypes.c_int
+        self.release_band_power_stream.argtypes = [
+            ctypes.c_int
+        ]
+
         self.get_psd = self.lib.get_psd
         self.get_psd.restype = ctypes.c_int
         self.get_psd.argtypes = [
@@ -560,6 +807,31 @@ class DataFilter(object):
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to enable logger', res)
 
+    @classmethod
+    def set_num_threads(cls, num_threads: int) -> None:
+        """set number of threads used by multichannel methods, default value can be set by BRAINFLOW_NUM_THREADS
+        env variable
+
+        :param num_threads: number of threads, 0 means number of hardware threads
+        :type num_threads: int
+        """
+        res = DataHandlerDLL.get_instance().set_num_threads_data_handler(num_threads)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to set number of threads', res)
+
+    @classmethod
+    def get_num_threads(cls) -> int:
+        """get number of threads used by multichannel methods
+
+        :return: number of threads
+        :rtype: int
+        """
+        num_threads = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().get_num_threads_data_handler(num_threads)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to get number of threads', res)
+        return int(num_threads[0])
+
     @classmethod
     def enable_data_logger(cls) -> None:
         """enable Data Logger with level INFO, uses stderr for log messages by default"""
@@ -706,6 +978,79 @@ class DataFilter(object):
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to apply band stop filter', res)
 
+    @classmethod
+    def create_streaming_filter(cls, filter_operation: int, num_channels: int, sampling_rate: int,
+                                start_freq: float, stop_freq: float, order: int, filter_type: int,
+                                ripple: float) -> int:
+        """create filter which keeps its state between calls, use it to filter data chunk by chunk
+
+        :param filter_operation: operation from FilterOperations enum
+        :type filter_operation: int
+        :param num_channels: number of channels filtered together
+        :type num_channels: int
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param start_freq: start frequency, cutoff for lowpass and highpass
+        :type start_freq: float
+        :param stop_freq: stop frequency, ignored for lowpass and highpass
+        :type stop_freq: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum, zero phase types are not supported
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        :return: filter id
+        :rtype: int
+        """
+        if not isinstance(sampling_rate, int):
+            raise BrainFlowError('wrong type for sampling rate', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance(filter_type, int):
+            raise BrainFlowError('wrong type for filter type', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        filter_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_streaming_filter(filter_operation, num_channels, sampling_rate,
+                                                                    start_freq, stop_freq, order, filter_type,
+                                                                    ripple, filter_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to create streaming filter', res)
+        return int(filter_id[0])
+
+    @classmethod
+    def process_streaming_filter(cls, filter_id: int, data) -> None:
+        """filter next chunk in-place, each row is a channel
+
+        :param filter_id: id returned by create_streaming_filter
+        :type filter_id: int
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().process_streaming_filter(filter_id, data, data.shape[0], data.shape[1])
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to filter data', res)
+
+    @classmethod
+    def reset_streaming_filter(cls, filter_id: int) -> None:
+        """drop filter state, next chunk is filtered as a new signal
+
+        :param filter_id: id returned by create_streaming_filter
+        :type filter_id: int
+        """
+        res = DataHandlerDLL.get_instance().reset_streaming_filter(filter_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to reset streaming filter', res)
+
+    @classmethod
+    def release_streaming_filter(cls, filter_id: int) -> None:
+        """release streaming filter
+
+        :param filter_id: id returned by create_streaming_filter
+        :type filter_id: int
+        """
+        res = DataHandlerDLL.get_instance().release_streaming_filter(filter_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to release streaming filter', res)
+
     @classmethod
     def remove_environmental_noise(cls, data, sampling_rate: int, noise_type: float) -> None:
         """remove env noise using notch filter
@@ -938,6 +1283,67 @@ class DataFilter(object):
 
         return output
 
+    @classmethod
+    def create_peaks_detector(cls, lag=5, threshold=3.5, influence=0.1) -> int:
+        """create z score peaks detector which keeps its state between calls, consecutive chunks give the same
+        result as detect_peaks_z_score for the whole signal
+
+        :param lag: window size for averaging
+        :type lag: int
+        :param threshold: in stddev units
+        :type threshold: float
+        :param influence: contribution of peaks to mean value, between 0 and 1
+        :type influence: float
+        :return: detector id
+        :rtype: int
+        """
+        detector_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_peaks_detector(lag, threshold, influence, detector_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to create peaks detector', res)
+        return int(detector_id[0])
+
+    @classmethod
+    def process_peaks_detector(cls, detector_id: int, data):
+        """detect peaks in the next chunk
+
+        :param detector_id: id returned by create_peaks_detector
+        :type detector_id: int
+        :param data: next chunk of data
+        :type data: NDArray[Shape["*"], Float64]
+        :return: 1 for positive peaks, -1 for negative peaks and 0 otherwise
+        :rtype: NDArray[Shape["*"], Float64]
+        """
+        check_memory_layout_row_major(data, 1)
+
+        output = numpy.zeros(data.shape[0])
+        res = DataHandlerDLL.get_instance().process_peaks_detector(detector_id, data, data.shape[0], output)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to detect peaks', res)
+        return output
+
+    @classmethod
+    def reset_peaks_detector(cls, detector_id: int) -> None:
+        """drop detector state, next chunk is processed as a new signal
+
+        :param detector_id: id returned by create_peaks_detector
+        :type detector_id: int
+        """
+        res = DataHandlerDLL.get_instance().reset_peaks_detector(detector_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to reset peaks detector', res)
+
+    @classmethod
+    def release_peaks_detector(cls, detector_id: int) -> None:
+        """release peaks detector
+
+        :param detector_id: id returned by create_peaks_detector
+        :type detector_id: int
+        """
+        res = DataHandlerDLL.get_instance().release_peaks_detector(detector_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to release peaks detector', res)
+
     @classmethod
     def perform_inverse_wavelet_transform(cls, wavelet_output: Tuple, original_data_len: int, wavelet: int,
                                           decomposition_level: int, extension_type=WaveletExtensionTypes.SYMMETRIC):
@@ -1141,6 +1547,237 @@ class DataFilter(object):
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to detrend data', res)
 
+    @classmethod
+    def perform_lowpass_2d(cls, data, sampling_rate: int, cutoff: float, order: int, filter_type: int,
+                           ripple: float) -> None:
+        """apply low pass filter to each row of provided data, rows are processed in parallel
+
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param cutoff: cutoff frequency
+        :type cutoff: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().perform_lowpass_2d(data, data.shape[0], data.shape[1], sampling_rate,
+                                                               cutoff, order, filter_type, ripple)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to apply low pass filter', res)
+
+    @classmethod
+    def perform_highpass_2d(cls, data, sampling_rate: int, cutoff: float, order: int, filter_type: int,
+                            ripple: float) -> None:
+        """apply high pass filter to each row of provided data, rows are processed in parallel
+
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param cutoff: cutoff frequency
+        :type cutoff: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().perform_highpass_2d(data, data.shape[0], data.shape[1], sampling_rate,
+                                                                cutoff, order, filter_type, ripple)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to apply high pass filter', res)
+
+    @classmethod
+    def perform_bandpass_2d(cls, data, sampling_rate: int, start_freq: float, stop_freq: float, order: int,
+                            filter_type: int, ripple: float) -> None:
+        """apply band pass filter to each row of provided data, rows are processed in parallel
+
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param start_freq: start frequency
+        :type start_freq: float
+        :param stop_freq: stop frequency
+        :type stop_freq: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().perform_bandpass_2d(data, data.shape[0], data.shape[1], sampling_rate,
+                                                                start_freq, stop_freq, order, filter_type, ripple)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to apply band pass filter', res)
+
+    @classmethod
+    def perform_bandstop_2d(cls, data, sampling_rate: int, start_freq: float, stop_freq: float, order: int,
+                            filter_type: int, ripple: float) -> None:
+        """apply band stop filter to each row of provided data, rows are processed in parallel
+
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param start_freq: start frequency
+        :type start_freq: float
+        :param stop_freq: stop frequency
+        :type stop_freq: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().perform_bandstop_2d(data, data.shape[0], data.shape[1], sampling_rate,
+                                                                start_freq, stop_freq, order, filter_type, ripple)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to apply band stop filter', res)
+
+    @classmethod
+    def remove_environmental_noise_2d(cls, data, sampling_rate: int, noise_type: int) -> None:
+        """remove env noise from each row of provided data using notch filter
+
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param noise_type: Type of noise from NoiseTypes enum
+        :type noise_type: int
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().remove_environmental_noise_2d(data, data.shape[0], data.shape[1],
+                                                                          sampling_rate, noise_type)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to remove environmental noise', res)
+
+    @classmethod
+    def perform_rolling_filter_2d(cls, data, period: int, operation: int) -> None:
+        """smooth each row of provided data using moving average or median
+
+        :param data: data to smooth, it works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param period: window size
+        :type period: int
+        :param operation: int value from AggOperation enum
+        :type operation: int
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().perform_rolling_filter_2d(data, data.shape[0], data.shape[1], period,
+                                                                      operation)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to smooth data', res)
+
+    @classmethod
+    def perform_downsampling_2d(cls, data, period: int, operation: int):
+        """perform downsampling of each row of provided data, it just aggregates several data points
+
+        :param data: initial data
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param period: downsampling period
+        :type period: int
+        :param operation: int value from AggOperation enum
+        :type operation: int
+        :return: downsampled data
+        :rtype: NDArray[Shape["*, *"], Float64]
+        """
+        check_memory_layout_row_major(data, 2)
+        if period <= 0:
+            raise BrainFlowError('Invalid value for period', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+
+        downsampled_data = numpy.zeros((data.shape[0], int(data.shape[1] / period))).astype(numpy.float64)
+        res = DataHandlerDLL.get_instance().perform_downsampling_2d(data, data.shape[0], data.shape[1], period,
+                                                                    operation, downsampled_data)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to perform downsampling', res)
+
+        return downsampled_data
+
+    @classmethod
+    def perform_wavelet_denoising_2d(cls, data, wavelet: int, decomposition_level: int,
+                                     wavelet_denoising=WaveletDenoisingTypes.SURESHRINK,
+                                     threshold=ThresholdTypes.HARD,
+                                     extension_type=WaveletExtensionTypes.SYMMETRIC,
+                                     noise_level=NoiseEstimationLevelTypes.FIRST_LEVEL) -> None:
+        """perform wavelet denoising of each row of provided data, rows are processed in parallel
+
+        :param data: data to denoise, it works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param wavelet: use WaveletTypes enum
+        :type wavelet: int
+        :param decomposition_level: decomposition level
+        :type decomposition_level: int
+        :param wavelet_denoising: use WaveletDenoisingTypes enum
+        :type wavelet_denoising: int
+        :param threshold: use ThresholdTypes enum
+        :type threshold: int
+        :param extension_type: use WaveletExtensionTypes enum
+        :type extension_type: int
+        :param noise_level: use NoiseEstimationLevelTypes enum
+        :type noise_level: int
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().perform_wavelet_denoising_2d(data, data.shape[0], data.shape[1], wavelet,
+                                                                         decomposition_level, wavelet_denoising,
+                                                                         threshold, extension_type, noise_level)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to denoise data', res)
+
+    @classmethod
+    def detrend_2d(cls, data, detrend_operation: int) -> None:
+        """detrend each row of provided data, rows are processed in parallel
+
+        :param data: data to detrend, it works in-place
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param detrend_operation: Type of detrend operation
+        :type detrend_operation: int
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().detrend_2d(data, data.shape[0], data.shape[1], detrend_operation)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to detrend data', res)
+
+    @classmethod
+    def get_psd_welch_2d(cls, data, nfft: int, overlap: int, sampling_rate: int, window: int) -> Tuple:
+        """calculate PSD using Welch method for each row of provided data, rows are processed in parallel
+
+        :param data: data to calc psd
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param nfft: FFT Window size, must be even
+        :type nfft: int
+        :param overlap: overlap of FFT Windows, must be >= 0 and < nfft
+        :type overlap: int
+        :param sampling_rate: sampling rate
+        :type sampling_rate: int
+        :param window: window function
+        :type window: int
+        :return: amplitudes with shape (rows, N / 2 + 1) and frequency array of len N / 2 + 1
+        :rtype: tuple
+        """
+        check_memory_layout_row_major(data, 2)
+
+        ampls = numpy.zeros((data.shape[0], int(nfft / 2 + 1))).astype(numpy.float64)
+        freqs = numpy.zeros(int(nfft / 2 + 1)).astype(numpy.float64)
+        res = DataHandlerDLL.get_instance().get_psd_welch_2d(data, data.shape[0], data.shape[1], nfft, overlap,
+                                                             sampling_rate, window, ampls, freqs)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to calc psd welch', res)
+
+        return ampls, freqs
+
     @classmethod
     def get_band_power(cls, psd: Tuple, freq_start: float, freq_end: float) -> float:
         """calculate band power
@@ -1224,6 +1861,94 @@ class DataFilter(object):
 
         return avg_bands, stddev_bands
 
+    @classmethod
+    def create_band_power_stream(cls, num_channels: int, sampling_rate: int, window_len: int, hop: int,
+                                 bands=None, apply_filter=True) -> int:
+        """create band power stream which keeps filter state and spectra of seen welch segments, band powers of
+        the last window_len samples are updated every hop samples
+
+        :param num_channels: number of channels passed to process_band_power_stream
+        :type num_channels: int
+        :param sampling_rate: sampling rate
+        :type sampling_rate: int
+        :param window_len: number of samples used for calculation
+        :type window_len: int
+        :param hop: band powers are updated every hop samples
+        :type hop: int
+        :param bands: List of typles with bands to use, if None use bands from get_avg_band_powers
+        :type bands: List
+        :param apply_filter: apply causal bandpass and bandstop filtrers or not
+        :type apply_filter: bool
+        :return: stream id
+        :rtype: int
+        """
+        if bands is None:
+            bands = [(2.0, 4.0), (4.0, 8.0), (8.0, 13.0), (13.0, 30.0), (30.0, 45.0)]
+        if len(bands) == 0:
+            raise BrainFlowError('wrong input for bands', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        start_freqs = numpy.array([band[0] for band in bands]).astype(numpy.float64)
+        stop_freqs = numpy.array([band[1] for band in bands]).astype(numpy.float64)
+        stream_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_band_power_stream(num_channels, sampling_rate, window_len, hop,
+                                                                     start_freqs, stop_freqs, len(bands),
+                                                                     int(apply_filter), stream_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to create band power stream', res)
+        return int(stream_id[0])
+
+    @classmethod
+    def process_band_power_stream(cls, stream_id: int, data, channels: List, num_bands=5):
+        """feed the next chunk to band power stream
+
+        :param stream_id: id returned by create_band_power_stream
+        :type stream_id: int
+        :param data: 2d array with the next chunk
+        :type data: NDArray[Shape["*, *"], Float64]
+        :param channels: channels - rows of data array which should be used for calculation
+        :type channels: List
+        :param num_bands: number of bands used to create the stream
+        :type num_bands: int
+        :return: avg and stddev arrays for bandpowers or None if there was no update in this chunk
+        :rtype: tuple
+        """
+        check_memory_layout_row_major(data, 2)
+        if len(channels) == 0:
+            raise BrainFlowError('wrong input for channels', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        avg_bands = numpy.zeros(num_bands).astype(numpy.float64)
+        stddev_bands = numpy.zeros(num_bands).astype(numpy.float64)
+        is_updated = numpy.zeros(1).astype(numpy.int32)
+        data_1d = numpy.ascontiguousarray(data[channels], dtype=numpy.float64)
+        res = DataHandlerDLL.get_instance().process_band_power_stream(stream_id, data_1d, len(channels),
+                                                                      data.shape[1], num_bands, avg_bands,
+                                                                      stddev_bands, is_updated)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to process band power stream', res)
+        if is_updated[0] == 0:
+            return None
+        return avg_bands, stddev_bands
+
+    @classmethod
+    def reset_band_power_stream(cls, stream_id: int) -> None:
+        """drop stream state, next chunk is processed as a new signal
+
+        :param stream_id: id returned by create_band_power_stream
+        :type stream_id: int
+        """
+        res = DataHandlerDLL.get_instance().reset_band_power_stream(stream_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to reset band power stream', res)
+
+    @classmethod
+    def release_band_power_stream(cls, stream_id: int) -> None:
+        """release band power stream
+
+        :param stream_id: id returned by create_band_power_stream
+        :type stream_id: int
+        """
+        res = DataHandlerDLL.get_instance().release_band_power_stream(stream_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to release band power stream', res)
+
     @classmethod
     def perform_ica(cls, data, num_components: int, channels=None) -> Tuple:
         """perform ICA
@@ -0,0 +1,52 @@
+SET (BENCHMARKS_EXE_NAME "brainflow_benchmarks")
+
+find_package (benchmark QUIET)
+if (NOT benchmark_FOUND)
+    SET (BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    SET (BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    SET (BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    SET (FETCHCONTENT_QUIET ON CACHE BOOL "" FORCE)
+
+    include (FetchContent)
+    FetchContent_Declare (
+        googlebenchmark
+        URL https://github.com/google/benchmark/archive/refs/tags/v1.8.3.zip
+    )
+
+    FetchContent_MakeAvailable (googlebenchmark)
+endif (NOT benchmark_FOUND)
+
+SET (BENCHMARKS_SRC
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/dsp_kernels.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/socket_server_tcp.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/tsv_parser.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/benchmarks/data_handler/median_benchmark.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/benchmarks/utils/data_buffer_benchmark.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/benchmarks/utils/dsp_kernels_benchmark.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/benchmarks/utils/socket_server_tcp_benchmark.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/benchmarks/utils/tsv_parser_benchmark.cpp
+)
+
+add_executable (
+    ${BENCHMARKS_EXE_NAME}
+    ${BENCHMARKS_SRC}
+)
+
+target_include_directories (
+    ${BENCHMARKS_EXE_NAME} PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/inc
+)
+
+target_link_libraries (
+    ${BENCHMARKS_EXE_NAME} PRIVATE
+    benchmark::benchmark_main
+)
+
+set_target_properties (${BENCHMARKS_EXE_NAME}
+    PROPERTIES
+    ARCHIVE_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/benchmarks
+    LIBRARY_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/benchmarks
+    RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/benchmarks
+)
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "downsample_operators.h"
+#include "rolling_filter.h"
+
+
+// previous implementation of RollingMedian, kept as a baseline
+class MultisetRollingMedian : public RollingFilter<double>
+{
+    std::multiset<double> dataset;
+    std::deque<double> deque;
+
+public:
+    MultisetRollingMedian (int period) : RollingFilter<double> (period)
+    {
+    }
+
+    void add_data (double num)
+    {
+        this->deque.push_back (num);
+        this->dataset.insert (num);
+    }
+
+    double get_value ()
+    {
+        if ((int)this->dataset.size () < this->period)
+        {
+            return this->deque.back ();
+        }
+        auto it1 = this->dataset.begin ();
+        auto it2 = it1;
+        std::advance (it1, (this->period - 1) / 2);
+        it2 = it1;
+        std::advance (it2, (int)((this->period & 1) == 0));
+        double res = (*it1 + *it2) / 2.0;
+        double val = deque.front ();
+        deque.pop_front ();
+        this->dataset.erase (this->dataset.find (val));
+        return res;
+    }
+};
+
+// previous implementation of downsample_median, kept as a baseline
+static double sort_downsample_median (double *data, int len)
+{
+    std::vector<double> values;
+    for (int i = 0; i < len; i++)
+    {
+        values.push_back (data[i]);
+    }
+    std::sort (values.begin (), values.end ());
+    if (len % 2 == 0)
+    {
+        return (values[len / 2 - 1] + values[len / 2]) / 2.0;
+    }
+    return values[len / 2];
+}
+
+// a minute of 250hz signal
+static std::vector<double> generate_data ()
+{
+    std::mt19937 generator (42);
+    std::normal_distribution<double> distribution (0.0, 100.0);
+    std::vector<double> data (250 * 60);
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        data[i] = distribution (generator);
+    }
+    return data;
+}
+
+template <typename Filter>
+static void BM_RollingMedian (benchmark::State &state)
+{
+    std::vector<double> data = generate_data ();
+    int period = (int)state.range (0);
+    for (auto _ : state)
+    {
+        Filter filter (period);
+        for (size_t i = 0; i < data.size (); i++)
+        {
+            filter.add_data (data[i]);
+            benchmark::DoNotOptimize (filter.get_value ());
+        }
+    }
+    state.SetItemsProcessed (state.iterations () * data.size ());
+}
+
+static void BM_DownsampleMedian (benchmark::State &state, double (*op) (double *, int))
+{
+    std::vector<double> data = generate_data ();
+    int period = (int)state.range (0);
+    for (auto _ : state)
+    {
+        for (size_t pos = 0; pos + period <= data.size (); pos += period)
+        {
+            benchmark::DoNotOptimize (op (data.data () + pos, period));
+        }
+    }
+    state.SetItemsProcessed (state.iterations () * data.size ());
+}
+
+BENCHMARK_TEMPLATE (BM_RollingMedian, MultisetRollingMedian)->Arg (5)->Arg (51)->Arg (501);
+BENCHMARK_TEMPLATE (BM_RollingMedian, RollingMedian<double>)->Arg (5)->Arg (51)->Arg (501);
+BENCHMARK_CAPTURE (BM_DownsampleMedian, sort, sort_downsample_median)->Arg (5)->Arg (51)->Arg (501);
+BENCHMARK_CAPTURE (BM_DownsampleMedian, nth_element, downsample_median)
+    ->Arg (5)
+    ->Arg (51)
+    ->Arg (501);
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "data_buffer.h"
+#include "spinlock.h"
+
+
+// previous implementation where producer and readers share one spinlock, kept as a baseline
+class SpinLockDataBuffer
+{
+    SpinLock lock;
+    double *data;
+    size_t buffer_size;
+    size_t first_used, first_free;
+    size_t count;
+    size_t num_samples;
+
+    void get_chunk (size_t start, size_t size, double *data_buf)
+    {
+        if (start + size <= buffer_size)
+        {
+            memcpy (data_buf, data + start * num_samples, size * sizeof (double) * num_samples);
+        }
+        else
+        {
+            size_t first_half = buffer_size - start;
+            size_t second_half = size - first_half;
+            memcpy (
+                data_buf, data + start * num_samples, first_half * sizeof (double) * num_samples);
+            memcpy (data_buf + first_half * num_samples, data,
+                second_half * sizeof (double) * num_samples);
+        }
+    }
+
+public:
+    SpinLockDataBuffer (int num_samples, size_t buffer_size)
+    {
+        this->buffer_size = buffer_size;
+        this->num_samples = num_samples;
+        first_free = first_used = count = 0;
+        data = new double[buffer_size * num_samples];
+    }
+
+    ~SpinLockDataBuffer ()
+    {
+        delete[] data;
+    }
+
+    void add_data (double *value)
+    {
+        lock.lock ();
+        if (count == 0)
+        {
+            first_used = first_free = 0;
+        }
+        else if (first_free == first_used)
+        {
+            first_used = (first_used + 1) % buffer_size;
+            count--;
+        }
+        memcpy (data + first_free * num_samples, value, sizeof (double) * num_samples);
+        first_free = (first_free + 1) % buffer_size;
+        count++;
+        lock.unlock ();
+    }
+
+    size_t get_current_data (size_t max_count, double *data_buf)
+    {
+        lock.lock ();
+        size_t result_count = std::min (max_count, count);
+        if (result_count)
+        {
+            get_chunk ((first_used + (count - result_count)) % buffer_size, result_count, data_buf);
+        }
+        lock.unlock ();
+        return result_count;
+    }
+
+    size_t get_data_count ()
+    {
+        lock.lock ();
+        size_t result = count;
+        lock.unlock ();
+        return result;
+    }
+};
+
+// producer latency of add_data while state.range (0) threads poll the buffer in a tight loop like
+// bindings do with get_board_data_count and get_current_board_data
+template <typename Buffer>
+static void BM_AddDataUnderReaderContention (benchmark::State &state)
+{
+    const int num_rows = 32;
+    const size_t buffer_size = 45000;
+    const int num_readers = (int)state.range (0);
+    Buffer buffer (num_rows, buffer_size);
+    std::atomic<bool> keep_alive (true);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < num_readers; i++)
+    {
+        readers.push_back (std::thread (
+            [&buffer, &keep_alive, num_rows] ()
+            {
+                std::vector<double> out (256 * num_rows);
+                while (keep_alive.load (std::memory_order_relaxed))
+                {
+                    benchmark::DoNotOptimize (buffer.get_data_count ());
+                    benchmark::DoNotOptimize (buffer.get_current_data (256, out.data ()));
+                }
+            }));
+    }
+
+    std::vector<double> package (num_rows, 1.0);
+    std::vector<double> latencies;
+    latencies.reserve (1 << 20);
+    for (auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now ();
+        buffer.add_data (package.data ());
+        auto stop = std::chrono::high_resolution_clock::now ();
+        if (latencies.size () < latencies.capacity ())
+        {
+            latencies.push_back (
+                (double)std::chrono::duration_cast<std::chrono::nanoseconds> (stop - start)
+                    .count ());
+        }
+    }
+
+    keep_alive = false;
+    for (std::thread &reader : readers)
+    {
+        reader.join ();
+    }
+
+    if (!latencies.empty ())
+    {
+        double mean = 0.0;
+        for (double latency : latencies)
+        {
+            mean += latency;
+        }
+        mean /= latencies.size ();
+        double variance = 0.0;
+        for (double latency : latencies)
+        {
+            variance += (latency - mean) * (latency - mean);
+        }
+        variance /= latencies.size ();
+        std::sort (latencies.begin (), latencies.end ());
+        state.counters["p50_ns"] = latencies[latencies.size () / 2];
+        state.counters["p99_ns"] = latencies[(size_t)(latencies.size () * 0.99)];
+        state.counters["max_ns"] = latencies.back ();
+        state.counters["jitter_ns"] = std::sqrt (variance);
+    }
+    state.SetItemsProcessed (state.iterations ());
+}
+
+BENCHMARK_TEMPLATE (BM_AddDataUnderReaderContention, SpinLockDataBuffer)
+    ->Arg (0)
+    ->Arg (1)
+    ->Arg (4)
+    ->UseRealTime ();
+BENCHMARK_TEMPLATE (BM_AddDataUnderReaderContention, DataBuffer)
+    ->Arg (0)
+    ->Arg (1)
+    ->Arg (4)
+    ->UseRealTime ();
+
+// get_board_data path: read whole buffer as channel major matrix, state.range (0) selects storage
+static void BM_GetDataChannelMajorOutput (benchmark::State &state)
+{
+    const int num_rows = 32;
+    const size_t buffer_size = 45000;
+    DataBuffer buffer (num_rows, buffer_size, state.range (0) != 0);
+    std::vector<double> package (num_rows, 1.0);
+    std::vector<double> out (buffer_size * num_rows);
+    for (auto _ : state)
+    {
+        state.PauseTiming ();
+        for (size_t i = 0; i < buffer_size + buffer_size / 3; i++)
+        {
+            buffer.add_data (package.data ());
+        }
+        state.ResumeTiming ();
+        benchmark::DoNotOptimize (buffer.get_data (buffer_size, out.data (), true));
+    }
+    state.SetBytesProcessed (state.iterations () * buffer_size * num_rows * sizeof (double));
+}
+
+BENCHMARK (BM_GetDataChannelMajorOutput)->Arg (0)->Arg (1);
+
+// driver ingest path: state.range (0) samples per datagram pushed one by one or as one block
+static void BM_AddDataBlock (benchmark::State &state)
+{
+    const int num_rows = 32;
+    const size_t block_size = (size_t)state.range (0);
+    bool use_block = state.range (1) != 0;
+    DataBuffer buffer (num_rows, 45000);
+    std::vector<double> packages (block_size * num_rows, 1.0);
+    for (auto _ : state)
+    {
+        if (use_block)
+        {
+            buffer.add_data (packages.data (), block_size);
+        }
+        else
+        {
+            for (size_t i = 0; i < block_size; i++)
+            {
+                buffer.add_data (packages.data () + i * num_rows);
+            }
+        }
+    }
+    state.SetItemsProcessed (state.iterations () * block_size);
+}
+
+BENCHMARK (BM_AddDataBlock)->Args ({25, 0})->Args ({25, 1})->Args ({256, 0})->Args ({256, 1});
@@ -0,0 +1,149 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "dsp_kernels.h"
+
+
+static std::vector<double> generate_data (int len)
+{
+    std::mt19937 generator (42);
+    std::normal_distribution<double> distribution (0.0, 100.0);
+    std::vector<double> data (len);
+    for (int i = 0; i < len; i++)
+    {
+        data[i] = distribution (generator);
+    }
+    return data;
+}
+
+// bytes processed count every array which is read or written once
+static void set_processed (benchmark::State &state, int len, int num_arrays)
+{
+    state.SetItemsProcessed (state.iterations () * len);
+    state.SetBytesProcessed (state.iterations () * len * num_arrays * (long long)sizeof (double));
+}
+
+static void BM_Sum (benchmark::State &state, const DspKernels *kernels)
+{
+    int len = (int)state.range (0);
+    std::vector<double> data = generate_data (len);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize (kernels->sum (data.data (), len));
+    }
+    set_processed (state, len, 1);
+}
+
+static void BM_IndexWeightedSum (benchmark::State &state, const DspKernels *kernels)
+{
+    int len = (int)state.range (0);
+    std::vector<double> data = generate_data (len);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize (kernels->index_weighted_sum (data.data (), len));
+    }
+    set_processed (state, len, 1);
+}
+
+static void BM_SquaredDeviationSum (benchmark::State &state, const DspKernels *kernels)
+{
+    int len = (int)state.range (0);
+    std::vector<double> data = generate_data (len);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize (kernels->squared_deviation_sum (data.data (), len, 1.0));
+    }
+    set_processed (state, len, 1);
+}
+
+static void BM_AbsMax (benchmark::State &state, const DspKernels *kernels)
+{
+    int len = (int)state.range (0);
+    std::vector<double> data = generate_data (len);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize (kernels->abs_max (data.data (), len));
+    }
+    set_processed (state, len, 1);
+}
+
+// straight line is the worst case, whole array is checked
+static void BM_HasSteps (benchmark::State &state, const DspKernels *kernels)
+{
+    int len = (int)state.range (0);
+    std::vector<double> data (len, 1.0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize (kernels->has_steps (data.data (), len, 0.00001));
+    }
+    set_processed (state, len, 1);
+}
+
+static void BM_SubtractLine (benchmark::State &state, const DspKernels *kernels)
+{
+    int len = (int)state.range (0);
+    std::vector<double> data = generate_data (len);
+    for (auto _ : state)
+    {
+        kernels->subtract_line (data.data (), len, 0.0, 0.0);
+        benchmark::ClobberMemory ();
+    }
+    set_processed (state, len, 2);
+}
+
+static void BM_Multiply (benchmark::State &state, const DspKernels *kernels)
+{
+    int len = (int)state.range (0);
+    std::vector<double> data = generate_data (len);
+    std::vector<double> window = generate_data (len);
+    std::vector<double> output (len);
+    for (auto _ : state)
+    {
+        kernels->multiply (data.data (), window.data (), output.data (), len);
+        benchmark::ClobberMemory ();
+    }
+    set_processed (state, len, 3);
+}
+
+static void BM_AccumulatePower (benchmark::State &state, const DspKernels *kernels)
+{
+    int len = (int)state.range (0);
+    std::vector<double> complex_data = generate_data (2 * len);
+    std::vector<double> output (len);
+    for (auto _ : state)
+    {
+        kernels->accumulate_power (complex_data.data (), len, 1.0, output.data ());
+        benchmark::ClobberMemory ();
+    }
+    // complex input counts twice, output is read and written
+    set_processed (state, len, 4);
+}
+
+// registers every kernel for every table supported by the cpu, names are like BM_Sum/avx2/4096
+static int register_dsp_kernels_benchmarks ()
+{
+    typedef void (*BenchmarkFunc) (benchmark::State &, const DspKernels *);
+    const char *names[] = {"BM_Sum", "BM_IndexWeightedSum", "BM_SquaredDeviationSum",
+        "BM_AbsMax", "BM_HasSteps", "BM_SubtractLine", "BM_Multiply", "BM_AccumulatePower"};
+    BenchmarkFunc funcs[] = {BM_Sum, BM_IndexWeightedSum, BM_SquaredDeviationSum, BM_AbsMax,
+        BM_HasSteps, BM_SubtractLine, BM_Multiply, BM_AccumulatePower};
+    std::vector<const DspKernels *> kernels = get_available_dsp_kernels ();
+    for (size_t k = 0; k < kernels.size (); k++)
+    {
+        for (size_t i = 0; i < sizeof (funcs) / sizeof (funcs[0]); i++)
+        {
+            std::string name = std::string (names[i]) + "/" + kernels[k]->name;
+            // 256 is a typical welch segment, 1 << 20 doesnt fit into l2 cache
+            benchmark::RegisterBenchmark (name.c_str (), funcs[i], kernels[k])
+                ->Arg (256)
+                ->Arg (4096)
+                ->Arg (1 << 20);
+        }
+    }
+    return 0;
+}
+
+static int dsp_kernels_benchmarks_registered = register_dsp_kernels_benchmarks ();
@@ -0,0 +1,251 @@
+#include <atomic>
+#include <chrono>
+#include <queue>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "byte_ring.h"
+
+#ifndef _WIN32
+#include <netinet/in.h>
+#include <signal.h>
+
+#include "socket_server_tcp.h"
+#endif
+
+// wifi shield sends 33 bytes per package, socket returns chunks of any size
+#define BENCHMARK_CHUNK_SIZE 1000
+#define BENCHMARK_STREAM_SIZE (1 << 20)
+
+
+// previous staging of SocketServerTCP, kept as a baseline
+static int recv_with_queue (
+    std::queue<char> &temp_buffer, const char *received, int res, char *data, int size)
+{
+    memcpy (data, received, res);
+    for (int i = 0; i < res; i++)
+    {
+        temp_buffer.push (data[i]);
+    }
+    if ((int)temp_buffer.size () < size)
+    {
+        return 0;
+    }
+    for (int i = 0; i < size; i++)
+    {
+        data[i] = temp_buffer.front ();
+        temp_buffer.pop ();
+    }
+    return size;
+}
+
+static int recv_with_ring (
+    ByteRing &temp_buffer, const char *received, int res, char *data, int size)
+{
+    temp_buffer.reserve (temp_buffer.get_size () + res);
+    temp_buffer.push (received, res);
+    if (temp_buffer.get_size () < size)
+    {
+        return 0;
+    }
+    return temp_buffer.pop (data, size);
+}
+
+// staging only: packages of state.range (0) bytes are cut from chunks without socket calls
+template <typename Staging, typename Func>
+static void run_staging (benchmark::State &state, Staging &staging, Func recv_func)
+{
+    int package_size = (int)state.range (0);
+    std::vector<char> stream (BENCHMARK_STREAM_SIZE);
+    for (size_t i = 0; i < stream.size (); i++)
+    {
+        stream[i] = (char)i;
+    }
+    std::vector<char> package (package_size + BENCHMARK_CHUNK_SIZE);
+    for (auto _ : state)
+    {
+        int num_packages = 0;
+        for (size_t pos = 0; pos < stream.size (); pos += BENCHMARK_CHUNK_SIZE)
+        {
+            int res = (int)std::min ((size_t)BENCHMARK_CHUNK_SIZE, stream.size () - pos);
+            // chunk is split between recv calls of package_size bytes like on a real socket
+            int offset = 0;
+            while (offset < res)
+            {
+                int len = std::min (package_size, res - offset);
+                num_packages += (recv_func (staging, stream.data () + pos + offset, len,
+                                     package.data (), package_size) == package_size);
+                offset += len;
+            }
+        }
+        benchmark::DoNotOptimize (num_packages);
+    }
+    state.SetBytesProcessed ((int64_t)state.iterations () * (int64_t)stream.size ());
+}
+
+static void BM_StagingQueue (benchmark::State &state)
+{
+    std::queue<char> staging;
+    run_staging (state, staging, recv_with_queue);
+}
+
+static void BM_StagingByteRing (benchmark::State &state)
+{
+    ByteRing staging;
+    run_staging (state, staging, recv_with_ring);
+}
+
+BENCHMARK (BM_StagingQueue)->Arg (33)->Arg (257);
+BENCHMARK (BM_StagingByteRing)->Arg (33)->Arg (257);
+
+#ifndef _WIN32
+// writes chunks to 127.0.0.1:port until stop is set or the connection is closed
+class LoopbackSender
+{
+    int fd;
+    std::atomic<bool> stop;
+    std::thread sender_thread;
+
+public:
+    LoopbackSender () : fd (-1), stop (false)
+    {
+    }
+
+    ~LoopbackSender ()
+    {
+        stop = true;
+        if (fd >= 0)
+        {
+            shutdown (fd, SHUT_RDWR);
+        }
+        if (sender_thread.joinable ())
+        {
+            sender_thread.join ();
+        }
+        if (fd >= 0)
+        {
+            ::close (fd);
+        }
+    }
+
+    bool connect (int port)
+    {
+        signal (SIGPIPE, SIG_IGN);
+        fd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        struct sockaddr_in addr;
+        memset (&addr, 0, sizeof (addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons (port);
+        inet_pton (AF_INET, "127.0.0.1", &addr.sin_addr);
+        if ((fd < 0) || (::connect (fd, (const struct sockaddr *)&addr, sizeof (addr)) != 0))
+        {
+            return false;
+        }
+        sender_thread = std::thread ([this] {
+            char chunk[BENCHMARK_CHUNK_SIZE];
+            for (int i = 0; i < BENCHMARK_CHUNK_SIZE; i++)
+            {
+                chunk[i] = (char)i;
+            }
+            while ((!stop) && (::send (fd, chunk, sizeof (chunk), 0) > 0))
+            {
+            }
+        });
+        return true;
+    }
+};
+
+// raw socket with the previous staging, server side of the loopback connection
+static void BM_LoopbackQueue (benchmark::State &state)
+{
+    int package_size = (int)state.range (0);
+    int server = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    struct sockaddr_in addr;
+    memset (&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = 0;
+    inet_pton (AF_INET, "127.0.0.1", &addr.sin_addr);
+    socklen_t len = sizeof (addr);
+    if ((::bind (server, (const struct sockaddr *)&addr, sizeof (addr)) != 0) ||
+        (listen (server, 1) != 0) || (getsockname (server, (struct sockaddr *)&addr, &len) != 0))
+    {
+        ::close (server);
+        state.SkipWithError ("failed to create server socket");
+        return;
+    }
+    LoopbackSender sender;
+    if (!sender.connect (ntohs (addr.sin_port)))
+    {
+        ::close (server);
+        state.SkipWithError ("failed to connect");
+        return;
+    }
+    int connected = ::accept (server, NULL, NULL);
+    std::queue<char> staging;
+    std::vector<char> package (package_size);
+    std::vector<char> received (package_size);
+    for (auto _ : state)
+    {
+        for (int total = 0; total < BENCHMARK_STREAM_SIZE;)
+        {
+            int res = (int)::recv (connected, received.data (), package_size, 0);
+            if (res <= 0)
+            {
+                state.SkipWithError ("recv failed");
+                break;
+            }
+            total +=
+                recv_with_queue (staging, received.data (), res, package.data (), package_size);
+        }
+    }
+    state.SetBytesProcessed ((int64_t)state.iterations () * BENCHMARK_STREAM_SIZE);
+    ::close (connected);
+    ::close (server);
+}
+
+static void BM_LoopbackSocketServerTCP (benchmark::State &state)
+{
+    // new port for every run to not wait for sockets in time_wait state
+    static int next_port = 17321;
+    int port = next_port++;
+    int package_size = (int)state.range (0);
+    SocketServerTCP server ("127.0.0.1", port, true);
+    if (server.bind () != (int)SocketServerTCPReturnCodes::STATUS_OK)
+    {
+        state.SkipWithError ("failed to bind");
+        return;
+    }
+    server.accept ();
+    LoopbackSender sender;
+    if (!sender.connect (port))
+    {
+        state.SkipWithError ("failed to connect");
+        return;
+    }
+    while (!server.client_connected)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    }
+    std::vector<char> package (package_size);
+    for (auto _ : state)
+    {
+        for (int total = 0; total < BENCHMARK_STREAM_SIZE;)
+        {
+            int res = server.recv (package.data (), package_size);
+            if (res < 0)
+            {
+                state.SkipWithError ("recv failed");
+                break;
+            }
+            total += res;
+        }
+    }
+    state.SetBytesProcessed ((int64_t)state.iterations () * BENCHMARK_STREAM_SIZE);
+}
+
+BENCHMARK (BM_LoopbackQueue)->Arg (33)->Arg (257)->UseRealTime ();
+BENCHMARK (BM_LoopbackSocketServerTCP)->Arg (33)->Arg (257)->UseRealTime ();
+#endif
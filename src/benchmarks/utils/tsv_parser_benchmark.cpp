@@ -0,0 +1,132 @@
+#include <random>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "tsv_parser.h"
+
+#define BENCHMARK_TSV_FILE "tsv_parser_benchmark.csv"
+#define BENCHMARK_NUM_ROWS 32
+
+
+// BRAINFLOW_BENCHMARK_TSV_FILE may point to a real recording, otherwise a synthetic 32 channel
+// recording of state.range (0) megabytes is generated in the working directory
+static std::string prepare_file (benchmark::State &state)
+{
+    const char *user_file = getenv ("BRAINFLOW_BENCHMARK_TSV_FILE");
+    if (user_file != NULL)
+    {
+        return user_file;
+    }
+    long long target_size = state.range (0) * 1024LL * 1024LL;
+    FILE *fp = fopen (BENCHMARK_TSV_FILE, "wb");
+    if (fp == NULL)
+    {
+        state.SkipWithError ("failed to create benchmark file");
+        return "";
+    }
+    std::mt19937 generator (42);
+    std::normal_distribution<double> distribution (0.0, 100.0);
+    long long written = 0;
+    for (long long package = 0; written < target_size; package++)
+    {
+        for (int i = 0; i < BENCHMARK_NUM_ROWS - 1; i++)
+        {
+            written += fprintf (fp, "%lf\t", (i == 0) ? (double)package : distribution (generator));
+        }
+        written += fprintf (fp, "%lf\n", 1700000000.0 + package / 250.0);
+    }
+    fclose (fp);
+    return BENCHMARK_TSV_FILE;
+}
+
+static void cleanup_file (const std::string &file)
+{
+    if (file == BENCHMARK_TSV_FILE)
+    {
+        remove (BENCHMARK_TSV_FILE);
+    }
+}
+
+static long long get_file_size (const std::string &file)
+{
+    FILE *fp = fopen (file.c_str (), "rb");
+    if (fp == NULL)
+    {
+        return 0;
+    }
+    fseek (fp, 0, SEEK_END);
+    long long size = (long long)ftell (fp);
+    fclose (fp);
+    return size;
+}
+
+// previous implementation of read_file and PlaybackFileBoard, kept as a baseline
+static void BM_ParseTsvStringStream (benchmark::State &state)
+{
+    std::string file = prepare_file (state);
+    long long file_size = get_file_size (file);
+    std::vector<double> values (BENCHMARK_NUM_ROWS);
+    for (auto _ : state)
+    {
+        FILE *fp = fopen (file.c_str (), "r");
+        char buf[8192];
+        while (fgets (buf, sizeof (buf), fp) != NULL)
+        {
+            std::string tsv_string (buf);
+            std::stringstream ss (tsv_string);
+            std::vector<std::string> splitted;
+            std::string tmp;
+            char sep = '\t';
+            if (tsv_string.find ('\t') == std::string::npos)
+            {
+                sep = ',';
+            }
+            while (std::getline (ss, tmp, sep))
+            {
+                if (tmp != "\n")
+                {
+                    splitted.push_back (tmp);
+                }
+            }
+            for (size_t i = 0; (i < splitted.size ()) && (i < values.size ()); i++)
+            {
+                values[i] = std::stod (splitted[i]);
+            }
+            benchmark::DoNotOptimize (values.data ());
+        }
+        fclose (fp);
+    }
+    state.SetBytesProcessed (state.iterations () * file_size);
+    cleanup_file (file);
+}
+
+static void BM_ParseTsvLineReader (benchmark::State &state)
+{
+    std::string file = prepare_file (state);
+    long long file_size = get_file_size (file);
+    std::vector<double> values (BENCHMARK_NUM_ROWS);
+    for (auto _ : state)
+    {
+        LineReader reader;
+        reader.open (file.c_str ());
+        const char *line = NULL;
+        size_t len = 0;
+        while (reader.next_line (&line, &len))
+        {
+            benchmark::DoNotOptimize (
+                parse_tsv_line (line, len, values.data (), (int)values.size ()));
+        }
+        reader.close ();
+    }
+    state.SetBytesProcessed (state.iterations () * file_size);
+    cleanup_file (file);
+}
+
+// size of generated file in MB, 1024 matches an hour long recording of a 32 channel board
+BENCHMARK (BM_ParseTsvStringStream)->Arg (64)->Arg (1024)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_ParseTsvLineReader)->Arg (64)->Arg (1024)->Unit (benchmark::kMillisecond);
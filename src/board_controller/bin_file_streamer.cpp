@@ -0,0 +1,68 @@
+#include <string.h>
+
+#include "bin_file_streamer.h"
+#include "brainflow_constants.h"
+
+
+BinFileStreamer::BinFileStreamer (const char *file, const char *file_mode, int data_len,
+    int board_id, int preset, int sampling_rate)
+    : Streamer (data_len, "file_bin", file, file_mode)
+{
+    strncpy (this->file, file, BRAINFLOW_FILE_NAME_LIMIT - 1);
+    this->file[BRAINFLOW_FILE_NAME_LIMIT - 1] = '\0';
+    strncpy (this->file_mode, file_mode, BRAINFLOW_FILE_NAME_LIMIT - 1);
+    this->file_mode[BRAINFLOW_FILE_NAME_LIMIT - 1] = '\0';
+    this->board_id = board_id;
+    this->preset = preset;
+    this->sampling_rate = sampling_rate;
+    block = NULL;
+    block_size = (sampling_rate > 0) ? sampling_rate : DEFAULT_BIN_FILE_BLOCK_SIZE;
+    num_block_samples = 0;
+}
+
+BinFileStreamer::~BinFileStreamer ()
+{
+    flush_block ();
+    writer.close ();
+    delete[] block;
+    block = NULL;
+}
+
+int BinFileStreamer::init_streamer ()
+{
+    int res = writer.open (file, file_mode, board_id, preset, len, (double)sampling_rate);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    block = new double[len * block_size];
+    num_block_samples = 0;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void BinFileStreamer::write_packages (double *packages, int num_packages)
+{
+    for (int package = 0; package < num_packages; package++)
+    {
+        double *data = packages + package * len;
+        for (int i = 0; i < len; i++)
+        {
+            block[i * block_size + num_block_samples] = data[i];
+        }
+        num_block_samples++;
+        if (num_block_samples == block_size)
+        {
+            flush_block ();
+        }
+    }
+}
+
+void BinFileStreamer::flush_block ()
+{
+    if ((block == NULL) || (num_block_samples == 0))
+    {
+        return;
+    }
+    writer.write_block (block, num_block_samples, block_size);
+    num_block_samples = 0;
+}
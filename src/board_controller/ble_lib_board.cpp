@@ -1,10 +1,12 @@
 #include <string.h>
 #include <string>
+#include <vector>
 
 #include "ble_lib_board.h"
 
 #include "bluetooth_types.h"
 #include "get_dll_dir.h"
+#include "timestamp.h"
 
 #ifndef STATIC_SIMPLEBLE
 DLLLoader *BLELibBoard::dll_loader = NULL;
@@ -17,12 +19,81 @@ std::mutex BLELibBoard::mutex;
 #endif
 
 BLELibBoard::BLELibBoard (int board_id, struct BrainFlowInputParams params)
-    : Board (board_id, params)
+    : Board (board_id, params), keep_notification_worker (false)
 {
 }
 
 BLELibBoard::~BLELibBoard ()
 {
+    stop_notification_worker ();
+}
+
+int BLELibBoard::start_notification_worker ()
+{
+    if (notification_thread.joinable ())
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    if (!notification_queue.is_ready ())
+    {
+        safe_logger (spdlog::level::err, "failed to allocate notification queue");
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    keep_notification_worker = true;
+    notification_queue.open ();
+    notification_thread = std::thread ([this] { this->notification_worker (); });
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void BLELibBoard::stop_notification_worker ()
+{
+    if (!notification_thread.joinable ())
+    {
+        return;
+    }
+    keep_notification_worker = false;
+    notification_queue.close ();
+    notification_thread.join ();
+    uint64_t num_overflowed = notification_queue.get_num_overflowed ();
+    if (num_overflowed > 0)
+    {
+        safe_logger (spdlog::level::warn, "{} notifications were dropped, decoding is too slow",
+            num_overflowed);
+    }
+}
+
+void BLELibBoard::notification_worker ()
+{
+    std::vector<uint8_t> payload (notification_queue.get_max_size ());
+    int tag = 0;
+    double host_time = 0.0;
+    size_t size = 0;
+    while (true)
+    {
+        if (notification_queue.pop (&tag, &host_time, payload.data (), &size, 100))
+        {
+            on_notification (tag, payload.data (), size, host_time);
+        }
+        else if (!keep_notification_worker)
+        {
+            // queue is closed and drained
+            break;
+        }
+    }
+}
+
+bool BLELibBoard::queue_notification (int tag, const uint8_t *data, size_t size)
+{
+    return notification_queue.push (tag, get_timestamp (), data, size);
+}
+
+void BLELibBoard::on_notification (int tag, const uint8_t *data, size_t size, double host_time)
+{
+}
+
+uint64_t BLELibBoard::get_num_overflowed_notifications ()
+{
+    return notification_queue.get_num_overflowed ();
 }
 
 bool BLELibBoard::init_dll_loader ()
@@ -1,9 +1,12 @@
 #include <algorithm>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include "board.h"
+#include "bin_file_streamer.h"
 #include "board_controller.h"
+#include "brainflow_env_vars.h"
 #include "custom_cast.h"
 #include "file_streamer.h"
 #include "multicast_streamer.h"
@@ -78,7 +81,14 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
         safe_logger (spdlog::level::err, "invalid array size");
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
+    // held views point into buffers which are recreated here
+    if (get_num_data_views () > 0)
+    {
+        safe_logger (spdlog::level::err, "release board data views before starting the stream");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
 
+    cancel_data_waits ();
     for (auto it = dbs.begin (), next_it = it; it != dbs.end (); it = next_it)
     {
         ++next_it;
@@ -91,7 +101,9 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
         it->second.clear ();
         marker_queues.erase (it);
     }
+    preset_layouts.clear ();
     int res = (int)BrainFlowExitCodes::STATUS_OK;
+    bool channel_major = get_brainflow_channel_major_buffer ();
 
     std::vector<std::string> required_fields {
         "num_rows", "timestamp_channel", "name", "marker_channel"};
@@ -118,32 +130,39 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
         }
     }
 
-    if ((streamer_params != NULL) && (streamer_params[0] != '\0'))
+    for (auto &el : board_descr.items ())
     {
-        res = add_streamer (streamer_params, (int)BrainFlowPresets::DEFAULT_PRESET);
+        int preset_int = preset_to_int (el.key ());
+        PresetLayout layout;
+        if (layout.init (el.value ()) != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            safe_logger (spdlog::level::err, "invalid board descr for id {} and preset {}",
+                board_id, el.key ());
+            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            continue;
+        }
+        DataBuffer *db = new DataBuffer (layout.num_rows, buffer_size, channel_major);
+        if (!db->is_ready ())
+        {
+            safe_logger (
+                spdlog::level::err, "unable to prepare buffer with size {}", buffer_size);
+            delete db;
+            db = NULL;
+            res = (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+        }
+        else
+        {
+            dbs[preset_int] = db;
+            marker_queues[preset_int] = std::deque<double> ();
+            preset_layouts[preset_int] = layout;
+        }
     }
 
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (streamer_params != NULL) &&
+        (streamer_params[0] != '\0'))
     {
-        for (auto &el : board_descr.items ())
-        {
-            json board_preset = el.value ();
-            DataBuffer *db = new DataBuffer ((int)board_preset["num_rows"], buffer_size);
-            if (!db->is_ready ())
-            {
-                safe_logger (
-                    spdlog::level::err, "unable to prepare buffer with size {}", buffer_size);
-                delete db;
-                db = NULL;
-                res = (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
-            }
-            else
-            {
-                int preset_int = preset_to_int (el.key ());
-                dbs[preset_int] = db;
-                marker_queues[preset_int] = std::deque<double> ();
-            }
-        }
+        // after layouts are built, streamers read sampling rate and channels from them
+        res = add_streamer (streamer_params, (int)BrainFlowPresets::DEFAULT_PRESET);
     }
 
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
@@ -156,46 +175,112 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
 
 void Board::push_package (double *package, int preset)
 {
-    std::string preset_str = preset_to_string (preset);
-    if ((board_descr.find (preset_str) == board_descr.end ()) || (dbs.find (preset) == dbs.end ()))
+    // hot path, called for each sample from device threads, dont use json here
+    auto layout_it = preset_layouts.find (preset);
+    auto db_it = dbs.find (preset);
+    if ((layout_it == preset_layouts.end ()) || (db_it == dbs.end ()))
     {
         safe_logger (spdlog::level::err, "invalid json or push_package args, no such key");
         return;
     }
+    int marker_channel = layout_it->second.marker_channel;
 
     lock.lock ();
-    json board_preset = board_descr[preset_str];
-    try
+    auto marker_it = marker_queues.find (preset);
+    if ((marker_it == marker_queues.end ()) || (marker_it->second.empty ()))
+    {
+        package[marker_channel] = 0.0;
+    }
+    else
+    {
+        package[marker_channel] = marker_it->second.front ();
+        marker_it->second.pop_front ();
+        num_markers[preset].fetch_add (1, std::memory_order_relaxed);
+    }
+
+    if (db_it->second != NULL)
     {
-        int marker_channel = board_preset["marker_channel"];
-        if (marker_queues[preset].empty ())
+        db_it->second->add_data (package);
+    }
+    num_pushed[preset].fetch_add (1, std::memory_order_relaxed);
+    lock.unlock ();
+    data_notifier.notify ();
+    stream_packages (package, 1, preset);
+}
+
+void Board::push_packages (double *packages, int num_packages, int preset)
+{
+    // same as push_package for each row, but board lock, buffer lock and streamer wake ups are
+    // taken once per block
+    if (num_packages <= 0)
+    {
+        return;
+    }
+    auto layout_it = preset_layouts.find (preset);
+    auto db_it = dbs.find (preset);
+    if ((layout_it == preset_layouts.end ()) || (db_it == dbs.end ()))
+    {
+        safe_logger (spdlog::level::err, "invalid json or push_packages args, no such key");
+        return;
+    }
+    int num_rows = layout_it->second.num_rows;
+    int marker_channel = layout_it->second.marker_channel;
+
+    lock.lock ();
+    auto marker_it = marker_queues.find (preset);
+    for (int i = 0; i < num_packages; i++)
+    {
+        double *package = packages + i * num_rows;
+        if ((marker_it == marker_queues.end ()) || (marker_it->second.empty ()))
         {
             package[marker_channel] = 0.0;
         }
         else
         {
-            double marker = marker_queues[preset].at (0);
-            package[marker_channel] = marker;
-            marker_queues[preset].pop_front ();
+            package[marker_channel] = marker_it->second.front ();
+            marker_it->second.pop_front ();
+            num_markers[preset].fetch_add (1, std::memory_order_relaxed);
         }
     }
-    catch (...)
+
+    if (db_it->second != NULL)
     {
-        safe_logger (spdlog::level::err, "Failed to get marker channel/value");
+        db_it->second->add_data (packages, (size_t)num_packages);
     }
+    num_pushed[preset].fetch_add ((uint64_t)num_packages, std::memory_order_relaxed);
+    lock.unlock ();
+    data_notifier.notify ();
+    stream_packages (packages, num_packages, preset);
+}
 
-    if (dbs[preset] != NULL)
+void Board::stream_packages (double *packages, int num_packages, int preset)
+{
+    std::lock_guard<std::mutex> streamers_guard (streamers_mutex);
+    auto streamers_it = streamers.find (preset);
+    if (streamers_it == streamers.end ())
     {
-        dbs[preset]->add_data (package);
+        return;
     }
-    if (streamers.find (preset) != streamers.end ())
+    for (auto &streamer : streamers_it->second)
     {
-        for (auto &streamer : streamers[preset])
-        {
-            streamer->stream_data (package);
-        }
+        streamer->stream_data (packages, num_packages);
     }
-    lock.unlock ();
+}
+
+void Board::free_streamer (Streamer *streamer)
+{
+    streamer->stop_dispatch ();
+    delete streamer;
+}
+
+const PresetLayout *Board::get_preset_layout (int preset)
+{
+    auto layout_it = preset_layouts.find (preset);
+    if (layout_it == preset_layouts.end ())
+    {
+        return NULL;
+    }
+    return &layout_it->second;
 }
 
 int Board::insert_marker (double value, int preset)
@@ -218,8 +303,15 @@ int Board::insert_marker (double value, int preset)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+void Board::cancel_data_waits ()
+{
+    buffers_generation.fetch_add (1, std::memory_order_relaxed);
+    data_notifier.notify ();
+}
+
 void Board::free_packages ()
 {
+    cancel_data_waits ();
     for (auto it = dbs.begin (), next_it = it; it != dbs.end (); it = next_it)
     {
         ++next_it;
@@ -234,14 +326,18 @@ void Board::free_packages ()
         marker_queues.erase (it);
     }
 
-    for (auto it = streamers.begin (), next_it = it; it != streamers.end (); it = next_it)
+    preset_layouts.clear ();
+
+    std::map<int, std::vector<Streamer *>> old_streamers;
+    streamers_mutex.lock ();
+    old_streamers.swap (streamers);
+    streamers_mutex.unlock ();
+    for (auto &preset_streamers : old_streamers)
     {
-        ++next_it;
-        for (auto &streamer : it->second)
+        for (auto &streamer : preset_streamers.second)
         {
-            delete streamer;
+            free_streamer (streamer);
         }
-        streamers.erase (it);
     }
 }
 
@@ -257,7 +353,9 @@ int Board::add_streamer (const char *streamer_params, int preset)
     std::string streamer_type = "";
     std::string streamer_dest = "";
     std::string streamer_mods = "";
-    int res = parse_streamer_params (streamer_params, streamer_type, streamer_dest, streamer_mods);
+    std::string streamer_options = "";
+    int res = parse_streamer_params (
+        streamer_params, streamer_type, streamer_dest, streamer_mods, streamer_options);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
@@ -270,6 +368,15 @@ int Board::add_streamer (const char *streamer_params, int preset)
             streamer_dest.c_str (), streamer_mods.c_str ());
         streamer = new FileStreamer (streamer_dest.c_str (), streamer_mods.c_str (), num_rows);
     }
+    if (streamer_type == "file_bin")
+    {
+        const PresetLayout *layout = get_preset_layout (preset);
+        int sampling_rate = (layout != NULL) ? layout->sampling_rate : -1;
+        safe_logger (spdlog::level::trace, "Binary File Streamer, file: {}, mods: {}",
+            streamer_dest.c_str (), streamer_mods.c_str ());
+        streamer = new BinFileStreamer (streamer_dest.c_str (), streamer_mods.c_str (), num_rows,
+            board_id, preset, sampling_rate);
+    }
     if (streamer_type == "streaming_board")
     {
         int port = 0;
@@ -284,7 +391,25 @@ int Board::add_streamer (const char *streamer_params, int preset)
         }
         safe_logger (spdlog::level::trace, "MultiCast Streamer, ip addr: {}, port: {}",
             streamer_dest.c_str (), streamer_mods.c_str ());
-        streamer = new MultiCastStreamer (streamer_dest.c_str (), port, num_rows);
+        PresetLayout layout;
+        res = layout.init (board_descr[preset_str]);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+        // counters, markers and other channels like unix time of galea are not signals, compact
+        // encodings must not quantize them
+        std::vector<int> exact_rows = layout.other_channels;
+        if (layout.package_num_channel >= 0)
+        {
+            exact_rows.push_back (layout.package_num_channel);
+        }
+        if (layout.marker_channel >= 0)
+        {
+            exact_rows.push_back (layout.marker_channel);
+        }
+        streamer = new MultiCastStreamer (streamer_dest.c_str (), port, num_rows, preset,
+            layout.timestamp_channel, exact_rows);
     }
     if (streamer_type == "plotjuggler_udp")
     {
@@ -310,18 +435,31 @@ int Board::add_streamer (const char *streamer_params, int preset)
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    res = streamer->init_streamer ();
+    BackpressurePolicy policy = streamer->get_default_policy ();
+    size_t queue_size = DEFAULT_STREAMER_QUEUE_SIZE;
+    res = parse_streamer_options (streamer_options, streamer, policy, queue_size);
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = streamer->init_streamer ();
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            safe_logger (spdlog::level::err, "failed to init streamer");
+        }
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = streamer->start_dispatch (policy, queue_size);
+    }
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        safe_logger (spdlog::level::err, "failed to init streamer");
-        delete streamer;
+        free_streamer (streamer);
         streamer = NULL;
     }
     else
     {
-        lock.lock ();
+        streamers_mutex.lock ();
         streamers[preset].push_back (streamer);
-        lock.unlock ();
+        streamers_mutex.unlock ();
     }
 
     return res;
@@ -337,7 +475,9 @@ int Board::delete_streamer (const char *streamer_params, int preset)
     std::string streamer_type = "";
     std::string streamer_dest = "";
     std::string streamer_mods = "";
-    int res = parse_streamer_params (streamer_params, streamer_type, streamer_dest, streamer_mods);
+    std::string streamer_options = "";
+    int res = parse_streamer_params (
+        streamer_params, streamer_type, streamer_dest, streamer_mods, streamer_options);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
@@ -349,10 +489,12 @@ int Board::delete_streamer (const char *streamer_params, int preset)
     {
         if ((*it)->check_equals (streamer_type, streamer_dest, streamer_mods))
         {
-            lock.lock ();
-            delete *it;
+            Streamer *streamer = *it;
+            streamers_mutex.lock ();
             it = streamers[preset].erase (it);
-            lock.unlock ();
+            streamers_mutex.unlock ();
+            // flush queued packages outside of the streamers lock
+            free_streamer (streamer);
             res = (int)BrainFlowExitCodes::STATUS_OK;
             safe_logger (spdlog::level::info, "streamer {} removed", streamer_params);
             break;
@@ -371,7 +513,7 @@ int Board::delete_streamer (const char *streamer_params, int preset)
 }
 
 int Board::parse_streamer_params (const char *streamer_params, std::string &streamer_type,
-    std::string &streamer_dest, std::string &streamer_mods)
+    std::string &streamer_dest, std::string &streamer_mods, std::string &streamer_options)
 {
     if ((streamer_params == NULL) || (streamer_params[0] == '\0'))
     {
@@ -397,10 +539,87 @@ int Board::parse_streamer_params (const char *streamer_params, std::string &stre
     streamer_type = streamer_params_str.substr (0, idx1);
     streamer_dest = streamer_params_str.substr (idx1 + 3, idx2 - idx1 - 3);
     streamer_mods = streamer_params_str.substr (idx2 + 1);
+    // optional dispatch settings, e.g. streaming_board://225.1.1.1:6677?backpressure=drop_newest,
+    // options unknown here are passed to the streamer, e.g. encoding=int24 for streaming_board
+    size_t idx3 = streamer_mods.find ('?');
+    streamer_options = "";
+    if (idx3 != std::string::npos)
+    {
+        streamer_options = streamer_mods.substr (idx3 + 1);
+        streamer_mods = streamer_mods.substr (0, idx3);
+    }
 
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int Board::parse_streamer_options (const std::string &streamer_options, Streamer *streamer,
+    BackpressurePolicy &policy, size_t &queue_size)
+{
+    std::stringstream ss (streamer_options);
+    std::string option;
+    while (std::getline (ss, option, '&'))
+    {
+        if (option.empty ())
+        {
+            continue;
+        }
+        size_t idx = option.find ('=');
+        std::string key = option.substr (0, idx);
+        std::string value = (idx == std::string::npos) ? "" : option.substr (idx + 1);
+        if (key == "backpressure")
+        {
+            if (value == "drop_oldest")
+            {
+                policy = BackpressurePolicy::DROP_OLDEST;
+            }
+            else if (value == "drop_newest")
+            {
+                policy = BackpressurePolicy::DROP_NEWEST;
+            }
+            else if (value == "block")
+            {
+                policy = BackpressurePolicy::BLOCK;
+            }
+            else
+            {
+                safe_logger (spdlog::level::err, "unsupported backpressure policy {}", value);
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+            if ((policy != BackpressurePolicy::BLOCK) && (streamer->is_lossless ()))
+            {
+                safe_logger (
+                    spdlog::level::err, "backpressure {} would drop recorded packages", value);
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+        }
+        else if (key == "queue_size")
+        {
+            int parsed_size = 0;
+            try
+            {
+                parsed_size = std::stoi (value);
+            }
+            catch (const std::exception &e)
+            {
+                safe_logger (spdlog::level::err, e.what ());
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+            if ((parsed_size <= 0) || (parsed_size > MAX_CAPTURE_SAMPLES))
+            {
+                safe_logger (spdlog::level::err, "invalid streamer queue size {}", parsed_size);
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+            queue_size = (size_t)parsed_size;
+        }
+        else if (streamer->set_option (key, value) != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            safe_logger (spdlog::level::err, "unsupported streamer option {}={}", key, value);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int Board::get_current_board_data (
     int num_samples, int preset, double *data_buf, int *returned_samples)
 {
@@ -420,17 +639,13 @@ int Board::get_current_board_data (
     {
         return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
     }
-    if ((!data_buf) || (!returned_samples))
+    if ((!data_buf) || (!returned_samples) || (num_samples < 0))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
-
-    double *buf = new double[num_samples * num_rows];
-    int num_data_points = (int)dbs[preset]->get_current_data (num_samples, buf);
-    reshape_data (num_data_points, preset, buf, data_buf);
-    delete[] buf;
+    // DataBuffer writes channel major output directly to data_buf, no reshape pass needed
+    int num_data_points = (int)dbs[preset]->get_current_data (num_samples, data_buf, true);
     *returned_samples = num_data_points;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -456,6 +671,51 @@ int Board::get_board_data_count (int preset, int *result)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int Board::prepare_data_wait (int min_samples, int preset, DataWaitTarget *target)
+{
+    if ((min_samples < 0) || (target == NULL))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int data_count = 0;
+    int res = get_board_data_count (preset, &data_count);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    // counters are read after the count, packages pushed in between are counted twice and wake
+    // the waiter a bit earlier which is harmless
+    target->preset = preset;
+    target->num_pushed = num_pushed[preset].load (std::memory_order_acquire);
+    if (min_samples > data_count)
+    {
+        target->num_pushed += (uint64_t)(min_samples - data_count);
+    }
+    target->num_markers = num_markers[preset].load (std::memory_order_acquire);
+    target->buffers_generation = buffers_generation.load (std::memory_order_acquire);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::wait_for_data (const DataWaitTarget &target, int timeout_ms)
+{
+    int preset = target.preset;
+    auto is_ready = [this, &target, preset] () {
+        return (num_pushed[preset].load (std::memory_order_acquire) >= target.num_pushed) ||
+            (num_markers[preset].load (std::memory_order_acquire) != target.num_markers) ||
+            (buffers_generation.load (std::memory_order_acquire) != target.buffers_generation);
+    };
+    if ((!is_ready ()) && (!data_notifier.wait_for (timeout_ms, is_ready)))
+    {
+        return (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR;
+    }
+    if (buffers_generation.load (std::memory_order_acquire) != target.buffers_generation)
+    {
+        // session was released or stream was restarted while waiting
+        return (int)BrainFlowExitCodes::BOARD_NOT_READY_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int Board::get_board_data (int data_count, int preset, double *data_buf)
 {
     std::string preset_str = preset_to_string (preset);
@@ -474,30 +734,103 @@ int Board::get_board_data (int data_count, int preset, double *data_buf)
     {
         return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
     }
-    if (!data_buf)
+    if ((!data_buf) || (data_count < 0))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
-    double *buf = new double[data_count * num_rows];
-    int num_data_points = (int)dbs[preset]->get_data (data_count, buf);
-    reshape_data (num_data_points, preset, buf, data_buf);
-    delete[] buf;
+    // like before, data_count larger than available is clamped and rows are packed with stride of
+    // the clamped count, callers get it from get_board_data_count
+    int num_requested = std::min (data_count, (int)dbs[preset]->get_data_count ());
+    int num_data_points = (int)dbs[preset]->get_data (num_requested, data_buf, true);
+    if (num_data_points != num_requested)
+    {
+        safe_logger (spdlog::level::err,
+            "{} of {} samples were removed by another reader during the copy",
+            num_requested - num_data_points, num_requested);
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-void Board::reshape_data (int data_count, int preset, const double *buf, double *output_buf)
+int Board::acquire_board_data_view (int max_samples, int preset, double **first_span,
+    int *first_span_len, double **second_span, int *second_span_len, int *channel_stride,
+    int *sample_stride)
 {
-    std::string preset_str = preset_to_string (preset);
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
+    auto db_it = dbs.find (preset);
+    if (db_it == dbs.end ())
+    {
+        safe_logger (spdlog::level::err,
+            "stream is not started or no preset: {} found for this board", preset);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (!db_it->second)
+    {
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    }
+    if ((!first_span) || (!first_span_len) || (!second_span) || (!second_span_len) ||
+        (!channel_stride) || (!sample_stride) || (max_samples < 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (db_it->second->has_view ())
+    {
+        safe_logger (spdlog::level::err, "previous view for preset {} is not released", preset);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    size_t first_len = 0;
+    size_t second_len = 0;
+    size_t ch_stride = 0;
+    size_t smpl_stride = 0;
+    *first_span = NULL;
+    *second_span = NULL;
+    db_it->second->acquire_view ((size_t)max_samples, first_span, &first_len, second_span,
+        &second_len, &ch_stride, &smpl_stride);
+    *first_span_len = (int)first_len;
+    *second_span_len = (int)second_len;
+    *channel_stride = (int)ch_stride;
+    *sample_stride = (int)smpl_stride;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::release_board_data_view (int preset)
+{
+    auto db_it = dbs.find (preset);
+    if ((db_it == dbs.end ()) || (!db_it->second))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    db_it->second->release_view ();
+    uint64_t num_dropped = db_it->second->reset_num_dropped ();
+    if (num_dropped > 0)
+    {
+        safe_logger (spdlog::level::warn,
+            "{} samples for preset {} were dropped while the view was held", num_dropped, preset);
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    for (int i = 0; i < data_count; i++)
+int Board::get_num_data_views ()
+{
+    int num_views = 0;
+    for (auto &db : dbs)
     {
-        for (int j = 0; j < num_rows; j++)
+        if ((db.second) && (db.second->has_view ()))
         {
-            output_buf[j * data_count + i] = buf[i * num_rows + j];
+            num_views++;
         }
     }
+    return num_views;
+}
+
+void Board::log_clock_stats (TimestampEstimator &timestamps, double host_time, int preset)
+{
+    if (timestamps.is_stats_due (host_time))
+    {
+        safe_logger (spdlog::level::debug, "{} preset clock drift {:.1f} ppm, offset {:.6f}",
+            preset_to_string (preset), timestamps.get_drift () * 1000000.0,
+            timestamps.get_offset ());
+    }
 }
 
 std::string Board::preset_to_string (int preset)
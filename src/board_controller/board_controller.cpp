@@ -7,12 +7,14 @@
 #endif
 
 #include <algorithm>
+#include <climits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "aavaa_v3.h"
 #include "ant_neuro.h"
@@ -66,13 +68,41 @@
 using json = nlohmann::json;
 
 
-std::map<std::pair<int, struct BrainFlowInputParams>, std::shared_ptr<Board>> boards;
+#define MAX_BOARD_SESSIONS 1024
+#define MAX_SESSION_GENERATION (INT_MAX / MAX_BOARD_SESSIONS)
+
+// session handle is generation * MAX_BOARD_SESSIONS + slot, generation changes every time the slot
+// is reused so stale handles are rejected
+struct BoardSession
+{
+    // serializes calls to this board only, independent boards never contend
+    std::mutex lock;
+    // guarded by lock, NULL until prepare_session succeeds and after release_session
+    std::shared_ptr<Board> board;
+    // guarded by lock
+    int generation;
+    // guarded by global mutex
+    bool in_use;
+    std::pair<int, struct BrainFlowInputParams> key;
+
+    BoardSession () : generation (0), in_use (false)
+    {
+    }
+};
+
+// maps board id and input params to session handle
+std::map<std::pair<int, struct BrainFlowInputParams>, int> boards;
+BoardSession sessions[MAX_BOARD_SESSIONS];
+// guards boards map and allocation of slots, not held while a board method is called
 std::mutex mutex;
 
 std::pair<int, struct BrainFlowInputParams> get_key (
     int board_id, struct BrainFlowInputParams params);
-static int check_board_session (int board_id, const char *json_brainflow_input_params,
-    std::pair<int, struct BrainFlowInputParams> &key, bool log_error = true);
+static std::shared_ptr<Board> create_board (int board_id, struct BrainFlowInputParams params);
+static int lock_board_session (
+    int handle, std::unique_lock<std::mutex> &session_lock, Board **board);
+static int release_board_session (int handle, std::unique_lock<std::mutex> &session_lock);
+static void free_session_slot (int slot);
 static int string_to_brainflow_input_params (
     const char *json_brainflow_input_params, struct BrainFlowInputParams *params);
 static int copy_string_to_buffer (
@@ -81,7 +111,17 @@ static int copy_string_to_buffer (
 
 int prepare_session (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    return prepare_session_with_handle (board_id, json_brainflow_input_params, &handle);
+}
+
+int prepare_session_with_handle (
+    int board_id, const char *json_brainflow_input_params, int *handle)
+{
+    if (handle == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
 
     Board::board_logger->info ("incoming json: {}", json_brainflow_input_params);
     struct BrainFlowInputParams params;
@@ -91,14 +131,61 @@ int prepare_session (int board_id, const char *json_brainflow_input_params)
         return res;
     }
 
+    // reserve slot for this key, board is prepared without holding the global lock
     std::pair<int, struct BrainFlowInputParams> key = get_key (board_id, params);
-    if (boards.find (key) != boards.end ())
+    int slot = -1;
+    int new_handle = 0;
     {
-        Board::board_logger->error (
-            "Board with id {} and the same config already exists", board_id);
-        return (int)BrainFlowExitCodes::ANOTHER_BOARD_IS_CREATED_ERROR;
+        std::lock_guard<std::mutex> lock (mutex);
+        if (boards.find (key) != boards.end ())
+        {
+            Board::board_logger->error (
+                "Board with id {} and the same config already exists", board_id);
+            return (int)BrainFlowExitCodes::ANOTHER_BOARD_IS_CREATED_ERROR;
+        }
+        for (int i = 0; i < MAX_BOARD_SESSIONS; i++)
+        {
+            if (!sessions[i].in_use)
+            {
+                slot = i;
+                break;
+            }
+        }
+        if (slot < 0)
+        {
+            Board::board_logger->error ("too many board sessions, max is {}", MAX_BOARD_SESSIONS);
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        std::lock_guard<std::mutex> session_lock (sessions[slot].lock);
+        sessions[slot].generation = (sessions[slot].generation % MAX_SESSION_GENERATION) + 1;
+        sessions[slot].in_use = true;
+        sessions[slot].key = key;
+        new_handle = sessions[slot].generation * MAX_BOARD_SESSIONS + slot;
+        boards[key] = new_handle;
+    }
+
+    std::shared_ptr<Board> board = create_board (board_id, params);
+    if (board == NULL)
+    {
+        free_session_slot (slot);
+        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
+    }
+    Board::board_logger->trace ("Board object created {}", board->get_board_id ());
+    res = board->prepare_session ();
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        board = NULL;
+        free_session_slot (slot);
+        return res;
     }
+    std::lock_guard<std::mutex> session_lock (sessions[slot].lock);
+    sessions[slot].board = board;
+    *handle = new_handle;
+    return res;
+}
 
+static std::shared_ptr<Board> create_board (int board_id, struct BrainFlowInputParams params)
+{
     std::shared_ptr<Board> board = NULL;
     switch (static_cast<BoardIds> (board_id))
     {
@@ -319,27 +406,44 @@ int prepare_session (int board_id, const char *json_brainflow_input_params)
             board = std::shared_ptr<Board> (new Shimmer3 (params));
             break;
         default:
-            return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
+            break;
     }
-    Board::board_logger->trace ("Board object created {}", board->get_board_id ());
-    res = board->prepare_session ();
+    return board;
+}
+
+int get_session_handle (int board_id, const char *json_brainflow_input_params, int *handle)
+{
+    if (handle == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    struct BrainFlowInputParams params;
+    int res = string_to_brainflow_input_params (json_brainflow_input_params, &params);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        board = NULL;
+        return res;
     }
-    else
+
+    std::lock_guard<std::mutex> lock (mutex);
+    auto board_it = boards.find (get_key (board_id, params));
+    if (board_it == boards.end ())
     {
-        boards[key] = board;
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
-    return res;
+    *handle = board_it->second;
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int is_prepared (int *prepared, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        std::unique_lock<std::mutex> session_lock;
+        Board *board = NULL;
+        res = lock_board_session (handle, session_lock, &board);
+    }
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
         *prepared = 1;
@@ -355,125 +459,309 @@ int is_prepared (int *prepared, int board_id, const char *json_brainflow_input_p
 int start_stream (int buffer_size, const char *streamer_params, int board_id,
     const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return start_stream_by_handle (buffer_size, streamer_params, handle);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int start_stream_by_handle (int buffer_size, const char *streamer_params, int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->start_stream (buffer_size, streamer_params);
+    return board->start_stream (buffer_size, streamer_params);
 }
 
 int stop_stream (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return stop_stream_by_handle (handle);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int stop_stream_by_handle (int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->stop_stream ();
+    return board->stop_stream ();
 }
 
 int insert_marker (double value, int preset, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return insert_marker_by_handle (value, preset, handle);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int insert_marker_by_handle (double value, int preset, int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->insert_marker (value, preset);
+    return board->insert_marker (value, preset);
 }
 
 int release_session (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return release_session_by_handle (handle);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int release_session_by_handle (int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    res = board_it->second->release_session ();
-    boards.erase (board_it);
-    return res;
+    // views point into ring buffers of this board
+    if (board->get_num_data_views () > 0)
+    {
+        Board::board_logger->error ("release board data views before releasing the session");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return release_board_session (handle, session_lock);
 }
 
 int get_current_board_data (int num_samples, int preset, double *data_buf, int *returned_samples,
     int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return get_current_board_data_by_handle (
+        num_samples, preset, data_buf, returned_samples, handle);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int get_current_board_data_by_handle (
+    int num_samples, int preset, double *data_buf, int *returned_samples, int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_current_board_data (
-        num_samples, preset, data_buf, returned_samples);
+    return board->get_current_board_data (num_samples, preset, data_buf, returned_samples);
 }
 
 int get_board_data_count (
     int preset, int *result, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return get_board_data_count_by_handle (preset, result, handle);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int get_board_data_count_by_handle (int preset, int *result, int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_board_data_count (preset, result);
+    return board->get_board_data_count (preset, result);
+}
+
+int wait_for_board_data (int min_samples, int timeout_ms, int preset, int *data_count,
+    int board_id, const char *json_brainflow_input_params)
+{
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return wait_for_board_data_by_handle (min_samples, timeout_ms, preset, data_count, handle);
+}
+
+int wait_for_board_data_by_handle (
+    int min_samples, int timeout_ms, int preset, int *data_count, int handle)
+{
+    if ((min_samples < 0) || (timeout_ms < 0) || (data_count == NULL))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    // session lock is not held while waiting, otherwise other calls for this board would block,
+    // shared_ptr keeps board alive if session is released meanwhile
+    std::shared_ptr<Board> board_ptr;
+    Board::DataWaitTarget target;
+    {
+        std::unique_lock<std::mutex> session_lock;
+        Board *board = NULL;
+        int res = lock_board_session (handle, session_lock, &board);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+        res = board->prepare_data_wait (min_samples, preset, &target);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+        board_ptr = sessions[handle % MAX_BOARD_SESSIONS].board;
+    }
+    int wait_res = board_ptr->wait_for_data (target, timeout_ms);
+    board_ptr.reset ();
+    if ((wait_res != (int)BrainFlowExitCodes::STATUS_OK) &&
+        (wait_res != (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR))
+    {
+        return wait_res;
+    }
+    // report count on timeout too, caller may decide to take what is there
+    int res = get_board_data_count_by_handle (preset, data_count, handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return wait_res;
 }
 
 int get_board_data (int data_count, int preset, double *data_buf, int board_id,
     const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return get_board_data_by_handle (data_count, preset, data_buf, handle);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int get_board_data_by_handle (int data_count, int preset, double *data_buf, int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_board_data (data_count, preset, data_buf);
+    return board->get_board_data (data_count, preset, data_buf);
+}
+
+int acquire_board_data_view (int max_samples, int preset, double **first_span,
+    int *first_span_len, double **second_span, int *second_span_len, int *channel_stride,
+    int *sample_stride, int board_id, const char *json_brainflow_input_params)
+{
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return acquire_board_data_view_by_handle (max_samples, preset, first_span, first_span_len,
+        second_span, second_span_len, channel_stride, sample_stride, handle);
+}
+
+int acquire_board_data_view_by_handle (int max_samples, int preset, double **first_span,
+    int *first_span_len, double **second_span, int *second_span_len, int *channel_stride,
+    int *sample_stride, int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return board->acquire_board_data_view (max_samples, preset, first_span, first_span_len,
+        second_span, second_span_len, channel_stride, sample_stride);
+}
+
+int release_board_data_view (int preset, int board_id, const char *json_brainflow_input_params)
+{
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return release_board_data_view_by_handle (preset, handle);
+}
+
+int release_board_data_view_by_handle (int preset, int handle)
+{
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return board->release_board_data_view (preset);
 }
 
 int get_board_sampling_rate (
     int preset, int *sampling_rate, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return get_board_sampling_rate_by_handle (preset, sampling_rate, handle);
+}
+
+int get_board_sampling_rate_by_handle (int preset, int *sampling_rate, int handle)
+{
     if (sampling_rate == NULL)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    int value = board_it->second->get_board_sampling_rate (preset);
+    int value = board->get_board_sampling_rate (preset);
     if (value <= 0)
     {
         return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
@@ -534,22 +822,33 @@ int java_set_jnienv (JNIEnv *java_jnienv)
 int config_board (const char *config, char *response, int *response_len, int response_max_len,
     int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return config_board_by_handle (config, response, response_len, response_max_len, handle);
+}
+
+int config_board_by_handle (
+    const char *config, char *response, int *response_len, int response_max_len, int handle)
+{
     if ((config == NULL) || (response == NULL) || (response_len == NULL) || (response_max_len < 1))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
     std::string conf = config;
     std::string resp = "";
-    res = board_it->second->config_board (conf, resp);
+    res = board->config_board (conf, resp);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
         res = copy_string_to_buffer (resp, response, response_len, response_max_len);
@@ -560,39 +859,54 @@ int config_board (const char *config, char *response, int *response_len, int res
 int config_board_with_bytes (
     const char *bytes, int len, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if ((bytes == NULL) || (len < 1))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->config_board_with_bytes (bytes, len);
+    return board->config_board_with_bytes (bytes, len);
 }
 
 int add_streamer (
     const char *streamer, int preset, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return add_streamer_by_handle (streamer, preset, handle);
+}
+
+int add_streamer_by_handle (const char *streamer, int preset, int handle)
+{
     if (streamer == NULL)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->add_streamer (streamer, preset);
+    return board->add_streamer (streamer, preset);
 }
 
 static int copy_string_to_buffer (
@@ -619,34 +933,65 @@ static int copy_string_to_buffer (
 int delete_streamer (
     const char *streamer, int preset, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int handle = 0;
+    int res = get_session_handle (board_id, json_brainflow_input_params, &handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return delete_streamer_by_handle (streamer, preset, handle);
+}
+
+int delete_streamer_by_handle (const char *streamer, int preset, int handle)
+{
     if (streamer == NULL)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::unique_lock<std::mutex> session_lock;
+    Board *board = NULL;
+    int res = lock_board_session (handle, session_lock, &board);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->delete_streamer (streamer, preset);
+    return board->delete_streamer (streamer, preset);
 }
 
 int release_all_sessions ()
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    std::vector<int> handles;
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        for (auto it = boards.begin (); it != boards.end (); ++it)
+        {
+            handles.push_back (it->second);
+        }
+    }
 
-    for (auto it = boards.begin (), next_it = it; it != boards.end (); it = next_it)
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    for (int handle : handles)
     {
-        ++next_it;
-        it->second->release_session ();
-        boards.erase (it);
+        std::unique_lock<std::mutex> session_lock;
+        Board *board = NULL;
+        if (lock_board_session (handle, session_lock, &board) !=
+            (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            continue;
+        }
+        // sessions with held views are kept, other sessions are released anyway
+        if (board->get_num_data_views () > 0)
+        {
+            Board::board_logger->error (
+                "session {} has unreleased board data views, it is not released", handle);
+            res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            continue;
+        }
+        release_board_session (handle, session_lock);
     }
 
-    return (int)BrainFlowExitCodes::STATUS_OK;
+    return res;
 }
 
 int get_version_board_controller (char *version, int *num_chars, int max_chars)
@@ -667,30 +1012,41 @@ std::pair<int, struct BrainFlowInputParams> get_key (
     return key;
 }
 
-int check_board_session (int board_id, const char *json_brainflow_input_params,
-    std::pair<int, struct BrainFlowInputParams> &key, bool log_error)
+int lock_board_session (int handle, std::unique_lock<std::mutex> &session_lock, Board **board)
 {
-    struct BrainFlowInputParams params;
-    int res = string_to_brainflow_input_params (json_brainflow_input_params, &params);
-    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    if (handle < 0)
     {
-        return res;
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
-
-    key = get_key (board_id, params);
-
-    if (boards.find (key) == boards.end ())
+    int slot = handle % MAX_BOARD_SESSIONS;
+    int generation = handle / MAX_BOARD_SESSIONS;
+    session_lock = std::unique_lock<std::mutex> (sessions[slot].lock);
+    if ((sessions[slot].board == NULL) || (sessions[slot].generation != generation))
     {
-        if (log_error)
-        {
-            Board::board_logger->error (
-                "Board with id {} and port provided config is not created", key.first);
-        }
+        session_lock.unlock ();
         return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
+    *board = sessions[slot].board.get ();
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int release_board_session (int handle, std::unique_lock<std::mutex> &session_lock)
+{
+    int slot = handle % MAX_BOARD_SESSIONS;
+    int res = sessions[slot].board->release_session ();
+    sessions[slot].board = NULL;
+    session_lock.unlock ();
+    free_session_slot (slot);
+    return res;
+}
+
+void free_session_slot (int slot)
+{
+    std::lock_guard<std::mutex> lock (mutex);
+    boards.erase (sessions[slot].key);
+    sessions[slot].in_use = false;
+}
+
 int string_to_brainflow_input_params (
     const char *json_brainflow_input_params, struct BrainFlowInputParams *params)
 {
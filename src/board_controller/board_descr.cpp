@@ -0,0 +1,84 @@
+#include <stddef.h>
+
+#include "brainflow_boards.h"
+#include "brainflow_constants.h"
+
+
+struct IntField
+{
+    const char *name;
+    int BoardPresetDescr::*value;
+};
+
+struct ChannelsField
+{
+    const char *name;
+    ChannelList BoardPresetDescr::*value;
+};
+
+static const IntField int_fields[] = {{"sampling_rate", &BoardPresetDescr::sampling_rate},
+    {"package_num_channel", &BoardPresetDescr::package_num_channel},
+    {"timestamp_channel", &BoardPresetDescr::timestamp_channel},
+    {"marker_channel", &BoardPresetDescr::marker_channel},
+    {"battery_channel", &BoardPresetDescr::battery_channel},
+    {"num_rows", &BoardPresetDescr::num_rows}};
+
+static const ChannelsField channels_fields[] = {{"eeg_channels", &BoardPresetDescr::eeg_channels},
+    {"emg_channels", &BoardPresetDescr::emg_channels},
+    {"ecg_channels", &BoardPresetDescr::ecg_channels},
+    {"eog_channels", &BoardPresetDescr::eog_channels},
+    {"eda_channels", &BoardPresetDescr::eda_channels},
+    {"ppg_channels", &BoardPresetDescr::ppg_channels},
+    {"optical_channels", &BoardPresetDescr::optical_channels},
+    {"accel_channels", &BoardPresetDescr::accel_channels},
+    {"rotation_channels", &BoardPresetDescr::rotation_channels},
+    {"analog_channels", &BoardPresetDescr::analog_channels},
+    {"gyro_channels", &BoardPresetDescr::gyro_channels},
+    {"other_channels", &BoardPresetDescr::other_channels},
+    {"temperature_channels", &BoardPresetDescr::temperature_channels},
+    {"resistance_channels", &BoardPresetDescr::resistance_channels},
+    {"magnetometer_channels", &BoardPresetDescr::magnetometer_channels}};
+
+static const char *preset_names[BOARD_DESCR_NUM_PRESETS] = {"default", "auxiliary", "ancillary"};
+
+
+json preset_descr_to_json (const BoardPresetDescr &descr)
+{
+    json result = json::object ();
+    result["name"] = descr.name;
+    for (const IntField &field : int_fields)
+    {
+        if (descr.*field.value != BOARD_DESCR_NO_VALUE)
+        {
+            result[field.name] = descr.*field.value;
+        }
+    }
+    if (descr.eeg_names != NULL)
+    {
+        result["eeg_names"] = descr.eeg_names;
+    }
+    for (const ChannelsField &field : channels_fields)
+    {
+        const ChannelList &channels = descr.*field.value;
+        if (channels.channels != NULL)
+        {
+            result[field.name] =
+                std::vector<int> (channels.channels, channels.channels + channels.len);
+        }
+    }
+    return result;
+}
+
+json board_descr_to_json (int board_id)
+{
+    json result;
+    for (int preset = 0; preset < BOARD_DESCR_NUM_PRESETS; preset++)
+    {
+        const BoardPresetDescr *descr = get_board_preset_descr (board_id, preset);
+        if (descr != NULL)
+        {
+            result[preset_names[preset]] = preset_descr_to_json (*descr);
+        }
+    }
+    return result;
+}
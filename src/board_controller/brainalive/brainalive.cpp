@@ -2,6 +2,7 @@
 #include "custom_cast.h"
 #include "get_dll_dir.h"
 #include "timestamp.h"
+#include <algorithm>
 #include <string.h>
 
 // info about services and chars
@@ -22,17 +23,7 @@ static void brainalive_read_notifications (simpleble_peripheral_t peripheral,
     simpleble_uuid_t service, simpleble_uuid_t characteristic, const uint8_t *data, size_t size,
     void *board)
 {
-    if ((size == BrainAlive::brainalive_handshaking_packet_size) && (data[0] == START_BYTE) &&
-        (data[size - 1] == STOP_BYTE) && (data[2] == BrainAlive::brainalive_handshaking_command))
-    {
-        ((BrainAlive *)(board))->set_internal_gain (data[3]);
-        ((BrainAlive *)(board))->set_external_gain (data[4]);
-        ((BrainAlive *)(board))->set_ref_Voltage (((data[5] << 8) | data[6]));
-    }
-    else
-    {
-        ((BrainAlive *)(board))->read_data (service, characteristic, data, size, 0);
-    }
+    ((BrainAlive *)(board))->read_data (service, characteristic, data, size, 0);
 }
 
 BrainAlive::BrainAlive (struct BrainFlowInputParams params)
@@ -191,6 +182,12 @@ int BrainAlive::prepare_session ()
     }
 
     if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (control_characteristics_found))
+    {
+        default_layout.init (board_descr["default"]);
+        package_buf.resize (default_layout.num_rows);
+        res = start_notification_worker ();
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
         initialized = true;
         res = config_board ("0a036007000d");
@@ -273,6 +270,7 @@ int BrainAlive::release_session ()
                 break;
             }
         }
+        stop_notification_worker ();
         free_packages ();
         initialized = false;
     }
@@ -384,23 +382,29 @@ void BrainAlive::adapter_1_on_scan_found (
 void BrainAlive::read_data (simpleble_uuid_t service, simpleble_uuid_t characteristic,
     const uint8_t *data, size_t size, int channel_num)
 {
-    if (size == brainalive_packet_size)
+    queue_notification (channel_num, data, size);
+}
+
+void BrainAlive::on_notification (int tag, const uint8_t *data, size_t size, double host_time)
+{
+    if ((size == brainalive_handshaking_packet_size) && (data[0] == START_BYTE) &&
+        (data[size - 1] == STOP_BYTE) && (data[2] == brainalive_handshaking_command))
+    {
+        set_internal_gain (data[3]);
+        set_external_gain (data[4]);
+        set_ref_Voltage (((data[5] << 8) | data[6]));
+    }
+    else if (size == brainalive_packet_size)
     {
+        double *package = package_buf.data ();
+        const std::vector<int> &eeg_channels = default_layout.eeg_channels;
+        const std::vector<int> &accel_channels = default_layout.accel_channels;
+        const std::vector<int> &gyro_channels = default_layout.gyro_channels;
         for (int i = 0; i < (int)size; i += brainalive_single_packet_size)
         {
+            std::fill (package_buf.begin (), package_buf.end (), 0.0);
 
-            int num_rows = board_descr["default"]["num_rows"];
-            double *package = new double[num_rows];
-            for (int i = 0; i < num_rows; i++)
-            {
-                package[i] = 0.0;
-            }
-            std::vector<int> eeg_channels = board_descr["default"]["eeg_channels"];
-            std::vector<int> accel_channels = board_descr["default"]["accel_channels"];
-            std::vector<int> gyro_channels = board_descr["default"]["gyro_channels"];
-
-            package[board_descr["default"]["package_num_channel"].get<int> ()] =
-                data[brainalive_packet_index + i];
+            package[default_layout.package_num_channel] = data[brainalive_packet_index + i];
 
             for (int j = i + brainalive_eeg_Start_index, k = 0; j < i + brainalive_eeg_end_index;
                  j += 3, k++)
@@ -425,11 +429,10 @@ void BrainAlive::read_data (simpleble_uuid_t service, simpleble_uuid_t character
                 if (package[gyro_channels[k]] > 32767)
                     package[gyro_channels[k]] = package[gyro_channels[k]] - 65535;
             }
-            package[board_descr["default"]["marker_channel"].get<int> ()] =
-                data[(brainalive_packet_index + 1) + i];
-            package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+            package[default_layout.marker_channel] = data[(brainalive_packet_index + 1) + i];
+            package[default_layout.timestamp_channel] = host_time;
 
-            push_package (&package[0]);
+            push_package (package);
         }
     }
     else
@@ -1,10 +1,12 @@
 #include <condition_variable>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "ble_lib_board.h"
 #include "board.h"
 #include "board_controller.h"
+#include "preset_layout.h"
 
 class BrainAlive : public BLELibBoard
 {
@@ -94,4 +96,9 @@ protected:
     std::condition_variable cv;
     std::pair<simpleble_uuid_t, simpleble_uuid_t> notified_characteristics;
     std::pair<simpleble_uuid_t, simpleble_uuid_t> write_characteristics;
+    // built in prepare_session, notifications are decoded without json lookups
+    PresetLayout default_layout;
+    std::vector<double> package_buf;
+
+    void on_notification (int tag, const uint8_t *data, size_t size, double host_time) override;
 };
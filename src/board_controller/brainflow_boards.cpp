@@ -1,1222 +1,734 @@
+// Generated by tools/generate_board_descr.py from brainflow_boards.jsonc, do not edit
+
+#include <stddef.h>
+
 #include "brainflow_boards.h"
 
+#define MIN_BOARD_ID -3
+#define NUM_BOARD_IDS 72
+
 // clang-format off
 
-BrainFlowBoards::BrainFlowBoards()
-{
+static constexpr int board_m1_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_m1_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_m1_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_m1_default_eog_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_m1_default_eda_channels[] = {23};
+static constexpr int board_m1_default_ppg_channels[] = {24, 25};
+static constexpr int board_m1_default_accel_channels[] = {17, 18, 19};
+static constexpr int board_m1_default_gyro_channels[] = {20, 21, 22};
+static constexpr int board_m1_default_temperature_channels[] = {26};
+static constexpr int board_m1_default_resistance_channels[] = {27, 28};
+static constexpr int board_m1_auxiliary_eda_channels[] = {8};
+static constexpr int board_m1_auxiliary_ppg_channels[] = {9, 10};
+static constexpr int board_m1_auxiliary_accel_channels[] = {2, 3, 4};
+static constexpr int board_m1_auxiliary_gyro_channels[] = {5, 6, 7};
+static constexpr int board_m1_auxiliary_other_channels[] = {14, 15, 16, 17};
+static constexpr int board_m1_auxiliary_temperature_channels[] = {11};
+static constexpr int board_m1_auxiliary_resistance_channels[] = {12, 13};
+static constexpr int board_0_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_0_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_0_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_0_default_eog_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_0_default_accel_channels[] = {9, 10, 11};
+static constexpr int board_0_default_analog_channels[] = {19, 20, 21};
+static constexpr int board_0_default_other_channels[] = {12, 13, 14, 15, 16, 17, 18};
+static constexpr int board_1_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_1_default_emg_channels[] = {1, 2, 3, 4};
+static constexpr int board_1_default_ecg_channels[] = {1, 2, 3, 4};
+static constexpr int board_1_default_eog_channels[] = {1, 2, 3, 4};
+static constexpr int board_1_default_accel_channels[] = {5, 6, 7};
+static constexpr int board_1_default_resistance_channels[] = {8, 9, 10, 11, 12};
+static constexpr int board_2_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_2_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_2_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_2_default_eog_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_2_default_accel_channels[] = {17, 18, 19};
+static constexpr int board_2_default_analog_channels[] = {27, 28, 29};
+static constexpr int board_2_default_other_channels[] = {20, 21, 22, 23, 24, 25, 26};
+static constexpr int board_3_default_eeg_channels[] = {9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24};
+static constexpr int board_3_default_emg_channels[] = {1, 2, 3, 4, 7, 8};
+static constexpr int board_3_default_eog_channels[] = {5, 6};
+static constexpr int board_3_default_other_channels[] = {25, 26};
+static constexpr int board_3_auxiliary_eda_channels[] = {1, 2};
+static constexpr int board_3_auxiliary_ppg_channels[] = {3, 4};
+static constexpr int board_3_auxiliary_accel_channels[] = {7, 8, 9};
+static constexpr int board_3_auxiliary_gyro_channels[] = {10, 11, 12};
+static constexpr int board_3_auxiliary_other_channels[] = {16, 17};
+static constexpr int board_3_auxiliary_temperature_channels[] = {5};
+static constexpr int board_3_auxiliary_magnetometer_channels[] = {13, 14, 15};
+static constexpr int board_4_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_4_default_emg_channels[] = {1, 2, 3, 4};
+static constexpr int board_4_default_ecg_channels[] = {1, 2, 3, 4};
+static constexpr int board_4_default_eog_channels[] = {1, 2, 3, 4};
+static constexpr int board_4_default_accel_channels[] = {5, 6, 7};
+static constexpr int board_4_default_analog_channels[] = {15, 16, 17};
+static constexpr int board_4_default_other_channels[] = {8, 9, 10, 11, 12, 13, 14};
+static constexpr int board_4_default_resistance_channels[] = {18, 19, 20, 21, 22};
+static constexpr int board_5_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_5_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_5_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_5_default_eog_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_5_default_accel_channels[] = {9, 10, 11};
+static constexpr int board_5_default_analog_channels[] = {19, 20, 21};
+static constexpr int board_5_default_other_channels[] = {12, 13, 14, 15, 16, 17, 18};
+static constexpr int board_6_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_6_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_6_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_6_default_eog_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_6_default_accel_channels[] = {17, 18, 19};
+static constexpr int board_6_default_analog_channels[] = {27, 28, 29};
+static constexpr int board_6_default_other_channels[] = {20, 21, 22, 23, 24, 25, 26};
+static constexpr int board_7_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_7_default_resistance_channels[] = {5, 6, 7, 8};
+static constexpr int board_8_default_eeg_channels[] = {0, 1, 2, 3, 4, 5, 6, 7};
+static constexpr int board_8_default_accel_channels[] = {8, 9, 10};
+static constexpr int board_8_default_gyro_channels[] = {11, 12, 13};
+static constexpr int board_8_default_other_channels[] = {16};
+static constexpr int board_9_default_eeg_channels[] = {1};
+static constexpr int board_10_default_emg_channels[] = {1};
+static constexpr int board_11_default_ecg_channels[] = {1};
+static constexpr int board_13_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_13_default_other_channels[] = {9};
+static constexpr int board_14_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_14_default_other_channels[] = {9};
+static constexpr int board_16_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_17_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_17_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_17_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_18_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_19_default_emg_channels[] = {1, 2};
+static constexpr int board_21_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_21_default_other_channels[] = {5};
+static constexpr int board_21_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_21_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_21_ancillary_ppg_channels[] = {1, 2, 3};
+static constexpr int board_21_ancillary_optical_channels[] = {1, 2, 3};
+static constexpr int board_22_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_22_default_other_channels[] = {5};
+static constexpr int board_22_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_22_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_22_ancillary_ppg_channels[] = {1, 2, 3};
+static constexpr int board_22_ancillary_optical_channels[] = {1, 2, 3};
+static constexpr int board_23_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_23_default_other_channels[] = {9};
+static constexpr int board_24_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_24_default_other_channels[] = {11};
+static constexpr int board_24_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+static constexpr int board_25_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_25_default_other_channels[] = {11};
+static constexpr int board_25_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+static constexpr int board_26_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_26_default_other_channels[] = {11};
+static constexpr int board_26_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+static constexpr int board_27_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64};
+static constexpr int board_27_default_other_channels[] = {67};
+static constexpr int board_27_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66};
+static constexpr int board_28_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_28_default_other_channels[] = {35};
+static constexpr int board_28_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34};
+static constexpr int board_29_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_29_default_other_channels[] = {19};
+static constexpr int board_29_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18};
+static constexpr int board_30_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_30_default_emg_channels[] = {33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56};
+static constexpr int board_30_default_other_channels[] = {59};
+static constexpr int board_30_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 57, 58};
+static constexpr int board_31_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64};
+static constexpr int board_31_default_emg_channels[] = {65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88};
+static constexpr int board_31_default_other_channels[] = {91};
+static constexpr int board_31_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 89, 90};
+static constexpr int board_32_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_32_default_other_channels[] = {19};
+static constexpr int board_32_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18};
+static constexpr int board_33_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_33_default_other_channels[] = {35};
+static constexpr int board_33_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34};
+static constexpr int board_34_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_34_default_emg_channels[] = {33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56};
+static constexpr int board_34_default_other_channels[] = {59};
+static constexpr int board_34_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 57, 58};
+static constexpr int board_35_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64};
+static constexpr int board_35_default_other_channels[] = {67};
+static constexpr int board_35_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66};
+static constexpr int board_36_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64};
+static constexpr int board_36_default_emg_channels[] = {65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88};
+static constexpr int board_36_default_other_channels[] = {91};
+static constexpr int board_36_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 89, 90};
+static constexpr int board_37_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_38_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_38_default_other_channels[] = {5};
+static constexpr int board_38_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_38_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_38_ancillary_ppg_channels[] = {1, 2, 3};
+static constexpr int board_38_ancillary_optical_channels[] = {1, 2, 3};
+static constexpr int board_39_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_39_default_other_channels[] = {5};
+static constexpr int board_39_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_39_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_39_ancillary_ppg_channels[] = {1, 2, 3};
+static constexpr int board_39_ancillary_optical_channels[] = {1, 2, 3};
+static constexpr int board_40_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_40_default_accel_channels[] = {9, 10, 11};
+static constexpr int board_40_default_gyro_channels[] = {12, 13, 14};
+static constexpr int board_41_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_41_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_41_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_42_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_42_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_42_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_44_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_44_default_emg_channels[] = {1, 2, 3, 4};
+static constexpr int board_44_default_ecg_channels[] = {1, 2, 3, 4};
+static constexpr int board_44_default_other_channels[] = {5};
+static constexpr int board_44_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_44_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_44_auxiliary_magnetometer_channels[] = {7, 8, 9};
+static constexpr int board_44_ancillary_other_channels[] = {3};
+static constexpr int board_44_ancillary_temperature_channels[] = {1};
+static constexpr int board_45_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_45_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_45_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_45_default_other_channels[] = {9};
+static constexpr int board_45_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_45_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_45_auxiliary_magnetometer_channels[] = {7, 8, 9};
+static constexpr int board_45_ancillary_other_channels[] = {3};
+static constexpr int board_45_ancillary_temperature_channels[] = {1};
+static constexpr int board_46_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_46_default_emg_channels[] = {1, 2, 3, 4};
+static constexpr int board_46_default_ecg_channels[] = {1, 2, 3, 4};
+static constexpr int board_46_default_eog_channels[] = {1, 2, 3, 4};
+static constexpr int board_46_default_accel_channels[] = {5, 6, 7};
+static constexpr int board_46_default_resistance_channels[] = {8, 9, 10, 11, 12};
+static constexpr int board_47_default_accel_channels[] = {1, 2, 3};
+static constexpr int board_47_default_gyro_channels[] = {4, 5, 6};
+static constexpr int board_47_default_magnetometer_channels[] = {7, 8, 9};
+static constexpr int board_47_auxiliary_ppg_channels[] = {1, 2, 3};
+static constexpr int board_47_ancillary_eda_channels[] = {1};
+static constexpr int board_47_ancillary_other_channels[] = {3, 6};
+static constexpr int board_47_ancillary_temperature_channels[] = {2};
+static constexpr int board_50_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_50_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_50_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_50_default_eog_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_50_default_accel_channels[] = {9, 10, 11};
+static constexpr int board_50_default_analog_channels[] = {19, 20, 21};
+static constexpr int board_50_default_other_channels[] = {12, 13, 14, 15, 16, 17, 18};
+static constexpr int board_51_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24};
+static constexpr int board_51_default_emg_channels[] = {25, 26, 27, 28};
+static constexpr int board_51_default_other_channels[] = {31};
+static constexpr int board_51_default_resistance_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 29, 30};
+static constexpr int board_52_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128};
+static constexpr int board_52_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128};
+static constexpr int board_52_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128};
+static constexpr int board_53_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_53_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_53_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_53_default_eog_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_53_default_rotation_channels[] = {9, 10, 11};
+static constexpr int board_53_default_other_channels[] = {13, 14};
+static constexpr int board_54_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_54_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_54_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_54_default_other_channels[] = {9};
+static constexpr int board_54_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_54_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_54_auxiliary_magnetometer_channels[] = {7, 8, 9};
+static constexpr int board_54_ancillary_other_channels[] = {3};
+static constexpr int board_54_ancillary_temperature_channels[] = {1};
+static constexpr int board_55_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_55_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_55_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_55_default_other_channels[] = {33};
+static constexpr int board_55_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_55_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_55_auxiliary_magnetometer_channels[] = {7, 8, 9};
+static constexpr int board_55_ancillary_other_channels[] = {3};
+static constexpr int board_55_ancillary_temperature_channels[] = {1};
+static constexpr int board_56_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_57_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_57_default_other_channels[] = {9, 10};
+static constexpr int board_58_default_eeg_channels[] = {1, 2};
+static constexpr int board_58_default_ecg_channels[] = {3};
+static constexpr int board_59_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7};
+static constexpr int board_59_default_ecg_channels[] = {8};
+static constexpr int board_60_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_61_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_62_default_eeg_channels[] = {1};
+static constexpr int board_63_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23};
+static constexpr int board_63_default_ecg_channels[] = {24};
+static constexpr int board_64_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_64_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_64_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_64_default_eog_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_64_default_other_channels[] = {9, 10};
+static constexpr int board_64_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_64_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_64_auxiliary_other_channels[] = {9, 10};
+static constexpr int board_64_auxiliary_temperature_channels[] = {7};
+static constexpr int board_65_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_65_default_emg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_65_default_ecg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+static constexpr int board_66_default_eeg_channels[] = {1, 2, 3, 4, 5, 6, 7, 8};
+static constexpr int board_66_default_other_channels[] = {9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+static constexpr int board_67_default_eeg_channels[] = {1, 2, 3, 4};
+static constexpr int board_67_default_other_channels[] = {5, 6, 7, 8};
+static constexpr int board_67_auxiliary_accel_channels[] = {1, 2, 3};
+static constexpr int board_67_auxiliary_gyro_channels[] = {4, 5, 6};
+static constexpr int board_67_ancillary_optical_channels[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+static constexpr int board_68_default_ecg_channels[] = {10, 11, 12, 13};
+static constexpr int board_68_default_eda_channels[] = {14};
+static constexpr int board_68_default_accel_channels[] = {1, 2, 3};
+static constexpr int board_68_default_gyro_channels[] = {4, 5, 6};
+static constexpr int board_68_default_other_channels[] = {17};
+static constexpr int board_68_default_temperature_channels[] = {15};
+static constexpr int board_68_default_magnetometer_channels[] = {7, 8, 9};
 
-    /* For all real boards there are four required fields:
-     *   name
-     *   num_rows
-     *   timestamp_channel
-     *   marker_channel
-     * Nice to set:
-     *   package_num
-     *   sampling_rate
-     * Everything else is optional and up to device
-    */
+static constexpr BoardPresetDescr board_descr_table[NUM_BOARD_IDS][BOARD_DESCR_NUM_PRESETS] = {
+    // -3 PlayBack
+    {
+        {"PlayBack", BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"PlayBack", BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"PlayBack", BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // -2 Streaming
+    {
+        {"Streaming", BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Streaming", BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Streaming", BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // -1 Synthetic
+    {
+        {"Synthetic", 250, 0, 30, 31, 29, 32, "Fz,C3,Cz,C4,Pz,PO7,Oz,PO8,F5,F7,F3,F1,F2,F4,F6,F8", {board_m1_default_eeg_channels, 16}, {board_m1_default_emg_channels, 16}, {board_m1_default_ecg_channels, 16}, {board_m1_default_eog_channels, 16}, {board_m1_default_eda_channels, 1}, {board_m1_default_ppg_channels, 2}, {NULL, 0}, {board_m1_default_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_m1_default_gyro_channels, 3}, {NULL, 0}, {board_m1_default_temperature_channels, 1}, {board_m1_default_resistance_channels, 2}, {NULL, 0}},
+        {"SyntheticAux", 250, 0, 18, 19, 1, 20, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_m1_auxiliary_eda_channels, 1}, {board_m1_auxiliary_ppg_channels, 2}, {NULL, 0}, {board_m1_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_m1_auxiliary_gyro_channels, 3}, {board_m1_auxiliary_other_channels, 4}, {board_m1_auxiliary_temperature_channels, 1}, {board_m1_auxiliary_resistance_channels, 2}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 0 Cyton
+    {
+        {"Cyton", 250, 0, 22, 23, BOARD_DESCR_NO_VALUE, 24, "Fp1,Fp2,C3,C4,P7,P8,O1,O2", {board_0_default_eeg_channels, 8}, {board_0_default_emg_channels, 8}, {board_0_default_ecg_channels, 8}, {board_0_default_eog_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_0_default_accel_channels, 3}, {NULL, 0}, {board_0_default_analog_channels, 3}, {NULL, 0}, {board_0_default_other_channels, 7}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 1 Ganglion
+    {
+        {"Ganglion", 200, 0, 13, 14, BOARD_DESCR_NO_VALUE, 15, NULL, {board_1_default_eeg_channels, 4}, {board_1_default_emg_channels, 4}, {board_1_default_ecg_channels, 4}, {board_1_default_eog_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_1_default_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_1_default_resistance_channels, 5}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 2 CytonDaisy
+    {
+        {"CytonDaisy", 125, 0, 30, 31, BOARD_DESCR_NO_VALUE, 32, "Fp1,Fp2,C3,C4,P7,P8,O1,O2,F7,F8,F3,F4,T7,T8,P3,P4", {board_2_default_eeg_channels, 16}, {board_2_default_emg_channels, 16}, {board_2_default_ecg_channels, 16}, {board_2_default_eog_channels, 16}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_2_default_accel_channels, 3}, {NULL, 0}, {board_2_default_analog_channels, 3}, {NULL, 0}, {board_2_default_other_channels, 7}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 3 Galea
+    {
+        {"Galea", 250, 0, 27, 28, BOARD_DESCR_NO_VALUE, 29, "F1,F2,C3,C4,P3,P4,O1,O2,Cz,Pz,X1,X2,X3,X4,X5,X6", {board_3_default_eeg_channels, 16}, {board_3_default_emg_channels, 6}, {NULL, 0}, {board_3_default_eog_channels, 2}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_3_default_other_channels, 2}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"GaleaAuxiliary", 50, 0, 18, 19, 6, 20, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_3_auxiliary_eda_channels, 2}, {board_3_auxiliary_ppg_channels, 2}, {NULL, 0}, {board_3_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_3_auxiliary_gyro_channels, 3}, {board_3_auxiliary_other_channels, 2}, {board_3_auxiliary_temperature_channels, 1}, {NULL, 0}, {board_3_auxiliary_magnetometer_channels, 3}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 4 GanglionWifi
+    {
+        {"GanglionWifi", 1600, 0, 23, 24, BOARD_DESCR_NO_VALUE, 25, NULL, {board_4_default_eeg_channels, 4}, {board_4_default_emg_channels, 4}, {board_4_default_ecg_channels, 4}, {board_4_default_eog_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_4_default_accel_channels, 3}, {NULL, 0}, {board_4_default_analog_channels, 3}, {NULL, 0}, {board_4_default_other_channels, 7}, {NULL, 0}, {board_4_default_resistance_channels, 5}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 5 CytonWifi
+    {
+        {"CytonWifi", 1000, 0, 22, 23, BOARD_DESCR_NO_VALUE, 24, NULL, {board_5_default_eeg_channels, 8}, {board_5_default_emg_channels, 8}, {board_5_default_ecg_channels, 8}, {board_5_default_eog_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_5_default_accel_channels, 3}, {NULL, 0}, {board_5_default_analog_channels, 3}, {NULL, 0}, {board_5_default_other_channels, 7}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 6 CytonDaisyWifi
+    {
+        {"CytonDaisyWifi", 1000, 0, 30, 31, BOARD_DESCR_NO_VALUE, 32, NULL, {board_6_default_eeg_channels, 16}, {board_6_default_emg_channels, 16}, {board_6_default_ecg_channels, 16}, {board_6_default_eog_channels, 16}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_6_default_accel_channels, 3}, {NULL, 0}, {board_6_default_analog_channels, 3}, {NULL, 0}, {board_6_default_other_channels, 7}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 7 BrainBit
+    {
+        {"BrainBit", 250, 0, 10, 11, 9, 12, "T3,T4,O1,O2", {board_7_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_7_default_resistance_channels, 4}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 8 Unicorn
+    {
+        {"Unicorn", 250, 15, 17, 18, 14, 19, "Fz,C3,Cz,C4,Pz,PO7,Oz,PO8", {board_8_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_8_default_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_8_default_gyro_channels, 3}, {board_8_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 9 CallibriEEG
+    {
+        {"CallibriEEG", 250, 0, 2, 3, BOARD_DESCR_NO_VALUE, 4, NULL, {board_9_default_eeg_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 10 CallibriEMG
+    {
+        {"CallibriEMG", 1000, 0, 2, 3, BOARD_DESCR_NO_VALUE, 4, NULL, {NULL, 0}, {board_10_default_emg_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 11 CallibriECG
+    {
+        {"CallibriECG", 125, 0, 2, 3, BOARD_DESCR_NO_VALUE, 4, NULL, {NULL, 0}, {NULL, 0}, {board_11_default_ecg_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 12
+    {
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 13 NotionOSC1
+    {
+        {"NotionOSC1", 250, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, "CP6,F6,C4,CP4,CP3,F5,C3,CP5", {board_13_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_13_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 14 NotionOSC2
+    {
+        {"NotionOSC2", 250, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, "CP5,F5,C3,CP3,CP6,F6,C4,CP4", {board_14_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_14_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 15
+    {
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 16 GforcePro
+    {
+        {"GforcePro", 500, 0, 9, 10, BOARD_DESCR_NO_VALUE, 11, NULL, {NULL, 0}, {board_16_default_emg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 17 FreeEEG32
+    {
+        {"FreeEEG32", 512, 0, 33, 34, BOARD_DESCR_NO_VALUE, 35, NULL, {board_17_default_eeg_channels, 32}, {board_17_default_emg_channels, 32}, {board_17_default_ecg_channels, 32}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 18 BrainBitBLED
+    {
+        {"BrainBitBLED", 250, 0, 6, 7, 5, 8, "T3,T4,O1,O2", {board_18_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 19 GforceDual
+    {
+        {"GforceDual", 500, 0, 3, 4, BOARD_DESCR_NO_VALUE, 5, NULL, {NULL, 0}, {board_19_default_emg_channels, 2}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 20
+    {
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 21 MuseSBLED
+    {
+        {"MuseSBLED", 256, 0, 6, 7, BOARD_DESCR_NO_VALUE, 8, "TP9,AF7,AF8,TP10", {board_21_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_21_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"MuseSBLEDAux", 52, 0, 7, 8, BOARD_DESCR_NO_VALUE, 9, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_21_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_21_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"MuseSBLEDAnc", 64, 0, 4, 5, BOARD_DESCR_NO_VALUE, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_21_ancillary_ppg_channels, 3}, {board_21_ancillary_optical_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 22 Muse2BLED
+    {
+        {"Muse2BLED", 256, 0, 6, 7, BOARD_DESCR_NO_VALUE, 8, "TP9,AF7,AF8,TP10", {board_22_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_22_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Muse2BLEDAux", 52, 0, 7, 8, BOARD_DESCR_NO_VALUE, 9, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_22_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_22_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Muse2BLEDAnc", 64, 0, 4, 5, BOARD_DESCR_NO_VALUE, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_22_ancillary_ppg_channels, 3}, {board_22_ancillary_optical_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 23 CrownOSC
+    {
+        {"CrownOSC", 256, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, "CP3,C3,F5,PO3,PO4,F6,C4,CP4", {board_23_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_23_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 24 AntNeuroEE410
+    {
+        {"AntNeuroEE410", 2000, 0, 12, 13, BOARD_DESCR_NO_VALUE, 14, NULL, {NULL, 0}, {board_24_default_emg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_24_default_other_channels, 1}, {NULL, 0}, {board_24_default_resistance_channels, 10}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 25 AntNeuroEE411
+    {
+        {"AntNeuroEE411", 2000, 0, 12, 13, BOARD_DESCR_NO_VALUE, 14, NULL, {board_25_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_25_default_other_channels, 1}, {NULL, 0}, {board_25_default_resistance_channels, 10}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 26 AntNeuroEE430
+    {
+        {"AntNeuroEE430", 512, 0, 12, 13, BOARD_DESCR_NO_VALUE, 14, NULL, {board_26_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_26_default_other_channels, 1}, {NULL, 0}, {board_26_default_resistance_channels, 10}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 27 AntNeuroEE211
+    {
+        {"AntNeuroEE211", 2000, 0, 68, 69, BOARD_DESCR_NO_VALUE, 70, NULL, {board_27_default_eeg_channels, 64}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_27_default_other_channels, 1}, {NULL, 0}, {board_27_default_resistance_channels, 66}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 28 AntNeuroEE212
+    {
+        {"AntNeuroEE212", 2000, 0, 36, 37, BOARD_DESCR_NO_VALUE, 38, NULL, {board_28_default_eeg_channels, 32}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_28_default_other_channels, 1}, {NULL, 0}, {board_28_default_resistance_channels, 34}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 29 AntNeuroEE213
+    {
+        {"AntNeuroEE213", 2000, 0, 20, 21, BOARD_DESCR_NO_VALUE, 22, NULL, {board_29_default_eeg_channels, 16}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_29_default_other_channels, 1}, {NULL, 0}, {board_29_default_resistance_channels, 18}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 30 AntNeuroEE214
+    {
+        {"AntNeuroEE214", 2000, 0, 60, 61, BOARD_DESCR_NO_VALUE, 62, NULL, {board_30_default_eeg_channels, 32}, {board_30_default_emg_channels, 24}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_30_default_other_channels, 1}, {NULL, 0}, {board_30_default_resistance_channels, 34}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 31 AntNeuroEE215
+    {
+        {"AntNeuroEE215", 2000, 0, 92, 93, BOARD_DESCR_NO_VALUE, 94, NULL, {board_31_default_eeg_channels, 64}, {board_31_default_emg_channels, 24}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_31_default_other_channels, 1}, {NULL, 0}, {board_31_default_resistance_channels, 67}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 32 AntNeuroEE221
+    {
+        {"AntNeuroEE221", 16000, 0, 20, 21, BOARD_DESCR_NO_VALUE, 22, NULL, {board_32_default_eeg_channels, 16}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_32_default_other_channels, 1}, {NULL, 0}, {board_32_default_resistance_channels, 18}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 33 AntNeuroEE222
+    {
+        {"AntNeuroEE222", 16000, 0, 36, 37, BOARD_DESCR_NO_VALUE, 38, NULL, {board_33_default_eeg_channels, 32}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_33_default_other_channels, 1}, {NULL, 0}, {board_33_default_resistance_channels, 34}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 34 AntNeuroEE223
+    {
+        {"AntNeuroEE223", 16000, 0, 60, 61, BOARD_DESCR_NO_VALUE, 62, NULL, {board_34_default_eeg_channels, 32}, {board_34_default_emg_channels, 24}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_34_default_other_channels, 1}, {NULL, 0}, {board_34_default_resistance_channels, 34}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 35 AntNeuroEE224
+    {
+        {"AntNeuroEE224", 16000, 0, 68, 69, BOARD_DESCR_NO_VALUE, 70, NULL, {board_35_default_eeg_channels, 64}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_35_default_other_channels, 1}, {NULL, 0}, {board_35_default_resistance_channels, 66}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 36 AntNeuroEE225
+    {
+        {"AntNeuroEE225", 16000, 0, 92, 93, BOARD_DESCR_NO_VALUE, 94, NULL, {board_36_default_eeg_channels, 64}, {board_36_default_emg_channels, 24}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_36_default_other_channels, 1}, {NULL, 0}, {board_36_default_resistance_channels, 67}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 37 Enophone
+    {
+        {"Enophone", 250, 0, 5, 6, BOARD_DESCR_NO_VALUE, 7, "A2,A1,C4,C3", {board_37_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 38 Muse2
+    {
+        {"Muse2", 256, 0, 6, 7, BOARD_DESCR_NO_VALUE, 8, "TP9,AF7,AF8,TP10", {board_38_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_38_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Muse2Aux", 52, 0, 7, 8, BOARD_DESCR_NO_VALUE, 9, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_38_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_38_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Muse2Anc", 64, 0, 4, 5, BOARD_DESCR_NO_VALUE, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_38_ancillary_ppg_channels, 3}, {board_38_ancillary_optical_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 39 MuseS
+    {
+        {"MuseS", 256, 0, 6, 7, BOARD_DESCR_NO_VALUE, 8, "TP9,AF7,AF8,TP10", {board_39_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_39_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"MuseSAux", 52, 0, 7, 8, BOARD_DESCR_NO_VALUE, 9, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_39_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_39_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"MuseSAnc", 64, 0, 4, 5, BOARD_DESCR_NO_VALUE, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_39_ancillary_ppg_channels, 3}, {board_39_ancillary_optical_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 40 BrainAlive
+    {
+        {"BrainAlive", 250, 0, 16, 15, BOARD_DESCR_NO_VALUE, 17, "F7,FT7,T7,CP5,CZ,C6,FC6,F4", {board_40_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_40_default_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_40_default_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 41 Muse2016
+    {
+        {"Muse2016", 256, 0, 5, 6, BOARD_DESCR_NO_VALUE, 7, "TP9,AF7,AF8,TP10", {board_41_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Muse2016Aux", 52, 0, 7, 8, BOARD_DESCR_NO_VALUE, 9, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_41_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_41_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 42 Muse2016BLED
+    {
+        {"Muse2016BLED", 256, 0, 5, 6, BOARD_DESCR_NO_VALUE, 7, "TP9,AF7,AF8,TP10", {board_42_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Muse2016BLEDAux", 52, 0, 7, 8, BOARD_DESCR_NO_VALUE, 9, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_42_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_42_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 43
+    {
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 44 Explore4Channels
+    {
+        {"Explore4Channels", 250, 0, 6, 7, BOARD_DESCR_NO_VALUE, 8, NULL, {board_44_default_eeg_channels, 4}, {board_44_default_emg_channels, 4}, {board_44_default_ecg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_44_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Explore4Channels", 20, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_44_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_44_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_44_auxiliary_magnetometer_channels, 3}},
+        {"Explore4Channels", 1, 0, 4, 5, 2, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_44_ancillary_other_channels, 1}, {board_44_ancillary_temperature_channels, 1}, {NULL, 0}, {NULL, 0}},
+    },
+    // 45 Explore8Channels
+    {
+        {"Explore8Channels", 250, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, NULL, {board_45_default_eeg_channels, 8}, {board_45_default_emg_channels, 8}, {board_45_default_ecg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_45_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Explore8Channels", 20, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_45_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_45_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_45_auxiliary_magnetometer_channels, 3}},
+        {"Explore8Channels", 1, 0, 4, 5, 2, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_45_ancillary_other_channels, 1}, {board_45_ancillary_temperature_channels, 1}, {NULL, 0}, {NULL, 0}},
+    },
+    // 46 Ganglion
+    {
+        {"Ganglion", 200, 0, 13, 14, BOARD_DESCR_NO_VALUE, 15, NULL, {board_46_default_eeg_channels, 4}, {board_46_default_emg_channels, 4}, {board_46_default_ecg_channels, 4}, {board_46_default_eog_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_46_default_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_46_default_resistance_channels, 5}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 47 Emotibit
+    {
+        {"Emotibit", 25, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_47_default_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_47_default_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_47_default_magnetometer_channels, 3}},
+        {"Emotibit", 25, 0, 4, 5, BOARD_DESCR_NO_VALUE, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_47_auxiliary_ppg_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"Emotibit", 15, 0, 4, 5, 7, 8, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_47_ancillary_eda_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_47_ancillary_other_channels, 2}, {board_47_ancillary_temperature_channels, 1}, {NULL, 0}, {NULL, 0}},
+    },
+    // 48
+    {
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 49
+    {
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 50 NtlWifi
+    {
+        {"NtlWifi", 250, 0, 23, 24, 22, 25, "Fp1,Fp2,C3,C4,P7,P8,O1,O2", {board_50_default_eeg_channels, 8}, {board_50_default_emg_channels, 8}, {board_50_default_ecg_channels, 8}, {board_50_default_eog_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_50_default_accel_channels, 3}, {NULL, 0}, {board_50_default_analog_channels, 3}, {NULL, 0}, {board_50_default_other_channels, 7}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 51 AntNeuroEE511
+    {
+        {"AntNeuroEE511", 4096, 0, 32, 33, BOARD_DESCR_NO_VALUE, 34, NULL, {board_51_default_eeg_channels, 24}, {board_51_default_emg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_51_default_other_channels, 1}, {NULL, 0}, {board_51_default_resistance_channels, 26}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 52 FreeEEG128
+    {
+        {"FreeEEG128", 256, 0, 129, 130, BOARD_DESCR_NO_VALUE, 131, NULL, {board_52_default_eeg_channels, 128}, {board_52_default_emg_channels, 128}, {board_52_default_ecg_channels, 128}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 53 AAVAA V3
+    {
+        {"AAVAA V3", 50, 0, 15, 16, 12, 17, "L1,L2,L3,L4,R1,R2,R3,R4", {board_53_default_eeg_channels, 8}, {board_53_default_emg_channels, 8}, {board_53_default_ecg_channels, 8}, {board_53_default_eog_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_53_default_rotation_channels, 3}, {NULL, 0}, {NULL, 0}, {board_53_default_other_channels, 2}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 54 ExplorePlus8Channels
+    {
+        {"ExplorePlus8Channels", 250, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, NULL, {board_54_default_eeg_channels, 8}, {board_54_default_emg_channels, 8}, {board_54_default_ecg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_54_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"ExplorePlus8Channels", 20, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_54_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_54_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_54_auxiliary_magnetometer_channels, 3}},
+        {"ExplorePlus8Channels", 1, 0, 4, 5, 2, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_54_ancillary_other_channels, 1}, {board_54_ancillary_temperature_channels, 1}, {NULL, 0}, {NULL, 0}},
+    },
+    // 55 ExplorePlus32Channels
+    {
+        {"ExplorePlus32Channels", 250, 0, 34, 35, BOARD_DESCR_NO_VALUE, 36, NULL, {board_55_default_eeg_channels, 32}, {board_55_default_emg_channels, 32}, {board_55_default_ecg_channels, 32}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_55_default_other_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"ExplorePlus32Channels", 20, 0, 10, 11, BOARD_DESCR_NO_VALUE, 12, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_55_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_55_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_55_auxiliary_magnetometer_channels, 3}},
+        {"ExplorePlus32Channels", 1, 0, 4, 5, 2, 6, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_55_ancillary_other_channels, 1}, {board_55_ancillary_temperature_channels, 1}, {NULL, 0}, {NULL, 0}},
+    },
+    // 56 PIEEG
+    {
+        {"PIEEG", 250, 0, 9, 10, BOARD_DESCR_NO_VALUE, 11, "Fp1,Fp2,C3,C4,P7,P8,O1,O2", {board_56_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 57 Knight
+    {
+        {"Knight", 125, 0, 11, 12, BOARD_DESCR_NO_VALUE, 13, NULL, {board_57_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_57_default_other_channels, 2}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 58 Sync-Trio
+    {
+        {"Sync-Trio", 250, 0, 4, 5, BOARD_DESCR_NO_VALUE, 6, NULL, {board_58_default_eeg_channels, 2}, {NULL, 0}, {board_58_default_ecg_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 59 Sync-Octo
+    {
+        {"Sync-Octo", 250, 0, 9, 10, BOARD_DESCR_NO_VALUE, 11, NULL, {board_59_default_eeg_channels, 7}, {NULL, 0}, {board_59_default_ecg_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 60 OB5000MAX
+    {
+        {"OB5000MAX", 250, 0, 9, 10, BOARD_DESCR_NO_VALUE, 11, NULL, {board_60_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 61 Sync-Neo
+    {
+        {"Sync-Neo", 250, 0, 9, 10, BOARD_DESCR_NO_VALUE, 11, NULL, {board_61_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 62 Sync-Uno
+    {
+        {"Sync-Uno", 250, 0, 2, 3, BOARD_DESCR_NO_VALUE, 4, NULL, {board_62_default_eeg_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 63 OB3000
+    {
+        {"OB3000", 500, 0, 25, 26, BOARD_DESCR_NO_VALUE, 27, NULL, {board_63_default_eeg_channels, 23}, {NULL, 0}, {board_63_default_ecg_channels, 1}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 64 BioListener
+    {
+        {"BioListener", 500, 0, 11, 12, BOARD_DESCR_NO_VALUE, 13, NULL, {board_64_default_eeg_channels, 8}, {board_64_default_emg_channels, 8}, {board_64_default_ecg_channels, 8}, {board_64_default_eog_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_64_default_other_channels, 2}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"BioListener", 50, 0, 11, 12, 8, 13, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_64_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_64_auxiliary_gyro_channels, 3}, {board_64_auxiliary_other_channels, 2}, {board_64_auxiliary_temperature_channels, 1}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 65 IronBCI32
+    {
+        {"IronBCI32", 512, 0, 33, 34, BOARD_DESCR_NO_VALUE, 35, NULL, {board_65_default_eeg_channels, 32}, {board_65_default_emg_channels, 32}, {board_65_default_ecg_channels, 32}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 66 KnightIMU
+    {
+        {"KnightIMU", 125, 0, 20, 21, BOARD_DESCR_NO_VALUE, 22, NULL, {board_66_default_eeg_channels, 8}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_66_default_other_channels, 11}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 67 MuseAthena
+    {
+        {"MuseAthena", 256, 0, 9, 10, BOARD_DESCR_NO_VALUE, 11, "TP9,AF7,AF8,TP10", {board_67_default_eeg_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_67_default_other_channels, 4}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"MuseAthenaAux", 52, 0, 7, 8, BOARD_DESCR_NO_VALUE, 9, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_67_auxiliary_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_67_auxiliary_gyro_channels, 3}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {"MuseAthenaAnc", 64, 0, 18, 19, 17, 20, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {board_67_ancillary_optical_channels, 16}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+    // 68 Shimmer3
+    {
+        {"Shimmer3", 512, 0, 18, 19, 16, 20, NULL, {NULL, 0}, {NULL, 0}, {board_68_default_ecg_channels, 4}, {NULL, 0}, {board_68_default_eda_channels, 1}, {NULL, 0}, {NULL, 0}, {board_68_default_accel_channels, 3}, {NULL, 0}, {NULL, 0}, {board_68_default_gyro_channels, 3}, {board_68_default_other_channels, 1}, {board_68_default_temperature_channels, 1}, {NULL, 0}, {board_68_default_magnetometer_channels, 3}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+        {NULL, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, BOARD_DESCR_NO_VALUE, NULL, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}, {NULL, 0}},
+    },
+};
 
-    brainflow_boards_json = {
-        {"boards", {
-            {"-3", json::object()},
-            {"-2", json::object()},
-            {"-1", json::object()},
-            {"0", json::object()},
-            {"1", json::object()},
-            {"2", json::object()},
-            {"3", json::object()},
-            {"4", json::object()},
-            {"5", json::object()},
-            {"6", json::object()},
-            {"7", json::object()},
-            {"8", json::object()},
-            {"9", json::object()},
-            {"10", json::object()},
-            {"11", json::object()},
-            {"13", json::object()},
-            {"14", json::object()},
-            {"16", json::object()},
-            {"17", json::object()},
-            {"18", json::object()},
-            {"19", json::object()},
-            {"20", json::object()},
-            {"21", json::object()},
-            {"22", json::object()},
-            {"23", json::object()},
-            {"24", json::object()},
-            {"25", json::object()},
-            {"26", json::object()},
-            {"27", json::object()},
-            {"28", json::object()},
-            {"29", json::object()},
-            {"30", json::object()},
-            {"31", json::object()},
-            {"32", json::object()},
-            {"33", json::object()},
-            {"34", json::object()},
-            {"35", json::object()},
-            {"36", json::object()},
-            {"37", json::object()},
-            {"38", json::object()},
-            {"39", json::object()},
-            {"40", json::object()},
-            {"41", json::object()},
-            {"42", json::object()},
-            {"44", json::object()},
-            {"45", json::object()},
-            {"46", json::object()},
-            {"47", json::object()},
-            {"48", json::object()},
-            {"49", json::object()},
-            {"50", json::object()},
-            {"51", json::object()},
-            {"52", json::object()},
-            {"53", json::object()},
-            {"54", json::object()},
-            {"55", json::object()},
-            {"56", json::object()},
-            {"57", json::object()},
-            {"58", json::object()},
-            {"59", json::object()},
-            {"60", json::object()},
-            {"61", json::object()},
-            {"62", json::object()},
-            {"63", json::object()},
-            {"64", json::object()},
-            {"65", json::object()},
-            {"66", json::object()},
-            {"67", json::object()},
-            {"68", json::object()}
-        }
-    }};
+// clang-format on
 
-    // available presets are: default, auxiliary, ancillary, default is required, other presets are optional
-    brainflow_boards_json["boards"]["-3"]["default"] = {{"name", "PlayBack"}};
-    brainflow_boards_json["boards"]["-3"]["auxiliary"] = {{"name", "PlayBack"}};
-    brainflow_boards_json["boards"]["-3"]["ancillary"] = {{"name", "PlayBack"}};
-    brainflow_boards_json["boards"]["-2"]["default"] = {{"name", "Streaming"}};
-    brainflow_boards_json["boards"]["-2"]["auxiliary"] = {{"name", "Streaming"}};
-    brainflow_boards_json["boards"]["-2"]["ancillary"] = {{"name", "Streaming"}};
-    brainflow_boards_json["boards"]["-1"]["default"] =
-    {
-        {"name", "Synthetic"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"battery_channel", 29},
-        {"timestamp_channel", 30},
-        {"marker_channel", 31},
-        {"num_rows", 32},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eeg_names", "Fz,C3,Cz,C4,Pz,PO7,Oz,PO8,F5,F7,F3,F1,F2,F4,F6,F8"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"accel_channels", {17, 18, 19}},
-        {"gyro_channels", {20, 21, 22}},
-        {"eda_channels", {23}},
-        {"ppg_channels", {24, 25}},
-        {"temperature_channels", {26}},
-        {"resistance_channels", {27, 28}}
-    };
-    brainflow_boards_json["boards"]["-1"]["auxiliary"] =
-    {
-        {"name", "SyntheticAux"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 18},
-        {"marker_channel", 19},
-        {"num_rows", 20},
-        {"other_channels", {14, 15, 16, 17}},
-        {"battery_channel", 1},
-        {"accel_channels", {2, 3, 4}},
-        {"gyro_channels", {5, 6, 7}},
-        {"eda_channels", {8}},
-        {"ppg_channels", {9, 10}},
-        {"temperature_channels", {11}},
-        {"resistance_channels", {12, 13}}
-    };
-    brainflow_boards_json["boards"]["0"]["default"] =
-    {
-        {"name", "Cyton"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 22},
-        {"marker_channel", 23},
-        {"num_rows", 24},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "Fp1,Fp2,C3,C4,P7,P8,O1,O2"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"accel_channels", {9, 10, 11}},
-        {"analog_channels", {19, 20, 21}},
-        {"other_channels", {12, 13, 14, 15, 16, 17, 18}}
-    };
-    brainflow_boards_json["boards"]["1"]["default"] =
-    {
-        {"name", "Ganglion"},
-        {"sampling_rate", 200},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 13},
-        {"marker_channel", 14},
-        {"num_rows", 15},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"ecg_channels", {1, 2, 3, 4}},
-        {"eog_channels", {1, 2, 3, 4}},
-        {"accel_channels", {5, 6, 7}},
-        {"resistance_channels", {8, 9, 10, 11, 12}}
-    };
-    brainflow_boards_json["boards"]["2"]["default"] =
-    {
-        {"name", "CytonDaisy"},
-        {"sampling_rate", 125},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 30},
-        {"marker_channel", 31},
-        {"num_rows", 32},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eeg_names", "Fp1,Fp2,C3,C4,P7,P8,O1,O2,F7,F8,F3,F4,T7,T8,P3,P4"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"accel_channels", {17, 18, 19}},
-        {"analog_channels", {27, 28, 29}},
-        {"other_channels", {20, 21, 22, 23, 24, 25, 26}}
-    };
-    brainflow_boards_json["boards"]["3"]["default"] =
-    {
-        {"name", "Galea"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 27},
-        {"marker_channel", 28},
-        {"num_rows", 29},
-        {"eeg_channels", {9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24}},
-        {"eeg_names", "F1,F2,C3,C4,P3,P4,O1,O2,Cz,Pz,X1,X2,X3,X4,X5,X6"},
-        {"emg_channels", {1, 2, 3, 4, 7, 8}},
-        {"eog_channels", {5, 6}},
-        {"other_channels", {25, 26}},
-    };
-    brainflow_boards_json["boards"]["3"]["auxiliary"] =
-    {
-        {"name", "GaleaAuxiliary"},
-        {"sampling_rate", 50},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 18},
-        {"marker_channel", 19},
-        {"num_rows", 20},
-        {"battery_channel", 6},
-        {"eda_channels", {1, 2}},
-        {"ppg_channels", {3, 4}},
-        {"accel_channels", {7, 8, 9}},
-        {"gyro_channels", {10, 11, 12}},
-        {"magnetometer_channels", {13, 14, 15}},
-        {"other_channels", {16, 17}},
-        {"temperature_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["4"]["default"] =
-    {
-        {"name", "GanglionWifi"},
-        {"sampling_rate", 1600},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 23},
-        {"marker_channel", 24},
-        {"num_rows", 25},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"ecg_channels", {1, 2, 3, 4}},
-        {"eog_channels", {1, 2, 3, 4}},
-        {"accel_channels", {5, 6, 7}},
-        {"analog_channels", {15, 16, 17}},
-        {"other_channels", {8, 9, 10, 11, 12, 13, 14}},
-        {"resistance_channels", {18, 19, 20, 21, 22}}
-    };
-    brainflow_boards_json["boards"]["5"]["default"] =
-    {
-        {"name", "CytonWifi"},
-        {"sampling_rate", 1000},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 22},
-        {"marker_channel", 23},
-        {"num_rows", 24},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"accel_channels", {9, 10, 11}},
-        {"analog_channels", {19, 20, 21}},
-        {"other_channels", {12, 13, 14, 15, 16, 17, 18}}
-    };
-    brainflow_boards_json["boards"]["6"]["default"] =
-    {
-        {"name", "CytonDaisyWifi"},
-        {"sampling_rate", 1000},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 30},
-        {"marker_channel", 31},
-        {"num_rows", 32},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"accel_channels", {17, 18, 19}},
-        {"analog_channels", {27, 28, 29}},
-        {"other_channels", {20, 21, 22, 23, 24, 25, 26}}
-    };
-    brainflow_boards_json["boards"]["7"]["default"] =
-    {
-        {"name", "BrainBit"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"battery_channel", 9},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "T3,T4,O1,O2"},
-        {"resistance_channels", {5, 6, 7, 8}}
-    };
-    brainflow_boards_json["boards"]["8"]["default"] =
-    {
-        {"name", "Unicorn"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 17},
-        {"marker_channel", 18},
-        {"package_num_channel", 15},
-        {"num_rows", 19},
-        {"eeg_channels", {0, 1, 2, 3, 4, 5, 6, 7}},
-        {"eeg_names", "Fz,C3,Cz,C4,Pz,PO7,Oz,PO8"},
-        {"accel_channels", {8, 9, 10}},
-        {"gyro_channels", {11, 12, 13}},
-        {"other_channels", {16}},
-        {"battery_channel", 14}
-    };
-    brainflow_boards_json["boards"]["9"]["default"] =
-    {
-        {"name", "CallibriEEG"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 2},
-        {"marker_channel", 3},
-        {"package_num_channel", 0},
-        {"num_rows", 4},
-        {"eeg_channels", {1}}
-    };
-    brainflow_boards_json["boards"]["10"]["default"] =
-    {
-        {"name", "CallibriEMG"},
-        {"sampling_rate", 1000},
-        {"timestamp_channel", 2},
-        {"marker_channel", 3},
-        {"package_num_channel", 0},
-        {"num_rows", 4},
-        {"emg_channels", {1}}
-    };
-    brainflow_boards_json["boards"]["11"]["default"] =
-    {
-        {"name", "CallibriECG"},
-        {"sampling_rate", 125},
-        {"timestamp_channel", 2},
-        {"marker_channel", 3},
-        {"package_num_channel", 0},
-        {"num_rows", 4},
-        {"ecg_channels", {1}}
-    };
-    brainflow_boards_json["boards"]["13"]["default"] =
-    {
-        {"name", "NotionOSC1"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "CP6,F6,C4,CP4,CP3,F5,C3,CP5"},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["14"]["default"] =
-    {
-        {"name", "NotionOSC2"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "CP5,F5,C3,CP3,CP6,F6,C4,CP4"},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["16"]["default"] =
-    {
-        {"name", "GforcePro"},
-        {"sampling_rate", 500},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 9},
-        {"marker_channel", 10},
-        {"num_rows", 11},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}}
-    };
-    brainflow_boards_json["boards"]["17"]["default"] =
-    {
-        {"name", "FreeEEG32"},
-        {"sampling_rate", 512},
-        {"timestamp_channel", 33},
-        {"marker_channel", 34},
-        {"package_num_channel", 0},
-        {"num_rows", 35},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}}
-    };
-    brainflow_boards_json["boards"]["18"]["default"] =
-    {
-        {"name", "BrainBitBLED"},
-        {"sampling_rate", 250},
-        {"battery_channel", 5},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "T3,T4,O1,O2"}
-    };
-    brainflow_boards_json["boards"]["19"]["default"] =
-    {
-        {"name", "GforceDual"},
-        {"sampling_rate", 500},
-        {"timestamp_channel", 3},
-        {"marker_channel", 4},
-        {"package_num_channel", 0},
-        {"num_rows", 5},
-        {"emg_channels", {1, 2}}
-    };
-    brainflow_boards_json["boards"]["21"]["default"] =
-    {
-        {"name", "MuseSBLED"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,AF7,AF8,TP10"},
-        {"other_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["21"]["auxiliary"] =
-    {
-        {"name", "MuseSBLEDAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["21"]["ancillary"] =
-    {
-        {"name", "MuseSBLEDAnc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}},
-        {"optical_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["22"]["default"] =
-    {
-        {"name", "Muse2BLED"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,AF7,AF8,TP10"},
-        {"other_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["22"]["auxiliary"] =
-    {
-        {"name", "Muse2BLEDAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["22"]["ancillary"] =
-    {
-        {"name", "Muse2BLEDAnc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}},
-        {"optical_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["23"]["default"] =
-    {
-        {"name", "CrownOSC"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "CP3,C3,F5,PO3,PO4,F6,C4,CP4"},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["24"]["default"] =
-    {
-        {"name", "AntNeuroEE410"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 12},
-        {"marker_channel", 13},
-        {"package_num_channel", 0},
-        {"num_rows", 14},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}},
-        {"other_channels", {11}}
-    };
-    brainflow_boards_json["boards"]["25"]["default"] =
-    {
-        {"name", "AntNeuroEE411"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 12},
-        {"marker_channel", 13},
-        {"package_num_channel", 0},
-        {"num_rows", 14},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}},
-        {"other_channels", {11}}
-    };
-    brainflow_boards_json["boards"]["26"]["default"] =
-    {
-        {"name", "AntNeuroEE430"},
-        {"sampling_rate", 512},
-        {"timestamp_channel", 12},
-        {"marker_channel", 13},
-        {"package_num_channel", 0},
-        {"num_rows", 14},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}},
-        {"other_channels", {11}}
-    };
-    brainflow_boards_json["boards"]["27"]["default"] =
-    {
-        {"name", "AntNeuroEE211"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 68},
-        {"marker_channel", 69},
-        {"package_num_channel", 0},
-        {"num_rows", 70},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66}},
-        {"other_channels", {67}}
-    };
-    brainflow_boards_json["boards"]["28"]["default"] =
-    {
-        {"name", "AntNeuroEE212"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 36},
-        {"marker_channel", 37},
-        {"package_num_channel", 0},
-        {"num_rows", 38},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34}},
-        {"other_channels", {35}}
-    };
-    brainflow_boards_json["boards"]["29"]["default"] =
-    {
-        {"name", "AntNeuroEE213"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 20},
-        {"marker_channel", 21},
-        {"package_num_channel", 0},
-        {"num_rows", 22},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}},
-        {"other_channels", {19}}
-    };
-    brainflow_boards_json["boards"]["30"]["default"] =
-    {
-        {"name", "AntNeuroEE214"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 60},
-        {"marker_channel", 61},
-        {"package_num_channel", 0},
-        {"num_rows", 62},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 57, 58}},
-        {"other_channels", {59}}
-    };
-    brainflow_boards_json["boards"]["31"]["default"] =
-    {
-        {"name", "AntNeuroEE215"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 92},
-        {"marker_channel", 93},
-        {"package_num_channel", 0},
-        {"num_rows", 94},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64}},
-        {"emg_channels", {65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 55, 56, 57, 58, 59, 60, 61, 62, 63,
-            64, 89, 90}},
-        {"other_channels", {91}}
-    };
-    brainflow_boards_json["boards"]["32"]["default"] =
-    {
-        {"name", "AntNeuroEE221"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 20},
-        {"marker_channel", 21},
-        {"package_num_channel", 0},
-        {"num_rows", 22},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}},
-        {"other_channels", {19}}
-    };
-    brainflow_boards_json["boards"]["33"]["default"] =
-    {
-        {"name", "AntNeuroEE222"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 36},
-        {"marker_channel", 37},
-        {"package_num_channel", 0},
-        {"num_rows", 38},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34}},
-        {"other_channels", {35}}
-    };
-    brainflow_boards_json["boards"]["34"]["default"] =
-    {
-        {"name", "AntNeuroEE223"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 60},
-        {"marker_channel", 61},
-        {"package_num_channel", 0},
-        {"num_rows", 62},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 57, 58}},
-        {"other_channels", {59}}
-    };
-    brainflow_boards_json["boards"]["35"]["default"] =
-    {
-        {"name", "AntNeuroEE224"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 68},
-        {"marker_channel", 69},
-        {"package_num_channel", 0},
-        {"num_rows", 70},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66}},
-        {"other_channels", {67}}
-    };
-    brainflow_boards_json["boards"]["36"]["default"] =
-    {
-        {"name", "AntNeuroEE225"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 92},
-        {"marker_channel", 93},
-        {"package_num_channel", 0},
-        {"num_rows", 94},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64}},
-        {"emg_channels", {65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 55, 56, 57, 58, 59, 60, 61, 62, 63,
-            64, 89, 90}},
-        {"other_channels", {91}}
-    };
-    brainflow_boards_json["boards"]["37"]["default"] =
-    {
-        {"name", "Enophone"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 5},
-        {"marker_channel", 6},
-        {"package_num_channel", 0},
-        {"num_rows", 7},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "A2,A1,C4,C3"}
-    };
-    brainflow_boards_json["boards"]["38"]["default"] =
-    {
-        {"name", "Muse2"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,AF7,AF8,TP10"},
-        {"other_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["38"]["auxiliary"] =
-    {
-        {"name", "Muse2Aux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["38"]["ancillary"] =
-    {
-        {"name", "Muse2Anc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}},
-        {"optical_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["39"]["default"] =
-    {
-        {"name", "MuseS"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,AF7,AF8,TP10"},
-        {"other_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["39"]["auxiliary"] =
-    {
-        {"name", "MuseSAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["39"]["ancillary"] =
-    {
-        {"name", "MuseSAnc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}},
-        {"optical_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["40"]["default"] =
-    {
-        {"name", "BrainAlive"},
-        {"sampling_rate", 250},
-        {"marker_channel", 15},
-        {"timestamp_channel", 16},
-        {"num_rows", 17},
-        {"package_num_channel", 0},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "F7,FT7,T7,CP5,CZ,C6,FC6,F4"},
-        {"accel_channels", {9, 10, 11}},
-        {"gyro_channels", {12, 13, 14}}
-    };
-    brainflow_boards_json["boards"]["41"]["default"] =
-    {
-        {"name", "Muse2016"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 5},
-        {"marker_channel", 6},
-        {"package_num_channel", 0},
-        {"num_rows", 7},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,AF7,AF8,TP10"}
-    };
-    brainflow_boards_json["boards"]["41"]["auxiliary"] =
-    {
-        {"name", "Muse2016Aux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["42"]["default"] =
-    {
-        {"name", "Muse2016BLED"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 5},
-        {"marker_channel", 6},
-        {"package_num_channel", 0},
-        {"num_rows", 7},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,AF7,AF8,TP10"},
-    };
-    brainflow_boards_json["boards"]["42"]["auxiliary"] =
-    {
-        {"name", "Muse2016BLEDAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["44"]["default"] =
-    {
-        {"name", "Explore4Channels"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"ecg_channels", {1, 2, 3, 4}},
-        {"other_channels", {5}} // data status
-    };
-    brainflow_boards_json["boards"]["44"]["auxiliary"] =
-    {
-        {"name", "Explore4Channels"},
-        {"sampling_rate", 20},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["44"]["ancillary"] =
-    {
-        {"name", "Explore4Channels"},
-        {"sampling_rate", 1},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"temperature_channels", {1}},
-        {"battery_channel", 2},
-        {"other_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["45"]["default"] =
-    {
-        {"name", "Explore8Channels"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9}} // data status
-    };
-    brainflow_boards_json["boards"]["45"]["auxiliary"] =
-    {
-        {"name", "Explore8Channels"},
-        {"sampling_rate", 20},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["45"]["ancillary"] =
-    {
-        {"name", "Explore8Channels"},
-        {"sampling_rate", 1},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"temperature_channels", {1}},
-        {"battery_channel", 2},
-        {"other_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["46"]["default"] =
-    {
-        {"name", "Ganglion"},
-        {"sampling_rate", 200},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 13},
-        {"marker_channel", 14},
-        {"num_rows", 15},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"ecg_channels", {1, 2, 3, 4}},
-        {"eog_channels", {1, 2, 3, 4}},
-        {"accel_channels", {5, 6, 7}},
-        {"resistance_channels", {8, 9, 10, 11, 12}}
-    };
-    // todo add other data types and check/fix sampling rates for them
-    brainflow_boards_json["boards"]["47"]["default"] =
-    {
-        {"name", "Emotibit"},
-        {"sampling_rate", 25}, // random value for now
-        {"package_num_channel", 0},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["47"]["auxiliary"] =
-    {
-        {"name", "Emotibit"},
-        {"sampling_rate", 25},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["47"]["ancillary"] =
-    {
-        {"name", "Emotibit"},
-        {"sampling_rate", 15},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"num_rows", 8},
-        {"eda_channels", {1}},
-        {"temperature_channels", {2}},
-        {"other_channels", {3, 6}},
-        {"battery_channel", 7}
-    };
-    brainflow_boards_json["boards"]["50"]["default"] =
-    {
-        {"name", "NtlWifi"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 23},
-        {"marker_channel", 24},
-        {"num_rows", 25},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "Fp1,Fp2,C3,C4,P7,P8,O1,O2"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"accel_channels", {9, 10, 11}},
-        {"analog_channels", {19, 20, 21}},
-        {"other_channels", {12, 13, 14, 15, 16, 17, 18}},
-        {"battery_channel", 22}
-    };
-    brainflow_boards_json["boards"]["51"]["default"] =
-    {
-        {"name", "AntNeuroEE511"},
-        {"sampling_rate", 4096},
-        {"timestamp_channel", 32},
-        {"marker_channel", 33},
-        {"package_num_channel", 0},
-        {"num_rows", 34},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24}},
-        {"emg_channels", {25, 26, 27, 28}},
-        {"resistance_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 29, 30}},
-        {"other_channels", {31}}
-    };
-    brainflow_boards_json["boards"]["52"]["default"] =
-    {
-        {"name", "FreeEEG128"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 129},
-        {"marker_channel", 130},
-        {"package_num_channel", 0},
-        {"num_rows", 131},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128}}
-    };
-    brainflow_boards_json["boards"]["53"]["default"] =
-    {
-        {"name", "AAVAA V3"},
-        {"sampling_rate", 50},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 15},
-        {"marker_channel", 16},
-        {"num_rows", 17},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "L1,L2,L3,L4,R1,R2,R3,R4"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"rotation_channels", {9, 10, 11}},
-        {"battery_channel", 12},
-        {"other_channels", {13, 14}}
-    };
-    brainflow_boards_json["boards"]["54"]["default"] =
-    {
-        {"name", "ExplorePlus8Channels"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9}} // data status
-    };
-    brainflow_boards_json["boards"]["54"]["auxiliary"] =
-    {
-        {"name", "ExplorePlus8Channels"},
-        {"sampling_rate", 20},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["54"]["ancillary"] =
-    {
-        {"name", "ExplorePlus8Channels"},
-        {"sampling_rate", 1},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"temperature_channels", {1}},
-        {"battery_channel", 2},
-        {"other_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["55"]["default"] =
-    {
-        {"name", "ExplorePlus32Channels"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 34},
-        {"marker_channel", 35},
-        {"package_num_channel", 0},
-        {"num_rows", 36},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"other_channels", {33}} // data status
-    };
-    brainflow_boards_json["boards"]["55"]["auxiliary"] =
-    {
-        {"name", "ExplorePlus32Channels"},
-        {"sampling_rate", 20},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["55"]["ancillary"] =
-    {
-        {"name", "ExplorePlus32Channels"},
-        {"sampling_rate", 1},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"temperature_channels", {1}},
-        {"battery_channel", 2},
-        {"other_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["56"]["default"] = {
-        {"name", "PIEEG"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 9},
-        {"marker_channel", 10},
-        {"num_rows", 11},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},  
-        {"eeg_names", "Fp1,Fp2,C3,C4,P7,P8,O1,O2"}
-    };
-    brainflow_boards_json["boards"]["57"]["default"] =
-    {
-        {"name", "Knight"},
-        {"sampling_rate", 125},
-        {"timestamp_channel", 11},
-        {"marker_channel",12},
-        {"package_num_channel", 0},
-        {"num_rows", 13},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9, 10}}
-    };
-    brainflow_boards_json["boards"]["58"]["default"] = {
-        {"name", "Sync-Trio"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"num_rows", 6},
-        {"eeg_channels", {1, 2}},
-        {"ecg_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["59"]["default"] = {
-        {"name", "Sync-Octo"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 9},
-        {"marker_channel", 10},
-        {"num_rows", 11},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7}},
-        {"ecg_channels", {8}}
-    };
-        brainflow_boards_json["boards"]["60"]["default"] = {
-        {"name", "OB5000MAX"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 9},
-        {"marker_channel", 10},
-        {"num_rows", 11},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-    };
-    brainflow_boards_json["boards"]["61"]["default"] = {
-        {"name", "Sync-Neo"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 9},
-        {"marker_channel", 10},
-        {"num_rows", 11},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}}
-    };
-    brainflow_boards_json["boards"]["62"]["default"] = {
-        {"name", "Sync-Uno"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 2},
-        {"marker_channel", 3},
-        {"num_rows", 4},
-        {"eeg_channels", {1}}
-    };
-    brainflow_boards_json["boards"]["63"]["default"] = {
-        {"name", "OB3000"},
-        {"sampling_rate", 500},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 25},
-        {"marker_channel", 26},
-        {"num_rows", 27},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23}},
-        {"ecg_channels", {24}}
-    };
-    brainflow_boards_json["boards"]["64"]["default"] =
-    {
-        {"name", "BioListener"},
-        {"sampling_rate", 500},
-        {"timestamp_channel", 11},
-        {"marker_channel", 12},
-        {"package_num_channel", 0},
-        {"num_rows", 13},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9, 10}}
-    };
-    brainflow_boards_json["boards"]["64"]["auxiliary"] =
-    {
-        {"name", "BioListener"},
-        {"sampling_rate", 50},
-        {"timestamp_channel", 11},
-        {"marker_channel", 12},
-        {"package_num_channel", 0},
-        {"num_rows", 13},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"temperature_channels", {7}},
-        {"battery_channel", 8},
-        {"other_channels", {9, 10}}
-    };
-    brainflow_boards_json["boards"]["65"]["default"] =
-    {
-        {"name", "IronBCI32"},
-        {"sampling_rate", 512},
-        {"timestamp_channel", 33},
-        {"marker_channel", 34},
-        {"package_num_channel", 0},
-        {"num_rows", 35},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}}
-    };
-    brainflow_boards_json["boards"]["66"]["default"] =
-    {
-        {"name", "KnightIMU"},
-        {"sampling_rate", 125},
-        {"timestamp_channel", 20},
-        {"marker_channel", 21},
-        {"package_num_channel", 0},
-        {"num_rows", 22},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19}}
-    };
-    brainflow_boards_json["boards"]["67"]["default"] =
-    {
-        {"name", "MuseAthena"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 9},
-        {"marker_channel", 10},
-        {"package_num_channel", 0},
-        {"num_rows", 11},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,AF7,AF8,TP10"},
-        {"other_channels", {5, 6, 7, 8}}
-    };
-    brainflow_boards_json["boards"]["67"]["auxiliary"] =
-    {
-        {"name", "MuseAthenaAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["67"]["ancillary"] =
-    {
-        {"name", "MuseAthenaAnc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 18},
-        {"marker_channel", 19},
-        {"package_num_channel", 0},
-        {"num_rows", 20},
-        {"optical_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"battery_channel", 17}
-    };
-    brainflow_boards_json["boards"]["68"]["default"] =
-    {
-        {"name", "Shimmer3"},
-        {"sampling_rate", 512}, // configurable via config_board("sampling_rate:<Hz>")
-        {"package_num_channel", 0},
-        {"timestamp_channel", 18},
-        {"marker_channel", 19},
-        {"num_rows", 20},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}},
-        {"ecg_channels", {10, 11, 12, 13}},
-        {"eda_channels", {14}},
-        {"temperature_channels", {15}},
-        {"battery_channel", 16},
-        {"other_channels", {17}}
-    };
+const BoardPresetDescr *get_board_preset_descr (int board_id, int preset)
+{
+    if ((board_id < MIN_BOARD_ID) || (board_id >= MIN_BOARD_ID + NUM_BOARD_IDS) || (preset < 0) ||
+        (preset >= BOARD_DESCR_NUM_PRESETS))
+    {
+        return NULL;
+    }
+    const BoardPresetDescr *descr = &board_descr_table[board_id - MIN_BOARD_ID][preset];
+    return (descr->name == NULL) ? NULL : descr;
 }
-
-BrainFlowBoards boards_struct;
@@ -24,10 +24,17 @@ endif (CMAKE_SIZEOF_VOID_P EQUAL 8)
 
 SET (BOARD_CONTROLLER_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/timestamp.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/timestamp_estimator.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/tsv_parser.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bin_file.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/notification_queue.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/package_queue.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/os_serial.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/os_serial_ioctl.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/serial.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/serial_frame_reader.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/stream_packet.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/libftdi_serial.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/socket_client_tcp.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/socket_client_udp.cpp
@@ -50,13 +57,17 @@ SET (BOARD_CONTROLLER_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board_controller.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board_info_getter.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/preset_layout.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/brainflow_boards.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board_descr.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/streaming_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/synthetic_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/dyn_lib_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/bt_lib_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/playback_file_board.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/streamer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/file_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/bin_file_streamer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/multicast_streamer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/plotjuggler_udp_streamer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/gtec/unicorn_board.cpp
@@ -2,6 +2,8 @@
 
 #include "dyn_lib_board.h"
 
+#define MAX_DYN_LIB_BATCH_SIZE 64
+
 
 DynLibBoard::DynLibBoard (int board_id, struct BrainFlowInputParams params)
     : Board (board_id, params)
@@ -159,21 +161,29 @@ void DynLibBoard::read_thread ()
     }
 
     int num_rows = board_descr["default"]["num_rows"];
-    double *data = new double[num_rows];
+    double *data = new double[num_rows * MAX_DYN_LIB_BATCH_SIZE];
     if (data == NULL)
     {
         safe_logger (spdlog::level::err, "failed to allocate data");
         state = (int)BrainFlowExitCodes::GENERAL_ERROR;
         return;
     }
-    for (int i = 0; i < num_rows; i++)
+    for (int i = 0; i < num_rows * MAX_DYN_LIB_BATCH_SIZE; i++)
     {
         data[i] = 0.0;
     }
     while (keep_alive)
     {
-        int res = func ((void *)data);
-        if (res == (int)BrainFlowExitCodes::STATUS_OK)
+        // library returns a single package per call, take everything it has and push it at once
+        int num_packages = 0;
+        int res = (int)BrainFlowExitCodes::STATUS_OK;
+        while ((num_packages < MAX_DYN_LIB_BATCH_SIZE) &&
+            ((res = func ((void *)(data + num_packages * num_rows))) ==
+                (int)BrainFlowExitCodes::STATUS_OK))
+        {
+            num_packages++;
+        }
+        if (num_packages > 0)
         {
             if (state != (int)BrainFlowExitCodes::STATUS_OK)
             {
@@ -183,9 +193,9 @@ void DynLibBoard::read_thread ()
                 }
                 cv.notify_one ();
             }
-            push_package (data);
+            push_packages (data, num_packages);
         }
-        else
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
             if (state == (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR)
             {
@@ -10,6 +10,7 @@
 #include "json.hpp"
 #include "network_interfaces.h"
 #include "timestamp.h"
+#include "timestamp_estimator.h"
 
 #include "emotibit_defines.h"
 
@@ -214,6 +215,9 @@ void Emotibit::read_thread ()
         }
     }
 
+    // header has device time in milliseconds
+    TimestampEstimator timestamps (0.001);
+
     while (keep_alive)
     {
         int bytes_recv = data_socket->recv (message, max_size);
@@ -230,8 +234,15 @@ void Emotibit::read_thread ()
             int package_num = 0;
             int data_len = 0;
             std::string type_tag = "";
-            if (get_header (recv_package, &package_num, &data_len, type_tag))
+            double device_timestamp = -1.0;
+            if (get_header (recv_package, &package_num, &data_len, type_tag, &device_timestamp))
             {
+                double timestamp = get_timestamp ();
+                if (device_timestamp >= 0)
+                {
+                    timestamp = timestamps.update (device_timestamp, timestamp);
+                    log_clock_stats (timestamps, timestamp);
+                }
                 // default package
                 std::vector<std::string> payload = get_payload (recv_package, data_len);
                 int channel = -1;
@@ -278,7 +289,7 @@ void Emotibit::read_thread ()
                     {
                         default_packages[i]
                                         [board_descr["default"]["timestamp_channel"].get<int> ()] =
-                                            get_timestamp ();
+                                            timestamp;
                         default_packages[i][board_descr["default"]["package_num_channel"]
                                                 .get<int> ()] = package_num;
                         try
@@ -320,7 +331,7 @@ void Emotibit::read_thread ()
                          i++)
                     {
                         aux_packages[i][board_descr["auxiliary"]["timestamp_channel"].get<int> ()] =
-                            get_timestamp ();
+                            timestamp;
                         aux_packages[i]
                                     [board_descr["auxiliary"]["package_num_channel"].get<int> ()] =
                                         package_num;
@@ -406,7 +417,7 @@ void Emotibit::read_thread ()
                     for (int i = 0; i < (int)payload.size (); i++)
                     {
                         anc_packages[i][board_descr["ancillary"]["timestamp_channel"].get<int> ()] =
-                            get_timestamp ();
+                            timestamp;
                         anc_packages[i]
                                     [board_descr["ancillary"]["package_num_channel"].get<int> ()] =
                                         package_num;
@@ -500,21 +511,35 @@ std::vector<std::string> Emotibit::split_string (const std::string &package, cha
     return result;
 }
 
-bool Emotibit::get_header (
-    const std::string &package_string, int *package_num, int *data_len, std::string &type_tag)
+bool Emotibit::get_header (const std::string &package_string, int *package_num, int *data_len,
+    std::string &type_tag, double *device_timestamp)
 {
     std::string serial_number = "";
-    return get_header (package_string, package_num, data_len, type_tag, serial_number);
+    return get_header (
+        package_string, package_num, data_len, type_tag, serial_number, device_timestamp);
 }
 
 bool Emotibit::get_header (const std::string &package_string, int *package_num, int *data_len,
     std::string &type_tag, std::string &serial_number)
+{
+    double device_timestamp = -1.0;
+    return get_header (
+        package_string, package_num, data_len, type_tag, serial_number, &device_timestamp);
+}
+
+bool Emotibit::get_header (const std::string &package_string, int *package_num, int *data_len,
+    std::string &type_tag, std::string &serial_number, double *device_timestamp)
 {
     std::vector<std::string> package = split_string (package_string, PAYLOAD_DELIMITER);
+    *device_timestamp = -1.0;
     if (package.size () >= HEADER_LENGTH)
     {
         try
         {
+            if (package.at (0) != "")
+            {
+                *device_timestamp = stod (package.at (0));
+            }
             if (package.at (1) != "")
             {
                 *package_num = stoi (package.at (1));
@@ -44,10 +44,13 @@ private:
         uint16_t packet_number, uint16_t data_length, uint8_t protocol_version = 1,
         uint8_t data_reliability = 100);
     std::vector<std::string> split_string (const std::string &package, char delim);
-    bool get_header (
-        const std::string &package_string, int *package_num, int *data_len, std::string &type_tag);
+    // device_timestamp is in milliseconds, -1 if not set
+    bool get_header (const std::string &package_string, int *package_num, int *data_len,
+        std::string &type_tag, double *device_timestamp);
     bool get_header (const std::string &package_string, int *package_num, int *data_len,
         std::string &type_tag, std::string &serial_number);
+    bool get_header (const std::string &package_string, int *package_num, int *data_len,
+        std::string &type_tag, std::string &serial_number, double *device_timestamp);
     std::vector<std::string> get_payload (const std::string &package_string, int data_len);
 
     int create_adv_connection ();
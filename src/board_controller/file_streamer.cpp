@@ -37,11 +37,15 @@ int FileStreamer::init_streamer ()
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-void FileStreamer::stream_data (double *data)
+void FileStreamer::write_packages (double *packages, int num_packages)
 {
-    for (int i = 0; i < len - 1; i++)
+    for (int package = 0; package < num_packages; package++)
     {
-        fprintf (fp, "%lf\t", data[i]);
+        double *data = packages + package * len;
+        for (int i = 0; i < len - 1; i++)
+        {
+            fprintf (fp, "%lf\t", data[i]);
+        }
+        fprintf (fp, "%lf\n", data[len - 1]);
     }
-    fprintf (fp, "%lf\n", data[len - 1]);
 }
@@ -5,6 +5,7 @@
 #include "custom_cast.h"
 #include "freeeeg.h"
 #include "serial.h"
+#include "serial_frame_reader.h"
 #include "timestamp.h"
 
 
@@ -131,9 +132,11 @@ int FreeEEG::release_session ()
 
 void FreeEEG::read_thread ()
 {
-    int res;
     constexpr int max_size = 1000; // random value bigger than package size which is unknown
     unsigned char b[max_size] = {0};
+    // skips bytes until the first end and start bytes, to handle the case that we start reading
+    // in the middle of data stream
+    SerialFrameReader reader (serial);
     float eeg_scale = FreeEEG::ads_vref / float ((pow (2, 23) - 1)) / FreeEEG::ads_gain * 1000000.;
     int num_rows = board_descr["default"]["num_rows"];
     double *package = new double[num_rows];
@@ -141,34 +144,16 @@ void FreeEEG::read_thread ()
     {
         package[i] = 0.0;
     }
-    bool first_package_received = false;
 
     std::vector<int> eeg_channels = board_descr["default"]["eeg_channels"];
 
     while (keep_alive)
     {
-        int pos = 0;
-        bool complete_package = false;
-        while ((keep_alive) && (pos < max_size - 2))
+        int size = 0;
+        SerialFrameStatus res = reader.read_delimited_frame (FreeEEG::start_byte,
+            FreeEEG::end_byte, min_package_size, max_size - 2, b, &size);
+        if (res == SerialFrameStatus::FRAME_READY)
         {
-            res = serial->read_from_serial_port (b + pos, 1);
-            int prev_id = (pos <= 0) ? 0 : pos - 1;
-            if ((b[pos] == FreeEEG::start_byte) && (b[prev_id] == FreeEEG::end_byte) &&
-                (pos >= min_package_size))
-            {
-                complete_package = true;
-                break;
-            }
-            pos += res;
-        }
-        if (complete_package)
-        {
-            // handle the case that we start reading in the middle of data stream
-            if (!first_package_received)
-            {
-                first_package_received = true;
-                continue;
-            }
             package[board_descr["default"]["package_num_channel"].get<int> ()] = (double)b[0];
             for (unsigned int i = 0; i < eeg_channels.size (); i++)
             {
@@ -179,8 +164,7 @@ void FreeEEG::read_thread ()
         }
         else
         {
-            safe_logger (
-                spdlog::level::trace, "stopped with pos: {}, keep_alive: {}", pos, keep_alive);
+            safe_logger (spdlog::level::trace, "no package, keep_alive: {}", keep_alive);
         }
     }
     delete[] package;
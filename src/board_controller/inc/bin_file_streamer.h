@@ -0,0 +1,46 @@
+#pragma once
+
+#include "bin_file.h"
+#include "file_streamer.h"
+
+#define DEFAULT_BIN_FILE_BLOCK_SIZE 256
+
+
+// writes packages into binary file described in bin_file.h, a block is flushed to disk once it
+// holds about one second of data
+class BinFileStreamer : public Streamer
+{
+
+public:
+    BinFileStreamer (const char *file, const char *file_mode, int data_len, int board_id,
+        int preset, int sampling_rate);
+    ~BinFileStreamer ();
+
+    int init_streamer ();
+    // same as for csv files
+    BackpressurePolicy get_default_policy ()
+    {
+        return BackpressurePolicy::BLOCK;
+    }
+    bool is_lossless ()
+    {
+        return true;
+    }
+
+protected:
+    void write_packages (double *packages, int num_packages);
+
+private:
+    char file[BRAINFLOW_FILE_NAME_LIMIT];
+    char file_mode[BRAINFLOW_FILE_NAME_LIMIT];
+    int board_id;
+    int preset;
+    int sampling_rate;
+    BinFileWriter writer;
+    // channel major, len x block_size
+    double *block;
+    int block_size;
+    int num_block_samples;
+
+    void flush_block ();
+};
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <thread>
 
 #include "board.h"
 #include "board_controller.h"
+#include "notification_queue.h"
 #include "runtime_dll_loader.h"
 #include "simplecble/types.h"
 
@@ -16,9 +19,24 @@ private:
     static DLLLoader *dll_loader;
     static std::mutex mutex;
 #endif
+    NotificationQueue notification_queue;
+    std::thread notification_thread;
+    std::atomic<bool> keep_notification_worker;
+
+    void notification_worker ();
 
 protected:
     static bool init_dll_loader ();
+    // SimpleBLE callbacks should only copy payloads with queue_notification, decoding happens in
+    // on_notification called from a worker thread, so slow decoding or logging doesnt block the BLE
+    // stack. Tag tells the board which characteristic sent the payload, host_time is taken when
+    // the payload is queued and should be used instead of get_timestamp () in decoders. Worker must
+    // be stopped before the derived board is destroyed
+    int start_notification_worker ();
+    void stop_notification_worker ();
+    bool queue_notification (int tag, const uint8_t *data, size_t size);
+    virtual void on_notification (int tag, const uint8_t *data, size_t size, double host_time);
+    uint64_t get_num_overflowed_notifications ();
     // common
     void simpleble_free (void *handle);
     // adapter
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <deque>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <string>
 
 #include "board_controller.h"
@@ -11,8 +13,11 @@
 #include "brainflow_constants.h"
 #include "brainflow_input_params.h"
 #include "data_buffer.h"
+#include "data_notifier.h"
+#include "preset_layout.h"
 #include "spinlock.h"
 #include "streamer.h"
+#include "timestamp_estimator.h"
 
 #include "spdlog/spdlog.h"
 
@@ -39,14 +44,13 @@ public:
         skip_logs = false;
         this->board_id = board_id;
         this->params = params;
-        try
-        {
-            board_descr = boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)];
-        }
-        catch (json::exception &e)
+        board_descr = board_descr_to_json (board_id);
+        for (int i = 0; i < BOARD_DESCR_NUM_PRESETS; i++)
         {
-            safe_logger (spdlog::level::err, e.what ());
+            num_pushed[i] = 0;
+            num_markers[i] = 0;
         }
+        buffers_generation = 0;
     }
     virtual int prepare_session () = 0;
     virtual int start_stream (int buffer_size, const char *streamer_params) = 0;
@@ -77,7 +81,29 @@ public:
         int num_samples, int preset, double *data_buf, int *returned_samples);
     int get_board_data_count (int preset, int *result);
     int get_board_data (int data_count, int preset, double *data_buf);
+    // removes up to max_samples from the buffer and exposes them in place, spans stay valid until
+    // release_board_data_view. Session can not be released and stream can not be restarted while
+    // a view is held
+    int acquire_board_data_view (int max_samples, int preset, double **first_span,
+        int *first_span_len, double **second_span, int *second_span_len, int *channel_stride,
+        int *sample_stride);
+    int release_board_data_view (int preset);
+    int get_num_data_views ();
     int insert_marker (double value, int preset);
+
+    // counters observed by wait_for_data, taken while the session is locked
+    struct DataWaitTarget
+    {
+        int preset;
+        uint64_t num_pushed;
+        uint64_t num_markers;
+        uint64_t buffers_generation;
+    };
+    // computes how many packages should be pushed until buffer holds at least min_samples
+    int prepare_data_wait (int min_samples, int preset, DataWaitTarget *target);
+    // blocks until target is reached or a marker is pushed, doesnt touch buffers so it can be
+    // called without session lock as long as Board object is alive
+    int wait_for_data (const DataWaitTarget &target, int timeout_ms);
     int add_streamer (const char *streamer_params, int preset);
     int delete_streamer (const char *streamer_params, int preset);
 
@@ -112,22 +138,46 @@ public:
 protected:
     std::map<int, DataBuffer *> dbs;
     std::map<int, std::vector<Streamer *>> streamers;
+    // guards streamers, held while packages are published to streamer queues, never together
+    // with the board lock so a streamer which blocks can not stall readers of the buffers
+    std::mutex streamers_mutex;
     bool skip_logs;
     int board_id;
     struct BrainFlowInputParams params;
     json board_descr;
     SpinLock lock;
     std::map<int, std::deque<double>> marker_queues;
+    // built in prepare_for_acquisition, read only while streaming
+    std::map<int, PresetLayout> preset_layouts;
+    // updated by push_package, waiters are notified only if there are some
+    std::atomic<uint64_t> num_pushed[BOARD_DESCR_NUM_PRESETS];
+    std::atomic<uint64_t> num_markers[BOARD_DESCR_NUM_PRESETS];
+    // changes when buffers are recreated or freed, wakes up all waiters
+    std::atomic<uint64_t> buffers_generation;
+    DataNotifier data_notifier;
 
     int prepare_for_acquisition (int buffer_size, const char *streamer_params);
     void free_packages ();
+    void cancel_data_waits ();
     void push_package (double *package, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    // packages is num_packages x num_rows matrix, markers are written into it
+    void push_packages (
+        double *packages, int num_packages, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    // passes packages with markers to the streamers of this preset, called without board lock
+    void stream_packages (double *packages, int num_packages, int preset);
+    // joins dispatch thread before the streamer is destroyed, derived streamers can still write
+    // in it
+    void free_streamer (Streamer *streamer);
+    // logs device clock drift and offset once per TIMESTAMP_STATS_INTERVAL, called by the thread
+    // which owns the estimator after each update
+    void log_clock_stats (TimestampEstimator &timestamps, double host_time,
+        int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    // returns NULL if preset is not prepared, valid until free_packages
+    const PresetLayout *get_preset_layout (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     std::string preset_to_string (int preset);
     int preset_to_int (std::string preset);
     int parse_streamer_params (const char *streamer_params, std::string &streamer_type,
-        std::string &streamer_dest, std::string &streamer_mods);
-
-private:
-    // reshapes data from DataBuffer format where all channels are mixed to linear buffer
-    void reshape_data (int data_count, int preset, const double *buf, double *output_buf);
+        std::string &streamer_dest, std::string &streamer_mods, std::string &streamer_options);
+    int parse_streamer_options (const std::string &streamer_options, Streamer *streamer,
+        BackpressurePolicy &policy, size_t &queue_size);
 };
@@ -26,8 +26,18 @@ extern "C"
         int *returned_samples, int board_id, const char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION get_board_data_count (
         int preset, int *result, int board_id, const char *json_brainflow_input_params);
+    // removes min (data_count, get_board_data_count) samples and writes them to data_buf as
+    // num_rows x returned samples matrix
     SHARED_EXPORT int CALLING_CONVENTION get_board_data (int data_count, int preset,
         double *data_buf, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION wait_for_board_data (int min_samples, int timeout_ms,
+        int preset, int *data_count, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION acquire_board_data_view (int max_samples, int preset,
+        double **first_span, int *first_span_len, double **second_span, int *second_span_len,
+        int *channel_stride, int *sample_stride, int board_id,
+        const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION release_board_data_view (
+        int preset, int board_id, const char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION get_board_sampling_rate (
         int preset, int *sampling_rate, int board_id, const char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION config_board (const char *config, char *response,
@@ -45,6 +55,39 @@ extern "C"
         const char *streamer, int preset, int board_id, const char *json_brainflow_input_params);
     SHARED_EXPORT int CALLING_CONVENTION release_all_sessions ();
 
+    // session handle methods, handle identifies prepared session without parsing input params
+    SHARED_EXPORT int CALLING_CONVENTION prepare_session_with_handle (
+        int board_id, const char *json_brainflow_input_params, int *handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_session_handle (
+        int board_id, const char *json_brainflow_input_params, int *handle);
+    SHARED_EXPORT int CALLING_CONVENTION start_stream_by_handle (
+        int buffer_size, const char *streamer_params, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION stop_stream_by_handle (int handle);
+    SHARED_EXPORT int CALLING_CONVENTION release_session_by_handle (int handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_current_board_data_by_handle (
+        int num_samples, int preset, double *data_buf, int *returned_samples, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_board_data_count_by_handle (
+        int preset, int *result, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_board_data_by_handle (
+        int data_count, int preset, double *data_buf, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION wait_for_board_data_by_handle (
+        int min_samples, int timeout_ms, int preset, int *data_count, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION acquire_board_data_view_by_handle (int max_samples,
+        int preset, double **first_span, int *first_span_len, double **second_span,
+        int *second_span_len, int *channel_stride, int *sample_stride, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION release_board_data_view_by_handle (
+        int preset, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_board_sampling_rate_by_handle (
+        int preset, int *sampling_rate, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION config_board_by_handle (const char *config,
+        char *response, int *response_len, int response_max_len, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION insert_marker_by_handle (
+        double marker_value, int preset, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION add_streamer_by_handle (
+        const char *streamer, int preset, int handle);
+    SHARED_EXPORT int CALLING_CONVENTION delete_streamer_by_handle (
+        const char *streamer, int preset, int handle);
+
     // logging methods
     SHARED_EXPORT int CALLING_CONVENTION set_log_level_board_controller (int log_level);
     SHARED_EXPORT int CALLING_CONVENTION set_log_file_board_controller (const char *log_file);
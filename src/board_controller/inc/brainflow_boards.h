@@ -4,10 +4,49 @@
 
 using json = nlohmann::json;
 
-struct BrainFlowBoards
+#define BOARD_DESCR_NO_VALUE -1
+#define BOARD_DESCR_NUM_PRESETS 3
+
+
+struct ChannelList
+{
+    const int *channels;
+    int len;
+};
+
+// Static description of a board preset, table of them is generated from brainflow_boards.jsonc
+// by tools/generate_board_descr.py. Missing integer fields are BOARD_DESCR_NO_VALUE, missing
+// strings and channel lists are NULL
+struct BoardPresetDescr
 {
-    json brainflow_boards_json;
-    BrainFlowBoards ();
+    const char *name;
+    int sampling_rate;
+    int package_num_channel;
+    int timestamp_channel;
+    int marker_channel;
+    int battery_channel;
+    int num_rows;
+    const char *eeg_names;
+    ChannelList eeg_channels;
+    ChannelList emg_channels;
+    ChannelList ecg_channels;
+    ChannelList eog_channels;
+    ChannelList eda_channels;
+    ChannelList ppg_channels;
+    ChannelList optical_channels;
+    ChannelList accel_channels;
+    ChannelList rotation_channels;
+    ChannelList analog_channels;
+    ChannelList gyro_channels;
+    ChannelList other_channels;
+    ChannelList temperature_channels;
+    ChannelList resistance_channels;
+    ChannelList magnetometer_channels;
 };
 
-extern BrainFlowBoards boards_struct;
+// returns NULL if there is no such board or the board has no such preset
+const BoardPresetDescr *get_board_preset_descr (int board_id, int preset);
+// json is built on each call, keep it out of hot paths
+json preset_descr_to_json (const BoardPresetDescr &descr);
+// object with descriptions of all board presets keyed by preset name, null if board is unknown
+json board_descr_to_json (int board_id);
@@ -14,7 +14,19 @@ public:
     ~FileStreamer ();
 
     int init_streamer ();
-    void stream_data (double *data);
+    // device thread waits for a slow disk instead of losing recorded packages, it doesnt hold
+    // the board lock while waiting
+    BackpressurePolicy get_default_policy ()
+    {
+        return BackpressurePolicy::BLOCK;
+    }
+    bool is_lossless ()
+    {
+        return true;
+    }
+
+protected:
+    void write_packages (double *packages, int num_packages);
 
 private:
     char file[BRAINFLOW_FILE_NAME_LIMIT];
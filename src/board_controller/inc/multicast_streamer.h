@@ -1,29 +1,49 @@
 #pragma once
 
-#include <thread>
+#include <stdint.h>
+#include <string>
+#include <vector>
 
-#include "data_buffer.h"
 #include "multicast_server.h"
+#include "stream_packet.h"
 #include "streamer.h"
 
 
+// Sends packages to streaming_board. By default each datagram is a versioned stream packet with
+// sequence number, options in streamer params select encoding and batch size, e.g.
+// streaming_board://225.1.1.1:6677?encoding=int24_delta&batch_size=10. Exact rows like package
+// num and markers are sent as float64 in any encoding. encoding=legacy sends raw doubles of
+// exactly BRAINFLOW_BATCH_SIZE packages for receivers built before the packet format
 class MultiCastStreamer : public Streamer
 {
 
 public:
-    MultiCastStreamer (const char *ip, int port, int data_len);
+    MultiCastStreamer (const char *ip, int port, int data_len, int preset, int timestamp_channel,
+        const std::vector<int> &exact_rows);
     ~MultiCastStreamer ();
 
     int init_streamer ();
-    void stream_data (double *data);
+    int set_option (const std::string &key, const std::string &value);
+
+protected:
+    void write_packages (double *packages, int count);
 
 private:
     char ip[128];
     int port;
+    int preset;
+    int timestamp_channel;
+    std::vector<int> exact_rows;
+    bool is_legacy;
+    bool has_batch_size;
+    StreamEncoding encoding;
     MultiCastServer *server;
-    DataBuffer *db;
-    volatile bool is_streaming;
-    std::thread streaming_thread;
-
-    void thread_worker ();
+    // packages are sent in batches of num_packages, legacy receiver expects exactly this number
+    double *transaction;
+    int num_packages;
+    int num_buffered;
+    uint32_t sequence;
+    std::vector<uint8_t> datagram;
+
+    void send_transaction ();
 };
@@ -19,11 +19,11 @@ private:
     std::vector<double> pos_percentage;
     std::vector<std::thread> streaming_threads;
     bool initialized;
-    std::vector<std::vector<long int>> file_offsets;
+    std::vector<std::vector<long long>> file_offsets;
 
     int validate_file_access (const std::string &filename);
     void read_thread (int preset, std::string filename);
-    int get_file_offsets (std::string filename, std::vector<long int> &offsets);
+    int get_file_offsets (std::string filename, std::vector<long long> &offsets);
 
 public:
     PlaybackFileBoard (struct BrainFlowInputParams params);
@@ -1,8 +1,5 @@
 #pragma once
 
-#include <thread>
-
-#include "data_buffer.h"
 #include "socket_client_udp.h"
 #include "streamer.h"
 
@@ -19,17 +16,16 @@ public:
     ~PlotJugglerUDPStreamer ();
 
     int init_streamer ();
-    void stream_data (double *data);
+
+protected:
+    void write_packages (double *packages, int count);
 
 private:
     char ip[128];
     int port;
     SocketClientUDP *socket;
-    DataBuffer *db;
-    volatile bool is_streaming;
-    std::thread streaming_thread;
     json preset_descr;
 
-    void thread_worker ();
+    void send_package (double *package);
     std::string remove_substr (std::string str, std::string substr);
 };
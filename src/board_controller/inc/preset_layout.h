@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+
+// Compiled view of a single preset from brainflow_boards.cpp. It is built once before streaming
+// and used in hot paths instead of json lookups. Optional channels which are not present in board
+// descr are set to -1, optional channel lists are empty
+struct PresetLayout
+{
+    int num_rows;
+    int timestamp_channel;
+    int marker_channel;
+    int package_num_channel;
+    int battery_channel;
+    int sampling_rate;
+
+    std::vector<int> eeg_channels;
+    std::vector<int> emg_channels;
+    std::vector<int> ecg_channels;
+    std::vector<int> eog_channels;
+    std::vector<int> eda_channels;
+    std::vector<int> ppg_channels;
+    std::vector<int> accel_channels;
+    std::vector<int> gyro_channels;
+    std::vector<int> magnetometer_channels;
+    std::vector<int> rotation_channels;
+    std::vector<int> analog_channels;
+    std::vector<int> optical_channels;
+    std::vector<int> temperature_channels;
+    std::vector<int> resistance_channels;
+    std::vector<int> other_channels;
+
+    PresetLayout ();
+
+    // returns BrainFlowExitCodes, fails if required fields are missed or indices are out of range
+    int init (const json &board_preset);
+    void clear ();
+};
@@ -1,7 +1,16 @@
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <thread>
 
+#include "package_queue.h"
+
+#define DEFAULT_STREAMER_QUEUE_SIZE 4096
+
+
+// Board publishes packages into a queue from the device thread, packages are written to the
+// destination by a separate dispatch thread in batches. Derived classes implement write_packages
 class Streamer
 {
 public:
@@ -11,14 +20,38 @@ public:
         streamer_type = type;
         streamer_dest = dest;
         streamer_mods = mods;
+        queue = NULL;
+        is_dispatching = false;
+        last_reported_dropped = 0;
     }
 
-    virtual ~Streamer ()
+    // owner calls stop_dispatch before deleting a streamer, dispatch thread calls write_packages
+    // which is not available once the derived part is destroyed
+    virtual ~Streamer ();
+
+    virtual int init_streamer () = 0;
+    // policy used if user did not provide one in streamer params
+    virtual BackpressurePolicy get_default_policy ()
     {
+        return BackpressurePolicy::DROP_OLDEST;
     }
+    // recording sinks must not lose packages, only BLOCK policy is accepted for them
+    virtual bool is_lossless ()
+    {
+        return false;
+    }
+    // streamer specific key=value option from streamer params, called before init_streamer,
+    // returns BrainFlowExitCodes
+    virtual int set_option (const std::string &key, const std::string &value);
 
-    virtual int init_streamer () = 0;
-    virtual void stream_data (double *data) = 0;
+    int start_dispatch (BackpressurePolicy policy, size_t queue_size);
+    // writes remaining packages and joins dispatch thread
+    void stop_dispatch ();
+    // called by board for each package, doesnt do any IO
+    void stream_data (double *data);
+    // data is num_packages x len matrix
+    void stream_data (double *data, int num_packages);
+    uint64_t get_num_dropped ();
 
     virtual bool check_equals (std::string type, std::string dest, std::string mods)
     {
@@ -30,4 +63,15 @@ protected:
     std::string streamer_dest;
     std::string streamer_mods;
     int len;
+
+    // called from dispatch thread only, packages is num_packages x len matrix
+    virtual void write_packages (double *packages, int num_packages) = 0;
+
+private:
+    PackageQueue *queue;
+    std::thread dispatch_thread;
+    std::atomic<bool> is_dispatching;
+    uint64_t last_reported_dropped;
+
+    void dispatch_worker ();
 };
@@ -7,6 +7,7 @@
 #include "board.h"
 #include "board_controller.h"
 #include "multicast_client.h"
+#include "stream_packet.h"
 
 
 class StreamingBoard : public Board
@@ -18,9 +19,12 @@ private:
     std::vector<std::thread> streaming_threads;
     std::vector<MultiCastClient *> clients;
     std::vector<int> presets;
+    // per client, datagrams are checked by sequence numbers
+    std::vector<StreamSequenceTracker *> trackers;
 
     void read_thread (int num);
     void log_socket_error (int error_code);
+    void free_clients ();
 
 public:
     StreamingBoard (struct BrainFlowInputParams params);
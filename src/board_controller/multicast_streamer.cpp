@@ -9,43 +9,113 @@
 #include "multicast_streamer.h"
 
 
-MultiCastStreamer::MultiCastStreamer (const char *ip, int port, int data_len)
+MultiCastStreamer::MultiCastStreamer (const char *ip, int port, int data_len, int preset,
+    int timestamp_channel, const std::vector<int> &exact_rows)
     : Streamer (data_len, "streaming_board", ip, std::to_string (port))
 {
     strcpy (this->ip, ip);
     this->port = port;
+    this->preset = preset;
+    this->timestamp_channel = timestamp_channel;
+    this->exact_rows = exact_rows;
+    is_legacy = false;
+    has_batch_size = false;
+    encoding = StreamEncoding::FLOAT64;
     server = NULL;
-    is_streaming = false;
-    db = NULL;
+    transaction = NULL;
+    num_packages = get_brainflow_batch_size ();
+    num_buffered = 0;
+    sequence = 0;
 }
 
 MultiCastStreamer::~MultiCastStreamer ()
 {
-    if ((streaming_thread.joinable ()) && (is_streaming))
+    // legacy receiver drops incomplete transactions
+    if ((server != NULL) && (!is_legacy) && (num_buffered > 0))
     {
-        is_streaming = false;
-        streaming_thread.join ();
+        send_transaction ();
     }
     if (server != NULL)
     {
         delete server;
         server = NULL;
     }
-    if (db != NULL)
+    if (transaction != NULL)
     {
-        delete db;
-        db = NULL;
+        delete[] transaction;
+        transaction = NULL;
     }
 }
 
+int MultiCastStreamer::set_option (const std::string &key, const std::string &value)
+{
+    if (key == "encoding")
+    {
+        is_legacy = (value == "legacy");
+        if ((!is_legacy) && (!parse_stream_encoding (value.c_str (), &encoding)))
+        {
+            Board::board_logger->error ("unsupported encoding {}", value.c_str ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    if (key == "batch_size")
+    {
+        try
+        {
+            num_packages = std::stoi (value);
+        }
+        catch (const std::exception &e)
+        {
+            Board::board_logger->error (e.what ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        if (num_packages <= 0)
+        {
+            Board::board_logger->error ("invalid batch size {}", num_packages);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        has_batch_size = true;
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+}
+
 int MultiCastStreamer::init_streamer ()
 {
-    if ((is_streaming) || (server != NULL) || (db != NULL))
+    if (server != NULL)
     {
         Board::board_logger->error ("multicast streamer is running");
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
 
+    if ((is_legacy) && (has_batch_size))
+    {
+        // options can come in any order, so it is checked here
+        Board::board_logger->error (
+            "batch_size is not supported by legacy encoding, receiver expects BRAINFLOW_BATCH_SIZE "
+            "packages");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (!is_legacy)
+    {
+        int num_exact_rows = (int)exact_rows.size ();
+        // batch must fit into a single datagram
+        while ((num_packages > 1) &&
+            (get_stream_packet_max_size (len, num_packages, encoding, num_exact_rows) >
+                STREAM_PACKET_MAX_SIZE))
+        {
+            num_packages--;
+        }
+        size_t max_size = get_stream_packet_max_size (len, num_packages, encoding, num_exact_rows);
+        if (max_size > STREAM_PACKET_MAX_SIZE)
+        {
+            Board::board_logger->error ("package with {} channels doesnt fit into datagram", len);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        datagram.resize (max_size);
+    }
+
     server = new MultiCastServer (ip, port);
     int res = server->init ();
     if (res != (int)MultiCastReturnCodes::STATUS_OK)
@@ -56,51 +126,41 @@ int MultiCastStreamer::init_streamer ()
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
 
-    db = new DataBuffer (len, 1000);
-    if (!db->is_ready ())
+    num_buffered = 0;
+    sequence = 0;
+    transaction = new double[num_packages * len];
+    for (int i = 0; i < num_packages * len; i++)
     {
-        Board::board_logger->error ("unable to prepare buffer for multicast");
-        delete db;
-        db = NULL;
-        delete server;
-        server = NULL;
-        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+        transaction[i] = 0.0;
     }
-
-    is_streaming = true;
-    streaming_thread = std::thread ([this] { this->thread_worker (); });
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-void MultiCastStreamer::stream_data (double *data)
+void MultiCastStreamer::write_packages (double *packages, int count)
 {
-    db->add_data (data);
+    for (int i = 0; i < count; i++)
+    {
+        memcpy (transaction + num_buffered * len, packages + i * len, sizeof (double) * len);
+        num_buffered++;
+        if (num_buffered == num_packages)
+        {
+            send_transaction ();
+        }
+    }
 }
 
-void MultiCastStreamer::thread_worker ()
+void MultiCastStreamer::send_transaction ()
 {
-    int num_packages = get_brainflow_batch_size ();
-    int transaction_len = num_packages * len;
-    double *transaction = new double[transaction_len];
-    for (int i = 0; i < transaction_len; i++)
+    if (is_legacy)
     {
-        transaction[i] = 0.0;
+        server->send (transaction, sizeof (double) * num_packages * len);
     }
-    while (is_streaming)
+    else
     {
-        if (db->get_data_count () >= (size_t)num_packages)
-        {
-            db->get_data (num_packages, transaction);
-            server->send (transaction, sizeof (double) * transaction_len);
-        }
-        else
-        {
-#ifdef _WIN32
-            Sleep (1);
-#else
-            usleep (100);
-#endif
-        }
+        size_t size = encode_stream_packet (transaction, len, num_buffered, timestamp_channel,
+            exact_rows, preset, sequence, encoding, datagram.data (), datagram.size ());
+        server->send (datagram.data (), (int)size);
+        sequence++;
     }
-    delete[] transaction;
+    num_buffered = 0;
 }
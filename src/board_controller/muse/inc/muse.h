@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ble_lib_board.h"
+#include "preset_layout.h"
+#include "timestamp_estimator.h"
 #include <condition_variable>
 #include <mutex>
 #include <string>
@@ -27,10 +29,21 @@ protected:
     std::vector<bool> new_eeg_data;
     std::vector<bool> new_ppg_data;
     double last_fifth_chan_timestamp; // used to determine 4 or 5 channels used
-    double last_ppg_timestamp;        // used for timestamp correction
-    double last_eeg_timestamp;        // used for timestamp correction
-    double last_aux_timestamp;        // used for timestamp correction
+    // map package nums to host time for timestamp correction
+    TimestampEstimator eeg_timestamps;
+    TimestampEstimator aux_timestamps;
+    TimestampEstimator ppg_timestamps;
     std::string muse_preset;
+    // channel indices for decoding, built in prepare_session
+    PresetLayout default_layout;
+    PresetLayout aux_layout;
+    PresetLayout anc_layout;
+
+    void on_notification (int tag, const uint8_t *data, size_t size, double host_time) override;
+    void decode_eeg (const uint8_t *data, size_t size, size_t channel_num, double host_time);
+    void decode_accel (const uint8_t *data, size_t size);
+    void decode_gyro (const uint8_t *data, size_t size, double host_time);
+    void decode_ppg (const uint8_t *data, size_t size, size_t ppg_num, double host_time);
 
 public:
     Muse (int board_id, struct BrainFlowInputParams params);
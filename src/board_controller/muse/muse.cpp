@@ -9,6 +9,12 @@
 
 #include <iostream>
 
+// tags of queued notifications, eeg and ppg tags are followed by channel number
+#define MUSE_EEG_NOTIFICATION 0
+#define MUSE_ACCEL_NOTIFICATION 5
+#define MUSE_GYRO_NOTIFICATION 6
+#define MUSE_PPG_NOTIFICATION 7
+
 void adapter_on_scan_found (
     simpleble_adapter_t adapter, simpleble_peripheral_t peripheral, void *board)
 {
@@ -83,9 +89,6 @@ Muse::Muse (int board_id, struct BrainFlowInputParams params) : BLELibBoard (boa
     muse_peripheral = NULL;
     is_streaming = false;
     last_fifth_chan_timestamp = -1.0;
-    last_ppg_timestamp = -1.0;
-    last_eeg_timestamp = -1.0;
-    last_aux_timestamp = -1.0;
     muse_preset = "p21";
 }
 
@@ -400,8 +403,10 @@ int Muse::prepare_session ()
 
     if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (control_characteristics_found))
     {
-        int eeg_buffer_size = board_descr["default"]["num_rows"].get<int> ();
-        int aux_buffer_size = board_descr["auxiliary"]["num_rows"].get<int> ();
+        default_layout.init (board_descr["default"]);
+        aux_layout.init (board_descr["auxiliary"]);
+        int eeg_buffer_size = default_layout.num_rows;
+        int aux_buffer_size = aux_layout.num_rows;
         current_default_buf.resize (12); // 12 eeg packages in single ble transaction
         new_eeg_data.resize (5);         // 5 eeg channels total
         current_aux_buf.resize (3);      // 3 samples in each message for gyro and accel
@@ -411,6 +416,8 @@ int Muse::prepare_session ()
             std::fill (current_default_buf[i].begin (), current_default_buf[i].end (), 0.0);
         }
         std::fill (new_eeg_data.begin (), new_eeg_data.end (), false);
+        eeg_timestamps = TimestampEstimator (1.0 / default_layout.sampling_rate);
+        aux_timestamps = TimestampEstimator (1.0 / aux_layout.sampling_rate);
         for (int i = 0; i < 3; i++)
         {
             current_aux_buf[i].resize (aux_buffer_size);
@@ -419,7 +426,8 @@ int Muse::prepare_session ()
         // muse 2016 has no ppg
         if (board_id != (int)BoardIds::MUSE_2016_BOARD)
         {
-            int anc_buffer_size = board_descr["ancillary"]["num_rows"].get<int> ();
+            anc_layout.init (board_descr["ancillary"]);
+            int anc_buffer_size = anc_layout.num_rows;
             current_anc_buf.resize (6); // 6 ppg packages in single transaction
             for (int i = 0; i < 6; i++)
             {
@@ -428,9 +436,14 @@ int Muse::prepare_session ()
             }
             new_ppg_data.resize (3); // 3 ppg chars
             std::fill (new_ppg_data.begin (), new_ppg_data.end (), false);
+            ppg_timestamps = TimestampEstimator (1.0 / anc_layout.sampling_rate);
         }
 
-        initialized = true;
+        res = start_notification_worker ();
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            initialized = true;
+        }
     }
 
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
@@ -485,10 +498,12 @@ int Muse::stop_stream ()
         res = (int)BrainFlowExitCodes::STREAM_ALREADY_RUN_ERROR;
     }
     is_streaming = false;
+    // decoding thread uses this state
+    std::lock_guard<std::mutex> callback_guard (callback_lock);
     last_fifth_chan_timestamp = -1.0;
-    last_ppg_timestamp = -1.0;
-    last_eeg_timestamp = -1.0;
-    last_aux_timestamp = -1.0;
+    eeg_timestamps.reset ();
+    aux_timestamps.reset ();
+    ppg_timestamps.reset ();
     return res;
 }
 
@@ -517,6 +532,7 @@ int Muse::release_session ()
                 }
             }
         }
+        stop_notification_worker ();
         free_packages ();
         initialized = false;
     }
@@ -645,8 +661,51 @@ void Muse::adapter_on_scan_found (simpleble_adapter_t adapter, simpleble_periphe
 
 void Muse::peripheral_on_eeg (simpleble_peripheral_t peripheral, simpleble_uuid_t service,
     simpleble_uuid_t characteristic, const uint8_t *data, size_t size, size_t channel_num)
+{
+    queue_notification (MUSE_EEG_NOTIFICATION + (int)channel_num, data, size);
+}
+
+void Muse::peripheral_on_accel (simpleble_peripheral_t peripheral, simpleble_uuid_t service,
+    simpleble_uuid_t characteristic, const uint8_t *data, size_t size)
+{
+    queue_notification (MUSE_ACCEL_NOTIFICATION, data, size);
+}
+
+void Muse::peripheral_on_gyro (simpleble_peripheral_t peripheral, simpleble_uuid_t service,
+    simpleble_uuid_t characteristic, const uint8_t *data, size_t size)
+{
+    queue_notification (MUSE_GYRO_NOTIFICATION, data, size);
+}
+
+void Muse::peripheral_on_ppg (simpleble_peripheral_t peripheral, simpleble_uuid_t service,
+    simpleble_uuid_t characteristic, const uint8_t *data, size_t size, size_t ppg_num)
+{
+    queue_notification (MUSE_PPG_NOTIFICATION + (int)ppg_num, data, size);
+}
+
+void Muse::on_notification (int tag, const uint8_t *data, size_t size, double host_time)
 {
     std::lock_guard<std::mutex> callback_guard (callback_lock);
+    if (tag == MUSE_ACCEL_NOTIFICATION)
+    {
+        decode_accel (data, size);
+    }
+    else if (tag == MUSE_GYRO_NOTIFICATION)
+    {
+        decode_gyro (data, size, host_time);
+    }
+    else if (tag >= MUSE_PPG_NOTIFICATION)
+    {
+        decode_ppg (data, size, (size_t)(tag - MUSE_PPG_NOTIFICATION), host_time);
+    }
+    else
+    {
+        decode_eeg (data, size, (size_t)(tag - MUSE_EEG_NOTIFICATION), host_time);
+    }
+}
+
+void Muse::decode_eeg (const uint8_t *data, size_t size, size_t channel_num, double host_time)
+{
     if (size != 20)
     {
         safe_logger (spdlog::level::warn, "unknown size for eeg callback: {}", size);
@@ -657,11 +716,10 @@ void Muse::peripheral_on_eeg (simpleble_peripheral_t peripheral, simpleble_uuid_
      * timestamps to determine if its on or not */
     if (channel_num == 4)
     {
-        last_fifth_chan_timestamp = get_timestamp ();
+        last_fifth_chan_timestamp = host_time;
     }
     new_eeg_data[channel_num] = true;
 
-    std::vector<int> eeg_channels = board_descr["default"]["eeg_channels"];
     unsigned int package_num = data[0] * 256 + data[1];
     for (size_t i = 2, counter = 0; i < size; i += 3, counter += 2)
     {
@@ -672,27 +730,19 @@ void Muse::peripheral_on_eeg (simpleble_peripheral_t peripheral, simpleble_uuid_
         // place optional aux channel to other channels
         if (channel_num == 4)
         {
-            try
-            {
-                std::vector<int> other_channels = board_descr["default"]["other_channels"];
-                current_default_buf[counter][other_channels[0]] = val1;
-                current_default_buf[counter + 1][other_channels[0]] = val2;
-            }
-            catch (...)
+            if (!default_layout.other_channels.empty ())
             {
-                safe_logger (spdlog::level::trace,
-                    "no other_channels for this board"); // should not get here
+                current_default_buf[counter][default_layout.other_channels[0]] = val1;
+                current_default_buf[counter + 1][default_layout.other_channels[0]] = val2;
             }
         }
         else
         {
-            current_default_buf[counter][eeg_channels[channel_num]] = val1;
-            current_default_buf[counter + 1][eeg_channels[channel_num]] = val2;
+            current_default_buf[counter][default_layout.eeg_channels[channel_num]] = val1;
+            current_default_buf[counter + 1][default_layout.eeg_channels[channel_num]] = val2;
         }
-        current_default_buf[counter][board_descr["default"]["package_num_channel"].get<int> ()] =
-            package_num;
-        current_default_buf[counter +
-            1][board_descr["default"]["package_num_channel"].get<int> ()] = package_num;
+        current_default_buf[counter][default_layout.package_num_channel] = package_num;
+        current_default_buf[counter + 1][default_layout.package_num_channel] = package_num;
     }
 
     int num_trues = 0;
@@ -704,32 +754,30 @@ void Muse::peripheral_on_eeg (simpleble_peripheral_t peripheral, simpleble_uuid_
         }
     }
 
-    double current_timestamp = get_timestamp ();
+    double current_timestamp = host_time;
 
     if ((num_trues == new_eeg_data.size ()) ||
         ((num_trues == new_eeg_data.size () - 1) &&
             (current_timestamp - last_fifth_chan_timestamp > 1)))
     {
-        // skip one package to setup timestamp correction
-        if (last_eeg_timestamp > 0)
+        // package num is incremented once per transaction
+        int num_samples = (int)current_default_buf.size ();
+        double device_clock = eeg_timestamps.get_device_clock (
+            (int)package_num, 65536, current_timestamp, num_samples);
+        eeg_timestamps.update (device_clock + num_samples - 1, current_timestamp);
+        log_clock_stats (eeg_timestamps, current_timestamp);
+        for (int i = 0; i < num_samples; i++)
         {
-            double step = (current_timestamp - last_eeg_timestamp) / current_default_buf.size ();
-            for (size_t i = 0; i < current_default_buf.size (); i++)
-            {
-                current_default_buf[i][board_descr["default"]["timestamp_channel"].get<int> ()] =
-                    last_eeg_timestamp + step * (i + 1);
-                push_package (&current_default_buf[i][0]);
-            }
+            current_default_buf[i][default_layout.timestamp_channel] =
+                eeg_timestamps.get_timestamp (device_clock + i);
+            push_package (&current_default_buf[i][0]);
         }
-        last_eeg_timestamp = current_timestamp;
         std::fill (new_eeg_data.begin (), new_eeg_data.end (), false);
     }
 }
 
-void Muse::peripheral_on_accel (simpleble_peripheral_t peripheral, simpleble_uuid_t service,
-    simpleble_uuid_t characteristic, const uint8_t *data, size_t size)
+void Muse::decode_accel (const uint8_t *data, size_t size)
 {
-    std::lock_guard<std::mutex> callback_guard (callback_lock);
     if (size != 20)
     {
         safe_logger (spdlog::level::warn, "unknown size for accel callback: {}", size);
@@ -741,16 +789,14 @@ void Muse::peripheral_on_accel (simpleble_peripheral_t peripheral, simpleble_uui
         double accel_valx = (double)cast_16bit_to_int32 ((unsigned char *)&data[2 + i * 6]) / 16384;
         double accel_valy = (double)cast_16bit_to_int32 ((unsigned char *)&data[4 + i * 6]) / 16384;
         double accel_valz = (double)cast_16bit_to_int32 ((unsigned char *)&data[6 + i * 6]) / 16384;
-        current_aux_buf[i][board_descr["auxiliary"]["accel_channels"][0].get<int> ()] = accel_valx;
-        current_aux_buf[i][board_descr["auxiliary"]["accel_channels"][1].get<int> ()] = accel_valy;
-        current_aux_buf[i][board_descr["auxiliary"]["accel_channels"][2].get<int> ()] = accel_valz;
+        current_aux_buf[i][aux_layout.accel_channels[0]] = accel_valx;
+        current_aux_buf[i][aux_layout.accel_channels[1]] = accel_valy;
+        current_aux_buf[i][aux_layout.accel_channels[2]] = accel_valz;
     }
 }
 
-void Muse::peripheral_on_gyro (simpleble_peripheral_t peripheral, simpleble_uuid_t service,
-    simpleble_uuid_t characteristic, const uint8_t *data, size_t size)
+void Muse::decode_gyro (const uint8_t *data, size_t size, double host_time)
 {
-    std::lock_guard<std::mutex> callback_guard (callback_lock);
     if (size != 20)
     {
         safe_logger (spdlog::level::warn, "unknown size for gyro callback: {}", size);
@@ -758,7 +804,7 @@ void Muse::peripheral_on_gyro (simpleble_peripheral_t peripheral, simpleble_uuid
     }
 
     unsigned int package_num = data[0] * 256 + data[1];
-    double current_timestamp = get_timestamp ();
+    double current_timestamp = host_time;
 
     for (int i = 0; i < 3; i++)
     {
@@ -768,44 +814,45 @@ void Muse::peripheral_on_gyro (simpleble_peripheral_t peripheral, simpleble_uuid
             MUSE_GYRO_SCALE_FACTOR;
         double gyro_valz = (double)cast_16bit_to_int32 ((unsigned char *)&data[6 + i * 6]) *
             MUSE_GYRO_SCALE_FACTOR;
-        current_aux_buf[i][board_descr["auxiliary"]["gyro_channels"][0].get<int> ()] = gyro_valx;
-        current_aux_buf[i][board_descr["auxiliary"]["gyro_channels"][1].get<int> ()] = gyro_valy;
-        current_aux_buf[i][board_descr["auxiliary"]["gyro_channels"][2].get<int> ()] = gyro_valz;
-        current_aux_buf[i][board_descr["auxiliary"]["package_num_channel"].get<int> ()] =
-            (double)package_num;
+        current_aux_buf[i][aux_layout.gyro_channels[0]] = gyro_valx;
+        current_aux_buf[i][aux_layout.gyro_channels[1]] = gyro_valy;
+        current_aux_buf[i][aux_layout.gyro_channels[2]] = gyro_valz;
+        current_aux_buf[i][aux_layout.package_num_channel] = (double)package_num;
     }
 
-    if (last_aux_timestamp > 0)
+    int num_samples = (int)current_aux_buf.size ();
+    double device_clock = aux_timestamps.get_device_clock (
+        (int)package_num, 65536, current_timestamp, num_samples);
+    aux_timestamps.update (device_clock + num_samples - 1, current_timestamp);
+    log_clock_stats (aux_timestamps, current_timestamp, (int)BrainFlowPresets::AUXILIARY_PRESET);
+    // push aux packages from gyro callback
+    for (int i = 0; i < num_samples; i++)
     {
-        double step = (current_timestamp - last_aux_timestamp) / current_aux_buf.size ();
-        // push aux packages from gyro callback
-        for (size_t i = 0; i < current_aux_buf.size (); i++)
-        {
-            current_aux_buf[i][board_descr["auxiliary"]["timestamp_channel"].get<int> ()] =
-                last_aux_timestamp + step * (i + 1);
-            push_package (&current_aux_buf[i][0], (int)BrainFlowPresets::AUXILIARY_PRESET);
-        }
+        current_aux_buf[i][aux_layout.timestamp_channel] =
+            aux_timestamps.get_timestamp (device_clock + i);
+        push_package (&current_aux_buf[i][0], (int)BrainFlowPresets::AUXILIARY_PRESET);
     }
-    last_aux_timestamp = current_timestamp;
 }
 
-void Muse::peripheral_on_ppg (simpleble_peripheral_t peripheral, simpleble_uuid_t service,
-    simpleble_uuid_t characteristic, const uint8_t *data, size_t size, size_t ppg_num)
+void Muse::decode_ppg (const uint8_t *data, size_t size, size_t ppg_num, double host_time)
 {
-    std::lock_guard<std::mutex> callback_guard (callback_lock);
     if (size != 20)
     {
         safe_logger (spdlog::level::warn, "unknown size for ppg callback: {}", size);
         return;
     }
+    if (new_ppg_data.empty ())
+    {
+        // muse 2016 has no ppg
+        return;
+    }
     unsigned int package_num = data[0] * 256 + data[1];
     new_ppg_data[ppg_num] = true;
-    std::vector<int> ppg_channels = board_descr["ancillary"]["ppg_channels"];
     // format is: 2 bytes for package num, 6 int24 values for actual data
     for (int i = 0; i < 6; i++)
     {
         double ppg_val = (double)cast_24bit_to_int32 ((unsigned char *)&data[2 + i * 3]);
-        current_anc_buf[i][ppg_channels[ppg_num]] = ppg_val;
+        current_anc_buf[i][anc_layout.ppg_channels[ppg_num]] = ppg_val;
     }
     int num_trues = 0;
     for (size_t i = 0; i < new_ppg_data.size (); i++)
@@ -816,23 +863,23 @@ void Muse::peripheral_on_ppg (simpleble_peripheral_t peripheral, simpleble_uuid_
         }
     }
 
-    double current_timestamp = get_timestamp ();
+    double current_timestamp = host_time;
 
     if (num_trues == new_ppg_data.size () - 1) // actually it streams only 2 of 3 ppg data types and
                                                // I am not sure that these 2 are freezed
     {
-        // skip one package to setup timestamp correction
-        if (last_ppg_timestamp > 0)
+        int num_samples = (int)current_anc_buf.size ();
+        double device_clock = ppg_timestamps.get_device_clock (
+            (int)package_num, 65536, current_timestamp, num_samples);
+        ppg_timestamps.update (device_clock + num_samples - 1, current_timestamp);
+        log_clock_stats (
+            ppg_timestamps, current_timestamp, (int)BrainFlowPresets::ANCILLARY_PRESET);
+        for (int i = 0; i < num_samples; i++)
         {
-            double step = (current_timestamp - last_ppg_timestamp) / current_anc_buf.size ();
-            for (size_t i = 0; i < current_anc_buf.size (); i++)
-            {
-                current_anc_buf[i][board_descr["ancillary"]["timestamp_channel"].get<int> ()] =
-                    last_ppg_timestamp + step * (i + 1);
-                push_package (&current_anc_buf[i][0], (int)BrainFlowPresets::ANCILLARY_PRESET);
-            }
+            current_anc_buf[i][anc_layout.timestamp_channel] =
+                ppg_timestamps.get_timestamp (device_clock + i);
+            push_package (&current_anc_buf[i][0], (int)BrainFlowPresets::ANCILLARY_PRESET);
         }
-        last_ppg_timestamp = current_timestamp;
         std::fill (new_ppg_data.begin (), new_ppg_data.end (), false);
     }
 }
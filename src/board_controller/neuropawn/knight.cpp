@@ -3,6 +3,7 @@
 
 #include "custom_cast.h"
 #include "knight.h"
+#include "serial_frame_reader.h"
 #include "timestamp.h"
 
 Knight::Knight (int board_id, struct BrainFlowInputParams params) : KnightBase (board_id, params)
@@ -27,8 +28,8 @@ void Knight::read_thread ()
     [20] 21 Byte: End byte
     */
 
-    int res;
     unsigned char b[20] = {0};
+    SerialFrameReader reader (serial);
     float eeg_scale = 4 / float ((pow (2, 15) - 1)) / 12 * 1000000.;
     int num_rows = board_descr["default"]["num_rows"];
     double *package = new double[num_rows];
@@ -43,33 +44,14 @@ void Knight::read_thread ()
 
     while (keep_alive)
     {
-        // checking the start byte
-        res = serial->read_from_serial_port (b, 1);
-        if (res != 1)
+        SerialFrameStatus res = reader.read_frame (KnightBase::start_byte, KnightBase::end_byte,
+            KnightBase::end_byte, 20, b);
+        if (res == SerialFrameStatus::NO_DATA)
         {
-            safe_logger (spdlog::level::debug, "unable to read 1 byte, {}");
+            safe_logger (spdlog::level::debug, "unable to read data");
             continue;
         }
-        if (b[0] != KnightBase::start_byte)
-        {
-            continue;
-        }
-
-        int remaining_bytes = 20;
-        int pos = 0;
-        while ((remaining_bytes > 0) && (keep_alive))
-        {
-            res = serial->read_from_serial_port (b + pos, remaining_bytes);
-            remaining_bytes -= res;
-            pos += res;
-        }
-
-        if (!keep_alive)
-        {
-            break;
-        }
-
-        if (b[19] != KnightBase::end_byte)
+        if (res == SerialFrameStatus::WRONG_END_BYTE)
         {
             safe_logger (spdlog::level::warn, "Wrong end byte {}", b[19]);
             continue;
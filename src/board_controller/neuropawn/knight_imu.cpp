@@ -6,6 +6,7 @@
 
 #include "custom_cast.h"
 #include "knight_imu.h"
+#include "serial_frame_reader.h"
 #include "timestamp.h"
 
 KnightIMU::KnightIMU (int board_id, struct BrainFlowInputParams params)
@@ -26,7 +27,6 @@ void KnightIMU::read_thread ()
     [56]   1 Byte : END (0xC0)
     */
 
-    int res;
     constexpr int exg_channels_count = 8;
     constexpr int imu_channels_count = 9;
     constexpr int loff_bytes = 2;
@@ -34,6 +34,7 @@ void KnightIMU::read_thread ()
         (imu_channels_count * 4) + 1 /*end*/;
 
     unsigned char b[frame_payload_size] = {0};
+    SerialFrameReader reader (serial);
 
     float eeg_scale = 4 / float ((pow (2, 15) - 1)) / 12 * 1000000.;
     int num_rows = board_descr["default"]["num_rows"];
@@ -48,37 +49,14 @@ void KnightIMU::read_thread ()
 
     while (keep_alive)
     {
-        // checking the start byte
-        unsigned char start = 0;
-        res = serial->read_from_serial_port (&start, 1);
-        if (res != 1)
+        SerialFrameStatus res = reader.read_frame (KnightBase::start_byte, KnightBase::end_byte,
+            KnightBase::end_byte, frame_payload_size, b);
+        if (res == SerialFrameStatus::NO_DATA)
         {
-            safe_logger (spdlog::level::debug, "unable to read 1 byte, {}");
+            safe_logger (spdlog::level::debug, "unable to read data");
             continue;
         }
-        if (start != KnightBase::start_byte)
-        {
-            continue;
-        }
-
-        int remaining_bytes = frame_payload_size;
-        int pos = 0;
-        while ((remaining_bytes > 0) && (keep_alive))
-        {
-            res = serial->read_from_serial_port (b + pos, remaining_bytes);
-            if (res > 0)
-            {
-                remaining_bytes -= res;
-                pos += res;
-            }
-        }
-
-        if (!keep_alive)
-        {
-            break;
-        }
-
-        if (b[frame_payload_size - 1] != KnightBase::end_byte)
+        if (res == SerialFrameStatus::WRONG_END_BYTE)
         {
             safe_logger (spdlog::level::warn, "Wrong end byte {}", b[frame_payload_size - 1]);
             continue;
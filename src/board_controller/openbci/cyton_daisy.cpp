@@ -3,7 +3,9 @@
 #include "custom_cast.h"
 #include "cyton_daisy.h"
 #include "serial.h"
+#include "serial_frame_reader.h"
 #include "timestamp.h"
+#include "timestamp_estimator.h"
 
 #define START_BYTE 0xA0
 #define END_BYTE_STANDARD 0xC0
@@ -43,8 +45,8 @@ void CytonDaisy::read_thread ()
         Aux Data Bytes 27-32: 6 bytes of data
         Byte 33: 0xCX where X is 0-F in hex
     */
-    int res;
     unsigned char b[32];
+    SerialFrameReader reader (serial);
     bool first_sample = true;
     double accel[3] = {0.};
     double *package = new double[board_descr["default"]["num_rows"].get<int> ()];
@@ -54,34 +56,19 @@ void CytonDaisy::read_thread ()
     }
     double accel_scale = (double)(0.002 / (pow (2, 4)));
 
+    // sample number is a device clock which wraps at 256, it counts cyton and daisy samples
+    TimestampEstimator timestamps (0.5 / board_descr["default"]["sampling_rate"].get<int> ());
+
     while (keep_alive)
     {
-        // check start byte
-        res = serial->read_from_serial_port (b, 1);
-        if (res != 1)
+        SerialFrameStatus res =
+            reader.read_frame (START_BYTE, END_BYTE_STANDARD, END_BYTE_MAX, 32, b);
+        if (res == SerialFrameStatus::NO_DATA)
         {
-            safe_logger (spdlog::level::debug, "unable to read 1 byte");
+            safe_logger (spdlog::level::debug, "unable to read data");
             continue;
         }
-        if (b[0] != START_BYTE)
-        {
-            continue;
-        }
-
-        int remaining_bytes = 32;
-        int pos = 0;
-        while ((remaining_bytes > 0) && (keep_alive))
-        {
-            res = serial->read_from_serial_port (b + pos, remaining_bytes);
-            remaining_bytes -= res;
-            pos += res;
-        }
-        if (!keep_alive)
-        {
-            break;
-        }
-
-        if ((b[31] < END_BYTE_STANDARD) || (b[31] > END_BYTE_MAX))
+        if (res == SerialFrameStatus::WRONG_END_BYTE)
         {
             safe_logger (spdlog::level::warn, "Wrong end byte {}", b[31]);
             continue;
@@ -203,7 +190,11 @@ void CytonDaisy::read_thread ()
         // commit package
         if (!first_sample)
         {
-            package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+            double host_time = get_timestamp ();
+            double device_clock = timestamps.get_device_clock (b[0], 256, host_time);
+            package[board_descr["default"]["timestamp_channel"].get<int> ()] =
+                timestamps.update (device_clock, host_time);
+            log_clock_stats (timestamps, host_time);
             push_package (package);
         }
     }
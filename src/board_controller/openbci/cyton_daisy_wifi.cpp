@@ -1,6 +1,7 @@
 #include "cyton_daisy_wifi.h"
 #include "custom_cast.h"
 #include "timestamp.h"
+#include "timestamp_estimator.h"
 
 #ifndef _WIN32
 #include <errno.h>
@@ -68,6 +69,9 @@ void CytonDaisyWifi::read_thread ()
     unsigned char last_sample_id = 0;
     double accel_scale = (double)(0.002 / (pow (2, 4)));
 
+    // sample number is a device clock which wraps at 256, it counts cyton and daisy samples
+    TimestampEstimator timestamps (0.5 / board_descr["default"]["sampling_rate"].get<int> ());
+
     while (keep_alive)
     {
         res = server_socket->recv (b, OpenBCIWifiShieldBoard::package_size);
@@ -219,7 +223,11 @@ void CytonDaisyWifi::read_thread ()
         // commit package
         if (!first_sample)
         {
-            package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+            double host_time = get_timestamp ();
+            double device_clock = timestamps.get_device_clock (bytes[0], 256, host_time);
+            package[board_descr["default"]["timestamp_channel"].get<int> ()] =
+                timestamps.update (device_clock, host_time);
+            log_clock_stats (timestamps, host_time);
             push_package (package);
         }
 
@@ -3,6 +3,7 @@
 #include "custom_cast.h"
 #include "cyton_wifi.h"
 #include "timestamp.h"
+#include "timestamp_estimator.h"
 
 #ifndef _WIN32
 #include <errno.h>
@@ -69,6 +70,9 @@ void CytonWifi::read_thread ()
     std::vector<int> eeg_channels = board_descr["default"]["eeg_channels"];
     double accel_scale = (double)(0.002 / (pow (2, 4)));
 
+    // sample number is a device clock which wraps at 256
+    TimestampEstimator timestamps (1.0 / board_descr["default"]["sampling_rate"].get<int> ());
+
     while (keep_alive)
     {
         // check start byte
@@ -148,7 +152,11 @@ void CytonWifi::read_thread ()
                 cast_16bit_to_int32 (bytes + 29);
         }
 
-        package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+        double host_time = get_timestamp ();
+        double device_clock = timestamps.get_device_clock (bytes[0], 256, host_time);
+        package[board_descr["default"]["timestamp_channel"].get<int> ()] =
+            timestamps.update (device_clock, host_time);
+        log_clock_stats (timestamps, host_time);
         push_package (package);
     }
     delete[] package;
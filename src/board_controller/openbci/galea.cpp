@@ -11,6 +11,7 @@
 #include "custom_cast.h"
 #include "json.hpp"
 #include "timestamp.h"
+#include "timestamp_estimator.h"
 
 using json = nlohmann::json;
 
@@ -360,8 +361,8 @@ void Galea::read_thread ()
 {
     int res;
     unsigned char b[Galea::max_transaction_size];
-    DataBuffer time_buffer (1, 11);
-    double latest_times[10];
+    // device timestamps are in microseconds
+    TimestampEstimator timestamps (0.000001);
     for (int i = 0; i < Galea::max_transaction_size; i++)
     {
         b[i] = 0;
@@ -369,15 +370,16 @@ void Galea::read_thread ()
 
     int num_exg_rows = board_descr["default"]["num_rows"];
     int num_aux_rows = board_descr["auxiliary"]["num_rows"];
-    double *exg_package = new double[num_exg_rows];
-    double *aux_package = new double[num_aux_rows];
-    for (int i = 0; i < num_exg_rows; i++)
+    // all packages from a single datagram are pushed as one block
+    double *exg_packages = new double[num_exg_rows * Galea::max_num_packages];
+    double *aux_packages = new double[num_aux_rows * Galea::max_num_packages];
+    for (int i = 0; i < num_exg_rows * Galea::max_num_packages; i++)
     {
-        exg_package[i] = 0.0;
+        exg_packages[i] = 0.0;
     }
-    for (int i = 0; i < num_aux_rows; i++)
+    for (int i = 0; i < num_aux_rows * Galea::max_num_packages; i++)
     {
-        aux_package[i] = 0.0;
+        aux_packages[i] = 0.0;
     }
 
     while (keep_alive)
@@ -406,23 +408,14 @@ void Galea::read_thread ()
         {
             int num_packages = res / Galea::package_size;
             int offset_last_package = Galea::package_size * (num_packages - 1);
-            // calc delta between PC timestamp and device timestamp in last 10 packages,
-            // use this delta later on to assign timestamps
+            // fit device clock to PC clock using the last package of every transaction, use this
+            // fit later on to assign timestamps
             double pc_timestamp = get_timestamp ();
             unsigned long long timestamp_last_package = 0.0;
             memcpy (&timestamp_last_package, b + 88 + offset_last_package,
                 sizeof (unsigned long long)); // microseconds
-            double timestamp_last_package_converted =
-                static_cast<double> (timestamp_last_package) / 1000000.0; // convert to seconds
-            double time_delta = pc_timestamp - timestamp_last_package_converted;
-            time_buffer.add_data (&time_delta);
-            int num_time_deltas = (int)time_buffer.get_current_data (10, latest_times);
-            time_delta = 0.0;
-            for (int i = 0; i < num_time_deltas; i++)
-            {
-                time_delta += latest_times[i];
-            }
-            time_delta /= num_time_deltas;
+            timestamps.update ((double)timestamp_last_package, pc_timestamp);
+            log_clock_stats (timestamps, pc_timestamp);
 
             // inform main thread that everything is ok and first package was received
             if (this->state != (int)BrainFlowExitCodes::STATUS_OK)
@@ -437,9 +430,11 @@ void Galea::read_thread ()
                 safe_logger (spdlog::level::debug, "start streaming");
             }
 
+            int num_aux_packages = 0;
             for (int cur_package = 0; cur_package < num_packages; cur_package++)
             {
                 int offset = cur_package * Galea::package_size;
+                double *exg_package = exg_packages + cur_package * num_exg_rows;
                 // exg (default preset)
                 exg_package[board_descr["default"]["package_num_channel"].get<int> ()] =
                     (double)b[0 + offset];
@@ -456,17 +451,18 @@ void Galea::read_thread ()
 
                 double timestamp_device_converted = static_cast<double> (timestamp_device);
                 timestamp_device_converted /= 1000000.0; // convert to seconds
+                double timestamp = timestamps.get_timestamp ((double)timestamp_device) - half_rtt;
 
-                exg_package[board_descr["default"]["timestamp_channel"].get<int> ()] =
-                    timestamp_device_converted + time_delta - half_rtt;
+                exg_package[board_descr["default"]["timestamp_channel"].get<int> ()] = timestamp;
                 exg_package[board_descr["default"]["other_channels"][0].get<int> ()] = pc_timestamp;
                 exg_package[board_descr["default"]["other_channels"][1].get<int> ()] =
                     timestamp_device_converted;
-                push_package (exg_package);
 
                 // aux, 5 times smaller sampling rate
                 if (((int)b[0 + offset]) % 5 == 0)
                 {
+                    double *aux_package = aux_packages + num_aux_packages * num_aux_rows;
+                    num_aux_packages++;
                     double accel_scale = (double)(8.0 / static_cast<double> (pow (2, 16) - 1));
                     double gyro_scale = (double)(1000.0 / static_cast<double> (pow (2, 16) - 1));
                     double magnetometer_scale_xy =
@@ -504,7 +500,7 @@ void Galea::read_thread ()
                     aux_package[board_descr["auxiliary"]["battery_channel"].get<int> ()] =
                         (double)b[77 + offset];
                     aux_package[board_descr["auxiliary"]["timestamp_channel"].get<int> ()] =
-                        timestamp_device_converted + time_delta - half_rtt;
+                        timestamp;
                     aux_package[board_descr["auxiliary"]["other_channels"][0].get<int> ()] =
                         pc_timestamp;
                     aux_package[board_descr["auxiliary"]["other_channels"][1].get<int> ()] =
@@ -533,14 +529,15 @@ void Galea::read_thread ()
                     aux_package[board_descr["auxiliary"]["magnetometer_channels"][2].get<int> ()] =
                         magnetometer_scale_z *
                         (double)cast_15bit_to_int32_swap_order (b + 112 + offset);
-
-                    push_package (aux_package, (int)BrainFlowPresets::AUXILIARY_PRESET);
                 }
             }
+            push_packages (exg_packages, num_packages);
+            push_packages (
+                aux_packages, num_aux_packages, (int)BrainFlowPresets::AUXILIARY_PRESET);
         }
     }
-    delete[] exg_package;
-    delete[] aux_package;
+    delete[] exg_packages;
+    delete[] aux_packages;
 }
 
 int Galea::calc_time (std::string &resp)
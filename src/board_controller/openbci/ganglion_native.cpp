@@ -1,9 +1,11 @@
+#include <algorithm>
 #include <string>
 
 #include "custom_cast.h"
 #include "ganglion_native.h"
 #include "get_dll_dir.h"
 #include "timestamp.h"
+#include "timestamp_estimator.h"
 
 
 #define GANGLION_WRITE_CHAR "2d30c083-f39f-4ce6-923f-3484ea480596"
@@ -230,6 +232,12 @@ int GanglionNative::prepare_session ()
     }
 
     if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (num_chars_found == 2))
+    {
+        default_layout.init (board_descr["default"]);
+        package_buf.resize (default_layout.num_rows);
+        res = start_notification_worker ();
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
         initialized = true;
     }
@@ -251,6 +259,7 @@ int GanglionNative::start_stream (int buffer_size, const char *streamer_params)
         return (int)BrainFlowExitCodes::STREAM_ALREADY_RUN_ERROR;
     }
     temp_data.reset (); // reset last data before streaming
+    timestamps = TimestampEstimator (1.0 / current_sampling_rate);
     int res = prepare_for_acquisition (buffer_size, streamer_params);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
@@ -310,6 +319,7 @@ int GanglionNative::release_session ()
                 break;
             }
         }
+        stop_notification_worker ();
         free_packages ();
         initialized = false;
     }
@@ -510,6 +520,11 @@ void GanglionNative::adapter_1_on_scan_found (
 
 void GanglionNative::read_data (
     simpleble_uuid_t service, simpleble_uuid_t characteristic, const uint8_t *data, size_t size)
+{
+    queue_notification (0, data, size);
+}
+
+void GanglionNative::on_notification (int tag, const uint8_t *data, size_t size, double host_time)
 {
     if (size < 2)
     {
@@ -517,25 +532,19 @@ void GanglionNative::read_data (
         return;
     }
 
-    int num_rows = board_descr["default"]["num_rows"];
-    double *package = new double[num_rows];
-
-    for (int i = 0; i < num_rows; i++)
-    {
-        package[i] = 0.0;
-    }
+    double *package = package_buf.data ();
+    std::fill (package_buf.begin (), package_buf.end (), 0.0);
 
     if (data[0] <= 200 && size == 20)
     {
         if (firmware == 3)
         {
-            decompress_firmware_3 (data, package);
+            decompress_firmware_3 (data, package, host_time);
         }
         else if (firmware == 2)
         {
-            decompress_firmware_2 (data, package);
+            decompress_firmware_2 (data, package, host_time);
         }
-        delete[] package;
     }
     else if ((data[0] > 200) && (data[0] < 206))
     {
@@ -559,7 +568,6 @@ void GanglionNative::read_data (
         {
             safe_logger (
                 spdlog::level::err, "failed to parse impedance data: {}", ascii_value.c_str ());
-            delete[] package;
             return;
         }
 
@@ -583,20 +591,14 @@ void GanglionNative::read_data (
             default:
                 break;
         }
-        package[board_descr["default"]["package_num_channel"].get<int> ()] = data[0];
-        package[board_descr["default"]["resistance_channels"][0].get<int> ()] =
-            temp_data.resist_first;
-        package[board_descr["default"]["resistance_channels"][1].get<int> ()] =
-            temp_data.resist_second;
-        package[board_descr["default"]["resistance_channels"][2].get<int> ()] =
-            temp_data.resist_third;
-        package[board_descr["default"]["resistance_channels"][3].get<int> ()] =
-            temp_data.resist_fourth;
-        package[board_descr["default"]["resistance_channels"][4].get<int> ()] =
-            temp_data.resist_ref;
-        package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+        package[default_layout.package_num_channel] = data[0];
+        package[default_layout.resistance_channels[0]] = temp_data.resist_first;
+        package[default_layout.resistance_channels[1]] = temp_data.resist_second;
+        package[default_layout.resistance_channels[2]] = temp_data.resist_third;
+        package[default_layout.resistance_channels[3]] = temp_data.resist_fourth;
+        package[default_layout.resistance_channels[4]] = temp_data.resist_ref;
+        package[default_layout.timestamp_channel] = host_time;
         push_package (package);
-        delete[] package;
         return;
     }
     else
@@ -605,12 +607,22 @@ void GanglionNative::read_data (
         {
             safe_logger (spdlog::level::warn, "byte {} value {}", i, data[i]);
         }
-        delete[] package;
         return;
     }
 }
 
-void GanglionNative::decompress_firmware_3 (const uint8_t *data, double *package)
+void GanglionNative::get_package_timestamps (
+    uint8_t package_num, double host_time, double *first_timestamp, double *second_timestamp)
+{
+    // package num goes over 0-99 twice for 18 and 19 bit compression, each package has 2 samples
+    double device_clock = timestamps.get_device_clock (package_num % 100, 100, host_time, 2);
+    *second_timestamp = timestamps.update (device_clock + 1, host_time);
+    log_clock_stats (timestamps, host_time);
+    *first_timestamp = timestamps.get_timestamp (device_clock);
+}
+
+void GanglionNative::decompress_firmware_3 (
+    const uint8_t *data, double *package, double host_time)
 {
     int bits_per_num = 0;
     unsigned char package_bits[160] = {0}; // 20 * 8
@@ -661,35 +673,32 @@ void GanglionNative::decompress_firmware_3 (const uint8_t *data, double *package
         }
     }
 
+    double first_timestamp = 0.0;
+    double second_timestamp = 0.0;
+    get_package_timestamps (data[0], host_time, &first_timestamp, &second_timestamp);
+
     // add first encoded package
-    package[board_descr["default"]["package_num_channel"].get<int> ()] = data[0];
-    package[board_descr["default"]["eeg_channels"][0].get<int> ()] =
-        eeg_scale * temp_data.last_data[0];
-    package[board_descr["default"]["eeg_channels"][1].get<int> ()] =
-        eeg_scale * temp_data.last_data[1];
-    package[board_descr["default"]["eeg_channels"][2].get<int> ()] =
-        eeg_scale * temp_data.last_data[2];
-    package[board_descr["default"]["eeg_channels"][3].get<int> ()] =
-        eeg_scale * temp_data.last_data[3];
-    package[board_descr["default"]["accel_channels"][0].get<int> ()] = temp_data.accel_x;
-    package[board_descr["default"]["accel_channels"][1].get<int> ()] = temp_data.accel_y;
-    package[board_descr["default"]["accel_channels"][2].get<int> ()] = temp_data.accel_z;
-    package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+    package[default_layout.package_num_channel] = data[0];
+    package[default_layout.eeg_channels[0]] = eeg_scale * temp_data.last_data[0];
+    package[default_layout.eeg_channels[1]] = eeg_scale * temp_data.last_data[1];
+    package[default_layout.eeg_channels[2]] = eeg_scale * temp_data.last_data[2];
+    package[default_layout.eeg_channels[3]] = eeg_scale * temp_data.last_data[3];
+    package[default_layout.accel_channels[0]] = temp_data.accel_x;
+    package[default_layout.accel_channels[1]] = temp_data.accel_y;
+    package[default_layout.accel_channels[2]] = temp_data.accel_z;
+    package[default_layout.timestamp_channel] = first_timestamp;
     push_package (package);
     // add second package
-    package[board_descr["default"]["eeg_channels"][0].get<int> ()] =
-        eeg_scale * temp_data.last_data[4];
-    package[board_descr["default"]["eeg_channels"][1].get<int> ()] =
-        eeg_scale * temp_data.last_data[5];
-    package[board_descr["default"]["eeg_channels"][2].get<int> ()] =
-        eeg_scale * temp_data.last_data[6];
-    package[board_descr["default"]["eeg_channels"][3].get<int> ()] =
-        eeg_scale * temp_data.last_data[7];
-    package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+    package[default_layout.eeg_channels[0]] = eeg_scale * temp_data.last_data[4];
+    package[default_layout.eeg_channels[1]] = eeg_scale * temp_data.last_data[5];
+    package[default_layout.eeg_channels[2]] = eeg_scale * temp_data.last_data[6];
+    package[default_layout.eeg_channels[3]] = eeg_scale * temp_data.last_data[7];
+    package[default_layout.timestamp_channel] = second_timestamp;
     push_package (package);
 }
 
-void GanglionNative::decompress_firmware_2 (const uint8_t *data, double *package)
+void GanglionNative::decompress_firmware_2 (
+    const uint8_t *data, double *package, double host_time)
 {
     int bits_per_num = 0;
     unsigned char package_bits[160] = {0}; // 20 * 8
@@ -716,19 +725,18 @@ void GanglionNative::decompress_firmware_2 (const uint8_t *data, double *package
         temp_data.last_data[7] = (float)cast_24bit_to_int32 (data + 10);
 
         // scale new packet and insert into result
-        package[board_descr["default"]["package_num_channel"].get<int> ()] = 0.;
-        package[board_descr["default"]["eeg_channels"][0].get<int> ()] =
-            eeg_scale * temp_data.last_data[4];
-        package[board_descr["default"]["eeg_channels"][1].get<int> ()] =
-            eeg_scale * temp_data.last_data[5];
-        package[board_descr["default"]["eeg_channels"][2].get<int> ()] =
-            eeg_scale * temp_data.last_data[6];
-        package[board_descr["default"]["eeg_channels"][3].get<int> ()] =
-            eeg_scale * temp_data.last_data[7];
-        package[board_descr["default"]["accel_channels"][0].get<int> ()] = temp_data.accel_x;
-        package[board_descr["default"]["accel_channels"][1].get<int> ()] = temp_data.accel_y;
-        package[board_descr["default"]["accel_channels"][2].get<int> ()] = temp_data.accel_z;
-        package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+        package[default_layout.package_num_channel] = 0.;
+        package[default_layout.eeg_channels[0]] = eeg_scale * temp_data.last_data[4];
+        package[default_layout.eeg_channels[1]] = eeg_scale * temp_data.last_data[5];
+        package[default_layout.eeg_channels[2]] = eeg_scale * temp_data.last_data[6];
+        package[default_layout.eeg_channels[3]] = eeg_scale * temp_data.last_data[7];
+        package[default_layout.accel_channels[0]] = temp_data.accel_x;
+        package[default_layout.accel_channels[1]] = temp_data.accel_y;
+        package[default_layout.accel_channels[2]] = temp_data.accel_z;
+        double first_timestamp = 0.0;
+        double second_timestamp = 0.0;
+        get_package_timestamps (data[0], host_time, &first_timestamp, &second_timestamp);
+        package[default_layout.timestamp_channel] = second_timestamp;
         push_package (package);
         return;
     }
@@ -784,30 +792,26 @@ void GanglionNative::decompress_firmware_2 (const uint8_t *data, double *package
         temp_data.last_data[i] = temp_data.last_data[i - 4] - delta[i];
     }
 
+    double first_timestamp = 0.0;
+    double second_timestamp = 0.0;
+    get_package_timestamps (data[0], host_time, &first_timestamp, &second_timestamp);
+
     // add first encoded package
-    package[board_descr["default"]["package_num_channel"].get<int> ()] = data[0];
-    package[board_descr["default"]["eeg_channels"][0].get<int> ()] =
-        eeg_scale * temp_data.last_data[0];
-    package[board_descr["default"]["eeg_channels"][1].get<int> ()] =
-        eeg_scale * temp_data.last_data[1];
-    package[board_descr["default"]["eeg_channels"][2].get<int> ()] =
-        eeg_scale * temp_data.last_data[2];
-    package[board_descr["default"]["eeg_channels"][3].get<int> ()] =
-        eeg_scale * temp_data.last_data[3];
-    package[board_descr["default"]["accel_channels"][0].get<int> ()] = temp_data.accel_x;
-    package[board_descr["default"]["accel_channels"][1].get<int> ()] = temp_data.accel_y;
-    package[board_descr["default"]["accel_channels"][2].get<int> ()] = temp_data.accel_z;
-    package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+    package[default_layout.package_num_channel] = data[0];
+    package[default_layout.eeg_channels[0]] = eeg_scale * temp_data.last_data[0];
+    package[default_layout.eeg_channels[1]] = eeg_scale * temp_data.last_data[1];
+    package[default_layout.eeg_channels[2]] = eeg_scale * temp_data.last_data[2];
+    package[default_layout.eeg_channels[3]] = eeg_scale * temp_data.last_data[3];
+    package[default_layout.accel_channels[0]] = temp_data.accel_x;
+    package[default_layout.accel_channels[1]] = temp_data.accel_y;
+    package[default_layout.accel_channels[2]] = temp_data.accel_z;
+    package[default_layout.timestamp_channel] = first_timestamp;
     push_package (package);
     // add second package
-    package[board_descr["default"]["eeg_channels"][0].get<int> ()] =
-        eeg_scale * temp_data.last_data[4];
-    package[board_descr["default"]["eeg_channels"][1].get<int> ()] =
-        eeg_scale * temp_data.last_data[5];
-    package[board_descr["default"]["eeg_channels"][2].get<int> ()] =
-        eeg_scale * temp_data.last_data[6];
-    package[board_descr["default"]["eeg_channels"][3].get<int> ()] =
-        eeg_scale * temp_data.last_data[7];
-    package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+    package[default_layout.eeg_channels[0]] = eeg_scale * temp_data.last_data[4];
+    package[default_layout.eeg_channels[1]] = eeg_scale * temp_data.last_data[5];
+    package[default_layout.eeg_channels[2]] = eeg_scale * temp_data.last_data[6];
+    package[default_layout.eeg_channels[3]] = eeg_scale * temp_data.last_data[7];
+    package[default_layout.timestamp_channel] = second_timestamp;
     push_package (package);
 }
@@ -1,11 +1,14 @@
 #include <condition_variable>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "ble_lib_board.h"
 #include "board.h"
 #include "board_controller.h"
 #include "openbci_sampling_tracker.h"
+#include "preset_layout.h"
+#include "timestamp_estimator.h"
 
 struct GanglionTempData
 {
@@ -114,12 +117,19 @@ protected:
     std::string stop_command;
     int current_sampling_rate;
     struct GanglionTempData temp_data;
+    TimestampEstimator timestamps;
+    // built in prepare_session, notifications are decoded without json lookups
+    PresetLayout default_layout;
+    std::vector<double> package_buf;
 
     double const accel_scale = 0.016f;
     double const eeg_scale = (1.2f * 1000000) / (8388607.0f * 1.5f * 51.0f);
 
-    void decompress_firmware_3 (const uint8_t *data, double *package);
-    void decompress_firmware_2 (const uint8_t *data, double *package);
+    void on_notification (int tag, const uint8_t *data, size_t size, double host_time) override;
+    void get_package_timestamps (uint8_t package_num, double host_time, double *first_timestamp,
+        double *second_timestamp);
+    void decompress_firmware_3 (const uint8_t *data, double *package, double host_time);
+    void decompress_firmware_2 (const uint8_t *data, double *package, double host_time);
 
 private:
     int get_firmware_from_params (BrainFlowInputParams &params);
@@ -1,6 +1,5 @@
 #include <algorithm>
 #include <chrono>
-#include <sstream>
 #include <stdio.h>
 #include <string.h>
 #include <string>
@@ -13,13 +12,14 @@
 
 #include "playback_file_board.h"
 #include "timestamp.h"
+#include "tsv_parser.h"
 
 #define SET_LOOPBACK_TRUE "loopback_true"
 #define SET_LOOPBACK_FALSE "loopback_false"
 #define NEW_TIMESTAMPS "new_timestamps"
 #define OLD_TIMESTAMPS "old_timestamps"
 #define SET_INDEX_PREFIX "set_index_percentage:"
-#define MAX_LINE_LENGTH 8192
+#define MAX_PLAYBACK_BATCH_SIZE 64
 
 
 PlaybackFileBoard::PlaybackFileBoard (struct BrainFlowInputParams params)
@@ -55,28 +55,17 @@ int PlaybackFileBoard::prepare_session ()
         safe_logger (spdlog::level::err, "master board id is not provided");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    try
+    board_id = params.master_board;
+    board_descr = board_descr_to_json (board_id);
+    if (board_descr.is_null ())
     {
-        board_id = params.master_board;
-        board_descr = boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)];
-    }
-    catch (json::exception &e)
-    {
-        safe_logger (spdlog::level::err, "invalid json for master board");
-        safe_logger (spdlog::level::err, e.what ());
-        return (int)BrainFlowExitCodes::GENERAL_ERROR;
-    }
-    catch (const std::exception &e)
-    {
-        safe_logger (
-            spdlog::level::err, "Write board id of board which recorded data to other_info field");
-        safe_logger (spdlog::level::err, e.what ());
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        safe_logger (spdlog::level::err, "master board id is not supported");
+        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
 
     if (!params.file.empty ())
     {
-        std::vector<long int> offsets;
+        std::vector<long long> offsets;
         int res = get_file_offsets (params.file, offsets);
         if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
@@ -89,7 +78,7 @@ int PlaybackFileBoard::prepare_session ()
     }
     if (!params.file_aux.empty ())
     {
-        std::vector<long int> offsets;
+        std::vector<long long> offsets;
         int res = get_file_offsets (params.file_aux, offsets);
         if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
@@ -102,7 +91,7 @@ int PlaybackFileBoard::prepare_session ()
     }
     if (!params.file_anc.empty ())
     {
-        std::vector<long int> offsets;
+        std::vector<long long> offsets;
         int res = get_file_offsets (params.file_anc, offsets);
         if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
@@ -228,9 +217,8 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
         return;
     }
 
-    FILE *fp;
-    fp = fopen (file.c_str (), "rb");
-    if (fp == NULL)
+    LineReader reader;
+    if (!reader.open (file.c_str ()))
     {
         safe_logger (spdlog::level::err, "failed to open file in thread");
         return;
@@ -243,7 +231,11 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
     {
         package[i] = 0.0;
     }
-    char buf[MAX_LINE_LENGTH];
+    // samples which are already due are pushed together, block is flushed before each sleep
+    double *batch = new double[num_rows * MAX_PLAYBACK_BATCH_SIZE];
+    int batch_size = 0;
+    const char *line = NULL;
+    size_t line_len = 0;
     double last_timestamp = -1.0;
     bool new_timestamps = use_new_timestamps; // to prevent changing during streaming
     int timestamp_channel = board_preset["timestamp_channel"];
@@ -259,12 +251,11 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
         if ((int)cur_index >= 0)
         {
             int new_pos = (int)(cur_index * (file_offsets[preset].size () / 100.0));
-            try
+            if (reader.seek (file_offsets[preset][new_pos]))
             {
-                fseek (fp, file_offsets[preset][new_pos], SEEK_SET);
                 safe_logger (spdlog::level::trace, "set position in a file to {}", new_pos);
             }
-            catch (...)
+            else
             {
                 // should never happen since input is already validated
                 safe_logger (spdlog::level::warn, "invalid position in a file");
@@ -273,15 +264,17 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
             pos_percentage[preset] = -1;
         }
         lock.unlock ();
-        char *res = fgets (buf, sizeof (buf), fp);
-        if ((loopback) && (res == NULL))
+        bool res = reader.next_line (&line, &line_len);
+        if ((loopback) && (!res))
         {
-            fseek (fp, 0, SEEK_SET); // go to beginning'
+            reader.seek (0); // go to beginning'
             last_timestamp = -1.0;
             continue;
         }
-        if ((!loopback) && (res == NULL))
+        if ((!loopback) && (!res))
         {
+            push_packages (batch, batch_size, preset);
+            batch_size = 0;
             if (!reached_end)
             {
                 reached_end = true;
@@ -299,46 +292,28 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
 #endif
             continue;
         }
-        // res not NULL
-        std::string tsv_string (buf);
-        std::stringstream ss (tsv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        char sep = '\t';
-        if (tsv_string.find ('\t') == std::string::npos)
-        {
-            sep = ',';
-        }
-        while (std::getline (ss, tmp, sep))
+        // res is true
+        int num_values = parse_tsv_line (line, line_len, package, num_rows);
+        if (num_values < 0)
         {
-            if (tmp != "\n")
-            {
-                splitted.push_back (tmp);
-            }
+            safe_logger (spdlog::level::err, "failed to parse line: {}",
+                std::string (line, line_len).c_str ());
+            continue;
         }
-        if (splitted.size () != num_rows)
+        if (num_values != num_rows)
         {
             safe_logger (spdlog::level::err,
                 "invalid string in file, check provided board id. String size {}, expected size {}",
-                splitted.size (), num_rows);
+                num_values, num_rows);
             continue;
         }
-        for (int i = 0; i < num_rows; i++)
-        {
-            try
-            {
-                package[i] = std::stod (splitted[i]);
-            }
-            catch (...)
-            {
-                safe_logger (spdlog::level::err, "failed to parse value: {}", splitted[i].c_str ());
-            }
-        }
         if (last_timestamp > 0)
         {
             double time_wait = (package[timestamp_channel] - last_timestamp) * 1000; // in ms
             if (time_wait - accumulated_time_delta > 1)
             {
+                push_packages (batch, batch_size, preset);
+                batch_size = 0;
 #ifdef _WIN32
                 Sleep ((int)(time_wait - accumulated_time_delta));
 #else
@@ -357,10 +332,18 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
         {
             package[timestamp_channel] = get_timestamp ();
         }
-        push_package (package, preset);
+        memcpy (batch + batch_size * num_rows, package, sizeof (double) * num_rows);
+        batch_size++;
+        if (batch_size == MAX_PLAYBACK_BATCH_SIZE)
+        {
+            push_packages (batch, batch_size, preset);
+            batch_size = 0;
+        }
     }
-    fclose (fp);
+    push_packages (batch, batch_size, preset);
+    reader.close ();
     delete[] package;
+    delete[] batch;
 }
 
 int PlaybackFileBoard::config_board (std::string config, std::string &response)
@@ -414,31 +397,29 @@ int PlaybackFileBoard::config_board (std::string config, std::string &response)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int PlaybackFileBoard::get_file_offsets (std::string filename, std::vector<long int> &offsets)
+int PlaybackFileBoard::get_file_offsets (std::string filename, std::vector<long long> &offsets)
 {
     offsets.clear ();
 
-    FILE *fp = fopen (filename.c_str (), "rb");
-    if (fp == NULL)
+    LineReader reader;
+    if (!reader.open (filename.c_str ()))
     {
         safe_logger (spdlog::level::err, "failed to open file: {}", filename.c_str ());
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    char buf[MAX_LINE_LENGTH];
-    long int bytes_read = 0;
+    const char *line = NULL;
+    size_t line_len = 0;
     while (true)
     {
-        offsets.push_back (bytes_read);
-        char *res = fgets (buf, sizeof (buf), fp);
-        bytes_read += (long int)strlen (buf);
-        if (res == NULL)
+        offsets.push_back (reader.tell ());
+        if (!reader.next_line (&line, &line_len))
         {
             break;
         }
     }
 
-    fclose (fp);
+    reader.close ();
     if (offsets.size () < 2)
     {
         safe_logger (spdlog::level::err, "empty file: {}", filename);
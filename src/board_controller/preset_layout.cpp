@@ -0,0 +1,130 @@
+#include <string>
+
+#include "brainflow_constants.h"
+#include "preset_layout.h"
+
+
+static int get_optional_int (const json &board_preset, const char *key)
+{
+    auto it = board_preset.find (key);
+    if (it == board_preset.end ())
+    {
+        return -1;
+    }
+    return it->get<int> ();
+}
+
+static std::vector<int> get_optional_channels (const json &board_preset, const char *key)
+{
+    auto it = board_preset.find (key);
+    if (it == board_preset.end ())
+    {
+        return std::vector<int> ();
+    }
+    return it->get<std::vector<int>> ();
+}
+
+static bool is_valid_channel (int channel, int num_rows, bool required)
+{
+    if (channel == -1)
+    {
+        return !required;
+    }
+    return ((channel >= 0) && (channel < num_rows));
+}
+
+static bool are_valid_channels (const std::vector<int> &channels, int num_rows)
+{
+    for (int channel : channels)
+    {
+        if (!is_valid_channel (channel, num_rows, true))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+PresetLayout::PresetLayout ()
+{
+    clear ();
+}
+
+void PresetLayout::clear ()
+{
+    num_rows = 0;
+    timestamp_channel = -1;
+    marker_channel = -1;
+    package_num_channel = -1;
+    battery_channel = -1;
+    sampling_rate = -1;
+    eeg_channels.clear ();
+    emg_channels.clear ();
+    ecg_channels.clear ();
+    eog_channels.clear ();
+    eda_channels.clear ();
+    ppg_channels.clear ();
+    accel_channels.clear ();
+    gyro_channels.clear ();
+    magnetometer_channels.clear ();
+    rotation_channels.clear ();
+    analog_channels.clear ();
+    optical_channels.clear ();
+    temperature_channels.clear ();
+    resistance_channels.clear ();
+    other_channels.clear ();
+}
+
+int PresetLayout::init (const json &board_preset)
+{
+    clear ();
+    try
+    {
+        num_rows = board_preset.at ("num_rows").get<int> ();
+        timestamp_channel = board_preset.at ("timestamp_channel").get<int> ();
+        marker_channel = board_preset.at ("marker_channel").get<int> ();
+        package_num_channel = get_optional_int (board_preset, "package_num_channel");
+        battery_channel = get_optional_int (board_preset, "battery_channel");
+        sampling_rate = get_optional_int (board_preset, "sampling_rate");
+
+        eeg_channels = get_optional_channels (board_preset, "eeg_channels");
+        emg_channels = get_optional_channels (board_preset, "emg_channels");
+        ecg_channels = get_optional_channels (board_preset, "ecg_channels");
+        eog_channels = get_optional_channels (board_preset, "eog_channels");
+        eda_channels = get_optional_channels (board_preset, "eda_channels");
+        ppg_channels = get_optional_channels (board_preset, "ppg_channels");
+        accel_channels = get_optional_channels (board_preset, "accel_channels");
+        gyro_channels = get_optional_channels (board_preset, "gyro_channels");
+        magnetometer_channels = get_optional_channels (board_preset, "magnetometer_channels");
+        rotation_channels = get_optional_channels (board_preset, "rotation_channels");
+        analog_channels = get_optional_channels (board_preset, "analog_channels");
+        optical_channels = get_optional_channels (board_preset, "optical_channels");
+        temperature_channels = get_optional_channels (board_preset, "temperature_channels");
+        resistance_channels = get_optional_channels (board_preset, "resistance_channels");
+        other_channels = get_optional_channels (board_preset, "other_channels");
+    }
+    catch (json::exception &)
+    {
+        clear ();
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+
+    const std::vector<int> *channel_lists[] = {&eeg_channels, &emg_channels, &ecg_channels,
+        &eog_channels, &eda_channels, &ppg_channels, &accel_channels, &gyro_channels,
+        &magnetometer_channels, &rotation_channels, &analog_channels, &optical_channels,
+        &temperature_channels, &resistance_channels, &other_channels};
+    bool is_valid = (num_rows > 0) && is_valid_channel (timestamp_channel, num_rows, true) &&
+        is_valid_channel (marker_channel, num_rows, true) &&
+        is_valid_channel (package_num_channel, num_rows, false) &&
+        is_valid_channel (battery_channel, num_rows, false);
+    for (const std::vector<int> *channels : channel_lists)
+    {
+        is_valid = is_valid && are_valid_channels (*channels, num_rows);
+    }
+    if (!is_valid)
+    {
+        clear ();
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
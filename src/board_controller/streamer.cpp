@@ -0,0 +1,117 @@
+#include <chrono>
+
+#include "board.h"
+#include "brainflow_constants.h"
+#include "streamer.h"
+
+#define STREAMER_DISPATCH_BATCH_SIZE 256
+#define STREAMER_DISPATCH_TIMEOUT_MS 10
+
+
+Streamer::~Streamer ()
+{
+    // dispatch thread is already joined by the owner, see Board::free_streamer
+    delete queue;
+    queue = NULL;
+}
+
+int Streamer::set_option (const std::string &key, const std::string &value)
+{
+    return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+}
+
+int Streamer::start_dispatch (BackpressurePolicy policy, size_t queue_size)
+{
+    if (queue != NULL)
+    {
+        Board::board_logger->error ("streamer {} is already dispatching", streamer_dest.c_str ());
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    queue = new PackageQueue ((size_t)len, queue_size, policy);
+    if (!queue->is_ready ())
+    {
+        Board::board_logger->error ("unable to prepare queue for streamer");
+        delete queue;
+        queue = NULL;
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    is_dispatching = true;
+    dispatch_thread = std::thread ([this] { this->dispatch_worker (); });
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void Streamer::stop_dispatch ()
+{
+    if (dispatch_thread.joinable ())
+    {
+        is_dispatching = false;
+        queue->close ();
+        dispatch_thread.join ();
+        uint64_t num_dropped = queue->get_num_dropped ();
+        if (num_dropped > 0)
+        {
+            Board::board_logger->warn ("streamer {}://{} dropped {} packages in total",
+                streamer_type.c_str (), streamer_dest.c_str (), num_dropped);
+        }
+    }
+}
+
+void Streamer::stream_data (double *data)
+{
+    if (queue != NULL)
+    {
+        queue->push (data);
+    }
+}
+
+void Streamer::stream_data (double *data, int num_packages)
+{
+    if ((queue != NULL) && (num_packages > 0))
+    {
+        queue->push (data, (size_t)num_packages);
+    }
+}
+
+uint64_t Streamer::get_num_dropped ()
+{
+    if (queue == NULL)
+    {
+        return 0;
+    }
+    return queue->get_num_dropped ();
+}
+
+void Streamer::dispatch_worker ()
+{
+    double *packages = new double[STREAMER_DISPATCH_BATCH_SIZE * len];
+    auto last_report = std::chrono::steady_clock::now ();
+    while (true)
+    {
+        size_t count =
+            queue->pop (packages, STREAMER_DISPATCH_BATCH_SIZE, STREAMER_DISPATCH_TIMEOUT_MS);
+        if (count > 0)
+        {
+            write_packages (packages, (int)count);
+        }
+        else if ((!is_dispatching) && (queue->get_size () == 0))
+        {
+            // queue is closed and drained
+            break;
+        }
+
+        auto now = std::chrono::steady_clock::now ();
+        if (now - last_report > std::chrono::seconds (1))
+        {
+            uint64_t num_dropped = queue->get_num_dropped ();
+            if (num_dropped != last_reported_dropped)
+            {
+                Board::board_logger->warn ("streamer {}://{} can not keep up, {} packages dropped",
+                    streamer_type.c_str (), streamer_dest.c_str (),
+                    num_dropped - last_reported_dropped);
+                last_reported_dropped = num_dropped;
+            }
+            last_report = now;
+        }
+    }
+    delete[] packages;
+}
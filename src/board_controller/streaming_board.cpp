@@ -38,23 +38,12 @@ int StreamingBoard::prepare_session ()
         safe_logger (spdlog::level::err, "Master board id is not provided");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    try
+    board_id = params.master_board;
+    board_descr = board_descr_to_json (board_id);
+    if (board_descr.is_null ())
     {
-        board_id = params.master_board;
-        board_descr = boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)];
-    }
-    catch (json::exception &e)
-    {
-        safe_logger (spdlog::level::err, "Invalid json for master board");
-        safe_logger (spdlog::level::err, e.what ());
-        return (int)BrainFlowExitCodes::GENERAL_ERROR;
-    }
-    catch (const std::exception &e)
-    {
-        safe_logger (spdlog::level::err,
-            "Write board id for the board which streams data to other_info field");
-        safe_logger (spdlog::level::err, e.what ());
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        safe_logger (spdlog::level::err, "Master board id is not supported");
+        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
 
     // default preset
@@ -62,6 +51,7 @@ int StreamingBoard::prepare_session ()
     {
         MultiCastClient *client = new MultiCastClient (params.ip_address.c_str (), params.ip_port);
         clients.push_back (client);
+        trackers.push_back (new StreamSequenceTracker ());
         presets.push_back ((int)BrainFlowPresets::DEFAULT_PRESET);
     }
     if ((!params.ip_address.empty ()) != (params.ip_port != 0))
@@ -74,6 +64,7 @@ int StreamingBoard::prepare_session ()
         MultiCastClient *client =
             new MultiCastClient (params.ip_address_aux.c_str (), params.ip_port_aux);
         clients.push_back (client);
+        trackers.push_back (new StreamSequenceTracker ());
         presets.push_back ((int)BrainFlowPresets::AUXILIARY_PRESET);
     }
     if ((!params.ip_address_aux.empty ()) != (params.ip_port_aux != 0))
@@ -86,6 +77,7 @@ int StreamingBoard::prepare_session ()
         MultiCastClient *client =
             new MultiCastClient (params.ip_address_anc.c_str (), params.ip_port_anc);
         clients.push_back (client);
+        trackers.push_back (new StreamSequenceTracker ());
         presets.push_back ((int)BrainFlowPresets::ANCILLARY_PRESET);
     }
     if ((!params.ip_address_anc.empty ()) != (params.ip_port_anc != 0))
@@ -115,12 +107,7 @@ int StreamingBoard::prepare_session ()
 
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        for (auto client : clients)
-        {
-            delete client;
-        }
-        clients.clear ();
-        presets.clear ();
+        free_clients ();
     }
 
     return res;
@@ -128,6 +115,20 @@ int StreamingBoard::prepare_session ()
 
 int StreamingBoard::config_board (std::string config, std::string &response)
 {
+    // loss counters of this receiver, format is {"preset": {"received": ..., "lost": ...}}
+    if (config == "get_loss_stats")
+    {
+        json j = json::object ();
+        for (int i = 0; i < (int)trackers.size (); i++)
+        {
+            j[preset_to_string (presets[i])] = {{"received", trackers[i]->get_num_received ()},
+                {"lost", trackers[i]->get_num_lost ()},
+                {"reordered", trackers[i]->get_num_reordered ()},
+                {"invalid", trackers[i]->get_num_invalid ()}};
+        }
+        response = j.dump ();
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
     // dont allow streaming boards to change config for master board
     return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
 }
@@ -145,6 +146,10 @@ int StreamingBoard::start_stream (int buffer_size, const char *streamer_params)
         return res;
     }
 
+    for (auto tracker : trackers)
+    {
+        tracker->reset ();
+    }
     keep_alive = true;
     for (int i = 0; i < (int)clients.size (); i++)
     {
@@ -181,52 +186,78 @@ int StreamingBoard::release_session ()
         }
         free_packages ();
         initialized = false;
-        for (auto client : clients)
-        {
-            delete client;
-        }
-        clients.clear ();
-        presets.clear ();
+        free_clients ();
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 void StreamingBoard::read_thread (int num)
 {
-    std::string preset_str = preset_to_string (presets[num]);
-    if (board_descr.find (preset_str) == board_descr.end ())
+    const PresetLayout *layout = get_preset_layout (presets[num]);
+    if (layout == NULL)
     {
         safe_logger (spdlog::level::err, "invalid json or push_package args, no such key");
         return;
     }
 
-    json board_preset = board_descr[preset_str];
-    int num_rows = board_preset["num_rows"];
-    int num_packages = get_brainflow_batch_size ();
-    int transaction_len = num_rows * num_packages;
-    int bytes_per_recv = sizeof (double) * transaction_len;
-    double *transaction = new double[transaction_len];
-    for (int i = 0; i < num_rows; i++)
+    int num_rows = layout->num_rows;
+    // streamers built before the packet format send exactly batch_size packages as raw doubles
+    int legacy_num_packages = get_brainflow_batch_size ();
+    int legacy_bytes_per_recv = (int)sizeof (double) * num_rows * legacy_num_packages;
+    // one more byte than max datagram to detect truncation
+    int max_bytes_per_recv = STREAM_PACKET_MAX_SIZE + 1;
+    if (legacy_bytes_per_recv >= max_bytes_per_recv)
     {
-        transaction[i] = 0.0;
+        max_bytes_per_recv = legacy_bytes_per_recv + 1;
     }
+    std::vector<uint8_t> datagram (max_bytes_per_recv);
+    std::vector<double> packages;
+    StreamSequenceTracker *tracker = trackers[num];
 
     while (keep_alive)
     {
-        int res = clients[num]->recv (transaction, bytes_per_recv);
-        if (res != bytes_per_recv)
+        int res = clients[num]->recv (datagram.data (), max_bytes_per_recv);
+        if (res <= 0)
         {
-            safe_logger (
-                spdlog::level::trace, "unable to read {} bytes, read {}", bytes_per_recv, res);
+            safe_logger (spdlog::level::trace, "unable to read datagram, res {}", res);
             log_socket_error (-1);
             continue;
         }
-        for (int i = 0; i < num_packages; i++)
+
+        StreamPacketHeader header;
+        StreamPacketStatus status = decode_stream_packet_header (datagram.data (), res, &header);
+        if ((status == StreamPacketStatus::NOT_A_PACKET) && (res == legacy_bytes_per_recv))
+        {
+            packages.resize (num_rows * legacy_num_packages);
+            memcpy (packages.data (), datagram.data (), res);
+            push_packages (packages.data (), legacy_num_packages, presets[num]);
+            continue;
+        }
+        // number of rows must match master board, preset is not checked to support streaming of
+        // any preset with the same layout like in legacy format
+        if ((status == StreamPacketStatus::OK) && (header.num_rows != num_rows))
+        {
+            status = StreamPacketStatus::INVALID_PACKET;
+        }
+        if (status == StreamPacketStatus::OK)
+        {
+            packages.resize (header.num_samples * num_rows);
+            status = decode_stream_packet (datagram.data (), res, header, packages.data ());
+        }
+        if (status != StreamPacketStatus::OK)
+        {
+            tracker->add_invalid ();
+            safe_logger (spdlog::level::trace, "invalid datagram of {} bytes, status {}", res,
+                (int)status);
+            continue;
+        }
+        if (!tracker->update (header.sequence))
         {
-            push_package (transaction + i * num_rows, presets[num]);
+            safe_logger (spdlog::level::trace, "late datagram {}", header.sequence);
+            continue;
         }
+        push_packages (packages.data (), header.num_samples, presets[num]);
     }
-    delete[] transaction;
 }
 
 void StreamingBoard::log_socket_error (int error_code)
@@ -238,3 +269,18 @@ void StreamingBoard::log_socket_error (int error_code)
 #endif
     safe_logger (spdlog::level::err, "socket operation error code: {}", error_code);
 }
+
+void StreamingBoard::free_clients ()
+{
+    for (auto client : clients)
+    {
+        delete client;
+    }
+    for (auto tracker : trackers)
+    {
+        delete tracker;
+    }
+    clients.clear ();
+    trackers.clear ();
+    presets.clear ();
+}
@@ -95,27 +95,33 @@ int SyntheticBoard::release_session ()
 void SyntheticBoard::read_thread ()
 {
     unsigned char counter = 0;
-    std::vector<int> exg_channels =
-        board_descr["default"]["eeg_channels"]; // same channels for eeg\emg\ecg
+    const PresetLayout *layout = get_preset_layout ((int)BrainFlowPresets::DEFAULT_PRESET);
+    const PresetLayout *aux_layout = get_preset_layout ((int)BrainFlowPresets::AUXILIARY_PRESET);
+    if ((layout == NULL) || (aux_layout == NULL))
+    {
+        safe_logger (spdlog::level::err, "presets are not prepared");
+        return;
+    }
+    const std::vector<int> &exg_channels = layout->eeg_channels; // same channels for eeg\emg\ecg
     double *sin_phase_rad = new double[exg_channels.size ()];
-    for (unsigned int i = 0; i < board_descr["default"]["eeg_channels"].size (); i++)
+    for (unsigned int i = 0; i < exg_channels.size (); i++)
     {
         sin_phase_rad[i] = 0.0;
     }
-    int sampling_rate = board_descr["default"]["sampling_rate"];
+    int sampling_rate = layout->sampling_rate;
     int sleep_time = (int)((1000.0 / sampling_rate));
     std::uniform_real_distribution<double> dist_around_one (0.90, 1.10);
     uint64_t seed = std::chrono::high_resolution_clock::now ().time_since_epoch ().count ();
     std::mt19937 mt (static_cast<uint32_t> (seed));
     double accumulated_time_delta = 0.0;
 
-    int num_rows = board_descr["default"]["num_rows"];
+    int num_rows = layout->num_rows;
     double *package = new double[num_rows];
     for (int i = 0; i < num_rows; i++)
     {
         package[i] = 0.0;
     }
-    int num_aux_rows = board_descr["auxiliary"]["num_rows"];
+    int num_aux_rows = aux_layout->num_rows;
     double *aux_package = new double[num_aux_rows];
     for (int i = 0; i < num_aux_rows; i++)
     {
@@ -125,7 +131,7 @@ void SyntheticBoard::read_thread ()
     while (keep_alive)
     {
         auto start = std::chrono::high_resolution_clock::now ();
-        package[board_descr["default"]["package_num_channel"].get<int> ()] = (double)counter;
+        package[layout->package_num_channel] = (double)counter;
         for (unsigned int i = 0; i < exg_channels.size (); i++)
         {
             double amplitude = 10.0 * (i + 1);
@@ -149,22 +155,21 @@ void SyntheticBoard::read_thread ()
             package[exg_channels[i]] =
                 amplitude + (amplitude + dist (mt)) * sqrt (2.0) * sin (sin_phase_rad[i] + shift);
         }
-        for (int channel : board_descr["default"]["accel_channels"])
+        for (int channel : layout->accel_channels)
         {
             package[channel] = dist_around_one (mt) - 0.1;
         }
-        for (int channel : board_descr["default"]["gyro_channels"])
+        for (int channel : layout->gyro_channels)
         {
             package[channel] = dist_around_one (mt) - 0.1;
         }
-        for (int channel : board_descr["default"]["eda_channels"])
+        for (int channel : layout->eda_channels)
         {
             package[channel] = dist_around_one (mt);
         }
-        for (int chan_num = 0; chan_num < (int)board_descr["default"]["ppg_channels"].size ();
-             chan_num++)
+        for (int chan_num = 0; chan_num < (int)layout->ppg_channels.size (); chan_num++)
         {
-            int channel = board_descr["default"]["ppg_channels"][chan_num];
+            int channel = layout->ppg_channels[chan_num];
             if (chan_num == 0)
             {
                 package[channel] = 500.0 * dist_around_one (mt);
@@ -174,45 +179,42 @@ void SyntheticBoard::read_thread ()
                 package[channel] = 253500.0 * dist_around_one (mt);
             }
         }
-        for (int channel : board_descr["default"]["temperature_channels"])
+        for (int channel : layout->temperature_channels)
         {
             package[channel] = dist_around_one (mt) / 10.0 + 36.5;
         }
-        for (int channel : board_descr["default"]["resistance_channels"])
+        for (int channel : layout->resistance_channels)
         {
             package[channel] = 1000.0 * dist_around_one (mt);
         }
-        package[board_descr["default"]["battery_channel"].get<int> ()] =
-            (dist_around_one (mt) - 0.1) * 100;
-        package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
+        package[layout->battery_channel] = (dist_around_one (mt) - 0.1) * 100;
+        package[layout->timestamp_channel] = get_timestamp ();
 
         push_package (package); // use this method to submit data to buffers
 
         // push aux package
-        for (int channel : board_descr["auxiliary"]["other_channels"])
+        for (int channel : aux_layout->other_channels)
         {
             aux_package[channel] = (double)channel;
         }
-        aux_package[board_descr["auxiliary"]["timestamp_channel"].get<int> ()] = get_timestamp ();
-        aux_package[board_descr["auxiliary"]["package_num_channel"].get<int> ()] = (double)counter;
-        aux_package[board_descr["auxiliary"]["battery_channel"].get<int> ()] =
-            (dist_around_one (mt) - 0.1) * 100;
-        for (int channel : board_descr["auxiliary"]["accel_channels"])
+        aux_package[aux_layout->timestamp_channel] = get_timestamp ();
+        aux_package[aux_layout->package_num_channel] = (double)counter;
+        aux_package[aux_layout->battery_channel] = (dist_around_one (mt) - 0.1) * 100;
+        for (int channel : aux_layout->accel_channels)
         {
             aux_package[channel] = dist_around_one (mt) - 0.1;
         }
-        for (int channel : board_descr["auxiliary"]["gyro_channels"])
+        for (int channel : aux_layout->gyro_channels)
         {
             aux_package[channel] = dist_around_one (mt) - 0.1;
         }
-        for (int channel : board_descr["auxiliary"]["eda_channels"])
+        for (int channel : aux_layout->eda_channels)
         {
             aux_package[channel] = dist_around_one (mt);
         }
-        for (int chan_num = 0; chan_num < (int)board_descr["auxiliary"]["ppg_channels"].size ();
-             chan_num++)
+        for (int chan_num = 0; chan_num < (int)aux_layout->ppg_channels.size (); chan_num++)
         {
-            int channel = board_descr["auxiliary"]["ppg_channels"][chan_num];
+            int channel = aux_layout->ppg_channels[chan_num];
             if (chan_num == 0)
             {
                 aux_package[channel] = 500.0 * dist_around_one (mt);
@@ -222,11 +224,11 @@ void SyntheticBoard::read_thread ()
                 aux_package[channel] = 253500.0 * dist_around_one (mt);
             }
         }
-        for (int channel : board_descr["auxiliary"]["temperature_channels"])
+        for (int channel : aux_layout->temperature_channels)
         {
             aux_package[channel] = dist_around_one (mt) / 10.0 + 36.5;
         }
-        for (int channel : board_descr["auxiliary"]["resistance_channels"])
+        for (int channel : aux_layout->resistance_channels)
         {
             aux_package[channel] = 1000.0 * dist_around_one (mt);
         }
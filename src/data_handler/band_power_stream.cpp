@@ -0,0 +1,214 @@
+#include <algorithm>
+
+#include "band_power_stream.h"
+#include "brainflow_constants.h"
+#include "data_handler.h"
+
+
+BandPowerStream::BandPowerStream (FFTPlanCache &fft_plans, int num_channels, int sampling_rate,
+    int nfft, int window_len, int hop, const std::vector<double> &start_freqs,
+    const std::vector<double> &stop_freqs, const std::vector<Dsp::Filter *> &filters,
+    int filters_per_channel)
+    : fft_plans (fft_plans)
+{
+    this->num_channels = num_channels;
+    this->sampling_rate = sampling_rate;
+    this->nfft = nfft;
+    // same overlap as in get_custom_band_powers
+    this->step = nfft - 4 * nfft / 5;
+    this->hop = hop;
+    this->window_len = window_len;
+    this->num_segments = (window_len - nfft) / step + 1;
+    this->start_freqs = start_freqs;
+    this->stop_freqs = stop_freqs;
+    this->filters = filters;
+    this->filters_per_channel = filters_per_channel;
+    freqs.resize (nfft / 2 + 1);
+    for (int i = 0; i < nfft / 2 + 1; i++)
+    {
+        freqs[i] = i * (double)sampling_rate / (double)nfft;
+    }
+    samples.resize (num_channels, std::vector<double> (nfft));
+    spectra.resize (num_channels, std::vector<double> ((size_t)num_segments * (nfft / 2 + 1)));
+    spectra_sum.resize (num_channels, std::vector<double> (nfft / 2 + 1));
+    offsets.resize (num_channels);
+    segment.resize (nfft);
+    avg_spectrum.resize (nfft / 2 + 1);
+    reset_state ();
+}
+
+BandPowerStream::~BandPowerStream ()
+{
+    for (Dsp::Filter *f : filters)
+    {
+        delete f;
+    }
+    filters.clear ();
+}
+
+void BandPowerStream::reset_state ()
+{
+    num_samples = 0;
+    for (int i = 0; i < num_channels; i++)
+    {
+        std::fill (spectra_sum[i].begin (), spectra_sum[i].end (), 0.0);
+    }
+    for (Dsp::Filter *f : filters)
+    {
+        f->reset ();
+    }
+}
+
+int BandPowerStream::feed (int channel, const double *data, int data_len, FFTPlan *plan)
+{
+    int num_bins = nfft / 2 + 1;
+    if (num_samples == 0)
+    {
+        // filters start from zero state, removing dc offset of the first sample shortens the
+        // transient
+        offsets[channel] = (data_len > 0) ? data[0] : 0.0;
+    }
+    chunk.resize (data_len);
+    for (int i = 0; i < data_len; i++)
+    {
+        chunk[i] = data[i] - offsets[channel];
+    }
+    double *chunk_data[1] = {chunk.data ()};
+    for (int i = 0; i < filters_per_channel; i++)
+    {
+        filters[channel * filters_per_channel + i]->process (data_len, chunk_data);
+    }
+
+    std::vector<double> &channel_samples = samples[channel];
+    for (int i = 0; i < data_len; i++)
+    {
+        long long pos = num_samples + i;
+        channel_samples[(size_t)(pos % nfft)] = chunk[i];
+        long long segment_start = pos + 1 - nfft;
+        if ((segment_start < 0) || (segment_start % step != 0))
+        {
+            continue;
+        }
+        // segment is complete, unwrap it and replace the oldest periodogram in the ring
+        for (int j = 0; j < nfft; j++)
+        {
+            segment[j] = channel_samples[(size_t)((segment_start + j) % nfft)];
+        }
+        long long segment_num = segment_start / step;
+        int slot = (int)(segment_num % num_segments);
+        double *spectrum = spectra[channel].data () + (size_t)slot * num_bins;
+        std::vector<double> &sum = spectra_sum[channel];
+        if (segment_num >= num_segments)
+        {
+            for (int j = 0; j < num_bins; j++)
+            {
+                sum[j] -= spectrum[j];
+            }
+        }
+        std::fill (spectrum, spectrum + num_bins, 0.0);
+        accumulate_psd (plan, segment.data (), sampling_rate, spectrum);
+        if (slot == num_segments - 1)
+        {
+            // recompute the sum once per ring pass, so rounding errors dont pile up
+            std::fill (sum.begin (), sum.end (), 0.0);
+            for (int k = 0; k < num_segments; k++)
+            {
+                const double *cached = spectra[channel].data () + (size_t)k * num_bins;
+                for (int j = 0; j < num_bins; j++)
+                {
+                    sum[j] += cached[j];
+                }
+            }
+        }
+        else
+        {
+            for (int j = 0; j < num_bins; j++)
+            {
+                sum[j] += spectrum[j];
+            }
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BandPowerStream::get_band_powers (std::vector<std::vector<double>> &bands)
+{
+    int num_bins = nfft / 2 + 1;
+    int num_bands = (int)start_freqs.size ();
+    bands.assign (num_bands, std::vector<double> (num_channels, 0.0));
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        for (int j = 0; j < num_bins; j++)
+        {
+            avg_spectrum[j] = spectra_sum[channel][j] / num_segments;
+        }
+        for (int band = 0; band < num_bands; band++)
+        {
+            int res = ::get_band_power (avg_spectrum.data (), freqs.data (), num_bins,
+                start_freqs[band], stop_freqs[band], &bands[band][channel]);
+            if (res != (int)BrainFlowExitCodes::STATUS_OK)
+            {
+                return res;
+            }
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BandPowerStream::process (const double *data, int data_len,
+    std::vector<std::vector<double>> &bands, bool *is_updated)
+{
+    std::lock_guard<std::mutex> guard (lock);
+    *is_updated = false;
+    // updates happen when num_samples reaches window_len + k * hop, find the last one in this
+    // chunk and split the chunk there
+    int split = 0;
+    long long end = num_samples + data_len;
+    if (end >= window_len)
+    {
+        long long last_update = window_len + (end - window_len) / hop * hop;
+        if (last_update > num_samples)
+        {
+            split = (int)(last_update - num_samples);
+        }
+    }
+
+    ScopedFFTPlan plan (fft_plans);
+    int res = plan.acquire (nfft, false, (int)WindowOperations::HANNING);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    int part_starts[2] = {0, split};
+    int part_ends[2] = {split, data_len};
+    for (int part = 0; part < 2; part++)
+    {
+        int part_len = part_ends[part] - part_starts[part];
+        for (int channel = 0; (channel < num_channels) && (part_len > 0); channel++)
+        {
+            res = feed (channel, data + (size_t)channel * data_len + part_starts[part], part_len,
+                plan.get ());
+            if (res != (int)BrainFlowExitCodes::STATUS_OK)
+            {
+                return res;
+            }
+        }
+        num_samples += part_len;
+        if ((part == 0) && (split > 0))
+        {
+            res = get_band_powers (bands);
+            if (res != (int)BrainFlowExitCodes::STATUS_OK)
+            {
+                return res;
+            }
+            *is_updated = true;
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void BandPowerStream::reset ()
+{
+    std::lock_guard<std::mutex> guard (lock);
+    reset_state ();
+}
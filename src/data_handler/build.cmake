@@ -27,8 +27,15 @@ else (CMAKE_SIZEOF_VOID_P EQUAL 8)
 endif (CMAKE_SIZEOF_VOID_P EQUAL 8)
 
 SET (DATA_HANDLER_SRC
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/band_power_stream.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/data_handler.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/fastica.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/fft_plan_cache.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/wavelet_transform_cache.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bin_file.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/dsp_kernels.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/thread_pool.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/tsv_parser.cpp
 )
 
 add_library (
@@ -1,5 +1,7 @@
 #include <algorithm>
+#include <map>
 #include <math.h>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <stdexcept>
@@ -10,13 +12,23 @@
 #include <thread>
 #include <vector>
 
+#include "band_power_stream.h"
+#include "bin_file.h"
 #include "brainflow_constants.h"
+#include "brainflow_env_vars.h"
 #include "brainflow_version.h"
 #include "common_data_handler_helpers.h"
 #include "data_handler.h"
 #include "downsample_operators.h"
+#include "dsp_kernels.h"
+#include "fft_plan_cache.h"
+#include "peaks_detector.h"
 #include "rolling_filter.h"
+#include "streaming_filter.h"
+#include "thread_pool.h"
+#include "tsv_parser.h"
 #include "wavelet_helpers.h"
+#include "wavelet_transform_cache.h"
 #include "window_functions.h"
 
 #include "DspFilters/Dsp.h"
@@ -50,6 +62,26 @@ std::shared_ptr<spdlog::logger> data_logger = spdlog::stderr_logger_mt (LOGGER_N
 
 // its only for logging methods, other methods can be executed simultaneously
 std::mutex data_mutex;
+// fft configs, windows and scratch buffers reused between calls
+static FFTPlanCache fft_plans;
+static WaveletTransformCache wavelet_transforms;
+// filters created by create_streaming_filter, mutex guards the map only
+std::mutex streaming_filters_mutex;
+std::map<int, std::shared_ptr<StreamingFilter>> streaming_filters;
+int next_streaming_filter_id = 0;
+// detectors created by create_peaks_detector, mutex guards the map only
+std::mutex peaks_detectors_mutex;
+std::map<int, std::shared_ptr<PeaksDetector>> peaks_detectors;
+int next_peaks_detector_id = 0;
+// streams created by create_band_power_stream, mutex guards the map only
+std::mutex band_power_streams_mutex;
+std::map<int, std::shared_ptr<BandPowerStream>> band_power_streams;
+int next_band_power_stream_id = 0;
+// workers for multichannel methods, created on first use and recreated if number of threads
+// changes. Pool is never destroyed on unload, joining threads there may deadlock on windows
+std::mutex thread_pool_mutex;
+std::shared_ptr<ThreadPool> &thread_pool = *new std::shared_ptr<ThreadPool> ();
+int num_threads_setting = get_brainflow_num_threads ();
 
 
 int log_message_data_handler (int log_level, char *log_message)
@@ -122,61 +154,197 @@ int set_log_level_data_handler (int level)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int set_num_threads_data_handler (int num_threads)
+{
+    if ((num_threads < 0) || (num_threads > MAX_BRAINFLOW_NUM_THREADS))
+    {
+        data_logger->error ("num_threads should be between 0 and {}", MAX_BRAINFLOW_NUM_THREADS);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<ThreadPool> old_pool;
+    {
+        std::lock_guard<std::mutex> lock (thread_pool_mutex);
+        num_threads_setting = num_threads;
+        old_pool = thread_pool;
+        thread_pool.reset ();
+    }
+    // running calls keep the old pool, its workers are joined after the last of them
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-int perform_lowpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
-    int filter_type, double ripple)
+static std::shared_ptr<ThreadPool> get_thread_pool ()
 {
-    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data) || (cutoff < 0) || (sampling_rate < 1))
+    std::lock_guard<std::mutex> lock (thread_pool_mutex);
+    if (!thread_pool)
+    {
+        thread_pool = std::make_shared<ThreadPool> (num_threads_setting);
+    }
+    return thread_pool;
+}
+
+int get_num_threads_data_handler (int *num_threads)
+{
+    if (num_threads == NULL)
     {
-        data_logger->error (
-            "Order must be from 1-8 and data cannot be empty. Order:{} , Data:{} , Cutoff:{}",
-            order, (data != NULL), cutoff);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+#ifdef _OPENMP
+    {
+        std::lock_guard<std::mutex> lock (thread_pool_mutex);
+        *num_threads = (num_threads_setting > 0) ? num_threads_setting : omp_get_max_threads ();
+    }
+#else
+    *num_threads = get_thread_pool ()->get_num_threads ();
+#endif
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    double *filter_data[1];
-    filter_data[0] = data;
-    Dsp::Filter *f = NULL;
+// calls process_channel (channel) for every row of num_channels x data_len matrix in parallel,
+// returns error of the first failed channel. Uses thread pool or OpenMP if library is built
+// with USE_OPENMP
+template <class Func>
+static int process_channels (int num_channels, Func process_channel)
+{
+    std::vector<int> exit_codes (num_channels, (int)BrainFlowExitCodes::STATUS_OK);
+#ifdef _OPENMP
+    int num_threads = 0;
+    get_num_threads_data_handler (&num_threads);
+#pragma omp parallel for num_threads (num_threads)
+    for (int i = 0; i < num_channels; i++)
+    {
+        exit_codes[i] = process_channel (i);
+    }
+#else
+    get_thread_pool ()->parallel_for (num_channels,
+        [&exit_codes, &process_channel] (int i) { exit_codes[i] = process_channel (i); });
+#endif
+    for (int i = 0; i < num_channels; i++)
+    {
+        if (exit_codes[i] != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return exit_codes[i];
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+static bool is_valid_matrix (const double *data, int num_channels, int data_len)
+{
+    if ((data == NULL) || (num_channels < 1) || (data_len < 1))
+    {
+        data_logger->error ("Please review your arguments.");
+        return false;
+    }
+    return true;
+}
 
+
+template <template <int> class ButterworthDesign, template <int> class ChebyshevDesign,
+    template <int> class BesselDesign>
+static Dsp::Filter *new_filter_design (int filter_type)
+{
     switch (static_cast<FilterTypes> (filter_type))
     {
         case FilterTypes::BUTTERWORTH:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
-            break;
         case FilterTypes::BUTTERWORTH_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
-            break;
+            return new Dsp::FilterDesign<ButterworthDesign<MAX_FILTER_ORDER>, 1> ();
         case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
-            break;
         case FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
-            break;
+            return new Dsp::FilterDesign<ChebyshevDesign<MAX_FILTER_ORDER>, 1> ();
         case FilterTypes::BESSEL:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
-            break;
         case FilterTypes::BESSEL_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
-            break;
+            return new Dsp::FilterDesign<BesselDesign<MAX_FILTER_ORDER>, 1> ();
         default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            return NULL;
     }
+}
 
+// designs a single channel filter, for low and high pass start_freq is a cutoff and stop_freq is
+// ignored. Returns NULL for invalid filter type
+static Dsp::Filter *create_filter_design (int filter_operation, int filter_type,
+    int sampling_rate, double start_freq, double stop_freq, int order, double ripple)
+{
+    Dsp::Filter *f = NULL;
     Dsp::Params params;
+    params.clear ();
     params[0] = sampling_rate; // sample rate
     params[1] = order;         // order
-    params[2] = cutoff;        // cutoff
-    if ((filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1) ||
-        (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE))
+    bool is_chebyshev = ((filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1) ||
+        (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE));
+    switch (static_cast<FilterOperations> (filter_operation))
+    {
+        case FilterOperations::LOWPASS:
+            f = new_filter_design<Dsp::Butterworth::Design::LowPass,
+                Dsp::ChebyshevI::Design::LowPass, Dsp::Bessel::Design::LowPass> (filter_type);
+            params[2] = start_freq; // cutoff
+            if (is_chebyshev)
+            {
+                params[3] = ripple; // ripple
+            }
+            break;
+        case FilterOperations::HIGHPASS:
+            f = new_filter_design<Dsp::Butterworth::Design::HighPass,
+                Dsp::ChebyshevI::Design::HighPass, Dsp::Bessel::Design::HighPass> (filter_type);
+            params[2] = start_freq; // cutoff
+            if (is_chebyshev)
+            {
+                params[3] = ripple; // ripple
+            }
+            break;
+        case FilterOperations::BANDPASS:
+        case FilterOperations::BANDSTOP:
+            if (filter_operation == (int)FilterOperations::BANDPASS)
+            {
+                f = new_filter_design<Dsp::Butterworth::Design::BandPass,
+                    Dsp::ChebyshevI::Design::BandPass, Dsp::Bessel::Design::BandPass> (
+                    filter_type);
+            }
+            else
+            {
+                f = new_filter_design<Dsp::Butterworth::Design::BandStop,
+                    Dsp::ChebyshevI::Design::BandStop, Dsp::Bessel::Design::BandStop> (
+                    filter_type);
+            }
+            params[2] = (start_freq + stop_freq) / 2.0; // center freq
+            params[3] = stop_freq - start_freq;         // band width
+            if (is_chebyshev)
+            {
+                // band pass and band stop chebyshev designs take 5 params and expect the ripple
+                // after the band width, unlike the low pass and high pass designs which take 4
+                params[4] = ripple; // ripple
+            }
+            break;
+        default:
+            break;
+    }
+    if (f != NULL)
     {
-        params[3] = ripple; // ripple
+        f->setParams (params);
     }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    if ((filter_type == (int)FilterTypes::BUTTERWORTH_ZERO_PHASE) ||
+    return f;
+}
+
+static bool is_zero_phase (int filter_type)
+{
+    return ((filter_type == (int)FilterTypes::BUTTERWORTH_ZERO_PHASE) ||
         (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE) ||
-        (filter_type == (int)FilterTypes::BESSEL_ZERO_PHASE))
+        (filter_type == (int)FilterTypes::BESSEL_ZERO_PHASE));
+}
+
+static int apply_filter (double *data, int data_len, int filter_operation, int filter_type,
+    int sampling_rate, double start_freq, double stop_freq, int order, double ripple)
+{
+    Dsp::Filter *f = create_filter_design (
+        filter_operation, filter_type, sampling_rate, start_freq, stop_freq, order, ripple);
+    if (f == NULL)
+    {
+        data_logger->error ("Filter type {} is Invalid", filter_type);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    double *filter_data[1];
+    filter_data[0] = data;
+    f->process (data_len, filter_data);
+    if (is_zero_phase (filter_type))
     {
         reverse_array (data, data_len);
         f->process (data_len, filter_data);
@@ -187,7 +355,7 @@ int perform_lowpass (double *data, int data_len, int sampling_rate, double cutof
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int perform_highpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
+int perform_lowpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
     int filter_type, double ripple)
 {
     if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data) || (cutoff < 0) || (sampling_rate < 1))
@@ -197,57 +365,22 @@ int perform_highpass (double *data, int data_len, int sampling_rate, double cuto
             order, (data != NULL), cutoff);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    return apply_filter (data, data_len, (int)FilterOperations::LOWPASS, filter_type,
+        sampling_rate, cutoff, 0.0, order, ripple);
+}
 
-    Dsp::Filter *f = NULL;
-    double *filter_data[1];
-    filter_data[0] = data;
-
-    switch (static_cast<FilterTypes> (filter_type))
-    {
-        case FilterTypes::BUTTERWORTH:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BUTTERWORTH_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-    }
-    Dsp::Params params;
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = cutoff;        // cutoff
-    if ((filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1) ||
-        (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE))
-    {
-        params[3] = ripple; // ripple
-    }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    if ((filter_type == (int)FilterTypes::BUTTERWORTH_ZERO_PHASE) ||
-        (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE) ||
-        (filter_type == (int)FilterTypes::BESSEL_ZERO_PHASE))
+int perform_highpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
+    int filter_type, double ripple)
+{
+    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data) || (cutoff < 0) || (sampling_rate < 1))
     {
-        reverse_array (data, data_len);
-        f->process (data_len, filter_data);
-        reverse_array (data, data_len);
+        data_logger->error (
+            "Order must be from 1-8 and data cannot be empty. Order:{} , Data:{} , Cutoff:{}",
+            order, (data != NULL), cutoff);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    delete f;
-
-    return (int)BrainFlowExitCodes::STATUS_OK;
+    return apply_filter (data, data_len, (int)FilterOperations::HIGHPASS, filter_type,
+        sampling_rate, cutoff, 0.0, order, ripple);
 }
 
 int perform_bandpass (double *data, int data_len, int sampling_rate, double start_freq,
@@ -261,64 +394,8 @@ int perform_bandpass (double *data, int data_len, int sampling_rate, double star
             order, (data != NULL), start_freq, stop_freq);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-
-    double center_freq = (start_freq + stop_freq) / 2.0;
-    double band_width = stop_freq - start_freq;
-    Dsp::Filter *f = NULL;
-    double *filter_data[1];
-    filter_data[0] = data;
-
-    switch (static_cast<FilterTypes> (filter_type))
-    {
-        case FilterTypes::BUTTERWORTH:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BUTTERWORTH_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        default:
-            data_logger->error ("Filter type {} is Invalid. ", filter_type);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-    }
-
-    Dsp::Params params;
-    params.clear ();
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = center_freq;   // center freq
-    params[3] = band_width;    // band width
-    if ((filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1) ||
-        (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE))
-    {
-        // band pass and band stop chebyshev designs take 5 params and expect the ripple after
-        // the band width, unlike the low pass and high pass designs which take 4
-        params[4] = ripple; // ripple
-    }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    if ((filter_type == (int)FilterTypes::BUTTERWORTH_ZERO_PHASE) ||
-        (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE) ||
-        (filter_type == (int)FilterTypes::BESSEL_ZERO_PHASE))
-    {
-        reverse_array (data, data_len);
-        f->process (data_len, filter_data);
-        reverse_array (data, data_len);
-    }
-    delete f;
-
-    return (int)BrainFlowExitCodes::STATUS_OK;
+    return apply_filter (data, data_len, (int)FilterOperations::BANDPASS, filter_type,
+        sampling_rate, start_freq, stop_freq, order, ripple);
 }
 
 int perform_bandstop (double *data, int data_len, int sampling_rate, double start_freq,
@@ -332,63 +409,112 @@ int perform_bandstop (double *data, int data_len, int sampling_rate, double star
             order, (data != NULL), start_freq, stop_freq);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    return apply_filter (data, data_len, (int)FilterOperations::BANDSTOP, filter_type,
+        sampling_rate, start_freq, stop_freq, order, ripple);
+}
 
-    double center_freq = (start_freq + stop_freq) / 2.0;
-    double band_width = stop_freq - start_freq;
-    Dsp::Filter *f = NULL;
-    double *filter_data[1];
-    filter_data[0] = data;
+int create_streaming_filter (int filter_operation, int num_channels, int sampling_rate,
+    double start_freq, double stop_freq, int order, int filter_type, double ripple,
+    int *filter_id)
+{
+    bool is_band = ((filter_operation == (int)FilterOperations::BANDPASS) ||
+        (filter_operation == (int)FilterOperations::BANDSTOP));
+    if ((filter_id == NULL) || (num_channels < 1) || (order < 1) ||
+        (order > MAX_FILTER_ORDER) || (start_freq < 0) || (sampling_rate < 1) ||
+        ((is_band) && (stop_freq <= start_freq)))
+    {
+        data_logger->error ("Order must be from 1-8, num_channels must be positive. Order:{} , "
+                            "Channels:{} , Start Freq:{} , Stop Freq:{}",
+            order, num_channels, start_freq, stop_freq);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    // backward pass needs the whole signal, it can not be applied chunk by chunk
+    if (is_zero_phase (filter_type))
+    {
+        data_logger->error ("Zero phase filter type {} is not supported for streaming filters",
+            filter_type);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
 
-    switch (static_cast<FilterTypes> (filter_type))
+    std::vector<Dsp::Filter *> channel_filters;
+    for (int i = 0; i < num_channels; i++)
     {
-        case FilterTypes::BUTTERWORTH:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BUTTERWORTH_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL_ZERO_PHASE:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
+        Dsp::Filter *f = create_filter_design (
+            filter_operation, filter_type, sampling_rate, start_freq, stop_freq, order, ripple);
+        if (f == NULL)
+        {
+            for (Dsp::Filter *channel_filter : channel_filters)
+            {
+                delete channel_filter;
+            }
+            data_logger->error ("Filter type {} or operation {} is Invalid", filter_type,
+                filter_operation);
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        channel_filters.push_back (f);
     }
 
-    Dsp::Params params;
-    params.clear ();
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = center_freq;   // center freq
-    params[3] = band_width;    // band width
-    if ((filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1) ||
-        (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE))
+    std::lock_guard<std::mutex> lock (streaming_filters_mutex);
+    int id = next_streaming_filter_id++;
+    streaming_filters[id] = std::make_shared<StreamingFilter> (channel_filters);
+    *filter_id = id;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+static std::shared_ptr<StreamingFilter> get_streaming_filter (int filter_id)
+{
+    std::lock_guard<std::mutex> lock (streaming_filters_mutex);
+    auto it = streaming_filters.find (filter_id);
+    if (it == streaming_filters.end ())
     {
-        // band pass and band stop chebyshev designs take 5 params and expect the ripple after
-        // the band width, unlike the low pass and high pass designs which take 4
-        params[4] = ripple; // ripple
+        return std::shared_ptr<StreamingFilter> ();
     }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    if ((filter_type == (int)FilterTypes::BUTTERWORTH_ZERO_PHASE) ||
-        (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1_ZERO_PHASE) ||
-        (filter_type == (int)FilterTypes::BESSEL_ZERO_PHASE))
+    return it->second;
+}
+
+int process_streaming_filter (int filter_id, double *data, int num_channels, int data_len)
+{
+    if ((data == NULL) || (data_len < 0))
     {
-        reverse_array (data, data_len);
-        f->process (data_len, filter_data);
-        reverse_array (data, data_len);
+        data_logger->error ("Data cannot be empty.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    delete f;
+    std::shared_ptr<StreamingFilter> filter = get_streaming_filter (filter_id);
+    if (!filter)
+    {
+        data_logger->error ("No streaming filter with id {}", filter_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (num_channels != filter->get_num_channels ())
+    {
+        data_logger->error ("Filter was created for {} channels, provided {}",
+            filter->get_num_channels (), num_channels);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    filter->process (data, data_len);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
+int reset_streaming_filter (int filter_id)
+{
+    std::shared_ptr<StreamingFilter> filter = get_streaming_filter (filter_id);
+    if (!filter)
+    {
+        data_logger->error ("No streaming filter with id {}", filter_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    filter->reset ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int release_streaming_filter (int filter_id)
+{
+    std::lock_guard<std::mutex> lock (streaming_filters_mutex);
+    if (streaming_filters.erase (filter_id) == 0)
+    {
+        data_logger->error ("No streaming filter with id {}", filter_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -507,15 +633,11 @@ int perform_wavelet_transform (double *data, int data_len, int wavelet, int deco
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    wave_object obj = NULL;
-    wt_object wt = NULL;
-
     try
     {
-        obj = wave_init (wavelet_str.c_str ());
-        wt = wt_init (obj, "dwt", data_len, decomposition_level);
-        setDWTExtension (wt, extension_str.c_str ());
-        setWTConv (wt, "direct");
+        ScopedWaveletTransform transform (wavelet_transforms);
+        transform.acquire (wavelet, data_len, decomposition_level, extension);
+        wt_object wt = transform->wt;
         dwt (wt, data);
         for (int i = 0; i < wt->outlength; i++)
         {
@@ -525,23 +647,9 @@ int perform_wavelet_transform (double *data, int data_len, int wavelet, int deco
         {
             decomposition_lengths[i] = wt->length[i];
         }
-        wave_free (obj);
-        obj = NULL;
-        wt_free (wt);
-        wt = NULL;
     }
     catch (const std::exception &e)
     {
-        if (obj)
-        {
-            wave_free (obj);
-            obj = NULL;
-        }
-        if (wt)
-        {
-            wt_free (wt);
-            wt = NULL;
-        }
         // more likely exception here occured because input buffer is to small to perform wavelet
         // transform
         data_logger->error ("Exception in wavelib: {}", e.what ());
@@ -565,15 +673,11 @@ int perform_inverse_wavelet_transform (double *wavelet_coeffs, int original_data
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    wave_object obj = NULL;
-    wt_object wt = NULL;
-
     try
     {
-        obj = wave_init (wavelet_str.c_str ());
-        wt = wt_init (obj, "dwt", original_data_len, decomposition_level);
-        setDWTExtension (wt, extension_str.c_str ());
-        setWTConv (wt, "direct");
+        ScopedWaveletTransform transform (wavelet_transforms);
+        transform.acquire (wavelet, original_data_len, decomposition_level, extension);
+        wt_object wt = transform->wt;
         int total_len = 0;
         for (int i = 0; i < decomposition_level + 1; i++)
         {
@@ -585,23 +689,9 @@ int perform_inverse_wavelet_transform (double *wavelet_coeffs, int original_data
             wt->output[i] = wavelet_coeffs[i];
         }
         idwt (wt, output_data);
-        wave_free (obj);
-        obj = NULL;
-        wt_free (wt);
-        wt = NULL;
     }
     catch (const std::exception &e)
     {
-        if (obj)
-        {
-            wave_free (obj);
-            obj = NULL;
-        }
-        if (wt)
-        {
-            wt_free (wt);
-            wt = NULL;
-        }
         data_logger->error ("Exception in wavelib: {}", e.what ());
         // more likely exception here occured because input buffer is to small to perform wavelet
         // transform
@@ -627,31 +717,22 @@ int perform_wavelet_denoising (double *data, int data_len, int wavelet, int deco
     }
 
     denoise_object obj = NULL;
-    double *temp = new double[data_len];
     try
     {
+        ScopedWaveletTransform transform (wavelet_transforms);
+        transform.acquire (wavelet, data_len, decomposition_level, extenstion_type);
         obj = denoise_init (data_len, decomposition_level, wavelet_str.c_str ());
         setDenoiseMethod (obj, denoising_str.c_str ());
         setDenoiseWTMethod (obj, "dwt");
         setDenoiseWTExtension (obj, extension_str.c_str ());
         setDenoiseParameters (obj, threshold_str.c_str (), noise_str.c_str ());
-        denoise (obj, data, temp);
-        for (int i = 0; i < data_len; i++)
-        {
-            data[i] = temp[i];
-        }
-        delete[] temp;
-        temp = NULL;
+        // dwt copies the signal before idwt writes the output, so denoising can be done in-place
+        denoise_wt (obj, transform->wt, data, data);
         denoise_free (obj);
         obj = NULL;
     }
     catch (const std::exception &e)
     {
-        if (temp)
-        {
-            delete[] temp;
-            temp = NULL;
-        }
         if (obj)
         {
             denoise_free (obj);
@@ -753,6 +834,15 @@ int get_csp (const double *data, const double *labels, int n_epochs, int n_chann
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+static void fill_psd_freqs (int nfft, int sampling_rate, double *output_freq)
+{
+    double freq_res = (double)sampling_rate / (double)nfft;
+    for (int i = 0; i < nfft / 2 + 1; i++)
+    {
+        output_freq[i] = i * freq_res;
+    }
+}
+
 int get_window (int window_function, int window_len, double *output_window)
 {
     if ((window_len <= 0) || (window_function < 0) || (output_window == NULL))
@@ -793,50 +883,18 @@ int perform_fft (
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    double *windowed_data = new double[data_len];
-    int window_res = get_window (window_function, data_len, windowed_data);
-    if (window_res != (int)BrainFlowExitCodes::STATUS_OK)
-    {
-        delete[] windowed_data;
-        return window_res;
-    }
-    for (int i = 0; i < data_len; i++)
+    ScopedFFTPlan plan (fft_plans);
+    int res = plan.acquire (data_len, false, window_function);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        windowed_data[i] *= data[i];
+        data_logger->error ("Error with doing FFT processing.");
+        return res;
     }
-    kiss_fft_cpx *sout = new kiss_fft_cpx[data_len];
-    kiss_fftr_cfg cfg = NULL;
-    try
+    apply_fft (plan.get (), data);
+    for (int i = 0; i < data_len / 2 + 1; i++)
     {
-        cfg = kiss_fftr_alloc (data_len, 0, 0, 0);
-        kiss_fftr (cfg, windowed_data, sout);
-        for (int i = 0; i < data_len / 2 + 1; i++)
-        {
-            output_re[i] = sout[i].r;
-            output_im[i] = sout[i].i;
-        }
-        delete[] sout;
-        delete[] windowed_data;
-        windowed_data = NULL;
-        sout = NULL;
-        kiss_fftr_free (cfg);
-    }
-    catch (...)
-    {
-        if (sout)
-        {
-            delete[] sout;
-        }
-        if (windowed_data)
-        {
-            delete[] windowed_data;
-        }
-        if (cfg)
-        {
-            kiss_fftr_free (cfg);
-        }
-        data_logger->error ("Error with doing FFT processing.");
-        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        output_re[i] = plan->complex_buf[i].r;
+        output_im[i] = plan->complex_buf[i].i;
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -850,44 +908,23 @@ int perform_ifft (double *input_re, double *input_im, int data_len, double *rest
             "Please check to make sure all arguments aren't empty and data_len is even.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *temp = new double[data_len];
-    kiss_fft_cpx *cin = new kiss_fft_cpx[data_len];
-    for (int i = 0; i < data_len / 2 + 1; i++)
+
+    ScopedFFTPlan plan (fft_plans);
+    int res = plan.acquire (data_len, true, -1);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        cin[i].r = input_re[i];
-        cin[i].i = input_im[i];
+        data_logger->error ("Error with doing inverse FFT.");
+        return res;
     }
-    kiss_fftr_cfg cfg = NULL;
-    try
+    for (int i = 0; i < data_len / 2 + 1; i++)
     {
-        cfg = kiss_fftr_alloc (data_len, 1, 0, 0);
-        kiss_fftri (cfg, cin, temp);
-        for (int i = 0; i < data_len; i++)
-        {
-            restored_data[i] = temp[i] / data_len;
-        }
-        delete[] cin;
-        cin = NULL;
-        delete[] temp;
-        temp = NULL;
-        kiss_fftr_free (cfg);
+        plan->complex_buf[i].r = input_re[i];
+        plan->complex_buf[i].i = input_im[i];
     }
-    catch (...)
+    kiss_fftri (plan->cfg, plan->complex_buf.data (), plan->real_buf.data ());
+    for (int i = 0; i < data_len; i++)
     {
-        if (temp)
-        {
-            delete[] temp;
-        }
-        if (cin)
-        {
-            delete[] cin;
-        }
-        if (cfg)
-        {
-            kiss_fftr_free (cfg);
-        }
-        data_logger->error ("Error with doing inverse FFT.");
-        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        restored_data[i] = plan->real_buf[i] / data_len;
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -902,28 +939,20 @@ int get_psd (double *data, int data_len, int sampling_rate, int window_function,
                             "is >=1 and data_len is even.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *re = new double[data_len / 2 + 1];
-    double *im = new double[data_len / 2 + 1];
-    int res = perform_fft (data, data_len, window_function, re, im);
+
+    ScopedFFTPlan plan (fft_plans);
+    int res = plan.acquire (data_len, false, window_function);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        delete[] re;
-        delete[] im;
+        data_logger->error ("Error with doing FFT processing.");
         return res;
     }
-    double freq_res = (double)sampling_rate / (double)data_len;
     for (int i = 0; i < data_len / 2 + 1; i++)
     {
-        // https://www.mathworks.com/help/signal/ug/power-spectral-density-estimates-using-fft.html
-        output_ampl[i] = (re[i] * re[i] + im[i] * im[i]) / ((double)(sampling_rate * data_len));
-        if ((i != 0) && (i != data_len / 2))
-        {
-            output_ampl[i] *= 2;
-        }
-        output_freq[i] = i * freq_res;
+        output_ampl[i] = 0.0;
     }
-    delete[] re;
-    delete[] im;
+    accumulate_psd (plan.get (), data, sampling_rate, output_ampl);
+    fill_psd_freqs (data_len, sampling_rate, output_freq);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -1019,6 +1048,29 @@ int write_file (
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+// files written by file_bin streamer, data is copied from the mapping without parsing
+static int read_bin_file (
+    double *data, int *num_rows, int *num_cols, const char *file_name, int num_elements)
+{
+    BinFileReader reader;
+    int res = reader.open (file_name);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("Couldn't read binary file {}", file_name);
+        return res;
+    }
+    int rows = reader.get_header ().num_rows;
+    size_t cols = reader.read (data, (size_t)(num_elements / rows));
+    if (cols == 0)
+    {
+        data_logger->error ("Empty file {}", file_name);
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    }
+    *num_rows = rows;
+    *num_cols = (int)cols;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int read_file (double *data, int *num_rows, int *num_cols, const char *file_name, int num_elements)
 {
     if (num_elements <= 0)
@@ -1026,84 +1078,65 @@ int read_file (double *data, int *num_rows, int *num_cols, const char *file_name
         data_logger->error ("Nummber or elements must be greater than 0.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    FILE *fp;
-    fp = fopen (file_name, "r");
-    if (fp == NULL)
+    if (BinFileReader::is_bin_file (file_name))
+    {
+        return read_bin_file (data, num_rows, num_cols, file_name, num_elements);
+    }
+    // rows and cols in tsv file, in data array its transposed!
+    long long total_rows = count_lines_in_file (file_name);
+    LineReader reader;
+    if ((total_rows < 0) || (!reader.open (file_name)))
     {
         data_logger->error ("Couldn't read file {}", file_name);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    char buf[4096];
-    // rows and cols in tsv file, in data array its transposed!
-    int total_rows = 0;
+    std::vector<double> values (64);
     int total_cols = 0;
-
-    // count rows
-    char c;
-    for (c = getc (fp); !feof (fp); c = getc (fp))
+    int max_rows = 0;
+    int current_row = 0;
+    const char *line = NULL;
+    size_t len = 0;
+    while (((current_row == 0) || (current_row < max_rows)) && (reader.next_line (&line, &len)))
     {
-        if (c == '\n')
+        int cols = parse_tsv_line (line, len, values.data (), (int)values.size ());
+        if (cols > (int)values.size ())
         {
-            total_rows++;
+            values.resize (cols);
+            cols = parse_tsv_line (line, len, values.data (), (int)values.size ());
         }
-    }
-
-    fseek (fp, 0, SEEK_SET);
-    int current_row = 0;
-    int cur_pos = 0;
-    while (fgets (buf, sizeof (buf), fp) != NULL)
-    {
-        std::string tsv_string (buf);
-        std::stringstream ss (tsv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        char sep = '\t';
-        if (tsv_string.find ('\t') == std::string::npos)
+        if (cols < 0)
         {
-            sep = ',';
+            data_logger->error ("found not a number in data file");
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
-        while (std::getline (ss, tmp, sep))
+        if (current_row == 0)
         {
-            if (tmp != "\n")
+            total_cols = cols;
+            // output is total_cols x max_rows matrix, dont write more than caller allocated
+            if (cols > 0)
             {
-                splitted.push_back (tmp);
+                max_rows = (int)std::min (total_rows, (long long)(num_elements / cols));
+            }
+            if (max_rows == 0)
+            {
+                data_logger->error ("invalid input file or too small number of elements");
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
             }
         }
-        if ((total_cols != 0) && (total_cols != (int)splitted.size ()))
+        if (total_cols != cols)
         {
             data_logger->error ("some rows have more cols than others, invalid input file");
-            fclose (fp);
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
-        total_cols = (int)splitted.size ();
         for (int i = 0; i < total_cols; i++)
         {
-            try
-            {
-                data[i * total_rows + current_row] = std::stod (splitted[i]);
-            }
-            catch (const std::invalid_argument &)
-            {
-                fclose (fp);
-                data_logger->error ("found not a number in data file");
-                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-            }
-            if (cur_pos == (num_elements - 1))
-            {
-                *num_cols = current_row + 1;
-                *num_rows = total_cols;
-                fclose (fp);
-                return (int)BrainFlowExitCodes::STATUS_OK;
-            }
-            cur_pos++;
+            data[i * max_rows + current_row] = values[i];
         }
         current_row++;
     }
-    // more likely code below is unreachable
-    *num_cols = total_rows;
+    *num_cols = current_row;
     *num_rows = total_cols;
-    fclose (fp);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -1113,79 +1146,58 @@ int calc_stddev (double *data, int start_pos, int end_pos, double *output)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double mean = 0;
-    for (int i = start_pos; i < end_pos; i++)
-    {
-        mean += data[i];
-    }
-    mean /= (end_pos - start_pos);
-    double stddev = 0;
-    for (int i = start_pos; i < end_pos; i++)
-    {
-        stddev += (data[i] - mean) * (data[i] - mean);
-    }
-    stddev /= (end_pos - start_pos);
+    const DspKernels &kernels = get_dsp_kernels ();
+    int len = end_pos - start_pos;
+    double mean = kernels.sum (data + start_pos, len) / len;
+    double stddev = kernels.squared_deviation_sum (data + start_pos, len, mean) / len;
     *output = sqrt (stddev);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int get_num_elements_in_file (const char *file_name, int *num_elements)
 {
-    FILE *fp;
-    fp = fopen (file_name, "r");
-    if (fp == NULL)
+    if (BinFileReader::is_bin_file (file_name))
     {
-        data_logger->error ("Couldn't read file {}", file_name);
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        BinFileReader reader;
+        int res = reader.open (file_name);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            data_logger->error ("Couldn't read binary file {}", file_name);
+            return res;
+        }
+        *num_elements = (int)(reader.get_num_samples () * reader.get_header ().num_rows);
+        if (*num_elements == 0)
+        {
+            data_logger->error ("Empty file {}", file_name);
+            return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+        }
+        return (int)BrainFlowExitCodes::STATUS_OK;
     }
 
-    char buf[4096];
-    int total_rows = 0;
-
-    // count rows
-    char c;
-    for (c = getc (fp); !feof (fp); c = getc (fp))
+    long long total_rows = count_lines_in_file (file_name);
+    LineReader reader;
+    if ((total_rows < 0) || (!reader.open (file_name)))
     {
-        if (c == '\n')
-        {
-            total_rows++;
-        }
+        data_logger->error ("Couldn't read file {}", file_name);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    if (total_rows == 0)
+    const char *line = NULL;
+    size_t len = 0;
+    if ((total_rows == 0) || (!reader.next_line (&line, &len)))
     {
         *num_elements = 0;
-        fclose (fp);
         data_logger->error ("Empty file {}", file_name);
         return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
     }
-
-    fseek (fp, 0, SEEK_SET);
-    while (fgets (buf, sizeof (buf), fp) != NULL)
+    int total_cols = parse_tsv_line (line, len, NULL, 0);
+    if (total_cols < 0)
     {
-        std::string tsv_string (buf);
-        std::stringstream ss (tsv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        char sep = '\t';
-        if (tsv_string.find ('\t') == std::string::npos)
-        {
-            sep = ',';
-        }
-        while (std::getline (ss, tmp, sep))
-        {
-            if (tmp != "\n")
-            {
-                splitted.push_back (tmp);
-            }
-        }
-        *num_elements = (int)splitted.size () * total_rows;
-        fclose (fp);
-        return (int)BrainFlowExitCodes::STATUS_OK;
+        *num_elements = 0;
+        data_logger->error ("found not a number in data file");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    *num_elements = 0;
-    fclose (fp);
-    data_logger->error ("File contents", file_name);
-    return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    *num_elements = (int)(total_cols * total_rows);
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int detrend (double *data, int data_len, int detrend_operation)
@@ -1200,46 +1212,28 @@ int detrend (double *data, int data_len, int detrend_operation)
     {
         return (int)BrainFlowExitCodes::STATUS_OK;
     }
+    const DspKernels &kernels = get_dsp_kernels ();
     if (detrend_operation == (int)DetrendOperations::CONSTANT)
     {
-        double mean = 0.0;
         // subtract mean from data
-        for (int i = 0; i < data_len; i++)
-        {
-            mean += data[i];
-        }
-        mean /= data_len;
-        for (int i = 0; i < data_len; i++)
-        {
-            data[i] -= mean;
-        }
+        double mean = kernels.sum (data, data_len) / data_len;
+        kernels.subtract_line (data, data_len, 0.0, mean);
         return (int)BrainFlowExitCodes::STATUS_OK;
     }
     if (detrend_operation == (int)DetrendOperations::LINEAR)
     {
         // use mean and gradient to find a line
         double mean_x = (data_len - 1) / 2.0;
-        double mean_y = 0;
-        for (int i = 0; i < data_len; i++)
-        {
-            mean_y += data[i];
-        }
-        mean_y /= data_len;
-        double temp_xy = 0.0;
-        double temp_xx = 0.0;
-        for (int i = 0; i < data_len; i++)
-        {
-            temp_xy += i * data[i];
-            temp_xx += i * i;
-        }
+        double mean_y = kernels.sum (data, data_len) / data_len;
+        double temp_xy = kernels.index_weighted_sum (data, data_len);
+        // sum of i * i for i in [0, data_len)
+        double n = (double)data_len;
+        double temp_xx = (n - 1.0) * n * (2.0 * n - 1.0) / 6.0;
         double s_xy = temp_xy / data_len - mean_x * mean_y;
         double s_xx = temp_xx / data_len - mean_x * mean_x;
         double grad = s_xy / s_xx;
         double y_int = mean_y - grad * mean_x;
-        for (int i = 0; i < data_len; i++)
-        {
-            data[i] = data[i] - (grad * i + y_int);
-        }
+        kernels.subtract_line (data, data_len, grad, y_int);
         return (int)BrainFlowExitCodes::STATUS_OK;
     }
     data_logger->error ("Detrend operation is incorrect. Detrend:{}", detrend_operation);
@@ -1249,44 +1243,99 @@ int detrend (double *data, int data_len, int detrend_operation)
 int get_psd_welch (double *data, int data_len, int nfft, int overlap, int sampling_rate,
     int window_function, double *output_ampl, double *output_freq)
 {
-    if ((data == NULL) || (data_len < 1) || (nfft & (nfft - 1)) || (output_ampl == NULL) ||
-        (output_freq == NULL) || (sampling_rate < 1) || (overlap < 0) || (overlap >= nfft))
+    if ((data == NULL) || (data_len < 1) || (nfft < 2) || (nfft & (nfft - 1)) ||
+        (output_ampl == NULL) || (output_freq == NULL) || (sampling_rate < 1) || (overlap < 0) ||
+        (overlap >= nfft))
     {
         data_logger->error ("Please review your arguments.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *ampls = new double[nfft / 2 + 1];
-    int counter = 0;
+    if (nfft > data_len)
+    {
+        data_logger->error ("Nfft must be less than data_len.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    // all segments share one plan, window and scratch buffers
+    ScopedFFTPlan plan (fft_plans);
+    int res = plan.acquire (nfft, false, window_function);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("Error with doing FFT processing.");
+        return res;
+    }
     for (int i = 0; i < nfft / 2 + 1; i++)
     {
         output_ampl[i] = 0.0;
     }
+    int counter = 0;
     for (int pos = 0; (pos + nfft) <= data_len; pos += (nfft - overlap), counter++)
     {
-        int res = get_psd (data + pos, nfft, sampling_rate, window_function, ampls, output_freq);
-        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        accumulate_psd (plan.get (), data + pos, sampling_rate, output_ampl);
+    }
+    // average data
+    get_dsp_kernels ().scale (output_ampl, nfft / 2 + 1, 1.0 / counter);
+    fill_psd_freqs (nfft, sampling_rate, output_freq);
+
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+// nfft for band powers of data_len samples, less than 8 if there is not enough data
+static int get_band_powers_nfft (int sampling_rate, int data_len)
+{
+    int nfft = 0;
+    get_nearest_power_of_two (sampling_rate, &nfft);
+    nfft *= 2; // for resolution ~ 0.5
+    // handle the case if nfft > number of data points
+    // its valid case but results will not be accurate
+    while ((nfft > 0) && (nfft > data_len))
+    {
+        nfft /= 2;
+    }
+    return nfft;
+}
+
+// bands[band][channel] to average and stddev across channels relative to sum of averages
+static void get_relative_band_powers (const std::vector<std::vector<double>> &bands, int rows,
+    double *avg_band_powers, double *stddev_band_powers)
+{
+    int num_bands = (int)bands.size ();
+    // find average and stddev
+    double *avg_bands = new double[num_bands];
+    double *std_bands = new double[num_bands];
+    memset (avg_bands, 0, sizeof (double) * num_bands);
+    memset (std_bands, 0, sizeof (double) * num_bands);
+    for (int i = 0; i < num_bands; i++)
+    {
+        for (int j = 0; j < rows; j++)
         {
-            delete[] ampls;
-            return res;
+            avg_bands[i] += bands[i][j];
         }
-        for (int i = 0; i < nfft / 2 + 1; i++)
+        avg_bands[i] /= rows;
+        for (int j = 0; j < rows; j++)
         {
-            output_ampl[i] += ampls[i];
+            std_bands[i] += (bands[i][j] - avg_bands[i]) * (bands[i][j] - avg_bands[i]);
         }
+        std_bands[i] /= rows;
+        std_bands[i] = sqrt (std_bands[i]);
     }
-    delete[] ampls;
-    if (counter == 0)
+    // use relative band powers
+    double sum = 0.0;
+    for (int i = 0; i < num_bands; i++)
     {
-        data_logger->error ("Nfft must be less than data_len.");
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        sum += avg_bands[i];
     }
-    // average data
-    for (int i = 0; i < nfft / 2 + 1; i++)
+    for (int i = 0; i < num_bands; i++)
     {
-        output_ampl[i] /= counter;
+        avg_band_powers[i] = avg_bands[i] / sum;
+        // use relative stddev to 'normalize'(doesnt ensure range between 0 and 1) it and keep
+        // information about variance, division by max doesnt make any sense for stddev, it will
+        // lose information about ratio between mean and deviation
+        stddev_band_powers[i] = std_bands[i] / avg_bands[i];
     }
 
-    return (int)BrainFlowExitCodes::STATUS_OK;
+    delete[] avg_bands;
+    delete[] std_bands;
 }
 
 int get_custom_band_powers (double *raw_data, int rows, int cols, double *start_freqs,
@@ -1301,141 +1350,194 @@ int get_custom_band_powers (double *raw_data, int rows, int cols, double *start_
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    // rows - channels, cols - datapoints
-    int *exit_codes = new int[rows];
-    for (int i = 0; i < rows; i++)
-    {
-        exit_codes[i] = (int)BrainFlowExitCodes::STATUS_OK;
-    }
-    int nfft = 0;
-    get_nearest_power_of_two (sampling_rate, &nfft);
-    nfft *= 2; // for resolution ~ 0.5
-    // handle the case if nfft > number of data points
-    // its valid case but results will not be accurate
-    while (nfft > cols)
-    {
-        nfft /= 2;
-    }
+    int nfft = get_band_powers_nfft (sampling_rate, cols);
     if (nfft < 8)
     {
         data_logger->error ("Not enough data for calculation.");
-        delete[] exit_codes;
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
-    double **bands = new double *[num_bands];
-    for (int i = 0; i < num_bands; i++)
-    {
-        bands[i] = new double[rows];
-        // to make valgrind happy
-        for (int j = 0; j < rows; j++)
-        {
-            bands[i][j] = 0.0;
-        }
-    }
+    // rows - channels, cols - datapoints
+    std::vector<std::vector<double>> bands (num_bands, std::vector<double> (rows, 0.0));
 
-#pragma omp parallel for
-    for (int i = 0; i < rows; i++)
-    {
-        double *ampls = new double[nfft / 2 + 1];
-        double *freqs = new double[nfft / 2 + 1];
-        double *thread_data = new double[cols];
-        memcpy (thread_data, raw_data + i * cols, sizeof (double) * cols);
+    int res = process_channels (rows, [&] (int i) {
+        std::vector<double> ampls (nfft / 2 + 1);
+        std::vector<double> freqs (nfft / 2 + 1);
+        std::vector<double> thread_data (
+            raw_data + (size_t)i * cols, raw_data + (size_t)(i + 1) * cols);
+        int ec = (int)BrainFlowExitCodes::STATUS_OK;
 
         if (apply_filters)
         {
-            exit_codes[i] = detrend (thread_data, cols, (int)DetrendOperations::CONSTANT);
-            if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
+            ec = detrend (thread_data.data (), cols, (int)DetrendOperations::CONSTANT);
+            if (ec == (int)BrainFlowExitCodes::STATUS_OK)
             {
-                exit_codes[i] = perform_bandstop (thread_data, cols, sampling_rate, 48.0, 52.0, 4,
+                ec = perform_bandstop (thread_data.data (), cols, sampling_rate, 48.0, 52.0, 4,
                     (int)FilterTypes::BUTTERWORTH_ZERO_PHASE, 0.0);
             }
-            if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
+            if (ec == (int)BrainFlowExitCodes::STATUS_OK)
             {
-                exit_codes[i] = perform_bandstop (thread_data, cols, sampling_rate, 58.0, 62.0, 4,
+                ec = perform_bandstop (thread_data.data (), cols, sampling_rate, 58.0, 62.0, 4,
                     (int)FilterTypes::BUTTERWORTH_ZERO_PHASE, 0.0);
             }
-            if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
+            if (ec == (int)BrainFlowExitCodes::STATUS_OK)
             {
-                exit_codes[i] = perform_bandpass (thread_data, cols, sampling_rate, 2.0, 45.0, 4,
+                ec = perform_bandpass (thread_data.data (), cols, sampling_rate, 2.0, 45.0, 4,
                     (int)FilterTypes::BUTTERWORTH_ZERO_PHASE, 0.0);
             }
         }
 
         // use 80% overlap, as long as it works fast overlap param can be big
-        exit_codes[i] = get_psd_welch (thread_data, cols, nfft, 4 * nfft / 5, sampling_rate,
-            (int)WindowOperations::HANNING, ampls, freqs);
+        ec = get_psd_welch (thread_data.data (), cols, nfft, 4 * nfft / 5, sampling_rate,
+            (int)WindowOperations::HANNING, ampls.data (), freqs.data ());
         for (int band_num = 0; band_num < num_bands; band_num++)
         {
-            if (exit_codes[i] == (int)BrainFlowExitCodes::STATUS_OK)
+            if (ec == (int)BrainFlowExitCodes::STATUS_OK)
             {
-                exit_codes[i] = get_band_power (ampls, freqs, nfft / 2 + 1, start_freqs[band_num],
-                    stop_freqs[band_num], &bands[band_num][i]);
+                ec = get_band_power (ampls.data (), freqs.data (), nfft / 2 + 1,
+                    start_freqs[band_num], stop_freqs[band_num], &bands[band_num][i]);
             }
         }
-
-        delete[] ampls;
-        delete[] freqs;
-        delete[] thread_data;
+        return ec;
+    });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
     }
 
-    for (int i = 0; i < rows; i++)
+    get_relative_band_powers (bands, rows, avg_band_powers, stddev_band_powers);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int create_band_power_stream (int num_channels, int sampling_rate, int window_len, int hop,
+    double *start_freqs, double *stop_freqs, int num_bands, int apply_filters, int *stream_id)
+{
+    if ((stream_id == NULL) || (num_channels < 1) || (sampling_rate < 1) || (window_len < 1) ||
+        (hop < 1) || (start_freqs == NULL) || (stop_freqs == NULL) || (num_bands < 1))
     {
-        if (exit_codes[i] != (int)BrainFlowExitCodes::STATUS_OK)
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int nfft = get_band_powers_nfft (sampling_rate, window_len);
+    if (nfft < 8)
+    {
+        data_logger->error ("Not enough data for calculation, window_len {}", window_len);
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    // same check as in get_band_power, at least one bin of the spectrum must be inside of a band
+    double freq_res = (double)sampling_rate / (double)nfft;
+    for (int band = 0; band < num_bands; band++)
+    {
+        bool is_valid = false;
+        for (int i = 0; (i < nfft / 2) && (i * freq_res <= stop_freqs[band]); i++)
         {
-            int ec = exit_codes[i];
-            delete[] exit_codes;
-            for (int j = 0; j < num_bands; j++)
-            {
-                delete[] bands[j];
-            }
-            delete[] bands;
-            return ec;
+            is_valid = is_valid || (i * freq_res >= start_freqs[band]);
+        }
+        if (!is_valid)
+        {
+            data_logger->error ("No data between {} and {}", start_freqs[band], stop_freqs[band]);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
     }
 
-    // find average and stddev
-    double *avg_bands = new double[num_bands];
-    double *std_bands = new double[num_bands];
-    memset (avg_bands, 0, sizeof (double) * num_bands);
-    memset (std_bands, 0, sizeof (double) * num_bands);
-    for (int i = 0; i < num_bands; i++)
+    // same filters as in get_custom_band_powers, but causal, backward pass needs the whole signal
+    std::vector<Dsp::Filter *> filters;
+    if (apply_filters)
     {
-        for (int j = 0; j < rows; j++)
-        {
-            avg_bands[i] += bands[i][j];
-        }
-        avg_bands[i] /= rows;
-        for (int j = 0; j < rows; j++)
+        for (int i = 0; i < num_channels; i++)
         {
-            std_bands[i] += (bands[i][j] - avg_bands[i]) * (bands[i][j] - avg_bands[i]);
+            filters.push_back (create_filter_design ((int)FilterOperations::BANDSTOP,
+                (int)FilterTypes::BUTTERWORTH, sampling_rate, 48.0, 52.0, 4, 0.0));
+            filters.push_back (create_filter_design ((int)FilterOperations::BANDSTOP,
+                (int)FilterTypes::BUTTERWORTH, sampling_rate, 58.0, 62.0, 4, 0.0));
+            filters.push_back (create_filter_design ((int)FilterOperations::BANDPASS,
+                (int)FilterTypes::BUTTERWORTH, sampling_rate, 2.0, 45.0, 4, 0.0));
         }
-        std_bands[i] /= rows;
-        std_bands[i] = sqrt (std_bands[i]);
     }
-    // use relative band powers
-    double sum = 0.0;
-    for (int i = 0; i < num_bands; i++)
+    int filters_per_channel = apply_filters ? 3 : 0;
+
+    std::lock_guard<std::mutex> lock (band_power_streams_mutex);
+    int id = next_band_power_stream_id++;
+    band_power_streams[id] = std::make_shared<BandPowerStream> (fft_plans, num_channels,
+        sampling_rate, nfft, window_len, hop,
+        std::vector<double> (start_freqs, start_freqs + num_bands),
+        std::vector<double> (stop_freqs, stop_freqs + num_bands), filters, filters_per_channel);
+    *stream_id = id;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+static std::shared_ptr<BandPowerStream> get_band_power_stream (int stream_id)
+{
+    std::lock_guard<std::mutex> lock (band_power_streams_mutex);
+    auto it = band_power_streams.find (stream_id);
+    if (it == band_power_streams.end ())
     {
-        sum += avg_bands[i];
+        return std::shared_ptr<BandPowerStream> ();
     }
-    for (int i = 0; i < num_bands; i++)
+    return it->second;
+}
+
+int process_band_power_stream (int stream_id, double *data, int num_channels, int data_len,
+    int num_bands, double *avg_band_powers, double *stddev_band_powers, int *is_updated)
+{
+    if ((data == NULL) || (data_len < 0) || (avg_band_powers == NULL) ||
+        (stddev_band_powers == NULL) || (is_updated == NULL))
     {
-        avg_band_powers[i] = avg_bands[i] / sum;
-        // use relative stddev to 'normalize'(doesnt ensure range between 0 and 1) it and keep
-        // information about variance, division by max doesnt make any sense for stddev, it will
-        // lose information about ratio between mean and deviation
-        stddev_band_powers[i] = std_bands[i] / avg_bands[i];
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<BandPowerStream> stream = get_band_power_stream (stream_id);
+    if (!stream)
+    {
+        data_logger->error ("No band power stream with id {}", stream_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (num_channels != stream->get_num_channels ())
+    {
+        data_logger->error ("Stream was created for {} channels, provided {}",
+            stream->get_num_channels (), num_channels);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (num_bands != stream->get_num_bands ())
+    {
+        data_logger->error (
+            "Stream was created for {} bands, provided {}", stream->get_num_bands (), num_bands);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::vector<std::vector<double>> bands;
+    bool updated = false;
+    int res = stream->process (data, data_len, bands, &updated);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    if (updated)
+    {
+        get_relative_band_powers (bands, num_channels, avg_band_powers, stddev_band_powers);
     }
+    *is_updated = (int)updated;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    delete[] exit_codes;
-    for (int j = 0; j < num_bands; j++)
+int reset_band_power_stream (int stream_id)
+{
+    std::shared_ptr<BandPowerStream> stream = get_band_power_stream (stream_id);
+    if (!stream)
     {
-        delete[] bands[j];
+        data_logger->error ("No band power stream with id {}", stream_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    delete[] bands;
-    delete[] avg_bands;
-    delete[] std_bands;
+    stream->reset ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
+int release_band_power_stream (int stream_id)
+{
+    std::lock_guard<std::mutex> lock (band_power_streams_mutex);
+    if (band_power_streams.erase (stream_id) == 0)
+    {
+        data_logger->error ("No band power stream with id {}", stream_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -1449,19 +1551,9 @@ int get_railed_percentage (double *raw_data, int data_len, int gain, double *out
 
     double scaler = (4.5 / (pow (2, 23) - 1) / gain * 1000000.);
     double max_val = scaler * pow (2, 23);
-    double cur_max = abs (raw_data[0]);
-    bool is_straight_line = true;
-    for (int i = 1; i < data_len; i++)
-    {
-        if (abs (raw_data[i]) > cur_max)
-        {
-            cur_max = abs (raw_data[i]);
-        }
-        if ((abs (raw_data[i - 1] - raw_data[i]) > 0.00001) && (abs (raw_data[i]) > 0.00001))
-        {
-            is_straight_line = false;
-        }
-    }
+    const DspKernels &kernels = get_dsp_kernels ();
+    double cur_max = kernels.abs_max (raw_data, data_len);
+    bool is_straight_line = !kernels.has_steps (raw_data, data_len, 0.00001);
 
     if (is_straight_line)
     {
@@ -1553,50 +1645,49 @@ int restore_data_from_wavelet_detailed_coeffs (double *data, int data_len, int w
 {
     int extension = (int)WaveletExtensionTypes::SYMMETRIC;
     if ((data == NULL) || (data_len <= 20) || (output == NULL) || (decomposition_level <= 0) ||
-        (level_to_restore <= 0) || (level_to_restore > decomposition_level))
+        (level_to_restore <= 0) || (level_to_restore > decomposition_level) ||
+        (get_wavelet_name (wavelet).empty ()))
     {
         data_logger->error ("Invalid input for restore_data_from_wavelet_detailed_coeffs.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    int max_wavelet_output_len = data_len + 2 * decomposition_level * (40 + 1);
-    double *wavelet_output = new double[max_wavelet_output_len];
-    int *decomposition_lengths = new int[decomposition_level + 1];
-
-    int res = perform_wavelet_transform (data, data_len, wavelet, decomposition_level, extension,
-        wavelet_output, decomposition_lengths);
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    // coefficients are modified in place, so forward and inverse transforms share one object
+    try
     {
+        ScopedWaveletTransform transform (wavelet_transforms);
+        transform.acquire (wavelet, data_len, decomposition_level, extension);
+        wt_object wt = transform->wt;
+        dwt (wt, data);
         // zero approx coefs
-        for (int j = 0; j < decomposition_lengths[0]; j++)
+        for (int j = 0; j < wt->length[0]; j++)
         {
-            wavelet_output[j] = 0.0;
+            wt->output[j] = 0.0;
         }
-        int cur_sum = decomposition_lengths[0];
+        int cur_sum = wt->length[0];
         // zero detailed coefs not from level_to_restore
         for (int i = 1; i < decomposition_level + 1; i++)
         {
             int cur_level = decomposition_level + 1 - i;
             if (cur_level != level_to_restore)
             {
-                for (int j = cur_sum; j < cur_sum + decomposition_lengths[i]; j++)
+                for (int j = cur_sum; j < cur_sum + wt->length[i]; j++)
                 {
-                    wavelet_output[j] = 0.0;
+                    wt->output[j] = 0.0;
                 }
             }
-            cur_sum += decomposition_lengths[i];
+            cur_sum += wt->length[i];
         }
-        res = perform_inverse_wavelet_transform (wavelet_output, data_len, wavelet,
-            decomposition_level, extension, decomposition_lengths, output);
+        idwt (wt, output);
     }
-
-    delete[] wavelet_output;
-    delete[] decomposition_lengths;
-
-    return res;
+    catch (const std::exception &e)
+    {
+        data_logger->error ("Exception in wavelib: {}", e.what ());
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-// https://stackoverflow.com/a/22640362
 int detect_peaks_z_score (
     double *data, int data_len, int lag, double threshold, double influence, double *output)
 {
@@ -1606,41 +1697,75 @@ int detect_peaks_z_score (
         data_logger->error ("invalid inputs for detect_peaks_z_score");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    memset (output, 0, sizeof (double) * data_len);
-    double *filtered_data = new double[data_len];
-    double *avg_filter = new double[data_len];
-    double *std_filter = new double[data_len];
-    memcpy (filtered_data, data, sizeof (double) * data_len);
+    PeaksDetector detector (lag, threshold, influence);
+    detector.process (data, data_len, output);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    avg_filter[lag - 1] = mean (data, lag);
-    std_filter[lag - 1] = stddev (data, lag);
+int create_peaks_detector (int lag, double threshold, double influence, int *detector_id)
+{
+    if ((detector_id == NULL) || (lag < 2) || (threshold < 0) || (influence < 0))
+    {
+        data_logger->error ("invalid inputs for create_peaks_detector, lag {}, threshold {}, "
+                            "influence {}",
+            lag, threshold, influence);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (peaks_detectors_mutex);
+    int id = next_peaks_detector_id++;
+    peaks_detectors[id] = std::make_shared<PeaksDetector> (lag, threshold, influence);
+    *detector_id = id;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    for (int i = lag; i < data_len; i++)
+static std::shared_ptr<PeaksDetector> get_peaks_detector (int detector_id)
+{
+    std::lock_guard<std::mutex> lock (peaks_detectors_mutex);
+    auto it = peaks_detectors.find (detector_id);
+    if (it == peaks_detectors.end ())
     {
-        if (abs (data[i] - avg_filter[i - 1]) > threshold * std_filter[i - 1])
-        {
-            if (data[i] > avg_filter[i - 1])
-            {
-                output[i] = 1;
-            }
-            else
-            {
-                output[i] = -1;
-            }
-            filtered_data[i] = influence * data[i] + (1 - influence) * filtered_data[i - 1];
-        }
-        else
-        {
-            output[i] = 0;
-        }
-        avg_filter[i] = mean (filtered_data + i - lag, lag);
-        std_filter[i] = stddev (filtered_data + i - lag, lag);
+        return std::shared_ptr<PeaksDetector> ();
+    }
+    return it->second;
+}
+
+int process_peaks_detector (int detector_id, double *data, int data_len, double *output)
+{
+    if ((data == NULL) || (data_len < 0) || (output == NULL))
+    {
+        data_logger->error ("Data and output cannot be empty.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<PeaksDetector> detector = get_peaks_detector (detector_id);
+    if (!detector)
+    {
+        data_logger->error ("No peaks detector with id {}", detector_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    detector->process (data, data_len, output);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    delete[] filtered_data;
-    delete[] avg_filter;
-    delete[] std_filter;
+int reset_peaks_detector (int detector_id)
+{
+    std::shared_ptr<PeaksDetector> detector = get_peaks_detector (detector_id);
+    if (!detector)
+    {
+        data_logger->error ("No peaks detector with id {}", detector_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    detector->reset ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
+int release_peaks_detector (int detector_id)
+{
+    std::lock_guard<std::mutex> lock (peaks_detectors_mutex);
+    if (peaks_detectors.erase (detector_id) == 0)
+    {
+        data_logger->error ("No peaks detector with id {}", detector_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -1726,6 +1851,155 @@ int perform_ica (double *data, int rows, int cols, int num_components, double *w
     return res;
 }
 
+int perform_lowpass_2d (double *data, int num_channels, int data_len, int sampling_rate,
+    double cutoff, int order, int filter_type, double ripple)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [=] (int channel) {
+        return perform_lowpass (data + (size_t)channel * data_len, data_len, sampling_rate, cutoff,
+            order, filter_type, ripple);
+    });
+}
+
+int perform_highpass_2d (double *data, int num_channels, int data_len, int sampling_rate,
+    double cutoff, int order, int filter_type, double ripple)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [=] (int channel) {
+        return perform_highpass (data + (size_t)channel * data_len, data_len, sampling_rate,
+            cutoff, order, filter_type, ripple);
+    });
+}
+
+int perform_bandpass_2d (double *data, int num_channels, int data_len, int sampling_rate,
+    double start_freq, double stop_freq, int order, int filter_type, double ripple)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [=] (int channel) {
+        return perform_bandpass (data + (size_t)channel * data_len, data_len, sampling_rate,
+            start_freq, stop_freq, order, filter_type, ripple);
+    });
+}
+
+int perform_bandstop_2d (double *data, int num_channels, int data_len, int sampling_rate,
+    double start_freq, double stop_freq, int order, int filter_type, double ripple)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [=] (int channel) {
+        return perform_bandstop (data + (size_t)channel * data_len, data_len, sampling_rate,
+            start_freq, stop_freq, order, filter_type, ripple);
+    });
+}
+
+int remove_environmental_noise_2d (
+    double *data, int num_channels, int data_len, int sampling_rate, int noise_type)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [=] (int channel) {
+        return remove_environmental_noise (
+            data + (size_t)channel * data_len, data_len, sampling_rate, noise_type);
+    });
+}
+
+int perform_rolling_filter_2d (
+    double *data, int num_channels, int data_len, int period, int agg_operation)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [=] (int channel) {
+        return perform_rolling_filter (
+            data + (size_t)channel * data_len, data_len, period, agg_operation);
+    });
+}
+
+int perform_downsampling_2d (double *data, int num_channels, int data_len, int period,
+    int agg_operation, double *output_data)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if ((output_data == NULL) || (period <= 0))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int output_len = data_len / period;
+    return process_channels (num_channels, [=] (int channel) {
+        return perform_downsampling (data + (size_t)channel * data_len, data_len, period,
+            agg_operation, output_data + (size_t)channel * output_len);
+    });
+}
+
+int perform_wavelet_denoising_2d (double *data, int num_channels, int data_len, int wavelet,
+    int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type,
+    int noise_level)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [=] (int channel) {
+        return perform_wavelet_denoising (data + (size_t)channel * data_len, data_len, wavelet,
+            decomposition_level, wavelet_denoising, threshold, extenstion_type, noise_level);
+    });
+}
+
+int detrend_2d (double *data, int num_channels, int data_len, int detrend_operation)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return process_channels (num_channels, [=] (int channel) {
+        return detrend (data + (size_t)channel * data_len, data_len, detrend_operation);
+    });
+}
+
+int get_psd_welch_2d (double *data, int num_channels, int data_len, int nfft, int overlap,
+    int sampling_rate, int window_function, double *output_ampl, double *output_freq)
+{
+    if (!is_valid_matrix (data, num_channels, data_len))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if ((output_ampl == NULL) || (output_freq == NULL) || (nfft < 2))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int output_len = nfft / 2 + 1;
+    // frequencies are the same for all channels, dont let threads write them simultaneously
+    return process_channels (num_channels, [=] (int channel) {
+        std::vector<double> freqs (output_len);
+        int res = get_psd_welch (data + (size_t)channel * data_len, data_len, nfft, overlap,
+            sampling_rate, window_function, output_ampl + (size_t)channel * output_len,
+            freqs.data ());
+        if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (channel == 0))
+        {
+            memcpy (output_freq, freqs.data (), sizeof (double) * output_len);
+        }
+        return res;
+    });
+}
+
 int get_version_data_handler (char *version, int *num_chars, int max_chars)
 {
     strncpy (version, BRAINFLOW_VERSION_STRING, max_chars);
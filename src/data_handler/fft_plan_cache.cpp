@@ -0,0 +1,124 @@
+#include "fft_plan_cache.h"
+#include "brainflow_constants.h"
+#include "data_handler.h"
+#include "dsp_kernels.h"
+
+
+FFTPlan::FFTPlan (int nfft, bool inverse, int window_function)
+{
+    this->nfft = nfft;
+    this->inverse = inverse;
+    this->window_function = inverse ? -1 : window_function;
+    last_released = 0;
+    cfg = kiss_fftr_alloc (nfft, inverse ? 1 : 0, NULL, NULL);
+    real_buf.resize (nfft);
+    complex_buf.resize (nfft / 2 + 1);
+}
+
+FFTPlan::~FFTPlan ()
+{
+    if (cfg != NULL)
+    {
+        kiss_fftr_free (cfg);
+        cfg = NULL;
+    }
+}
+
+FFTPlanCache::FFTPlanCache ()
+{
+    num_released = 0;
+}
+
+FFTPlanCache::~FFTPlanCache ()
+{
+    for (auto &item : idle_plans)
+    {
+        delete item.second;
+    }
+    idle_plans.clear ();
+}
+
+int FFTPlanCache::acquire (int nfft, bool inverse, int window_function, FFTPlan **plan)
+{
+    if (inverse)
+    {
+        window_function = -1;
+    }
+    std::unique_lock<std::mutex> guard (lock);
+    auto it = idle_plans.find (std::make_tuple (nfft, inverse, window_function));
+    if (it != idle_plans.end ())
+    {
+        *plan = it->second;
+        idle_plans.erase (it);
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    guard.unlock ();
+
+    // building a plan is the expensive part, dont block other threads
+    FFTPlan *new_plan = new FFTPlan (nfft, inverse, window_function);
+    if (new_plan->cfg == NULL)
+    {
+        delete new_plan;
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    if (!inverse)
+    {
+        new_plan->window.resize (nfft);
+        int res = get_window (window_function, nfft, new_plan->window.data ());
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            delete new_plan;
+            return res;
+        }
+    }
+    *plan = new_plan;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void FFTPlanCache::release (FFTPlan *plan)
+{
+    FFTPlan *evicted = NULL;
+    std::unique_lock<std::mutex> guard (lock);
+    plan->last_released = ++num_released;
+    // recently used plans are more likely to be requested again, cache is small so linear search
+    // for the oldest one is cheaper than keeping a separate list
+    if (idle_plans.size () >= MAX_CACHED_FFT_PLANS)
+    {
+        auto oldest = idle_plans.begin ();
+        for (auto it = idle_plans.begin (); it != idle_plans.end (); ++it)
+        {
+            if (it->second->last_released < oldest->second->last_released)
+            {
+                oldest = it;
+            }
+        }
+        evicted = oldest->second;
+        idle_plans.erase (oldest);
+    }
+    idle_plans.insert (
+        std::make_pair (std::make_tuple (plan->nfft, plan->inverse, plan->window_function), plan));
+    guard.unlock ();
+    delete evicted;
+}
+
+void apply_fft (FFTPlan *plan, const double *data)
+{
+    get_dsp_kernels ().multiply (data, plan->window.data (), plan->real_buf.data (), plan->nfft);
+    kiss_fftr (plan->cfg, plan->real_buf.data (), plan->complex_buf.data ());
+}
+
+static_assert (
+    sizeof (kiss_fft_cpx) == 2 * sizeof (double), "spectrum must be interleaved doubles");
+
+void accumulate_psd (FFTPlan *plan, const double *data, int sampling_rate, double *output_ampl)
+{
+    apply_fft (plan, data);
+    int nfft = plan->nfft;
+    // https://www.mathworks.com/help/signal/ug/power-spectral-density-estimates-using-fft.html
+    double scale = 1.0 / ((double)sampling_rate * nfft);
+    const double *spectrum = (const double *)plan->complex_buf.data ();
+    // dc and nyquist bins are not doubled
+    get_dsp_kernels ().accumulate_power (spectrum, 1, scale, output_ampl);
+    get_dsp_kernels ().accumulate_power (spectrum + 2, nfft / 2 - 1, 2.0 * scale, output_ampl + 1);
+    get_dsp_kernels ().accumulate_power (spectrum + nfft, 1, scale, output_ampl + nfft / 2);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "DspFilters/Dsp.h"
+
+#include "fft_plan_cache.h"
+
+
+// Band powers of the last window_len samples of every channel, updated every hop samples.
+// Welch segments are nfft samples long and start every step samples. Periodogram of a segment is
+// computed once when its last sample arrives and is kept in a ring together with a running sum,
+// so an update costs ffts of new segments and a pass over nfft / 2 + 1 bins per channel instead
+// of filtering and transforming the whole window again. Filters are causal and keep state
+// between calls.
+class BandPowerStream
+{
+    std::mutex lock;
+    FFTPlanCache &fft_plans;
+    int num_channels;
+    int sampling_rate;
+    int nfft;
+    int step;
+    int hop;
+    int window_len;
+    // segments which fit into window_len samples
+    int num_segments;
+    std::vector<double> start_freqs;
+    std::vector<double> stop_freqs;
+    // filters_per_channel filters of channel i start at i * filters_per_channel
+    std::vector<Dsp::Filter *> filters;
+    int filters_per_channel;
+    std::vector<double> freqs;
+    // last nfft filtered samples of every channel, sample n is stored at n % nfft
+    std::vector<std::vector<double>> samples;
+    // periodograms of last num_segments segments of every channel, segment k is stored at
+    // k % num_segments
+    std::vector<std::vector<double>> spectra;
+    std::vector<std::vector<double>> spectra_sum;
+    // first sample of every channel, subtracted before filtering
+    std::vector<double> offsets;
+    long long num_samples;
+    // scratch buffers
+    std::vector<double> chunk;
+    std::vector<double> segment;
+    std::vector<double> avg_spectrum;
+
+    void reset_state ();
+    // filters and stores samples of a single channel, computes periodograms of finished segments
+    int feed (int channel, const double *data, int data_len, FFTPlan *plan);
+    int get_band_powers (std::vector<std::vector<double>> &bands);
+
+public:
+    // takes ownership of filters, filters_per_channel filters for each channel
+    BandPowerStream (FFTPlanCache &fft_plans, int num_channels, int sampling_rate, int nfft,
+        int window_len, int hop, const std::vector<double> &start_freqs,
+        const std::vector<double> &stop_freqs, const std::vector<Dsp::Filter *> &filters,
+        int filters_per_channel);
+    ~BandPowerStream ();
+
+    int get_num_channels ()
+    {
+        return num_channels;
+    }
+
+    int get_num_bands ()
+    {
+        return (int)start_freqs.size ();
+    }
+
+    // data is num_channels x data_len matrix, it is not modified. If the last update point is
+    // inside of this chunk, bands[band][channel] is set to band powers at this point
+    int process (const double *data, int data_len, std::vector<std::vector<double>> &bands,
+        bool *is_updated);
+    void reset ();
+};
@@ -18,6 +18,16 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION perform_bandstop (double *data, int data_len,
         int sampling_rate, double start_freq, double stop_width, int order, int filter_type,
         double ripple);
+    // streaming filters keep state between calls to filter data chunk by chunk, filter_operation
+    // is FilterOperations, for low and high pass start_freq is a cutoff and stop_freq is ignored
+    SHARED_EXPORT int CALLING_CONVENTION create_streaming_filter (int filter_operation,
+        int num_channels, int sampling_rate, double start_freq, double stop_freq, int order,
+        int filter_type, double ripple, int *filter_id);
+    // data is num_channels x data_len matrix
+    SHARED_EXPORT int CALLING_CONVENTION process_streaming_filter (
+        int filter_id, double *data, int num_channels, int data_len);
+    SHARED_EXPORT int CALLING_CONVENTION reset_streaming_filter (int filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION release_streaming_filter (int filter_id);
     SHARED_EXPORT int CALLING_CONVENTION remove_environmental_noise (
         double *data, int data_len, int sampling_rate, int noise_type);
     SHARED_EXPORT int CALLING_CONVENTION perform_rolling_filter (
@@ -56,6 +66,18 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION get_custom_band_powers (double *raw_data, int rows,
         int cols, double *start_freqs, double *stop_freqs, int num_bands, int sampling_rate,
         int apply_filters, double *avg_band_powers, double *stddev_band_powers);
+    // band power stream keeps filter state and spectra of seen welch segments, band powers of the
+    // last window_len samples are updated every hop samples. is_updated is 0 if there was no update
+    // point in this chunk, band powers are not written in this case
+    SHARED_EXPORT int CALLING_CONVENTION create_band_power_stream (int num_channels,
+        int sampling_rate, int window_len, int hop, double *start_freqs, double *stop_freqs,
+        int num_bands, int apply_filters, int *stream_id);
+    // data is num_channels x data_len matrix, num_bands is checked against the stream
+    SHARED_EXPORT int CALLING_CONVENTION process_band_power_stream (int stream_id, double *data,
+        int num_channels, int data_len, int num_bands, double *avg_band_powers,
+        double *stddev_band_powers, int *is_updated);
+    SHARED_EXPORT int CALLING_CONVENTION reset_band_power_stream (int stream_id);
+    SHARED_EXPORT int CALLING_CONVENTION release_band_power_stream (int stream_id);
     SHARED_EXPORT int CALLING_CONVENTION get_railed_percentage (
         double *raw_data, int data_len, int gain, double *output);
     SHARED_EXPORT int CALLING_CONVENTION get_oxygen_level (double *ppg_ir, double *ppg_red,
@@ -67,9 +89,51 @@ extern "C"
         int data_len, int wavelet, int decomposition_level, int level_to_restore, double *output);
     SHARED_EXPORT int CALLING_CONVENTION detect_peaks_z_score (
         double *data, int data_len, int lag, double threshold, double influence, double *output);
+    // peaks detector keeps z-score state between calls, consecutive chunks give the same output
+    // as detect_peaks_z_score for the whole signal
+    SHARED_EXPORT int CALLING_CONVENTION create_peaks_detector (
+        int lag, double threshold, double influence, int *detector_id);
+    SHARED_EXPORT int CALLING_CONVENTION process_peaks_detector (
+        int detector_id, double *data, int data_len, double *output);
+    SHARED_EXPORT int CALLING_CONVENTION reset_peaks_detector (int detector_id);
+    SHARED_EXPORT int CALLING_CONVENTION release_peaks_detector (int detector_id);
     SHARED_EXPORT int CALLING_CONVENTION perform_ica (double *data, int rows, int cols,
         int num_components, double *w_mat, double *k_mat, double *a_mat, double *s_mat);
 
+    // multichannel methods, data is num_channels x data_len row major matrix, channels are
+    // processed in parallel and error of the first failed channel is returned
+    SHARED_EXPORT int CALLING_CONVENTION perform_lowpass_2d (double *data, int num_channels,
+        int data_len, int sampling_rate, double cutoff, int order, int filter_type, double ripple);
+    SHARED_EXPORT int CALLING_CONVENTION perform_highpass_2d (double *data, int num_channels,
+        int data_len, int sampling_rate, double cutoff, int order, int filter_type, double ripple);
+    SHARED_EXPORT int CALLING_CONVENTION perform_bandpass_2d (double *data, int num_channels,
+        int data_len, int sampling_rate, double start_freq, double stop_freq, int order,
+        int filter_type, double ripple);
+    SHARED_EXPORT int CALLING_CONVENTION perform_bandstop_2d (double *data, int num_channels,
+        int data_len, int sampling_rate, double start_freq, double stop_freq, int order,
+        int filter_type, double ripple);
+    SHARED_EXPORT int CALLING_CONVENTION remove_environmental_noise_2d (
+        double *data, int num_channels, int data_len, int sampling_rate, int noise_type);
+    SHARED_EXPORT int CALLING_CONVENTION perform_rolling_filter_2d (
+        double *data, int num_channels, int data_len, int period, int agg_operation);
+    // output_data is num_channels x (data_len / period) matrix
+    SHARED_EXPORT int CALLING_CONVENTION perform_downsampling_2d (double *data, int num_channels,
+        int data_len, int period, int agg_operation, double *output_data);
+    SHARED_EXPORT int CALLING_CONVENTION perform_wavelet_denoising_2d (double *data,
+        int num_channels, int data_len, int wavelet, int decomposition_level,
+        int wavelet_denoising, int threshold, int extenstion_type, int noise_level);
+    SHARED_EXPORT int CALLING_CONVENTION detrend_2d (
+        double *data, int num_channels, int data_len, int detrend_operation);
+    // output_ampl is num_channels x (nfft / 2 + 1) matrix, output_freq is shared by all channels
+    SHARED_EXPORT int CALLING_CONVENTION get_psd_welch_2d (double *data, int num_channels,
+        int data_len, int nfft, int overlap, int sampling_rate, int window_function,
+        double *output_ampl, double *output_freq);
+
+    // threads used by multichannel methods, 0 means number of hardware threads, default value can
+    // be set by BRAINFLOW_NUM_THREADS env variable
+    SHARED_EXPORT int CALLING_CONVENTION set_num_threads_data_handler (int num_threads);
+    SHARED_EXPORT int CALLING_CONVENTION get_num_threads_data_handler (int *num_threads);
+
     // logging methods
     SHARED_EXPORT int CALLING_CONVENTION set_log_level_data_handler (int log_level);
     SHARED_EXPORT int CALLING_CONVENTION set_log_file_data_handler (const char *log_file);
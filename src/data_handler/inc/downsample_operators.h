@@ -20,17 +20,16 @@ inline double downsample_each (double *data, int len)
 
 inline double downsample_median (double *data, int len)
 {
-    std::vector<double> values;
-    for (int i = 0; i < len; i++)
-    {
-        values.push_back (data[i]);
-    }
-    std::sort (values.begin (), values.end ());
+    // selection instead of full sort, scratch buffer is reused by all calls from the same thread
+    static thread_local std::vector<double> values;
+    values.assign (data, data + len);
+    std::vector<double>::iterator middle = values.begin () + len / 2;
+    std::nth_element (values.begin (), middle, values.end ());
     if (len % 2 == 0)
     {
         // for an even number of values the median is the mean of the two middle ones,
-        // same convention as RollingMedian in rolling_filter.h
-        return (values[len / 2 - 1] + values[len / 2]) / 2.0;
+        // same convention as RollingMedian in rolling_filter.h, lower one is the max of lower half
+        return (*std::max_element (values.begin (), middle) + *middle) / 2.0;
     }
-    return values[len / 2];
+    return *middle;
 }
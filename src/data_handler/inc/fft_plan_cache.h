@@ -0,0 +1,90 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <tuple>
+#include <vector>
+
+#include "kiss_fftr.h"
+
+#define MAX_CACHED_FFT_PLANS 64
+
+
+// kiss_fftr configs keep scratch memory inside, so a plan is used by one thread at a time. Plans
+// are checked out from the cache and returned after use, idle plans are reused by next calls with
+// the same nfft, direction and window
+struct FFTPlan
+{
+    int nfft;
+    bool inverse;
+    int window_function;
+    kiss_fftr_cfg cfg;
+    // empty for inverse plans
+    std::vector<double> window;
+    // scratch buffers, nfft real values and nfft / 2 + 1 complex values
+    std::vector<double> real_buf;
+    std::vector<kiss_fft_cpx> complex_buf;
+    // value of the cache release counter when plan was returned last time
+    uint64_t last_released;
+
+    FFTPlan (int nfft, bool inverse, int window_function);
+    ~FFTPlan ();
+};
+
+class FFTPlanCache
+{
+    std::mutex lock;
+    std::multimap<std::tuple<int, bool, int>, FFTPlan *> idle_plans;
+    uint64_t num_released;
+
+public:
+    FFTPlanCache ();
+    ~FFTPlanCache ();
+
+    // window_function is ignored for inverse plans
+    int acquire (int nfft, bool inverse, int window_function, FFTPlan **plan);
+    // least recently released idle plan is evicted if cache is full
+    void release (FFTPlan *plan);
+};
+
+// windows nfft samples and leaves spectrum in plan->complex_buf
+void apply_fft (FFTPlan *plan, const double *data);
+// adds one sided periodogram of nfft samples to output_ampl
+void accumulate_psd (FFTPlan *plan, const double *data, int sampling_rate, double *output_ampl);
+
+// returns plan to the cache when leaves the scope
+class ScopedFFTPlan
+{
+    FFTPlanCache &cache;
+    FFTPlan *plan;
+
+public:
+    ScopedFFTPlan (FFTPlanCache &cache) : cache (cache)
+    {
+        plan = NULL;
+    }
+
+    ~ScopedFFTPlan ()
+    {
+        if (plan != NULL)
+        {
+            cache.release (plan);
+        }
+    }
+
+    int acquire (int nfft, bool inverse, int window_function)
+    {
+        return cache.acquire (nfft, inverse, window_function, &plan);
+    }
+
+    FFTPlan *get ()
+    {
+        return plan;
+    }
+
+    FFTPlan *operator-> ()
+    {
+        return plan;
+    }
+};
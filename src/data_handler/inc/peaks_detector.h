@@ -0,0 +1,124 @@
+#pragma once
+
+#include <math.h>
+#include <mutex>
+#include <vector>
+
+
+// Smoothed z-score peaks detector, https://stackoverflow.com/a/22640362
+// Sample i is compared with mean and stddev of lag filtered values which end at i - 2, the first
+// two comparisons use the first lag samples. Window stats are updated in O(1) per sample and
+// recomputed once per lag samples to keep rounding errors from piling up. State is kept between
+// calls, so consecutive chunks give the same output as the whole signal at once.
+class PeaksDetector
+{
+    std::mutex lock;
+    int lag;
+    double threshold;
+    double influence;
+    // last lag + 2 filtered values, sample i is stored at i % (lag + 2)
+    std::vector<double> filtered;
+    long long num_samples;
+    double window_mean;
+    // sum of squared deviations from window_mean
+    double window_m2;
+    int num_updates;
+
+    double get_filtered (long long pos)
+    {
+        return filtered[(size_t)(pos % (lag + 2))];
+    }
+
+    // two pass stats of lag filtered values which end at last_pos
+    void compute_window (long long last_pos)
+    {
+        double sum = 0.0;
+        for (long long pos = last_pos - lag + 1; pos <= last_pos; pos++)
+        {
+            sum += get_filtered (pos);
+        }
+        window_mean = sum / lag;
+        window_m2 = 0.0;
+        for (long long pos = last_pos - lag + 1; pos <= last_pos; pos++)
+        {
+            double diff = get_filtered (pos) - window_mean;
+            window_m2 += diff * diff;
+        }
+        num_updates = 0;
+    }
+
+    // moves window by one sample to end at last_pos
+    void slide_window (long long last_pos)
+    {
+        if (++num_updates == lag)
+        {
+            compute_window (last_pos);
+            return;
+        }
+        double added = get_filtered (last_pos);
+        double removed = get_filtered (last_pos - lag);
+        double old_mean = window_mean;
+        window_mean += (added - removed) / lag;
+        window_m2 += (added - removed) * (added - window_mean + removed - old_mean);
+        if (window_m2 < 0.0)
+        {
+            window_m2 = 0.0;
+        }
+    }
+
+    double process_sample (double value)
+    {
+        long long pos = num_samples++;
+        double res = 0.0;
+        if (pos < lag)
+        {
+            filtered[(size_t)(pos % (lag + 2))] = value;
+            if (pos == lag - 1)
+            {
+                compute_window (pos);
+            }
+            return res;
+        }
+        if (pos >= lag + 2)
+        {
+            slide_window (pos - 2);
+        }
+        double filtered_value = value;
+        if (fabs (value - window_mean) > threshold * sqrt (window_m2 / lag))
+        {
+            res = (value > window_mean) ? 1.0 : -1.0;
+            filtered_value = influence * value + (1 - influence) * get_filtered (pos - 1);
+        }
+        filtered[(size_t)(pos % (lag + 2))] = filtered_value;
+        return res;
+    }
+
+public:
+    // lag must be at least 2
+    PeaksDetector (int lag, double threshold, double influence) : filtered (lag + 2)
+    {
+        this->lag = lag;
+        this->threshold = threshold;
+        this->influence = influence;
+        num_samples = 0;
+        window_mean = 0.0;
+        window_m2 = 0.0;
+        num_updates = 0;
+    }
+
+    // output is 1 for positive peaks, -1 for negative peaks and 0 otherwise, it may point to data
+    void process (const double *data, int data_len, double *output)
+    {
+        std::lock_guard<std::mutex> guard (lock);
+        for (int i = 0; i < data_len; i++)
+        {
+            output[i] = process_sample (data[i]);
+        }
+    }
+
+    void reset ()
+    {
+        std::lock_guard<std::mutex> guard (lock);
+        num_samples = 0;
+    }
+};
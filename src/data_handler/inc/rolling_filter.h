@@ -1,7 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <deque>
-#include <set>
+#include <vector>
 
 template <typename T>
 class RollingFilter
@@ -24,43 +25,149 @@ public:
     virtual T get_value () = 0;
 };
 
+// Sliding window median, O(log period) per sample. Window is a ring buffer, lower half of it is
+// kept in a max heap and upper half in a min heap. Heaps store ring slots and each slot knows its
+// position, so the oldest value is overwritten in place and only two heap tops are exchanged if
+// halves get out of order. Storage grows during the first period samples and is reused after that.
 template <typename T>
 class RollingMedian : public RollingFilter<T>
 {
 
 private:
-    std::multiset<T> dataset;
-    std::deque<T> deque;
+    std::vector<T> values;
+    // position of ring slot in heaps, >= 0 for low heap, -pos - 1 for high heap
+    std::vector<int> heap_pos;
+    // max heap with (period + 1) / 2 slots
+    std::vector<int> low;
+    // min heap with period / 2 slots
+    std::vector<int> high;
+    int oldest;
+    T last;
+
+    // true if slot a must be closer to the top of heap than slot b
+    bool is_above (bool is_low, int a, int b)
+    {
+        return is_low ? (this->values[a] > this->values[b]) : (this->values[a] < this->values[b]);
+    }
+
+    void set_node (bool is_low, int pos, int slot)
+    {
+        if (is_low)
+        {
+            this->low[pos] = slot;
+            this->heap_pos[slot] = pos;
+        }
+        else
+        {
+            this->high[pos] = slot;
+            this->heap_pos[slot] = -pos - 1;
+        }
+    }
+
+    // restores heap order after value of slot at pos changed
+    void sift (bool is_low, int pos)
+    {
+        std::vector<int> &heap = is_low ? this->low : this->high;
+        int slot = heap[pos];
+        while ((pos > 0) && (this->is_above (is_low, slot, heap[(pos - 1) / 2])))
+        {
+            this->set_node (is_low, pos, heap[(pos - 1) / 2]);
+            pos = (pos - 1) / 2;
+        }
+        int size = (int)heap.size ();
+        while (2 * pos + 1 < size)
+        {
+            int child = 2 * pos + 1;
+            if ((child + 1 < size) && (this->is_above (is_low, heap[child + 1], heap[child])))
+            {
+                child++;
+            }
+            if (!this->is_above (is_low, heap[child], slot))
+            {
+                break;
+            }
+            this->set_node (is_low, pos, heap[child]);
+            pos = child;
+        }
+        this->set_node (is_low, pos, slot);
+    }
+
+    // sorted arrays are valid heaps, so the first full window is split after sorting
+    void build_heaps ()
+    {
+        std::vector<int> order (this->period);
+        for (int i = 0; i < this->period; i++)
+        {
+            order[i] = i;
+        }
+        std::sort (order.begin (), order.end (),
+            [this] (int a, int b) { return this->values[a] < this->values[b]; });
+        this->heap_pos.resize (this->period);
+        this->low.resize ((this->period + 1) / 2);
+        this->high.resize (this->period / 2);
+        int num_low = (int)this->low.size ();
+        for (int i = 0; i < num_low; i++)
+        {
+            this->set_node (true, i, order[num_low - 1 - i]);
+        }
+        for (int i = 0; i < (int)this->high.size (); i++)
+        {
+            this->set_node (false, i, order[num_low + i]);
+        }
+    }
 
 public:
     RollingMedian (int period) : RollingFilter<T> (period)
     {
+        this->oldest = 0;
+        this->last = 0;
     }
 
     void add_data (T num)
     {
-        this->deque.push_back (num);
-        this->dataset.insert (num);
+        this->last = num;
+        if ((int)this->values.size () < this->period)
+        {
+            this->values.push_back (num);
+            if ((int)this->values.size () == this->period)
+            {
+                this->build_heaps ();
+            }
+            return;
+        }
+        int slot = this->oldest;
+        this->oldest = (this->oldest + 1) % this->period;
+        this->values[slot] = num;
+        int pos = this->heap_pos[slot];
+        if (pos >= 0)
+        {
+            this->sift (true, pos);
+        }
+        else
+        {
+            this->sift (false, -pos - 1);
+        }
+        if ((!this->high.empty ()) && (this->is_above (false, this->high[0], this->low[0])))
+        {
+            int low_top = this->low[0];
+            this->set_node (true, 0, this->high[0]);
+            this->set_node (false, 0, low_top);
+            this->sift (true, 0);
+            this->sift (false, 0);
+        }
     }
 
-    // https://leetcode.com/problems/sliding-window-median/
+    // median of last period values
     T get_value ()
     {
-        if ((int)this->dataset.size () < this->period)
+        if ((int)this->values.size () < this->period)
         {
             // to simplify algorithm if there are less data just return the last value
-            return this->deque.back ();
+            return this->last;
         }
-        auto it1 = this->dataset.begin ();
-        auto it2 = it1;
-        std::advance (it1, (this->period - 1) / 2);
-        it2 = it1;
-        std::advance (it2, (int)((this->period & 1) == 0));
-        T res = (*it1 + *it2) / 2.0;
-        T val = deque.front ();
-        deque.pop_front ();
-        this->dataset.erase (this->dataset.find (val));
-        return res;
+        T first = this->values[this->low[0]];
+        T second = ((this->period & 1) == 0) ? this->values[this->high[0]] : first;
+        return (first + second) / 2.0;
     }
 };
 
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "DspFilters/Dsp.h"
+
+
+// Keeps designed coefficients and biquad state of every channel between calls, so consecutive
+// chunks are filtered as a single continuous signal
+class StreamingFilter
+{
+    std::mutex lock;
+    std::vector<Dsp::Filter *> channel_filters;
+
+public:
+    // takes ownership of filters, one per channel
+    StreamingFilter (const std::vector<Dsp::Filter *> &channel_filters)
+    {
+        this->channel_filters = channel_filters;
+    }
+
+    ~StreamingFilter ()
+    {
+        for (Dsp::Filter *f : channel_filters)
+        {
+            delete f;
+        }
+        channel_filters.clear ();
+    }
+
+    int get_num_channels ()
+    {
+        return (int)channel_filters.size ();
+    }
+
+    // data is num_channels x data_len matrix, filtered in place
+    void process (double *data, int data_len)
+    {
+        std::lock_guard<std::mutex> guard (lock);
+        for (size_t i = 0; i < channel_filters.size (); i++)
+        {
+            double *channel_data[1] = {data + i * data_len};
+            channel_filters[i]->process (data_len, channel_data);
+        }
+    }
+
+    void reset ()
+    {
+        std::lock_guard<std::mutex> guard (lock);
+        for (Dsp::Filter *f : channel_filters)
+        {
+            f->reset ();
+        }
+    }
+};
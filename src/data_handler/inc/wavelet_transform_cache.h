@@ -0,0 +1,83 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "wavelib.h"
+
+// idle transforms keep signal length + coefficients doubles each, cache doesnt hold more
+#define MAX_CACHED_WAVELET_DOUBLES (1 << 22)
+
+
+// wavelib transform objects keep coefficients inside, so a transform is used by one thread at a
+// time. Transforms are checked out from the cache and returned after use, idle transforms are
+// reused by next calls with the same wavelet, signal length, decomposition level and extension.
+// In parallel batch calls every worker thread ends up with its own transform
+struct WaveletTransform
+{
+    int wavelet;
+    int data_len;
+    int decomposition_level;
+    int extension;
+    wave_object obj;
+    wt_object wt;
+
+    // throws wavelib exceptions, e.g. if data_len is too small for this wavelet and level
+    WaveletTransform (int wavelet, int data_len, int decomposition_level, int extension);
+    ~WaveletTransform ();
+
+    int get_num_doubles ()
+    {
+        return data_len + 2 * decomposition_level * (obj->filtlength + 1);
+    }
+};
+
+class WaveletTransformCache
+{
+    std::mutex lock;
+    std::multimap<std::tuple<int, int, int, int>, WaveletTransform *> idle_transforms;
+    long long idle_doubles;
+
+public:
+    WaveletTransformCache ()
+    {
+        idle_doubles = 0;
+    }
+    ~WaveletTransformCache ();
+
+    // throws wavelib exceptions if a new transform can not be created
+    WaveletTransform *acquire (int wavelet, int data_len, int decomposition_level, int extension);
+    void release (WaveletTransform *transform);
+};
+
+// returns transform to the cache when leaves the scope
+class ScopedWaveletTransform
+{
+    WaveletTransformCache &cache;
+    WaveletTransform *transform;
+
+public:
+    ScopedWaveletTransform (WaveletTransformCache &cache) : cache (cache)
+    {
+        transform = NULL;
+    }
+
+    ~ScopedWaveletTransform ()
+    {
+        if (transform != NULL)
+        {
+            cache.release (transform);
+        }
+    }
+
+    void acquire (int wavelet, int data_len, int decomposition_level, int extension)
+    {
+        transform = cache.acquire (wavelet, data_len, decomposition_level, extension);
+    }
+
+    WaveletTransform *operator-> ()
+    {
+        return transform;
+    }
+};
@@ -0,0 +1,107 @@
+#include <stdexcept>
+#include <string>
+
+#include "wavelet_helpers.h"
+#include "wavelet_transform_cache.h"
+
+
+WaveletTransform::WaveletTransform (
+    int wavelet, int data_len, int decomposition_level, int extension)
+{
+    this->wavelet = wavelet;
+    this->data_len = data_len;
+    this->decomposition_level = decomposition_level;
+    this->extension = extension;
+    obj = NULL;
+    wt = NULL;
+    std::string wavelet_str = get_wavelet_name (wavelet);
+    std::string extension_str = get_extension_type (extension);
+    if ((wavelet_str.empty ()) || (extension_str.empty ()))
+    {
+        throw std::runtime_error ("invalid wavelet or extension");
+    }
+    obj = wave_init (wavelet_str.c_str ());
+    try
+    {
+        wt = wt_init (obj, "dwt", data_len, decomposition_level);
+    }
+    catch (...)
+    {
+        wave_free (obj);
+        obj = NULL;
+        throw;
+    }
+    setDWTExtension (wt, extension_str.c_str ());
+    // measured on db4 - db20, coif5, sym10 up to 2^20 samples wavelib fft convolution is slower
+    // than direct one and less precise, so direct convolution is used for all lengths
+    setWTConv (wt, "direct");
+}
+
+WaveletTransform::~WaveletTransform ()
+{
+    if (wt != NULL)
+    {
+        wt_free (wt);
+        wt = NULL;
+    }
+    if (obj != NULL)
+    {
+        wave_free (obj);
+        obj = NULL;
+    }
+}
+
+WaveletTransformCache::~WaveletTransformCache ()
+{
+    for (auto &item : idle_transforms)
+    {
+        delete item.second;
+    }
+    idle_transforms.clear ();
+}
+
+WaveletTransform *WaveletTransformCache::acquire (
+    int wavelet, int data_len, int decomposition_level, int extension)
+{
+    std::unique_lock<std::mutex> guard (lock);
+    auto it = idle_transforms.find (
+        std::make_tuple (wavelet, data_len, decomposition_level, extension));
+    if (it != idle_transforms.end ())
+    {
+        WaveletTransform *transform = it->second;
+        idle_transforms.erase (it);
+        idle_doubles -= transform->get_num_doubles ();
+        return transform;
+    }
+    guard.unlock ();
+
+    return new WaveletTransform (wavelet, data_len, decomposition_level, extension);
+}
+
+void WaveletTransformCache::release (WaveletTransform *transform)
+{
+    std::multimap<std::tuple<int, int, int, int>, WaveletTransform *> evicted;
+    std::unique_lock<std::mutex> guard (lock);
+    if (transform->get_num_doubles () > MAX_CACHED_WAVELET_DOUBLES)
+    {
+        guard.unlock ();
+        delete transform;
+        return;
+    }
+    while ((!idle_transforms.empty ()) &&
+        (idle_doubles + transform->get_num_doubles () > MAX_CACHED_WAVELET_DOUBLES))
+    {
+        idle_doubles -= idle_transforms.begin ()->second->get_num_doubles ();
+        evicted.insert (*idle_transforms.begin ());
+        idle_transforms.erase (idle_transforms.begin ());
+    }
+    std::tuple<int, int, int, int> key = std::make_tuple (transform->wavelet,
+        transform->data_len, transform->decomposition_level, transform->extension);
+    idle_transforms.insert (std::make_pair (key, transform));
+    idle_doubles += transform->get_num_doubles ();
+    guard.unlock ();
+    for (auto &item : evicted)
+    {
+        delete item.second;
+    }
+}
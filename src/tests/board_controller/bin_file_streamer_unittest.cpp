@@ -0,0 +1,55 @@
+#include <gmock/gmock.h>
+#include <stdio.h>
+
+#include "bin_file.h"
+#include "board_shim.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+#define TEST_RECORDING_FILE "bin_file_streamer_unittest.bin"
+
+
+TEST (BinFileStreamerTest, StartStream_StreamerFromParams_WriteBoardDescrToHeader)
+{
+    remove (TEST_RECORDING_FILE);
+    BoardShim::disable_board_logger ();
+    struct BrainFlowInputParams params;
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+    BoardShim board (board_id, params);
+    board.prepare_session ();
+    board.start_stream (45000, std::string ("file_bin://") + TEST_RECORDING_FILE + ":w");
+    board.stop_stream ();
+    board.release_session ();
+
+    BinFileReader reader;
+    ASSERT_EQ (reader.open (TEST_RECORDING_FILE), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_header ().board_id, board_id);
+    EXPECT_EQ (reader.get_header ().preset, (int)BrainFlowPresets::DEFAULT_PRESET);
+    EXPECT_EQ (reader.get_header ().num_rows, BoardShim::get_num_rows (board_id));
+    EXPECT_EQ (reader.get_header ().sampling_rate, (double)BoardShim::get_sampling_rate (board_id));
+    reader.close ();
+    remove (TEST_RECORDING_FILE);
+}
+
+TEST (BinFileStreamerTest, AddStreamer_DropPolicy_ReturnError)
+{
+    BoardShim::disable_board_logger ();
+    struct BrainFlowInputParams params;
+    BoardShim board ((int)BoardIds::SYNTHETIC_BOARD, params);
+    board.prepare_session ();
+    std::string streamer = std::string ("file_bin://") + TEST_RECORDING_FILE + ":w";
+    int exit_code = (int)BrainFlowExitCodes::STATUS_OK;
+    try
+    {
+        board.add_streamer (streamer + "?backpressure=drop_newest");
+    }
+    catch (const BrainFlowException &err)
+    {
+        exit_code = err.exit_code;
+    }
+    EXPECT_EQ (exit_code, (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_NO_THROW (board.add_streamer (streamer + "?backpressure=block"));
+    board.release_session ();
+    remove (TEST_RECORDING_FILE);
+}
@@ -29,10 +29,42 @@ enable_testing()
 
 SET (TESTS_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/bluetooth_functions.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bin_file.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/dsp_kernels.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/os_serial.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/os_serial_ioctl.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/notification_queue.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/package_queue.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/serial_frame_reader.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/stream_packet.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/thread_pool.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/timestamp_estimator.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/tsv_parser.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/bin_file_streamer_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/cpp_package/board_shim_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/band_power_stream_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/downsample_operators_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/multichannel_methods_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/peaks_detector_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/rolling_filter_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/streaming_filter_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/wavelet_transform_unittest.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/socket_bluetooth_test.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/bluetooth_functions_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bin_file_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/brainflow_array_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/byte_ring_unittest.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/data_buffer_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/data_notifier_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/dsp_kernels_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/notification_queue_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/package_queue_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/serial_frame_reader_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/stream_packet_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/thread_pool_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/timestamp_estimator_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/tsv_parser_unittest.cpp
 )
 
 add_executable(
@@ -43,6 +75,7 @@ add_executable(
 target_include_directories (
     ${TESTS_EXE_NAME} PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/macos_third_party
@@ -51,6 +84,8 @@ target_include_directories (
 target_link_libraries(
     ${TESTS_EXE_NAME} PRIVATE
     gmock_main
+    ${BRAINFLOW_CPP_BINDING_NAME}
+    ${WAVELIB}
 )
 
 set_target_properties (${TESTS_EXE_NAME}
@@ -61,4 +96,14 @@ set_target_properties (${TESTS_EXE_NAME}
 )
 
 include(GoogleTest)
-gtest_discover_tests(${TESTS_EXE_NAME})
\ No newline at end of file
+gtest_discover_tests(${TESTS_EXE_NAME})
+# brainflow_boards.cpp is generated from brainflow_boards.jsonc, fail if they diverge
+find_package (Python3 COMPONENTS Interpreter)
+if (Python3_Interpreter_FOUND)
+    add_test (
+        NAME board_descr_up_to_date
+        COMMAND ${Python3_EXECUTABLE} ${CMAKE_CURRENT_SOURCE_DIR}/tools/generate_board_descr.py --check
+    )
+else (Python3_Interpreter_FOUND)
+    message (WARNING "python3 is not found, board_descr_up_to_date test is disabled")
+endif (Python3_Interpreter_FOUND)
@@ -0,0 +1,57 @@
+#include <gmock/gmock.h>
+
+#include "board_shim.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+TEST (BoardShimTest, GetBoardDataCount_SessionPreparedAgainBySecondShim_UseNewSession)
+{
+    BoardShim::disable_board_logger ();
+    struct BrainFlowInputParams params;
+    BoardShim first ((int)BoardIds::SYNTHETIC_BOARD, params);
+    BoardShim second ((int)BoardIds::SYNTHETIC_BOARD, params);
+    first.prepare_session ();
+    first.start_stream ();
+    // caches handle of the first session
+    EXPECT_GE (first.get_board_data_count (), 0);
+
+    second.release_session ();
+    second.prepare_session ();
+    second.start_stream ();
+    EXPECT_GE (first.get_board_data_count (), 0);
+    EXPECT_EQ (first.get_board_sampling_rate (),
+        BoardShim::get_sampling_rate ((int)BoardIds::SYNTHETIC_BOARD));
+
+    BoardShim::release_all_sessions ();
+    second.prepare_session ();
+    second.start_stream ();
+    EXPECT_GE (first.get_board_data_count (), 0);
+    EXPECT_TRUE (first.is_prepared ());
+    first.release_session ();
+    EXPECT_FALSE (second.is_prepared ());
+}
+
+TEST (BoardShimTest, GetBoardDataCount_SessionReleasedBySecondShim_ThrowBoardNotCreated)
+{
+    BoardShim::disable_board_logger ();
+    struct BrainFlowInputParams params;
+    BoardShim first ((int)BoardIds::SYNTHETIC_BOARD, params);
+    BoardShim second ((int)BoardIds::SYNTHETIC_BOARD, params);
+    first.prepare_session ();
+    first.start_stream ();
+    EXPECT_GE (first.get_board_data_count (), 0);
+    second.release_session ();
+
+    int exit_code = (int)BrainFlowExitCodes::STATUS_OK;
+    try
+    {
+        first.get_board_data_count ();
+    }
+    catch (const BrainFlowException &err)
+    {
+        exit_code = err.exit_code;
+    }
+    EXPECT_EQ (exit_code, (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR);
+}
@@ -0,0 +1,180 @@
+#include <cmath>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "data_handler.h"
+
+using namespace testing;
+
+
+// num_channels x data_len matrix, sum of 10hz and 20hz sines with different amplitudes per channel
+static std::vector<double> get_test_data (int num_channels, int data_len, int sampling_rate)
+{
+    std::vector<double> data ((size_t)num_channels * data_len);
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        for (int i = 0; i < data_len; i++)
+        {
+            double t = (double)i / sampling_rate;
+            data[(size_t)channel * data_len + i] = (channel + 1) * std::sin (2 * M_PI * 10.0 * t) +
+                5.0 * std::sin (2 * M_PI * 20.0 * t) + 0.1 * std::sin (2 * M_PI * 33.0 * t);
+        }
+    }
+    return data;
+}
+
+// copy of samples [start, start + len) of each channel
+static std::vector<double> get_chunk (
+    const std::vector<double> &data, int num_channels, int data_len, int start, int len)
+{
+    std::vector<double> chunk ((size_t)num_channels * len);
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        for (int i = 0; i < len; i++)
+        {
+            chunk[(size_t)channel * len + i] = data[(size_t)channel * data_len + start + i];
+        }
+    }
+    return chunk;
+}
+
+
+TEST (BandPowerStreamTest, ProcessBandPowerStream_FullWindow_MatchCustomBandPowers)
+{
+    const int num_channels = 3;
+    const int sampling_rate = 250;
+    // nfft is 512 and welch step is 103, window holds 6 segments
+    const int window_len = 512 + 5 * 103;
+    double start_freqs[] = {4.0, 8.0, 13.0, 30.0};
+    double stop_freqs[] = {8.0, 13.0, 30.0, 45.0};
+    std::vector<double> data = get_test_data (num_channels, window_len, sampling_rate);
+
+    int stream_id = -1;
+    ASSERT_EQ (create_band_power_stream (num_channels, sampling_rate, window_len, 50,
+                   start_freqs, stop_freqs, 4, 0, &stream_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    double avg[4] = {0.0};
+    double stddev[4] = {0.0};
+    int is_updated = 0;
+    EXPECT_EQ (process_band_power_stream (
+                   stream_id, data.data (), num_channels, window_len, 4, avg, stddev, &is_updated),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (is_updated, 1);
+
+    double expected_avg[4] = {0.0};
+    double expected_stddev[4] = {0.0};
+    ASSERT_EQ (get_custom_band_powers (data.data (), num_channels, window_len, start_freqs,
+                   stop_freqs, 4, sampling_rate, 0, expected_avg, expected_stddev),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    for (int band = 0; band < 4; band++)
+    {
+        EXPECT_NEAR (avg[band], expected_avg[band], 1e-6);
+        EXPECT_NEAR (stddev[band], expected_stddev[band], 1e-6);
+    }
+    EXPECT_EQ (release_band_power_stream (stream_id), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (BandPowerStreamTest, ProcessBandPowerStream_SmallChunks_UpdateEveryHopAfterFirstWindow)
+{
+    const int num_channels = 2;
+    const int sampling_rate = 250;
+    const int window_len = 600;
+    const int hop = 50;
+    const int chunk_len = 7;
+    const int data_len = 1400;
+    double start_freqs[] = {4.0, 13.0};
+    double stop_freqs[] = {13.0, 45.0};
+    std::vector<double> data = get_test_data (num_channels, data_len, sampling_rate);
+
+    int stream_id = -1;
+    ASSERT_EQ (create_band_power_stream (num_channels, sampling_rate, window_len, hop, start_freqs,
+                   stop_freqs, 2, 0, &stream_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    double avg[2] = {0.0};
+    double stddev[2] = {0.0};
+    int num_updates = 0;
+    for (int start = 0; start + chunk_len <= data_len; start += chunk_len)
+    {
+        std::vector<double> chunk = get_chunk (data, num_channels, data_len, start, chunk_len);
+        int is_updated = 0;
+        ASSERT_EQ (process_band_power_stream (stream_id, chunk.data (), num_channels, chunk_len, 2,
+                       avg, stddev, &is_updated),
+            (int)BrainFlowExitCodes::STATUS_OK);
+        // update points are window_len + k * hop samples
+        int end = start + chunk_len;
+        bool has_update_point = (end >= window_len) &&
+            ((start < window_len) || ((end - window_len) / hop > (start - window_len) / hop));
+        EXPECT_EQ (is_updated, has_update_point ? 1 : 0) << "chunk ends at " << end;
+        num_updates += is_updated;
+    }
+    // 1400 / 7 * 7 samples are processed, updates at 600, 650, ..., 1400
+    EXPECT_EQ (num_updates, 17);
+
+    // one chunk with several update points reports a single update, counting restarts after reset
+    EXPECT_EQ (reset_band_power_stream (stream_id), (int)BrainFlowExitCodes::STATUS_OK);
+    int is_updated = 0;
+    std::vector<double> first = get_chunk (data, num_channels, data_len, 0, window_len - 1);
+    EXPECT_EQ (process_band_power_stream (stream_id, first.data (), num_channels, window_len - 1, 2,
+                   avg, stddev, &is_updated),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (is_updated, 0);
+    std::vector<double> rest =
+        get_chunk (data, num_channels, data_len, window_len - 1, 3 * hop + 1);
+    EXPECT_EQ (process_band_power_stream (stream_id, rest.data (), num_channels, 3 * hop + 1, 2,
+                   avg, stddev, &is_updated),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (is_updated, 1);
+    EXPECT_EQ (release_band_power_stream (stream_id), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (BandPowerStreamTest, CreateBandPowerStream_InvalidArguments_ReturnError)
+{
+    double starts[] = {4.0, 13.0};
+    double stops[] = {13.0, 45.0};
+    int stream_id = -1;
+    int invalid_args = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    EXPECT_EQ (create_band_power_stream (2, 250, -5, 50, starts, stops, 2, 0, &stream_id),
+        invalid_args);
+    EXPECT_EQ (create_band_power_stream (2, 250, 0, 50, starts, stops, 2, 0, &stream_id),
+        invalid_args);
+    EXPECT_EQ (create_band_power_stream (2, 250, 600, 0, starts, stops, 2, 0, &stream_id),
+        invalid_args);
+    EXPECT_EQ (create_band_power_stream (0, 250, 600, 50, starts, stops, 2, 0, &stream_id),
+        invalid_args);
+    EXPECT_EQ (create_band_power_stream (2, 0, 600, 50, starts, stops, 2, 0, &stream_id),
+        invalid_args);
+    EXPECT_EQ (create_band_power_stream (2, 250, 600, 50, NULL, stops, 2, 0, &stream_id),
+        invalid_args);
+    EXPECT_EQ (create_band_power_stream (2, 250, 600, 50, starts, stops, 0, 0, &stream_id),
+        invalid_args);
+    EXPECT_EQ (create_band_power_stream (2, 250, 600, 50, starts, stops, 2, 0, NULL), invalid_args);
+    EXPECT_EQ (stream_id, -1);
+    // window is too short for the spectrum
+    EXPECT_EQ (create_band_power_stream (2, 250, 7, 1, starts, stops, 2, 0, &stream_id),
+        (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR);
+    // no bins inside of the band
+    double band_start[] = {10.1};
+    double band_stop[] = {10.2};
+    EXPECT_EQ (create_band_power_stream (2, 250, 600, 50, band_start, band_stop, 1, 0, &stream_id),
+        invalid_args);
+    EXPECT_EQ (stream_id, -1);
+
+    ASSERT_EQ (create_band_power_stream (2, 250, 600, 50, starts, stops, 2, 0, &stream_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    std::vector<double> data = get_test_data (2, 100, 250);
+    double avg[2] = {0.0};
+    double stddev[2] = {0.0};
+    int is_updated = 0;
+    EXPECT_EQ (
+        process_band_power_stream (stream_id, data.data (), 3, 50, 2, avg, stddev, &is_updated),
+        invalid_args);
+    EXPECT_EQ (
+        process_band_power_stream (stream_id, data.data (), 2, 50, 3, avg, stddev, &is_updated),
+        invalid_args);
+    EXPECT_EQ (process_band_power_stream (
+                   stream_id + 1000, data.data (), 2, 50, 2, avg, stddev, &is_updated),
+        invalid_args);
+    EXPECT_EQ (release_band_power_stream (stream_id), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (release_band_power_stream (stream_id), invalid_args);
+}
@@ -0,0 +1,25 @@
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "downsample_operators.h"
+
+using namespace testing;
+
+
+TEST (DownsampleOperatorsTest, DownsampleMedian_OddLength_ReturnMiddleValue)
+{
+    std::vector<double> data = {5.0, -1.0, 3.0, 8.0, 0.0};
+
+    EXPECT_EQ (3.0, downsample_median (data.data (), (int)data.size ()));
+    EXPECT_EQ (8.0, downsample_median (data.data () + 3, 1));
+    EXPECT_THAT (data, ElementsAre (5.0, -1.0, 3.0, 8.0, 0.0));
+}
+
+TEST (DownsampleOperatorsTest, DownsampleMedian_EvenLength_ReturnMeanOfMiddleValues)
+{
+    std::vector<double> data = {4.0, 10.0, -2.0, 1.0, 1.0, 7.0};
+
+    EXPECT_EQ (2.5, downsample_median (data.data (), (int)data.size ()));
+    EXPECT_EQ (7.0, downsample_median (data.data (), 2));
+    EXPECT_THAT (data, ElementsAre (4.0, 10.0, -2.0, 1.0, 1.0, 7.0));
+}
@@ -0,0 +1,123 @@
+#include <cmath>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "data_handler.h"
+
+using namespace testing;
+
+
+// num_channels x data_len matrix, channels differ in amplitudes, phase and trend
+static std::vector<double> get_test_data (int num_channels, int data_len, int sampling_rate)
+{
+    std::vector<double> data ((size_t)num_channels * data_len);
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        for (int i = 0; i < data_len; i++)
+        {
+            double t = (double)i / sampling_rate;
+            data[(size_t)channel * data_len + i] = 0.01 * channel * i +
+                (channel + 1) * std::sin (2 * M_PI * 10.0 * t + channel) +
+                std::sin (2 * M_PI * 50.0 * t) + 0.3 * std::cos (2 * M_PI * 93.0 * t * t);
+        }
+    }
+    return data;
+}
+
+
+TEST (MultichannelMethodsTest, Methods2d_SeveralChannels_MatchPerChannelCalls)
+{
+    const int num_channels = 5;
+    const int sampling_rate = 250;
+    const int data_len = 1024;
+    const int ok = (int)BrainFlowExitCodes::STATUS_OK;
+    std::vector<double> data = get_test_data (num_channels, data_len, sampling_rate);
+
+    // in place methods, 2d variant runs on a copy of the whole matrix and 1d one on each row
+    std::vector<double> matrix = data;
+    std::vector<double> rows = data;
+    ASSERT_EQ (perform_lowpass_2d (matrix.data (), num_channels, data_len, sampling_rate, 40.0, 4,
+                   (int)FilterTypes::BUTTERWORTH_ZERO_PHASE, 0.0),
+        ok);
+    ASSERT_EQ (perform_bandstop_2d (matrix.data (), num_channels, data_len, sampling_rate, 48.0,
+                   52.0, 2, (int)FilterTypes::CHEBYSHEV_TYPE_1, 0.5),
+        ok);
+    ASSERT_EQ (detrend_2d (matrix.data (), num_channels, data_len, (int)DetrendOperations::LINEAR),
+        ok);
+    ASSERT_EQ (perform_wavelet_denoising_2d (matrix.data (), num_channels, data_len,
+                   (int)WaveletTypes::DB4, 3, (int)WaveletDenoisingTypes::SURESHRINK,
+                   (int)ThresholdTypes::SOFT, (int)WaveletExtensionTypes::SYMMETRIC,
+                   (int)NoiseEstimationLevelTypes::FIRST_LEVEL),
+        ok);
+    ASSERT_EQ (perform_rolling_filter_2d (
+                   matrix.data (), num_channels, data_len, 5, (int)AggOperations::MEDIAN),
+        ok);
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        double *row = rows.data () + channel * data_len;
+        ASSERT_EQ (perform_lowpass (row, data_len, sampling_rate, 40.0, 4,
+                       (int)FilterTypes::BUTTERWORTH_ZERO_PHASE, 0.0),
+            ok);
+        ASSERT_EQ (perform_bandstop (row, data_len, sampling_rate, 48.0, 52.0, 2,
+                       (int)FilterTypes::CHEBYSHEV_TYPE_1, 0.5),
+            ok);
+        ASSERT_EQ (detrend (row, data_len, (int)DetrendOperations::LINEAR), ok);
+        ASSERT_EQ (perform_wavelet_denoising (row, data_len, (int)WaveletTypes::DB4, 3,
+                       (int)WaveletDenoisingTypes::SURESHRINK, (int)ThresholdTypes::SOFT,
+                       (int)WaveletExtensionTypes::SYMMETRIC,
+                       (int)NoiseEstimationLevelTypes::FIRST_LEVEL),
+            ok);
+        ASSERT_EQ (perform_rolling_filter (row, data_len, 5, (int)AggOperations::MEDIAN), ok);
+    }
+    for (size_t i = 0; i < matrix.size (); i++)
+    {
+        ASSERT_NEAR (matrix[i], rows[i], 1e-12) << "at " << i;
+    }
+
+    // methods with separate output
+    const int period = 3;
+    const int downsampled_len = data_len / period;
+    std::vector<double> downsampled_matrix ((size_t)num_channels * downsampled_len);
+    ASSERT_EQ (perform_downsampling_2d (data.data (), num_channels, data_len, period,
+                   (int)AggOperations::MEAN, downsampled_matrix.data ()),
+        ok);
+    const int nfft = 256;
+    const int psd_len = nfft / 2 + 1;
+    std::vector<double> ampl_matrix ((size_t)num_channels * psd_len);
+    std::vector<double> freq_2d (psd_len);
+    ASSERT_EQ (get_psd_welch_2d (data.data (), num_channels, data_len, nfft, nfft / 2,
+                   sampling_rate, (int)WindowOperations::HANNING, ampl_matrix.data (),
+                   freq_2d.data ()),
+        ok);
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        double *row = data.data () + channel * data_len;
+        std::vector<double> downsampled (downsampled_len);
+        ASSERT_EQ (perform_downsampling (
+                       row, data_len, period, (int)AggOperations::MEAN, downsampled.data ()),
+            ok);
+        for (int i = 0; i < downsampled_len; i++)
+        {
+            ASSERT_NEAR (downsampled_matrix[channel * downsampled_len + i], downsampled[i], 1e-12);
+        }
+        std::vector<double> ampl (psd_len);
+        std::vector<double> freq (psd_len);
+        ASSERT_EQ (get_psd_welch (row, data_len, nfft, nfft / 2, sampling_rate,
+                       (int)WindowOperations::HANNING, ampl.data (), freq.data ()),
+            ok);
+        for (int i = 0; i < psd_len; i++)
+        {
+            ASSERT_NEAR (ampl_matrix[channel * psd_len + i], ampl[i], 1e-12);
+            ASSERT_NEAR (freq_2d[i], freq[i], 1e-12);
+        }
+    }
+
+    // error of a failed channel is returned
+    EXPECT_EQ (perform_lowpass_2d (matrix.data (), num_channels, data_len, sampling_rate, 40.0, 0,
+                   (int)FilterTypes::BUTTERWORTH, 0.0),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (perform_lowpass_2d (NULL, num_channels, data_len, sampling_rate, 40.0, 4,
+                   (int)FilterTypes::BUTTERWORTH, 0.0),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+}
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <gmock/gmock.h>
+#include <math.h>
+#include <random>
+#include <vector>
+
+#include "peaks_detector.h"
+
+using namespace testing;
+
+
+// previous implementation of detect_peaks_z_score which recomputed window stats for every sample
+static std::vector<double> reference_peaks (
+    const std::vector<double> &data, int lag, double threshold, double influence)
+{
+    int len = (int)data.size ();
+    std::vector<double> output (len, 0.0);
+    std::vector<double> filtered = data;
+    std::vector<double> avg_filter (len);
+    std::vector<double> std_filter (len);
+    auto calc_stats = [&filtered, lag] (int start, double *mean, double *stddev)
+    {
+        double sum = 0.0;
+        for (int i = start; i < start + lag; i++)
+        {
+            sum += filtered[i];
+        }
+        *mean = sum / lag;
+        double deviation = 0.0;
+        for (int i = start; i < start + lag; i++)
+        {
+            deviation += (filtered[i] - *mean) * (filtered[i] - *mean);
+        }
+        *stddev = sqrt (deviation / lag);
+    };
+    calc_stats (0, &avg_filter[lag - 1], &std_filter[lag - 1]);
+    for (int i = lag; i < len; i++)
+    {
+        if (fabs (data[i] - avg_filter[i - 1]) > threshold * std_filter[i - 1])
+        {
+            output[i] = (data[i] > avg_filter[i - 1]) ? 1.0 : -1.0;
+            filtered[i] = influence * data[i] + (1 - influence) * filtered[i - 1];
+        }
+        calc_stats (i - lag, &avg_filter[i], &std_filter[i]);
+    }
+    return output;
+}
+
+// noisy sine with large offset like raw ppg and rare spikes
+static std::vector<double> generate_data (int len)
+{
+    std::mt19937 generator (42);
+    std::normal_distribution<double> noise (0.0, 1.0);
+    std::uniform_int_distribution<int> spike (0, 50);
+    std::vector<double> data (len);
+    for (int i = 0; i < len; i++)
+    {
+        data[i] = 100000.0 + 10.0 * sin (i * 0.05) + noise (generator);
+        if (spike (generator) == 0)
+        {
+            data[i] += (i % 2 == 0) ? 30.0 : -30.0;
+        }
+    }
+    return data;
+}
+
+
+TEST (PeaksDetectorTest, Process_WholeSignal_MatchReferenceImplementation)
+{
+    std::vector<double> data = generate_data (5000);
+    int lags[] = {2, 3, 20, 100};
+    double influences[] = {0.0, 0.5, 1.0};
+    for (int lag : lags)
+    {
+        for (double influence : influences)
+        {
+            std::vector<double> expected = reference_peaks (data, lag, 3.0, influence);
+            std::vector<double> output (data.size ());
+            PeaksDetector detector (lag, 3.0, influence);
+
+            detector.process (data.data (), (int)data.size (), output.data ());
+
+            EXPECT_THAT (output, ElementsAreArray (expected))
+                << "lag " << lag << " influence " << influence;
+            EXPECT_THAT (output, Contains (1.0));
+            EXPECT_THAT (output, Contains (-1.0));
+        }
+    }
+}
+
+TEST (PeaksDetectorTest, Process_ConsecutiveChunks_MatchWholeSignal)
+{
+    std::vector<double> data = generate_data (3000);
+    std::vector<double> expected (data.size ());
+    PeaksDetector whole (20, 3.5, 0.3);
+    whole.process (data.data (), (int)data.size (), expected.data ());
+
+    // chunks are shorter and longer than lag, output overwrites input
+    std::vector<double> output = data;
+    PeaksDetector chunked (20, 3.5, 0.3);
+    int chunk_sizes[] = {1, 7, 19, 20, 21, 64};
+    size_t pos = 0;
+    for (int i = 0; pos < output.size (); i++)
+    {
+        int len = std::min (chunk_sizes[i % 6], (int)(output.size () - pos));
+        chunked.process (output.data () + pos, len, output.data () + pos);
+        pos += len;
+    }
+
+    EXPECT_THAT (output, ElementsAreArray (expected));
+}
+
+TEST (PeaksDetectorTest, Reset_AfterProcessing_StartNewSignal)
+{
+    std::vector<double> data = generate_data (500);
+    std::vector<double> first (data.size ());
+    std::vector<double> second (data.size ());
+    PeaksDetector detector (10, 3.0, 0.0);
+
+    detector.process (data.data (), (int)data.size (), first.data ());
+    detector.reset ();
+    detector.process (data.data (), (int)data.size (), second.data ());
+
+    EXPECT_THAT (second, ElementsAreArray (first));
+}
@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <gmock/gmock.h>
+#include <random>
+#include <vector>
+
+#include "rolling_filter.h"
+
+using namespace testing;
+
+
+// median of period values which end at pos, or the value at pos if there are less of them
+static double reference_median (const std::vector<double> &data, int pos, int period)
+{
+    if (pos + 1 < period)
+    {
+        return data[pos];
+    }
+    std::vector<double> window (data.begin () + pos + 1 - period, data.begin () + pos + 1);
+    std::sort (window.begin (), window.end ());
+    return (window[(period - 1) / 2] + window[period / 2]) / 2.0;
+}
+
+
+TEST (RollingMedianTest, GetValue_RandomDataWithDuplicates_ReturnMedianOfLastPeriodValues)
+{
+    std::mt19937 generator (42);
+    // small range of values to get a lot of equal ones
+    std::uniform_int_distribution<int> distribution (-20, 20);
+    std::vector<double> data (500);
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        data[i] = distribution (generator) / 2.0;
+    }
+
+    for (int period = 1; period <= 34; period++)
+    {
+        RollingMedian<double> filter (period);
+        for (int i = 0; i < (int)data.size (); i++)
+        {
+            filter.add_data (data[i]);
+            ASSERT_EQ (reference_median (data, i, period), filter.get_value ())
+                << "period " << period << " pos " << i;
+        }
+    }
+}
+
+TEST (RollingMedianTest, GetValue_MonotonicData_ReturnMedianOfLastPeriodValues)
+{
+    // every new value goes to the same half and pushes values through both heaps
+    std::vector<double> data (200);
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        data[i] = (i < 100) ? (double)i : (double)(200 - i);
+    }
+
+    for (int period = 2; period <= 9; period++)
+    {
+        RollingMedian<double> filter (period);
+        for (int i = 0; i < (int)data.size (); i++)
+        {
+            filter.add_data (data[i]);
+            ASSERT_EQ (reference_median (data, i, period), filter.get_value ())
+                << "period " << period << " pos " << i;
+        }
+    }
+}
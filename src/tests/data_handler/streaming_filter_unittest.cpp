@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <cmath>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "data_handler.h"
+
+using namespace testing;
+
+
+// num_channels x data_len matrix, sines with different amplitudes per channel and a dc offset
+static std::vector<double> get_test_data (int num_channels, int data_len, int sampling_rate)
+{
+    std::vector<double> data ((size_t)num_channels * data_len);
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        for (int i = 0; i < data_len; i++)
+        {
+            double t = (double)i / sampling_rate;
+            data[(size_t)channel * data_len + i] = 3.0 +
+                (channel + 1) * std::sin (2 * M_PI * 5.0 * t) +
+                2.0 * std::sin (2 * M_PI * 20.0 * t) + std::sin (2 * M_PI * 60.0 * t);
+        }
+    }
+    return data;
+}
+
+// feeds data to the streaming filter in chunks of different sizes
+static int process_in_chunks (
+    int filter_id, std::vector<double> &data, int num_channels, int data_len)
+{
+    int chunk_sizes[] = {1, 7, 64, 13, 250, 3};
+    int num_chunk_sizes = sizeof (chunk_sizes) / sizeof (chunk_sizes[0]);
+    std::vector<double> chunk;
+    for (int start = 0, i = 0; start < data_len; i++)
+    {
+        int len = std::min (chunk_sizes[i % num_chunk_sizes], data_len - start);
+        chunk.resize ((size_t)num_channels * len);
+        for (int channel = 0; channel < num_channels; channel++)
+        {
+            std::copy (data.begin () + (size_t)channel * data_len + start,
+                data.begin () + (size_t)channel * data_len + start + len,
+                chunk.begin () + (size_t)channel * len);
+        }
+        int res = process_streaming_filter (filter_id, chunk.data (), num_channels, len);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+        for (int channel = 0; channel < num_channels; channel++)
+        {
+            std::copy (chunk.begin () + (size_t)channel * len,
+                chunk.begin () + (size_t)(channel + 1) * len,
+                data.begin () + (size_t)channel * data_len + start);
+        }
+        start += len;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+
+TEST (StreamingFilterTest, ProcessStreamingFilter_UnevenChunks_MatchLowpass)
+{
+    const int num_channels = 3;
+    const int sampling_rate = 250;
+    const int data_len = 1000;
+    std::vector<double> data = get_test_data (num_channels, data_len, sampling_rate);
+    std::vector<double> expected = data;
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        ASSERT_EQ (perform_lowpass (expected.data () + channel * data_len, data_len, sampling_rate,
+                       30.0, 4, (int)FilterTypes::BUTTERWORTH, 0.0),
+            (int)BrainFlowExitCodes::STATUS_OK);
+    }
+
+    int filter_id = -1;
+    ASSERT_EQ (create_streaming_filter ((int)FilterOperations::LOWPASS, num_channels,
+                   sampling_rate, 30.0, 0.0, 4, (int)FilterTypes::BUTTERWORTH, 0.0, &filter_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (process_in_chunks (filter_id, data, num_channels, data_len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        ASSERT_NEAR (data[i], expected[i], 1e-9) << "at " << i;
+    }
+    EXPECT_EQ (release_streaming_filter (filter_id), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (StreamingFilterTest, ProcessStreamingFilter_UnevenChunks_MatchBandpass)
+{
+    const int num_channels = 2;
+    const int sampling_rate = 250;
+    const int data_len = 1000;
+    std::vector<double> data = get_test_data (num_channels, data_len, sampling_rate);
+    std::vector<double> expected = data;
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        ASSERT_EQ (perform_bandpass (expected.data () + channel * data_len, data_len,
+                       sampling_rate, 3.0, 45.0, 3, (int)FilterTypes::CHEBYSHEV_TYPE_1, 0.5),
+            (int)BrainFlowExitCodes::STATUS_OK);
+    }
+
+    int filter_id = -1;
+    ASSERT_EQ (create_streaming_filter ((int)FilterOperations::BANDPASS, num_channels,
+                   sampling_rate, 3.0, 45.0, 3, (int)FilterTypes::CHEBYSHEV_TYPE_1, 0.5,
+                   &filter_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (process_in_chunks (filter_id, data, num_channels, data_len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        ASSERT_NEAR (data[i], expected[i], 1e-9) << "at " << i;
+    }
+    EXPECT_EQ (release_streaming_filter (filter_id), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (StreamingFilterTest, ResetStreamingFilter_SignalFedAgain_SameOutput)
+{
+    const int num_channels = 2;
+    const int sampling_rate = 250;
+    const int data_len = 500;
+    std::vector<double> data = get_test_data (num_channels, data_len, sampling_rate);
+    std::vector<double> first = data;
+    std::vector<double> second = data;
+
+    int filter_id = -1;
+    ASSERT_EQ (create_streaming_filter ((int)FilterOperations::HIGHPASS, num_channels,
+                   sampling_rate, 1.0, 0.0, 2, (int)FilterTypes::BESSEL, 0.0, &filter_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (process_in_chunks (filter_id, first, num_channels, data_len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    // without reset the second pass continues from the state of the first one
+    std::vector<double> continued = data;
+    EXPECT_EQ (process_in_chunks (filter_id, continued, num_channels, data_len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_GT (std::fabs (continued[0] - first[0]), 1e-3);
+
+    EXPECT_EQ (reset_streaming_filter (filter_id), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (process_in_chunks (filter_id, second, num_channels, data_len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_THAT (second, ElementsAreArray (first));
+    EXPECT_EQ (release_streaming_filter (filter_id), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (StreamingFilterTest, StreamingFilter_InvalidArguments_ReturnError)
+{
+    int invalid_args = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    int lowpass = (int)FilterOperations::LOWPASS;
+    int butterworth = (int)FilterTypes::BUTTERWORTH;
+    int filter_id = -1;
+    EXPECT_EQ (create_streaming_filter (lowpass, 0, 250, 30.0, 0.0, 4, butterworth, 0.0,
+                   &filter_id),
+        invalid_args);
+    EXPECT_EQ (create_streaming_filter (lowpass, 2, 250, 30.0, 0.0, 0, butterworth, 0.0,
+                   &filter_id),
+        invalid_args);
+    EXPECT_EQ (create_streaming_filter ((int)FilterOperations::BANDPASS, 2, 250, 30.0, 3.0, 4,
+                   butterworth, 0.0, &filter_id),
+        invalid_args);
+    // backward pass of zero phase filters needs the whole signal
+    EXPECT_EQ (create_streaming_filter (lowpass, 2, 250, 30.0, 0.0, 4,
+                   (int)FilterTypes::BUTTERWORTH_ZERO_PHASE, 0.0, &filter_id),
+        invalid_args);
+    EXPECT_EQ (create_streaming_filter (lowpass, 2, 250, 30.0, 0.0, 4, butterworth, 0.0, NULL),
+        invalid_args);
+    EXPECT_EQ (filter_id, -1);
+
+    ASSERT_EQ (create_streaming_filter (lowpass, 2, 250, 30.0, 0.0, 4, butterworth, 0.0,
+                   &filter_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    std::vector<double> data = get_test_data (2, 100, 250);
+    EXPECT_EQ (process_streaming_filter (filter_id, data.data (), 3, 50), invalid_args);
+    EXPECT_EQ (process_streaming_filter (filter_id, NULL, 2, 50), invalid_args);
+    EXPECT_EQ (process_streaming_filter (filter_id + 1000, data.data (), 2, 50), invalid_args);
+    EXPECT_EQ (reset_streaming_filter (filter_id + 1000), invalid_args);
+    EXPECT_EQ (release_streaming_filter (filter_id), (int)BrainFlowExitCodes::STATUS_OK);
+    // released handle is invalid
+    EXPECT_EQ (process_streaming_filter (filter_id, data.data (), 2, 50), invalid_args);
+    EXPECT_EQ (reset_streaming_filter (filter_id), invalid_args);
+    EXPECT_EQ (release_streaming_filter (filter_id), invalid_args);
+}
@@ -0,0 +1,121 @@
+#include <cmath>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "data_handler.h"
+#include "wavelib.h"
+
+using namespace testing;
+
+
+struct TestWavelet
+{
+    int id;
+    const char *name;
+};
+
+static const TestWavelet test_wavelets[] = {{(int)WaveletTypes::DB4, "db4"},
+    {(int)WaveletTypes::DB10, "db10"}, {(int)WaveletTypes::SYM10, "sym10"},
+    {(int)WaveletTypes::COIF5, "coif5"}, {(int)WaveletTypes::BIOR3_9, "bior3.9"}};
+
+static std::vector<double> get_test_data (int data_len)
+{
+    std::vector<double> data (data_len);
+    for (int i = 0; i < data_len; i++)
+    {
+        data[i] = std::sin (0.05 * i) + 0.5 * std::cos (0.37 * i) + 0.001 * i;
+    }
+    return data;
+}
+
+
+// direct convolution used to check every tap against the input with a branch, interior
+// coefficients must be the same sums in the same order
+TEST (WaveletTransformTest, PerformWaveletTransform_FirstLevel_InteriorMatchesTapByTapSum)
+{
+    const int extensions[] = {
+        (int)WaveletExtensionTypes::PERIODIC, (int)WaveletExtensionTypes::SYMMETRIC};
+    const int lengths[] = {256, 301};
+    for (const TestWavelet &wavelet : test_wavelets)
+    {
+        wave_object wave = wave_init (wavelet.name);
+        int len = wave->lpd_len;
+        for (int extension : extensions)
+        {
+            for (int data_len : lengths)
+            {
+                std::vector<double> data = get_test_data (data_len);
+                std::vector<double> output (data_len + 2 * len);
+                int lengths_out[2] = {0};
+                ASSERT_EQ (perform_wavelet_transform (data.data (), data_len, wavelet.id, 1,
+                               extension, output.data (), lengths_out),
+                    (int)BrainFlowExitCodes::STATUS_OK);
+                int len_ca = lengths_out[0];
+                // last input sample used by coefficient i is t
+                int first_t = (extension == (int)WaveletExtensionTypes::PERIODIC) ? len / 2 : 1;
+                int num_checked = 0;
+                for (int i = 0; i < len_ca; i++)
+                {
+                    int t = 2 * i + first_t;
+                    if ((t - len + 1 < 0) || (t >= data_len))
+                    {
+                        continue;
+                    }
+                    double ca = 0.0;
+                    double cd = 0.0;
+                    for (int l = 0; l < len; l++)
+                    {
+                        ca += wave->lpd[l] * data[t - l];
+                        cd += wave->hpd[l] * data[t - l];
+                    }
+                    ASSERT_DOUBLE_EQ (output[i], ca) << wavelet.name << " at " << i;
+                    ASSERT_DOUBLE_EQ (output[len_ca + i], cd) << wavelet.name << " at " << i;
+                    num_checked++;
+                }
+                EXPECT_GT (num_checked, data_len / 2 - len);
+            }
+        }
+        wave_free (wave);
+    }
+}
+
+TEST (WaveletTransformTest, PerformInverseWaveletTransform_CachedTransforms_RestoreSignal)
+{
+    const int extensions[] = {
+        (int)WaveletExtensionTypes::PERIODIC, (int)WaveletExtensionTypes::SYMMETRIC};
+    const int data_len = 500;
+    const int decomposition_level = 3;
+    std::vector<double> data = get_test_data (data_len);
+    for (const TestWavelet &wavelet : test_wavelets)
+    {
+        for (int extension : extensions)
+        {
+            std::vector<double> coeffs (data_len * 2 + 200);
+            std::vector<double> cached_coeffs (coeffs.size ());
+            int lengths[decomposition_level + 1] = {0};
+            ASSERT_EQ (perform_wavelet_transform (data.data (), data_len, wavelet.id,
+                           decomposition_level, extension, coeffs.data (), lengths),
+                (int)BrainFlowExitCodes::STATUS_OK);
+            // transform of other length takes the cache in between, reused one gives the same
+            std::vector<double> other_coeffs (data_len * 2 + 200);
+            int other_lengths[decomposition_level + 1] = {0};
+            ASSERT_EQ (perform_wavelet_transform (data.data (), data_len - 37, wavelet.id,
+                           decomposition_level, extension, other_coeffs.data (), other_lengths),
+                (int)BrainFlowExitCodes::STATUS_OK);
+            ASSERT_EQ (perform_wavelet_transform (data.data (), data_len, wavelet.id,
+                           decomposition_level, extension, cached_coeffs.data (), lengths),
+                (int)BrainFlowExitCodes::STATUS_OK);
+            EXPECT_THAT (cached_coeffs, ElementsAreArray (coeffs));
+
+            std::vector<double> restored (data_len);
+            ASSERT_EQ (perform_inverse_wavelet_transform (coeffs.data (), data_len, wavelet.id,
+                           decomposition_level, extension, lengths, restored.data ()),
+                (int)BrainFlowExitCodes::STATUS_OK);
+            for (int i = 0; i < data_len; i++)
+            {
+                ASSERT_NEAR (restored[i], data[i], 1e-9) << wavelet.name << " at " << i;
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <stdio.h>
+#include <vector>
+
+#include "bin_file.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+#define TEST_BIN_FILE "bin_file_unittest.bin"
+
+
+TEST (BinFileTest, Read_FileHasSeveralBlocks_ReturnChannelMajorMatrix)
+{
+    BinFileWriter writer;
+    EXPECT_EQ (writer.open (TEST_BIN_FILE, "w", 1, 2, 2, 250.0),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    // second block is padded to row stride 3 like a partially filled streamer block
+    double first_block[4] = {0.0, 1.0, 10.0, 11.0};
+    double second_block[6] = {2.0, -1.0, -1.0, 12.0, -1.0, -1.0};
+    EXPECT_EQ (writer.write_block (first_block, 2, 2), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (writer.write_block (second_block, 1, 3), (int)BrainFlowExitCodes::STATUS_OK);
+    writer.close ();
+
+    BinFileReader reader;
+    EXPECT_TRUE (BinFileReader::is_bin_file (TEST_BIN_FILE));
+    EXPECT_EQ (reader.open (TEST_BIN_FILE), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_header ().board_id, 1);
+    EXPECT_EQ (reader.get_header ().preset, 2);
+    EXPECT_EQ (reader.get_header ().num_rows, 2);
+    EXPECT_EQ (reader.get_header ().sampling_rate, 250.0);
+    EXPECT_EQ (reader.get_num_samples (), 3);
+    double output[6];
+    EXPECT_EQ (reader.read (output, 10), 3);
+    EXPECT_THAT (output, ElementsAre (0.0, 1.0, 2.0, 10.0, 11.0, 12.0));
+    double limited_output[4];
+    EXPECT_EQ (reader.read (limited_output, 2), 2);
+    EXPECT_THAT (limited_output, ElementsAre (0.0, 1.0, 10.0, 11.0));
+    reader.close ();
+    remove (TEST_BIN_FILE);
+}
+
+TEST (BinFileTest, Open_AppendAfterIncompleteBlock_DropIncompleteBlock)
+{
+    BinFileWriter writer;
+    double block[2] = {1.0, 2.0};
+    EXPECT_EQ (writer.open (TEST_BIN_FILE, "w", 0, 0, 1, 0.0), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (writer.write_block (block, 2, 2), (int)BrainFlowExitCodes::STATUS_OK);
+    writer.close ();
+    // emulate crash in the middle of the next block
+    FILE *fp = fopen (TEST_BIN_FILE, "ab");
+    BinBlockHeader block_header = {BIN_BLOCK_MAGIC, 100};
+    fwrite (&block_header, sizeof (block_header), 1, fp);
+    fwrite (block, sizeof (double), 2, fp);
+    fclose (fp);
+
+    BinFileReader reader;
+    EXPECT_EQ (reader.open (TEST_BIN_FILE), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_samples (), 2);
+    reader.close ();
+
+    double next_block[1] = {3.0};
+    EXPECT_EQ (writer.open (TEST_BIN_FILE, "a", 0, 0, 1, 0.0), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (writer.write_block (next_block, 1, 1), (int)BrainFlowExitCodes::STATUS_OK);
+    writer.close ();
+
+    EXPECT_EQ (reader.open (TEST_BIN_FILE), (int)BrainFlowExitCodes::STATUS_OK);
+    double output[3];
+    EXPECT_EQ (reader.read (output, 3), 3);
+    EXPECT_THAT (output, ElementsAre (1.0, 2.0, 3.0));
+    reader.close ();
+    remove (TEST_BIN_FILE);
+}
+
+TEST (BinFileTest, Open_AppendWithDifferentNumRows_ReturnError)
+{
+    BinFileWriter writer;
+    EXPECT_EQ (writer.open (TEST_BIN_FILE, "w", 0, 0, 2, 0.0), (int)BrainFlowExitCodes::STATUS_OK);
+    writer.close ();
+
+    EXPECT_EQ (writer.open (TEST_BIN_FILE, "a", 0, 0, 3, 0.0),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    remove (TEST_BIN_FILE);
+}
@@ -0,0 +1,35 @@
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "brainflow_array.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+TEST (BrainFlowArrayTest, GetAddress_InterleavedView_Throw)
+{
+    // 2 rows x 3 samples stored one sample after another
+    double interleaved[6] = {0.0, 10.0, 1.0, 11.0, 2.0, 12.0};
+    BrainFlowArray<double, 2> view = BrainFlowArray<double, 2>::view (
+        interleaved, make_array (2, 3), make_array (1, 2));
+    EXPECT_FALSE (view.has_contiguous_rows ());
+    EXPECT_EQ (view.at (1, 2), 12.0);
+    EXPECT_THROW (view.get_address (1), BrainFlowException);
+    EXPECT_THROW (view.get_address (1, 0), BrainFlowException);
+
+    BrainFlowArray<double, 2> copy = view;
+    EXPECT_TRUE (copy.has_contiguous_rows ());
+    EXPECT_THAT (std::vector<double> (copy.get_address (1), copy.get_address (1) + 3),
+        ElementsAre (10.0, 11.0, 12.0));
+}
+
+TEST (BrainFlowArrayTest, GetAddress_ChannelMajorView_PointToRow)
+{
+    // rows of 3 samples with a gap of 2 values between them like a ring with capacity 5
+    double channel_major[8] = {0.0, 1.0, 2.0, -1.0, -1.0, 10.0, 11.0, 12.0};
+    BrainFlowArray<double, 2> view = BrainFlowArray<double, 2>::view (
+        channel_major, make_array (2, 3), make_array (5, 1));
+    EXPECT_TRUE (view.has_contiguous_rows ());
+    EXPECT_EQ (view.get_address (1), channel_major + 5);
+}
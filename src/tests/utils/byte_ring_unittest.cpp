@@ -0,0 +1,56 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "byte_ring.h"
+
+using namespace testing;
+
+
+TEST (ByteRingTest, Pop_DataWrapsAroundEnd_ReturnBytesInOrder)
+{
+    ByteRing ring (8);
+    char first[6] = {0, 1, 2, 3, 4, 5};
+    char second[6] = {6, 7, 8, 9, 10, 11};
+    char out[8];
+
+    EXPECT_EQ (ring.push (first, 6), 6);
+    EXPECT_EQ (ring.pop (out, 4), 4);
+    EXPECT_EQ (ring.push (second, 6), 6);
+    EXPECT_EQ (ring.get_size (), 8);
+    EXPECT_EQ (ring.pop (out, 8), 8);
+
+    EXPECT_THAT (std::vector<char> (out, out + 8), ElementsAre (4, 5, 6, 7, 8, 9, 10, 11));
+    EXPECT_EQ (ring.get_size (), 0);
+}
+
+TEST (ByteRingTest, Push_NotEnoughFreeSpace_CopyOnlyFittingBytes)
+{
+    ByteRing ring (4);
+    char data[6] = {0, 1, 2, 3, 4, 5};
+    char out[6];
+
+    EXPECT_EQ (ring.push (data, 6), 4);
+    EXPECT_EQ (ring.push (data, 1), 0);
+    EXPECT_EQ (ring.pop (out, 6), 4);
+
+    EXPECT_THAT (std::vector<char> (out, out + 4), ElementsAre (0, 1, 2, 3));
+}
+
+TEST (ByteRingTest, Reserve_DataWrapsAroundEnd_KeepBytesInOrder)
+{
+    ByteRing ring (4);
+    char data[4] = {0, 1, 2, 3};
+    char out[8];
+    ring.push (data, 4);
+    ring.pop (out, 3);
+    ring.push (data, 3);
+
+    ring.reserve (6);
+
+    EXPECT_GE (ring.get_capacity (), 6);
+    EXPECT_EQ (ring.push (data, 2), 2);
+    EXPECT_EQ (ring.peek (out, 8), 6);
+    EXPECT_EQ (ring.get_size (), 6);
+    EXPECT_THAT (std::vector<char> (out, out + 6), ElementsAre (3, 0, 1, 2, 0, 1));
+}
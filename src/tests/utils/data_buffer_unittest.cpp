@@ -1,4 +1,5 @@
 #include <array>
+#include <atomic>
 #include <future>
 #include <gmock/gmock-matchers.h>
 #include <gmock/gmock.h>
@@ -424,4 +425,351 @@ TEST (DataBufferTest, IsReady_BufferSizeIsZero_ReturnFalse)
 {
     DataBuffer buffer_zero (4, 0);
     EXPECT_EQ (buffer_zero.is_ready (), false);
-}
\ No newline at end of file
+}
+
+TEST (DataBufferTest, GetData_BufferOverflowedSeveralTimes_ReturnMostRecentBufferSizeValueSets)
+{
+    DataBuffer buffer (2, 3);
+    for (int i = 0; i < 10; i++)
+    {
+        double values[2] = {(double)i, (double)i};
+        buffer.add_data (values);
+    }
+
+    EXPECT_EQ (buffer.get_data_count (), 3);
+
+    double retrieved[8];
+    auto result = buffer.get_data (4, retrieved);
+
+    EXPECT_EQ (result, 3);
+    EXPECT_EQ (buffer.get_data_count (), 0);
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ (retrieved[i * 2], 7.0 + i);
+        EXPECT_EQ (retrieved[i * 2 + 1], 7.0 + i);
+    }
+}
+
+TEST (DataBufferTest, GetCurrentData_InvokedWhileProducerOverwritesData_NoTornOrReorderedValueSets)
+{
+    DataBuffer buffer (8, 16);
+    std::atomic<bool> done (false);
+
+    std::thread producer (
+        [&] ()
+        {
+            double values[8];
+            for (int i = 0; i < 200000; i++)
+            {
+                for (int j = 0; j < 8; j++)
+                {
+                    values[j] = (double)i;
+                }
+                buffer.add_data (values);
+            }
+            done = true;
+        });
+
+    double retrieved[16 * 8];
+    bool is_valid = true;
+    while (!done)
+    {
+        size_t count = buffer.get_current_data (16, retrieved);
+        for (size_t i = 0; i < count; i++)
+        {
+            for (int j = 0; j < 8; j++)
+            {
+                is_valid = is_valid && (retrieved[i * 8 + j] == retrieved[i * 8]);
+            }
+            if (i > 0)
+            {
+                is_valid = is_valid && (retrieved[i * 8] == retrieved[(i - 1) * 8] + 1.0);
+            }
+        }
+    }
+    producer.join ();
+
+    EXPECT_TRUE (is_valid);
+}
+
+TEST (DataBufferTest, GetData_InvokedWhileProducerOverwritesData_ValueSetsAreReturnedInOrder)
+{
+    DataBuffer buffer (4, 8);
+    std::atomic<bool> done (false);
+
+    std::thread producer (
+        [&] ()
+        {
+            double values[4];
+            for (int i = 1; i <= 200000; i++)
+            {
+                for (int j = 0; j < 4; j++)
+                {
+                    values[j] = (double)i;
+                }
+                buffer.add_data (values);
+            }
+            done = true;
+        });
+
+    double retrieved[8 * 4];
+    double last = 0.0;
+    bool is_valid = true;
+    while (!done)
+    {
+        size_t count = buffer.get_data (8, retrieved);
+        for (size_t i = 0; i < count; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                is_valid = is_valid && (retrieved[i * 4 + j] == retrieved[i * 4]);
+            }
+            is_valid = is_valid && (retrieved[i * 4] > last);
+            last = retrieved[i * 4];
+        }
+    }
+    producer.join ();
+
+    EXPECT_TRUE (is_valid);
+}
+
+TEST (DataBufferTest, GetData_FullBufferIsOverwrittenDuringCopy_ReturnRequestedCountWithAlignedRows)
+{
+    for (bool channel_major : {false, true})
+    {
+        const size_t num_channels = 4;
+        const size_t buffer_size = 64;
+        DataBuffer buffer (num_channels, buffer_size, channel_major);
+        std::atomic<bool> done (false);
+
+        // channel j of value set i is i + j * 1e7
+        std::thread producer (
+            [&] ()
+            {
+                double values[num_channels];
+                for (int i = 1; i <= 300000; i++)
+                {
+                    for (size_t j = 0; j < num_channels; j++)
+                    {
+                        values[j] = i + j * 1e7;
+                    }
+                    buffer.add_data (values);
+                }
+                done = true;
+            });
+
+        double retrieved[num_channels * buffer_size];
+        double last = 0.0;
+        bool is_valid = true;
+        while (!done)
+        {
+            size_t requested = buffer.get_data_count ();
+            if (requested < buffer_size)
+            {
+                continue;
+            }
+            size_t count = buffer.get_data (requested, retrieved, true);
+            is_valid = is_valid && (count == requested);
+            for (size_t i = 0; i < count; i++)
+            {
+                for (size_t j = 0; j < num_channels; j++)
+                {
+                    is_valid = is_valid && (retrieved[j * count + i] == retrieved[i] + j * 1e7);
+                }
+                is_valid = is_valid && (retrieved[i] > last);
+                last = retrieved[i];
+            }
+        }
+        producer.join ();
+
+        EXPECT_TRUE (is_valid);
+    }
+}
+
+TEST (DataBufferTest, GetData_ChannelMajorOutputAfterWrapAround_ReturnTransposedValueSets)
+{
+    for (bool channel_major : {false, true})
+    {
+        DataBuffer buffer (3, 4, channel_major);
+        for (int i = 0; i < 6; i++)
+        {
+            double values[3] = {(double)i, 10.0 + i, 20.0 + i};
+            buffer.add_data (values);
+        }
+
+        double retrieved[12];
+        auto result = buffer.get_data (4, retrieved, true);
+
+        EXPECT_EQ (result, 4);
+        for (int channel = 0; channel < 3; channel++)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                EXPECT_EQ (retrieved[channel * 4 + i], channel * 10.0 + i + 2);
+            }
+        }
+    }
+}
+
+TEST (DataBufferTest, GetCurrentData_ChannelMajorBuffer_ReturnSameValuesAsInterleavedBuffer)
+{
+    DataBuffer interleaved (5, 7);
+    DataBuffer channel_major (5, 7, true);
+    for (int i = 0; i < 17; i++)
+    {
+        double values[5] = {(double)i, i * 2.0, i * 3.0, i * 4.0, i * 5.0};
+        interleaved.add_data (values);
+        channel_major.add_data (values);
+    }
+
+    for (bool channel_major_output : {false, true})
+    {
+        double expected[25];
+        double retrieved[25];
+        auto expected_count = interleaved.get_current_data (5, expected, channel_major_output);
+        auto result = channel_major.get_current_data (5, retrieved, channel_major_output);
+
+        EXPECT_EQ (result, expected_count);
+        for (int i = 0; i < 25; i++)
+        {
+            EXPECT_EQ (retrieved[i], expected[i]);
+        }
+    }
+}
+
+TEST (DataBufferTest, AcquireView_AfterWrapAround_SpansExposeOldestValueSetsInOrder)
+{
+    for (bool channel_major : {false, true})
+    {
+        DataBuffer buffer (3, 5, channel_major);
+        for (int i = 0; i < 8; i++)
+        {
+            double values[3] = {(double)i, i + 10.0, i + 20.0};
+            buffer.add_data (values);
+        }
+
+        double *first_span = NULL;
+        double *second_span = NULL;
+        size_t first_span_len = 0;
+        size_t second_span_len = 0;
+        size_t channel_stride = 0;
+        size_t sample_stride = 0;
+        auto result = buffer.acquire_view (4, &first_span, &first_span_len, &second_span,
+            &second_span_len, &channel_stride, &sample_stride);
+
+        EXPECT_EQ (result, 4);
+        EXPECT_EQ (first_span_len, 2);
+        EXPECT_EQ (second_span_len, 2);
+        EXPECT_EQ (buffer.get_data_count (), 1);
+        for (size_t channel = 0; channel < 3; channel++)
+        {
+            for (size_t i = 0; i < result; i++)
+            {
+                double value = (i < first_span_len) ?
+                    first_span[channel * channel_stride + i * sample_stride] :
+                    second_span[channel * channel_stride + (i - first_span_len) * sample_stride];
+                EXPECT_EQ (value, channel * 10.0 + i + 3);
+            }
+        }
+        buffer.release_view ();
+    }
+}
+
+TEST (DataBufferTest, AddData_ViewIsHeld_DropNewValueSetsInsteadOfOverwritingView)
+{
+    DataBuffer buffer (1, 4);
+    for (int i = 0; i < 4; i++)
+    {
+        double value = i;
+        buffer.add_data (&value);
+    }
+
+    double *first_span = NULL;
+    double *second_span = NULL;
+    size_t first_span_len = 0;
+    size_t second_span_len = 0;
+    size_t channel_stride = 0;
+    size_t sample_stride = 0;
+    auto result = buffer.acquire_view (2, &first_span, &first_span_len, &second_span,
+        &second_span_len, &channel_stride, &sample_stride);
+    ASSERT_EQ (result, 2);
+    EXPECT_TRUE (buffer.has_view ());
+    EXPECT_EQ (
+        buffer.acquire_view (1, &first_span, &first_span_len, &second_span, &second_span_len,
+            &channel_stride, &sample_stride),
+        0);
+
+    for (int i = 4; i < 10; i++)
+    {
+        double value = i;
+        buffer.add_data (&value);
+    }
+
+    EXPECT_EQ (first_span[0], 0.0);
+    EXPECT_EQ (first_span[1], 1.0);
+    EXPECT_EQ (buffer.reset_num_dropped (), 6);
+    buffer.release_view ();
+    EXPECT_FALSE (buffer.has_view ());
+
+    double value = 10.0;
+    buffer.add_data (&value);
+    double retrieved[3];
+    EXPECT_EQ (buffer.get_data (4, retrieved), 3);
+    EXPECT_THAT (retrieved, testing::ElementsAre (2.0, 3.0, 10.0));
+}
+
+TEST (DataBufferTest, AddDataBlock_BlockWrapsAroundBuffer_StoreSameValuesAsSingleAdds)
+{
+    for (bool channel_major : {false, true})
+    {
+        DataBuffer single (3, 5, channel_major);
+        DataBuffer block (3, 5, channel_major);
+        double values[21];
+        for (int i = 0; i < 7; i++)
+        {
+            values[i * 3] = i;
+            values[i * 3 + 1] = i + 10.0;
+            values[i * 3 + 2] = i + 20.0;
+            single.add_data (values + i * 3);
+        }
+        block.add_data (values, 3);
+        block.add_data (values + 9, 4);
+
+        for (bool channel_major_output : {false, true})
+        {
+            double expected[15];
+            double retrieved[15];
+            auto expected_count = single.get_current_data (5, expected, channel_major_output);
+            auto result = block.get_current_data (5, retrieved, channel_major_output);
+
+            EXPECT_EQ (result, expected_count);
+            EXPECT_THAT (retrieved, ElementsAreArray (expected));
+        }
+    }
+}
+
+TEST (DataBufferTest, AddDataBlock_ViewIsHeld_DropOnlyValueSetsWhichOverlapView)
+{
+    DataBuffer buffer (1, 4);
+    double values[6] = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    buffer.add_data (values, 2);
+
+    double *first_span = NULL;
+    double *second_span = NULL;
+    size_t first_span_len = 0;
+    size_t second_span_len = 0;
+    size_t channel_stride = 0;
+    size_t sample_stride = 0;
+    auto result = buffer.acquire_view (1, &first_span, &first_span_len, &second_span,
+        &second_span_len, &channel_stride, &sample_stride);
+    ASSERT_EQ (result, 1);
+
+    buffer.add_data (values + 2, 4);
+
+    EXPECT_EQ (first_span[0], 0.0);
+    EXPECT_EQ (buffer.reset_num_dropped (), 2);
+    buffer.release_view ();
+    double retrieved[3];
+    EXPECT_EQ (buffer.get_data (4, retrieved), 3);
+    EXPECT_THAT (retrieved, ElementsAre (1.0, 2.0, 3.0));
+}
@@ -0,0 +1,47 @@
+#include <atomic>
+#include <gmock/gmock.h>
+#include <thread>
+
+#include "data_notifier.h"
+
+using namespace testing;
+
+
+TEST (DataNotifierTest, WaitFor_PredicateIsTrue_ReturnTrueWithoutWaiting)
+{
+    DataNotifier notifier;
+
+    auto result = notifier.wait_for (10000, [] () { return true; });
+
+    EXPECT_TRUE (result);
+    EXPECT_FALSE (notifier.has_waiters ());
+}
+
+TEST (DataNotifierTest, WaitFor_NobodyNotifies_ReturnFalseAfterTimeout)
+{
+    DataNotifier notifier;
+
+    auto result = notifier.wait_for (10, [] () { return false; });
+
+    EXPECT_FALSE (result);
+    EXPECT_FALSE (notifier.has_waiters ());
+}
+
+TEST (DataNotifierTest, Notify_ProducerPublishesData_WakeUpWaiter)
+{
+    DataNotifier notifier;
+    std::atomic<int> num_values (0);
+
+    std::thread producer ([&notifier, &num_values] () {
+        for (int i = 0; i < 100; i++)
+        {
+            num_values.fetch_add (1);
+            notifier.notify ();
+        }
+    });
+    auto result = notifier.wait_for (10000, [&num_values] () { return num_values.load () >= 100; });
+    producer.join ();
+
+    EXPECT_TRUE (result);
+    EXPECT_EQ (num_values.load (), 100);
+}
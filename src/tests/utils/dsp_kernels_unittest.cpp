@@ -0,0 +1,139 @@
+#include <gmock/gmock.h>
+#include <math.h>
+#include <random>
+#include <vector>
+
+#include "dsp_kernels.h"
+
+using namespace testing;
+
+// lengths below and above vector widths and unroll factors to cover tails
+#define MAX_TEST_LEN 67
+
+
+static std::vector<double> generate_data (int len, unsigned int seed)
+{
+    std::mt19937 generator (seed);
+    std::normal_distribution<double> distribution (10.0, 100.0);
+    std::vector<double> data (len);
+    for (int i = 0; i < len; i++)
+    {
+        data[i] = distribution (generator);
+    }
+    return data;
+}
+
+// vectorized sums are reordered and may use fma, tolerance depends on magnitude of terms
+static void expect_near_sum (double expected, double actual, double magnitude)
+{
+    EXPECT_NEAR (expected, actual, 1e-12 * (magnitude + 1.0));
+}
+
+
+TEST (DspKernelsTest, GetAvailableDspKernels_AnyCpu_ScalarGoesFirstAndBestIsSelected)
+{
+    std::vector<const DspKernels *> kernels = get_available_dsp_kernels ();
+
+    ASSERT_FALSE (kernels.empty ());
+    EXPECT_EQ (kernels.front (), &get_scalar_dsp_kernels ());
+    EXPECT_EQ (kernels.back (), &get_dsp_kernels ());
+}
+
+TEST (DspKernelsTest, Reductions_AllAvailableKernels_MatchScalarKernels)
+{
+    const DspKernels &scalar = get_scalar_dsp_kernels ();
+    std::vector<const DspKernels *> kernels = get_available_dsp_kernels ();
+    for (size_t k = 0; k < kernels.size (); k++)
+    {
+        SCOPED_TRACE (kernels[k]->name);
+        for (int len = 0; len <= MAX_TEST_LEN; len++)
+        {
+            SCOPED_TRACE (len);
+            std::vector<double> data = generate_data (len, len);
+            double magnitude = 0.0;
+            double weighted_magnitude = 0.0;
+            for (int i = 0; i < len; i++)
+            {
+                magnitude += fabs (data[i]);
+                weighted_magnitude += i * fabs (data[i]);
+            }
+            double mean = scalar.sum (data.data (), len) / ((len > 0) ? len : 1);
+
+            expect_near_sum (
+                scalar.sum (data.data (), len), kernels[k]->sum (data.data (), len), magnitude);
+            expect_near_sum (scalar.index_weighted_sum (data.data (), len),
+                kernels[k]->index_weighted_sum (data.data (), len), weighted_magnitude);
+            double deviation = scalar.squared_deviation_sum (data.data (), len, mean);
+            expect_near_sum (deviation,
+                kernels[k]->squared_deviation_sum (data.data (), len, mean), deviation);
+            EXPECT_EQ (scalar.abs_max (data.data (), len), kernels[k]->abs_max (data.data (), len));
+        }
+    }
+}
+
+TEST (DspKernelsTest, HasSteps_StepAtAnyPosition_MatchScalarKernels)
+{
+    std::vector<const DspKernels *> kernels = get_available_dsp_kernels ();
+    for (size_t k = 0; k < kernels.size (); k++)
+    {
+        SCOPED_TRACE (kernels[k]->name);
+        for (int len = 0; len <= MAX_TEST_LEN; len++)
+        {
+            std::vector<double> data (len, 5.0);
+            EXPECT_FALSE (kernels[k]->has_steps (data.data (), len, 0.00001));
+            for (int pos = 0; pos < len; pos++)
+            {
+                data[pos] = 6.0;
+                // for pos 0 step back to 5.0 at pos 1 is found
+                EXPECT_EQ (len > 1, kernels[k]->has_steps (data.data (), len, 0.00001))
+                    << "len " << len << " pos " << pos;
+                data[pos] = 5.0;
+            }
+        }
+        // step to a value close to zero doesnt count
+        std::vector<double> zeros (MAX_TEST_LEN, 0.0);
+        zeros[MAX_TEST_LEN - 1] = 1.0;
+        EXPECT_TRUE (kernels[k]->has_steps (zeros.data (), MAX_TEST_LEN, 0.00001));
+        zeros[MAX_TEST_LEN - 1] = 0.000001;
+        EXPECT_FALSE (kernels[k]->has_steps (zeros.data (), MAX_TEST_LEN, 0.00001));
+    }
+}
+
+TEST (DspKernelsTest, ElementwiseOperations_AllAvailableKernels_MatchScalarKernels)
+{
+    const DspKernels &scalar = get_scalar_dsp_kernels ();
+    std::vector<const DspKernels *> kernels = get_available_dsp_kernels ();
+    for (size_t k = 0; k < kernels.size (); k++)
+    {
+        SCOPED_TRACE (kernels[k]->name);
+        for (int len = 0; len <= MAX_TEST_LEN; len++)
+        {
+            SCOPED_TRACE (len);
+            std::vector<double> data = generate_data (len, len);
+            std::vector<double> window = generate_data (len, len + 1000);
+            std::vector<double> complex_data = generate_data (2 * len, len + 2000);
+
+            std::vector<double> expected = data;
+            std::vector<double> actual = data;
+            scalar.subtract_line (expected.data (), len, 0.5, 3.0);
+            kernels[k]->subtract_line (actual.data (), len, 0.5, 3.0);
+            EXPECT_THAT (actual, Pointwise (DoubleEq (), expected));
+
+            expected = data;
+            actual = data;
+            scalar.scale (expected.data (), len, 0.25);
+            kernels[k]->scale (actual.data (), len, 0.25);
+            EXPECT_THAT (actual, Pointwise (DoubleEq (), expected));
+
+            scalar.multiply (data.data (), window.data (), expected.data (), len);
+            kernels[k]->multiply (data.data (), window.data (), actual.data (), len);
+            EXPECT_THAT (actual, Pointwise (DoubleEq (), expected));
+
+            expected = data;
+            actual = data;
+            scalar.accumulate_power (complex_data.data (), len, 2.0, expected.data ());
+            kernels[k]->accumulate_power (complex_data.data (), len, 2.0, actual.data ());
+            EXPECT_THAT (actual, Pointwise (DoubleEq (), expected));
+        }
+    }
+}
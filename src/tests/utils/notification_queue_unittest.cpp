@@ -0,0 +1,204 @@
+#include <atomic>
+#include <chrono>
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "notification_queue.h"
+
+using namespace testing;
+
+
+TEST (NotificationQueueTest, Pop_QueueHasNotifications_ReturnPayloadsTagsAndTimestampsInOrder)
+{
+    NotificationQueue queue (4, 8);
+    queue.open ();
+    for (int i = 0; i < 3; i++)
+    {
+        uint8_t payload[3] = {(uint8_t)i, (uint8_t)(i + 10), (uint8_t)(i + 20)};
+        EXPECT_TRUE (queue.push (i + 100, 1700000000.5 + i, payload, (size_t)i + 1));
+    }
+
+    uint8_t retrieved[8];
+    int tag = 0;
+    double timestamp = 0.0;
+    size_t size = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE (queue.pop (&tag, &timestamp, retrieved, &size, 0));
+        EXPECT_EQ (tag, i + 100);
+        EXPECT_EQ (timestamp, 1700000000.5 + i);
+        ASSERT_EQ (size, (size_t)i + 1);
+        EXPECT_EQ (retrieved[0], i);
+        EXPECT_EQ (retrieved[size - 1], i + 10 * i);
+    }
+    EXPECT_FALSE (queue.pop (&tag, &timestamp, retrieved, &size, 0));
+}
+
+TEST (NotificationQueueTest, Push_QueueIsFull_DropNewestAndCountOverflows)
+{
+    NotificationQueue queue (3, 4);
+    queue.open ();
+    for (int i = 0; i < 5; i++)
+    {
+        uint8_t payload = (uint8_t)i;
+        EXPECT_EQ (queue.push (0, 0.0, &payload, 1), i < 3);
+    }
+
+    uint8_t retrieved[4];
+    int tag = 0;
+    double timestamp = 0.0;
+    size_t size = 0;
+    std::vector<int> values;
+    while (queue.pop (&tag, &timestamp, retrieved, &size, 0))
+    {
+        values.push_back (retrieved[0]);
+    }
+    EXPECT_THAT (values, ElementsAre (0, 1, 2));
+    EXPECT_EQ (queue.get_num_overflowed (), 2);
+
+    // slots are reused after pop
+    uint8_t payload = 5;
+    EXPECT_TRUE (queue.push (0, 0.0, &payload, 1));
+}
+
+TEST (NotificationQueueTest, Push_QueueIsClosed_DropWithoutCountingOverflow)
+{
+    NotificationQueue queue (4, 4);
+    uint8_t payload[4] = {1, 2, 3, 4};
+    EXPECT_FALSE (queue.push (0, 0.0, payload, 4));
+
+    queue.open ();
+    EXPECT_TRUE (queue.push (0, 0.0, payload, 4));
+    queue.close ();
+    EXPECT_FALSE (queue.push (0, 0.0, payload, 4));
+
+    // queued notifications are still available after close
+    uint8_t retrieved[4];
+    int tag = 0;
+    double timestamp = 0.0;
+    size_t size = 0;
+    EXPECT_TRUE (queue.pop (&tag, &timestamp, retrieved, &size, 10000));
+    EXPECT_FALSE (queue.pop (&tag, &timestamp, retrieved, &size, 10000));
+    EXPECT_EQ (queue.get_num_overflowed (), 0);
+}
+
+TEST (NotificationQueueTest, Push_PayloadIsLongerThanSlot_TruncatePayload)
+{
+    NotificationQueue queue (2, 4);
+    queue.open ();
+    uint8_t payload[6] = {1, 2, 3, 4, 5, 6};
+    EXPECT_TRUE (queue.push (7, 0.0, payload, 6));
+
+    uint8_t retrieved[4];
+    int tag = 0;
+    double timestamp = 0.0;
+    size_t size = 0;
+    ASSERT_TRUE (queue.pop (&tag, &timestamp, retrieved, &size, 0));
+    EXPECT_EQ (size, 4);
+    EXPECT_THAT (retrieved, ElementsAre (1, 2, 3, 4));
+}
+
+TEST (NotificationQueueTest, Pop_ConsumerIsWaiting_WakeUpOnPush)
+{
+    NotificationQueue queue (4, 4);
+    queue.open ();
+    std::thread producer (
+        [&queue] ()
+        {
+            std::this_thread::sleep_for (std::chrono::milliseconds (50));
+            uint8_t payload = 42;
+            queue.push (0, 0.0, &payload, 1);
+        });
+
+    uint8_t retrieved[4];
+    int tag = 0;
+    double timestamp = 0.0;
+    size_t size = 0;
+    auto start = std::chrono::steady_clock::now ();
+    bool res = queue.pop (&tag, &timestamp, retrieved, &size, 10000);
+    auto elapsed = std::chrono::steady_clock::now () - start;
+    producer.join ();
+
+    EXPECT_TRUE (res);
+    EXPECT_EQ (retrieved[0], 42);
+    EXPECT_LT (std::chrono::duration_cast<std::chrono::milliseconds> (elapsed).count (), 5000);
+}
+
+TEST (NotificationQueueTest, Push_SeveralProducers_PayloadsAreNotTornAndStayInOrderPerProducer)
+{
+    const int num_producers = 4;
+    const int num_notifications = 50000;
+    const size_t payload_size = 20;
+    NotificationQueue queue (16, payload_size);
+    queue.open ();
+    std::atomic<int> num_running (num_producers);
+    std::vector<std::thread> producers;
+    std::vector<int> num_pushed (num_producers, 0);
+    for (int p = 0; p < num_producers; p++)
+    {
+        producers.push_back (std::thread (
+            [&queue, &num_running, &num_pushed, p, payload_size] ()
+            {
+                // counter in the first bytes, its low byte repeated in the rest
+                uint8_t payload[payload_size];
+                for (int i = 0; i < num_notifications; i++)
+                {
+                    memcpy (payload, &i, sizeof (i));
+                    std::fill (payload + sizeof (i), payload + payload_size, (uint8_t)i);
+                    num_pushed[p] += queue.push (p, 0.0, payload, payload_size);
+                }
+                num_running--;
+            }));
+    }
+
+    uint8_t retrieved[payload_size];
+    int tag = 0;
+    double timestamp = 0.0;
+    size_t size = 0;
+    std::vector<int> last (num_producers, -1);
+    std::vector<int> num_popped (num_producers, 0);
+    bool is_valid = true;
+    while (true)
+    {
+        bool is_running = (num_running > 0);
+        if (!queue.pop (&tag, &timestamp, retrieved, &size, 1))
+        {
+            if (!is_running)
+            {
+                break;
+            }
+            continue;
+        }
+        if ((tag < 0) || (tag >= num_producers))
+        {
+            is_valid = false;
+            continue;
+        }
+        int counter = 0;
+        memcpy (&counter, retrieved, sizeof (counter));
+        is_valid = is_valid && (size == payload_size) && (counter > last[tag]);
+        for (size_t j = sizeof (counter); j < payload_size; j++)
+        {
+            is_valid = is_valid && (retrieved[j] == (uint8_t)counter);
+        }
+        last[tag] = counter;
+        num_popped[tag]++;
+    }
+    for (auto &producer : producers)
+    {
+        producer.join ();
+    }
+
+    EXPECT_TRUE (is_valid);
+    uint64_t total_pushed = 0;
+    for (int p = 0; p < num_producers; p++)
+    {
+        EXPECT_EQ (num_popped[p], num_pushed[p]);
+        total_pushed += num_pushed[p];
+    }
+    EXPECT_EQ (total_pushed + queue.get_num_overflowed (),
+        (uint64_t)num_producers * num_notifications);
+}
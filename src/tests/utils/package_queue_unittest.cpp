@@ -0,0 +1,157 @@
+#include <atomic>
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <thread>
+#include <vector>
+
+#include "package_queue.h"
+
+using namespace testing;
+
+
+TEST (PackageQueueTest, Pop_QueueHasLessPackagesThanMaxCount_ReturnAllPackagesInOrder)
+{
+    PackageQueue queue (2, 4, BackpressurePolicy::DROP_OLDEST);
+    for (int i = 0; i < 3; i++)
+    {
+        double package[2] = {(double)i, i + 10.0};
+        EXPECT_TRUE (queue.push (package));
+    }
+
+    double retrieved[8];
+    auto result = queue.pop (retrieved, 4, 0);
+
+    EXPECT_EQ (result, 3);
+    EXPECT_EQ (queue.get_size (), 0);
+    EXPECT_THAT (std::vector<double> (retrieved, retrieved + 6),
+        ElementsAre (0.0, 10.0, 1.0, 11.0, 2.0, 12.0));
+}
+
+TEST (PackageQueueTest, Push_QueueIsFullWithDropOldestPolicy_OverwriteOldestPackages)
+{
+    PackageQueue queue (1, 3, BackpressurePolicy::DROP_OLDEST);
+    for (int i = 0; i < 5; i++)
+    {
+        double package = i;
+        EXPECT_TRUE (queue.push (&package));
+    }
+
+    double retrieved[3];
+    auto result = queue.pop (retrieved, 3, 0);
+
+    EXPECT_EQ (result, 3);
+    EXPECT_EQ (queue.get_num_dropped (), 2);
+    EXPECT_THAT (retrieved, ElementsAre (2.0, 3.0, 4.0));
+}
+
+TEST (PackageQueueTest, Push_QueueIsFullWithDropNewestPolicy_KeepOldestPackages)
+{
+    PackageQueue queue (1, 3, BackpressurePolicy::DROP_NEWEST);
+    for (int i = 0; i < 5; i++)
+    {
+        double package = i;
+        EXPECT_EQ (queue.push (&package), i < 3);
+    }
+
+    double retrieved[3];
+    auto result = queue.pop (retrieved, 3, 0);
+
+    EXPECT_EQ (result, 3);
+    EXPECT_EQ (queue.get_num_dropped (), 2);
+    EXPECT_THAT (retrieved, ElementsAre (0.0, 1.0, 2.0));
+}
+
+TEST (PackageQueueTest, Push_QueueIsFullWithBlockPolicy_WaitForConsumerAndLoseNothing)
+{
+    PackageQueue queue (1, 4, BackpressurePolicy::BLOCK);
+    const int num_packages = 10000;
+    std::vector<double> consumed;
+    std::thread consumer (
+        [&queue, &consumed, num_packages] ()
+        {
+            double retrieved[3];
+            while ((int)consumed.size () < num_packages)
+            {
+                size_t count = queue.pop (retrieved, 3, 10);
+                consumed.insert (consumed.end (), retrieved, retrieved + count);
+            }
+        });
+
+    for (int i = 0; i < num_packages; i++)
+    {
+        double package = i;
+        EXPECT_TRUE (queue.push (&package));
+    }
+    consumer.join ();
+
+    EXPECT_EQ (queue.get_num_dropped (), 0);
+    for (int i = 0; i < num_packages; i++)
+    {
+        EXPECT_EQ (consumed[i], (double)i);
+    }
+}
+
+TEST (PackageQueueTest, Pop_InvokedWhileProducerDropsOldest_PackagesAreNotTornAndStayInOrder)
+{
+    const int package_len = 16;
+    PackageQueue queue (package_len, 8, BackpressurePolicy::DROP_OLDEST);
+    std::atomic<bool> is_producing (true);
+    std::thread producer (
+        [&queue, &is_producing, package_len] ()
+        {
+            std::vector<double> package (package_len);
+            for (int i = 0; i < 200000; i++)
+            {
+                std::fill (package.begin (), package.end (), (double)i);
+                queue.push (package.data ());
+            }
+            is_producing = false;
+        });
+
+    std::vector<double> retrieved (4 * package_len);
+    double last = -1.0;
+    bool is_valid = true;
+    while ((is_producing) || (queue.get_size () > 0))
+    {
+        size_t count = queue.pop (retrieved.data (), 4, 1);
+        for (size_t i = 0; i < count; i++)
+        {
+            double first = retrieved[i * package_len];
+            for (int j = 1; j < package_len; j++)
+            {
+                is_valid = is_valid && (retrieved[i * package_len + j] == first);
+            }
+            is_valid = is_valid && (first > last);
+            last = first;
+        }
+    }
+    producer.join ();
+
+    EXPECT_TRUE (is_valid);
+}
+
+TEST (PackageQueueTest, Pop_QueueIsClosedAndEmpty_ReturnImmediately)
+{
+    PackageQueue queue (1, 4, BackpressurePolicy::BLOCK);
+    queue.close ();
+    double package = 1.0;
+
+    EXPECT_FALSE (queue.push (&package));
+    EXPECT_EQ (queue.pop (&package, 1, 10000), 0);
+    EXPECT_EQ (queue.get_num_dropped (), 1);
+}
+
+TEST (PackageQueueTest, PushBlock_QueueIsFullWithDropNewestPolicy_ReturnNumberOfPushedPackages)
+{
+    PackageQueue queue (2, 3, BackpressurePolicy::DROP_NEWEST);
+    double packages[8] = {0.0, 10.0, 1.0, 11.0, 2.0, 12.0, 3.0, 13.0};
+
+    auto num_pushed = queue.push (packages, 4);
+
+    double retrieved[6];
+    auto result = queue.pop (retrieved, 3, 0);
+    EXPECT_EQ (num_pushed, 3);
+    EXPECT_EQ (result, 3);
+    EXPECT_EQ (queue.get_num_dropped (), 1);
+    EXPECT_THAT (retrieved, ElementsAre (0.0, 10.0, 1.0, 11.0, 2.0, 12.0));
+}
@@ -0,0 +1,295 @@
+#include <algorithm>
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "os_serial.h"
+#endif
+
+#include "serial_frame_reader.h"
+
+using namespace testing;
+
+
+// returns prepared bytes, at most max_chunk bytes per read. If report_available is set, max_chunk
+// bytes are reported as buffered like on windows
+class FakeSerial : public Serial
+{
+    std::vector<unsigned char> data;
+    size_t pos;
+    int max_chunk;
+    bool report_available;
+
+public:
+    int max_request;
+
+    FakeSerial (
+        const std::vector<unsigned char> &data, int max_chunk, bool report_available = false)
+        : data (data), pos (0), max_chunk (max_chunk), report_available (report_available)
+    {
+        max_request = 0;
+    }
+
+    int open_serial_port () override
+    {
+        return SerialExitCodes::OK;
+    }
+    bool is_port_open () override
+    {
+        return true;
+    }
+    int set_serial_port_settings (int ms_timeout, bool timeout_only) override
+    {
+        return SerialExitCodes::OK;
+    }
+    int set_custom_baudrate (int baudrate) override
+    {
+        return SerialExitCodes::OK;
+    }
+    int set_custom_latency (int latency) override
+    {
+        return SerialExitCodes::OK;
+    }
+    int flush_buffer () override
+    {
+        return SerialExitCodes::OK;
+    }
+    int read_from_serial_port (void *bytes_to_read, int size) override
+    {
+        max_request = std::max (max_request, size);
+        int len = std::min ((int)(data.size () - pos), std::min (size, max_chunk));
+        memcpy (bytes_to_read, data.data () + pos, len);
+        pos += len;
+        return len;
+    }
+    int get_bytes_available () override
+    {
+        return report_available ? std::min ((int)(data.size () - pos), max_chunk) : -1;
+    }
+    int send_to_serial_port (const void *message, int length) override
+    {
+        return length;
+    }
+    int close_serial_port () override
+    {
+        return SerialExitCodes::OK;
+    }
+    const char *get_port_name () override
+    {
+        return "fake";
+    }
+};
+
+// cyton like frame: 0xA0, package num, 30 data bytes, 0xC0
+static void append_frame (std::vector<unsigned char> &stream, unsigned char package_num)
+{
+    stream.push_back (0xA0);
+    stream.push_back (package_num);
+    for (int i = 0; i < 30; i++)
+    {
+        stream.push_back ((unsigned char)(i + 1));
+    }
+    stream.push_back (0xC0);
+}
+
+static std::vector<int> read_package_nums (SerialFrameReader &reader, int *num_wrong_frames)
+{
+    std::vector<int> package_nums;
+    unsigned char payload[32];
+    SerialFrameStatus res;
+    while ((res = reader.read_frame (0xA0, 0xC0, 0xC6, 32, payload)) !=
+        SerialFrameStatus::NO_DATA)
+    {
+        if (res == SerialFrameStatus::FRAME_READY)
+        {
+            package_nums.push_back (payload[0]);
+        }
+        else
+        {
+            (*num_wrong_frames)++;
+        }
+    }
+    return package_nums;
+}
+
+
+TEST (SerialFrameReaderTest, ReadFrame_FramesSplitBetweenReads_ReturnAllFramesInOrder)
+{
+    std::vector<unsigned char> stream = {0x11, 0x22};
+    for (int i = 0; i < 100; i++)
+    {
+        append_frame (stream, (unsigned char)i);
+    }
+    FakeSerial serial (stream, 7);
+    SerialFrameReader reader (&serial, 64, 64);
+
+    int num_wrong_frames = 0;
+    std::vector<int> package_nums = read_package_nums (reader, &num_wrong_frames);
+
+    EXPECT_EQ (num_wrong_frames, 0);
+    ASSERT_EQ (package_nums.size (), 100);
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ (package_nums[i], i);
+    }
+}
+
+TEST (SerialFrameReaderTest, ReadFrame_SerialReportsBufferedBytes_RequestNoMoreThanBufferedOrFrame)
+{
+    std::vector<unsigned char> stream;
+    for (int i = 0; i < 100; i++)
+    {
+        append_frame (stream, (unsigned char)i);
+    }
+    FakeSerial serial (stream, 5, true);
+    SerialFrameReader reader (&serial);
+
+    int num_wrong_frames = 0;
+    std::vector<int> package_nums = read_package_nums (reader, &num_wrong_frames);
+
+    EXPECT_EQ (num_wrong_frames, 0);
+    EXPECT_EQ (package_nums.size (), 100);
+    // the rest of the frame is requested if less bytes are buffered, never the whole read size
+    EXPECT_LE (serial.max_request, 33);
+
+    FakeSerial fast_serial (stream, 1024, true);
+    SerialFrameReader fast_reader (&fast_serial);
+    package_nums = read_package_nums (fast_reader, &num_wrong_frames);
+    EXPECT_EQ (package_nums.size (), 100);
+    EXPECT_EQ (fast_serial.max_request, DEFAULT_SERIAL_FRAME_READ_SIZE);
+}
+
+TEST (SerialFrameReaderTest, ReadFrame_CorruptedAndLostBytes_ResyncOnNextFrame)
+{
+    std::vector<unsigned char> stream;
+    for (int i = 0; i < 6; i++)
+    {
+        append_frame (stream, (unsigned char)i);
+    }
+    // corrupt end byte of frame 1 and drop a byte of frame 3
+    stream[2 * 33 - 1] = 0x55;
+    stream.erase (stream.begin () + 3 * 33 + 10);
+    FakeSerial serial (stream, 1024);
+    SerialFrameReader reader (&serial);
+
+    int num_wrong_frames = 0;
+    std::vector<int> package_nums = read_package_nums (reader, &num_wrong_frames);
+
+    EXPECT_EQ (num_wrong_frames, 2);
+    EXPECT_THAT (package_nums, ElementsAre (0, 2, 4, 5));
+}
+
+TEST (SerialFrameReaderTest, ReadFrame_HighSamplingRate_ThirtyTimesLessReadsThanByteReads)
+{
+    // one second of 16 kHz stream
+    std::vector<unsigned char> stream;
+    int num_frames = 16000;
+    for (int i = 0; i < num_frames; i++)
+    {
+        append_frame (stream, (unsigned char)i);
+    }
+    FakeSerial serial (stream, 1 << 20);
+    SerialFrameReader reader (&serial);
+
+    int num_wrong_frames = 0;
+    std::vector<int> package_nums = read_package_nums (reader, &num_wrong_frames);
+
+    EXPECT_EQ (package_nums.size (), num_frames);
+    // reading start byte and the rest of the frame takes at least 2 reads per frame
+    EXPECT_LE (reader.get_num_reads () * 30, 2 * num_frames);
+}
+
+TEST (SerialFrameReaderTest, ReadDelimitedFrame_StartInTheMiddleOfStream_SkipPartialFrame)
+{
+    // tail of a previous frame, then frames of different sizes
+    std::vector<unsigned char> stream = {0x01, 0x02, 0xC0};
+    for (int i = 0; i < 5; i++)
+    {
+        stream.push_back (0xA0);
+        stream.push_back ((unsigned char)i);
+        for (int j = 0; j < 10 + i; j++)
+        {
+            stream.push_back (0x33);
+        }
+        stream.push_back (0xC0);
+    }
+    stream.push_back (0xA0);
+    FakeSerial serial (stream, 5);
+    SerialFrameReader reader (&serial);
+
+    unsigned char payload[100];
+    int size = 0;
+    std::vector<int> sizes;
+    while (reader.read_delimited_frame (0xA0, 0xC0, 10, 98, payload, &size) ==
+        SerialFrameStatus::FRAME_READY)
+    {
+        EXPECT_EQ (payload[0], sizes.size ());
+        EXPECT_EQ (payload[size - 1], 0xC0);
+        sizes.push_back (size);
+    }
+
+    EXPECT_THAT (sizes, ElementsAre (12, 13, 14, 15, 16));
+}
+
+#ifndef _WIN32
+TEST (SerialFrameReaderTest, ReadFrame_PseudoTerminal_ReturnFramesWrittenByDevice)
+{
+    int master = posix_openpt (O_RDWR | O_NOCTTY);
+    ASSERT_GE (master, 0);
+    ASSERT_EQ (grantpt (master), 0);
+    ASSERT_EQ (unlockpt (master), 0);
+    OSSerial serial (ptsname (master));
+    ASSERT_EQ (serial.open_serial_port (), (int)SerialExitCodes::OK);
+    ASSERT_EQ (serial.set_serial_port_settings (100, false), (int)SerialExitCodes::OK);
+
+    int num_frames = 500;
+    std::vector<unsigned char> stream;
+    for (int i = 0; i < num_frames; i++)
+    {
+        append_frame (stream, (unsigned char)i);
+    }
+    std::thread device ([&] {
+        // write in small pieces like a device does
+        for (size_t pos = 0; pos < stream.size (); pos += 330)
+        {
+            size_t len = std::min ((size_t)330, stream.size () - pos);
+            EXPECT_EQ (write (master, stream.data () + pos, len), (ssize_t)len);
+            std::this_thread::sleep_for (std::chrono::milliseconds (1));
+        }
+    });
+
+    SerialFrameReader reader (&serial);
+    unsigned char payload[32];
+    int num_received = 0;
+    int num_wrong_frames = 0;
+    while (num_received < num_frames)
+    {
+        SerialFrameStatus res = reader.read_frame (0xA0, 0xC0, 0xC6, 32, payload);
+        if (res == SerialFrameStatus::NO_DATA)
+        {
+            break;
+        }
+        if (res == SerialFrameStatus::WRONG_END_BYTE)
+        {
+            num_wrong_frames++;
+            continue;
+        }
+        EXPECT_EQ (payload[0], (unsigned char)num_received);
+        num_received++;
+    }
+    device.join ();
+    serial.close_serial_port ();
+    close (master);
+
+    EXPECT_EQ (num_received, num_frames);
+    EXPECT_EQ (num_wrong_frames, 0);
+    EXPECT_LT (reader.get_num_reads (), num_frames);
+}
+#endif
@@ -0,0 +1,259 @@
+#include <cmath>
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "stream_packet.h"
+
+using namespace testing;
+
+
+// num_samples x num_rows matrix, timestamp is the last row
+static std::vector<double> get_test_packages (int num_rows, int num_samples)
+{
+    std::vector<double> packages (num_rows * num_samples);
+    for (int i = 0; i < num_samples; i++)
+    {
+        for (int row = 0; row < num_rows - 1; row++)
+        {
+            packages[i * num_rows + row] = 100.0 * std::sin (0.1 * i + row) + row;
+        }
+        packages[i * num_rows + num_rows - 1] = 1700000000.123456 + i * 0.004;
+    }
+    return packages;
+}
+
+static std::vector<double> round_trip (const std::vector<double> &packages, int num_rows,
+    int num_samples, StreamEncoding encoding, size_t *packet_size,
+    const std::vector<int> &exact_rows = std::vector<int> ())
+{
+    std::vector<uint8_t> buf (
+        get_stream_packet_max_size (num_rows, num_samples, encoding, (int)exact_rows.size ()));
+    *packet_size = encode_stream_packet (packages.data (), num_rows, num_samples, num_rows - 1,
+        exact_rows, 2, 77, encoding, buf.data (), buf.size ());
+    std::vector<double> decoded (num_rows * num_samples, 0.0);
+    StreamPacketHeader header;
+    if ((*packet_size == 0) ||
+        (decode_stream_packet_header (buf.data (), *packet_size, &header) !=
+            StreamPacketStatus::OK) ||
+        (decode_stream_packet (buf.data (), *packet_size, header, decoded.data ()) !=
+            StreamPacketStatus::OK))
+    {
+        decoded.clear ();
+    }
+    return decoded;
+}
+
+TEST (StreamPacketTest, EncodeStreamPacket_Float64_DecodeExactValuesAndHeader)
+{
+    std::vector<double> packages = get_test_packages (5, 10);
+    std::vector<uint8_t> buf (get_stream_packet_max_size (5, 10, StreamEncoding::FLOAT64, 0));
+    size_t size = encode_stream_packet (packages.data (), 5, 10, 4, std::vector<int> (), 2, 77,
+        StreamEncoding::FLOAT64, buf.data (), buf.size ());
+    ASSERT_EQ (size, sizeof (StreamPacketHeader) + sizeof (double) * 50);
+
+    StreamPacketHeader header;
+    ASSERT_EQ (decode_stream_packet_header (buf.data (), size, &header), StreamPacketStatus::OK);
+    EXPECT_EQ (header.version, STREAM_PACKET_VERSION);
+    EXPECT_EQ (header.preset, 2);
+    EXPECT_EQ (header.sequence, 77);
+    EXPECT_EQ (header.num_rows, 5);
+    EXPECT_EQ (header.num_samples, 10);
+    EXPECT_EQ (header.timestamp_row, 4);
+    EXPECT_EQ (header.num_exact_rows, 0);
+
+    std::vector<double> decoded (50);
+    ASSERT_EQ (decode_stream_packet (buf.data (), size, header, decoded.data ()),
+        StreamPacketStatus::OK);
+    EXPECT_THAT (decoded, ElementsAreArray (packages));
+}
+
+TEST (StreamPacketTest, EncodeStreamPacket_CompactEncodings_KeepTimestampAndBoundError)
+{
+    const int num_rows = 9;
+    const int num_samples = 50;
+    std::vector<double> packages = get_test_packages (num_rows, num_samples);
+    StreamEncoding encodings[] = {
+        StreamEncoding::FLOAT32, StreamEncoding::INT24, StreamEncoding::INT24_DELTA};
+    size_t float64_size =
+        get_stream_packet_max_size (num_rows, num_samples, StreamEncoding::FLOAT64, 0);
+    for (StreamEncoding encoding : encodings)
+    {
+        size_t size = 0;
+        std::vector<double> decoded = round_trip (packages, num_rows, num_samples, encoding, &size);
+        ASSERT_EQ (decoded.size (), packages.size ());
+        EXPECT_LT (size, float64_size);
+        for (int i = 0; i < num_samples; i++)
+        {
+            for (int row = 0; row < num_rows - 1; row++)
+            {
+                // values are below 110, both float32 and int24 keep at least 1e-4 of it
+                EXPECT_NEAR (decoded[i * num_rows + row], packages[i * num_rows + row], 1e-4);
+            }
+            EXPECT_EQ (decoded[i * num_rows + num_rows - 1], packages[i * num_rows + num_rows - 1]);
+        }
+    }
+}
+
+TEST (StreamPacketTest, EncodeStreamPacket_CompactEncodings_KeepExactRows)
+{
+    // package num, signal, marker, unix time in other channel and timestamp
+    const int num_rows = 5;
+    const int num_samples = 50;
+    std::vector<double> packages (num_rows * num_samples);
+    for (int i = 0; i < num_samples; i++)
+    {
+        packages[i * num_rows + 0] = (double)(i % 256);
+        packages[i * num_rows + 1] = 100.0 * std::sin (0.1 * i);
+        packages[i * num_rows + 2] = (i % 7 == 0) ? 5.0 + i : 0.0;
+        packages[i * num_rows + 3] = 1700000000.654321 + i * 0.002;
+        packages[i * num_rows + 4] = 1700000000.123456 + i * 0.004;
+    }
+    StreamEncoding encodings[] = {
+        StreamEncoding::FLOAT32, StreamEncoding::INT24, StreamEncoding::INT24_DELTA};
+    for (StreamEncoding encoding : encodings)
+    {
+        size_t size = 0;
+        std::vector<double> decoded =
+            round_trip (packages, num_rows, num_samples, encoding, &size, {3, 0, 2, 3, 7});
+        ASSERT_EQ (decoded.size (), packages.size ());
+        for (int i = 0; i < num_samples; i++)
+        {
+            EXPECT_EQ (decoded[i * num_rows + 0], packages[i * num_rows + 0]);
+            EXPECT_NEAR (decoded[i * num_rows + 1], packages[i * num_rows + 1], 1e-4);
+            EXPECT_EQ (decoded[i * num_rows + 2], packages[i * num_rows + 2]);
+            EXPECT_EQ (decoded[i * num_rows + 3], packages[i * num_rows + 3]);
+            EXPECT_EQ (decoded[i * num_rows + 4], packages[i * num_rows + 4]);
+        }
+    }
+}
+
+TEST (StreamPacketTest, EncodeStreamPacket_SmoothSignal_DeltaIsSmallerThanInt24)
+{
+    const int num_rows = 9;
+    const int num_samples = 200;
+    std::vector<double> packages = get_test_packages (num_rows, num_samples);
+    size_t int24_size = 0;
+    size_t delta_size = 0;
+    round_trip (packages, num_rows, num_samples, StreamEncoding::INT24, &int24_size);
+    round_trip (packages, num_rows, num_samples, StreamEncoding::INT24_DELTA, &delta_size);
+    EXPECT_GT (int24_size, 0);
+    EXPECT_LT (delta_size, int24_size);
+}
+
+TEST (StreamPacketTest, EncodeStreamPacket_ConstantAndNonFiniteValues_DecodeAsZeroOrConstant)
+{
+    const int num_rows = 3;
+    const int num_samples = 4;
+    std::vector<double> packages = {
+        0.0, NAN, 1.0, 0.0, INFINITY, 2.0, 0.0, 5.0, 3.0, 0.0, 5.0, 4.0};
+    size_t size = 0;
+    std::vector<double> decoded =
+        round_trip (packages, num_rows, num_samples, StreamEncoding::INT24, &size);
+    ASSERT_EQ (decoded.size (), packages.size ());
+    EXPECT_THAT (decoded, ElementsAre (0.0, 0.0, 1.0, 0.0, 0.0, 2.0, 0.0, DoubleNear (5.0, 1e-5),
+                              3.0, 0.0, DoubleNear (5.0, 1e-5), 4.0));
+}
+
+TEST (StreamPacketTest, DecodeStreamPacket_CorruptedDatagram_ReturnError)
+{
+    std::vector<double> packages = get_test_packages (4, 8);
+    std::vector<uint8_t> buf (get_stream_packet_max_size (4, 8, StreamEncoding::INT24_DELTA, 1));
+    size_t size = encode_stream_packet (packages.data (), 4, 8, 3, std::vector<int> {0}, 0, 1,
+        StreamEncoding::INT24_DELTA, buf.data (), buf.size ());
+    ASSERT_GT (size, 0);
+    std::vector<double> decoded (32);
+    StreamPacketHeader header;
+    ASSERT_EQ (decode_stream_packet_header (buf.data (), size, &header), StreamPacketStatus::OK);
+
+    EXPECT_EQ (decode_stream_packet (buf.data (), size - 1, header, decoded.data ()),
+        StreamPacketStatus::INVALID_PACKET);
+    buf[size] = 0;
+    EXPECT_EQ (decode_stream_packet (buf.data (), size + 1, header, decoded.data ()),
+        StreamPacketStatus::INVALID_PACKET);
+    EXPECT_EQ (decode_stream_packet_header (buf.data (), sizeof (StreamPacketHeader) - 1, &header),
+        StreamPacketStatus::NOT_A_PACKET);
+    // exact row index is out of range
+    buf[sizeof (StreamPacketHeader)] = 4;
+    EXPECT_EQ (decode_stream_packet (buf.data (), size, header, decoded.data ()),
+        StreamPacketStatus::INVALID_PACKET);
+
+    buf[4] = STREAM_PACKET_VERSION + 1;
+    EXPECT_EQ (decode_stream_packet_header (buf.data (), size, &header),
+        StreamPacketStatus::UNSUPPORTED_VERSION);
+    buf[0] ^= 0xFF;
+    EXPECT_EQ (
+        decode_stream_packet_header (buf.data (), size, &header), StreamPacketStatus::NOT_A_PACKET);
+}
+
+TEST (StreamPacketTest, EncodeStreamPacket_BufferIsTooSmall_ReturnZero)
+{
+    std::vector<double> packages = get_test_packages (4, 8);
+    std::vector<uint8_t> buf (get_stream_packet_max_size (4, 8, StreamEncoding::FLOAT32, 0) - 1);
+    EXPECT_EQ (encode_stream_packet (packages.data (), 4, 8, 3, std::vector<int> (), 0, 1,
+                   StreamEncoding::FLOAT32, buf.data (), buf.size ()),
+        0);
+}
+
+TEST (StreamPacketTest, ParseStreamEncoding_UnknownName_ReturnFalse)
+{
+    StreamEncoding encoding = StreamEncoding::FLOAT64;
+    EXPECT_TRUE (parse_stream_encoding ("int24_delta", &encoding));
+    EXPECT_EQ (encoding, StreamEncoding::INT24_DELTA);
+    EXPECT_FALSE (parse_stream_encoding ("int16", &encoding));
+    EXPECT_EQ (encoding, StreamEncoding::INT24_DELTA);
+}
+
+TEST (StreamSequenceTrackerTest, Update_SequenceHasGaps_CountLostDatagrams)
+{
+    StreamSequenceTracker tracker;
+    EXPECT_TRUE (tracker.update (10));
+    EXPECT_TRUE (tracker.update (11));
+    EXPECT_TRUE (tracker.update (14));
+    EXPECT_TRUE (tracker.update (15));
+    EXPECT_EQ (tracker.get_num_received (), 4);
+    EXPECT_EQ (tracker.get_num_lost (), 2);
+    EXPECT_EQ (tracker.get_num_reordered (), 0);
+}
+
+TEST (StreamSequenceTrackerTest, Update_LateAndDuplicatedDatagrams_RejectThem)
+{
+    StreamSequenceTracker tracker;
+    EXPECT_TRUE (tracker.update (0));
+    EXPECT_TRUE (tracker.update (2));
+    EXPECT_FALSE (tracker.update (1));
+    EXPECT_FALSE (tracker.update (2));
+    EXPECT_TRUE (tracker.update (3));
+    EXPECT_EQ (tracker.get_num_received (), 3);
+    EXPECT_EQ (tracker.get_num_lost (), 1);
+    EXPECT_EQ (tracker.get_num_reordered (), 2);
+}
+
+TEST (StreamSequenceTrackerTest, Update_StreamerIsRestarted_AcceptNewSequence)
+{
+    StreamSequenceTracker tracker;
+    EXPECT_TRUE (tracker.update (5000));
+    // big step back
+    EXPECT_TRUE (tracker.update (0));
+    EXPECT_TRUE (tracker.update (1));
+
+    // small step back, accepted after several rejected datagrams in a row
+    EXPECT_TRUE (tracker.update (100));
+    int num_rejected = 0;
+    uint32_t sequence = 50;
+    while (!tracker.update (sequence++))
+    {
+        num_rejected++;
+        ASSERT_LT (num_rejected, 100);
+    }
+    EXPECT_GT (num_rejected, 0);
+    EXPECT_TRUE (tracker.update (sequence));
+    EXPECT_EQ (tracker.get_num_lost (), 98);
+
+    // sequence wraps around
+    tracker.reset ();
+    EXPECT_TRUE (tracker.update (0xFFFFFFFF));
+    EXPECT_TRUE (tracker.update (0));
+    EXPECT_EQ (tracker.get_num_lost (), 0);
+    EXPECT_EQ (tracker.get_num_received (), 2);
+}
@@ -0,0 +1,82 @@
+#include <atomic>
+#include <gmock/gmock.h>
+#include <thread>
+#include <vector>
+
+#include "thread_pool.h"
+
+using namespace testing;
+
+
+TEST (ThreadPoolTest, ParallelFor_PoolHasSeveralThreads_CallFuncOnceForEachIndex)
+{
+    ThreadPool pool (4);
+    std::vector<std::atomic<int>> calls (1000);
+    for (size_t i = 0; i < calls.size (); i++)
+    {
+        calls[i] = 0;
+    }
+
+    pool.parallel_for ((int)calls.size (), [&calls] (int i) { calls[i].fetch_add (1); });
+
+    EXPECT_EQ (pool.get_num_threads (), 4);
+    for (size_t i = 0; i < calls.size (); i++)
+    {
+        EXPECT_EQ (calls[i].load (), 1);
+    }
+}
+
+TEST (ThreadPoolTest, ParallelFor_PoolHasSingleThread_RunOnCallingThread)
+{
+    ThreadPool pool (1);
+    std::thread::id caller_id = std::this_thread::get_id ();
+    int num_foreign_calls = 0;
+
+    pool.parallel_for (100, [&] (int) {
+        if (std::this_thread::get_id () != caller_id)
+        {
+            num_foreign_calls++;
+        }
+    });
+
+    EXPECT_EQ (pool.get_num_threads (), 1);
+    EXPECT_EQ (num_foreign_calls, 0);
+}
+
+TEST (ThreadPoolTest, ParallelFor_InvokedFromLoopBody_FinishWithoutDeadlock)
+{
+    ThreadPool pool (3);
+    std::atomic<int> sum (0);
+
+    pool.parallel_for (8, [&] (int i) {
+        pool.parallel_for (8, [&sum, i] (int j) { sum.fetch_add (i * 8 + j); });
+    });
+
+    EXPECT_EQ (sum.load (), 63 * 64 / 2);
+}
+
+TEST (ThreadPoolTest, ParallelFor_InvokedFromSeveralThreads_AllJobsAreCompleted)
+{
+    ThreadPool pool (4);
+    std::atomic<int> sums[3];
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 3; t++)
+    {
+        sums[t] = 0;
+        callers.push_back (std::thread ([&pool, &sums, t] {
+            for (int k = 0; k < 50; k++)
+            {
+                pool.parallel_for (100, [&sums, t] (int i) { sums[t].fetch_add (i); });
+            }
+        }));
+    }
+    for (size_t t = 0; t < callers.size (); t++)
+    {
+        callers[t].join ();
+    }
+
+    for (int t = 0; t < 3; t++)
+    {
+        EXPECT_EQ (sums[t].load (), 50 * 99 * 100 / 2);
+    }
+}
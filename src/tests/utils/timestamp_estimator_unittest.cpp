@@ -0,0 +1,99 @@
+#include <gmock/gmock.h>
+#include <math.h>
+#include <random>
+
+#include "timestamp_estimator.h"
+
+using namespace testing;
+
+
+TEST (TimestampEstimatorTest, Update_JitteredArrivals_FollowDeviceClockAndEstimateDrift)
+{
+    // 250 Hz device, host clock is 100 ppm faster, latency is 10 - 50 ms
+    double sampling_rate = 250.0;
+    double drift = 0.0001;
+    double start = 1700000000.0;
+    std::mt19937 generator (42);
+    std::uniform_real_distribution<double> latency (0.01, 0.05);
+    TimestampEstimator estimator (1.0 / sampling_rate);
+
+    double max_error = 0.0;
+    for (int i = 0; i < 250 * 120; i++)
+    {
+        double sent = start + i / sampling_rate * (1.0 + drift);
+        double timestamp = estimator.update ((double)i, sent + latency (generator));
+        // estimator can not know constant part of latency, it compares with mean latency
+        if (i > 250 * 60)
+        {
+            max_error = std::max (max_error, fabs (timestamp - sent - 0.03));
+        }
+    }
+
+    EXPECT_LT (max_error, 0.003);
+    EXPECT_NEAR (estimator.get_drift (), drift, 0.00003);
+    EXPECT_NEAR (estimator.get_offset (), start + 0.03, 0.003);
+}
+
+TEST (TimestampEstimatorTest, GetDeviceClock_CounterWrapsDuringLostPackages_CountAllPackages)
+{
+    TimestampEstimator estimator (1.0 / 250.0);
+    double start = 1700000000.0;
+
+    EXPECT_EQ (estimator.get_device_clock (250, 256, start), 250.0);
+    EXPECT_EQ (estimator.get_device_clock (3, 256, start + 9.0 / 250.0), 259.0);
+    // 600 packages are lost, counter wraps twice
+    EXPECT_EQ (estimator.get_device_clock (91, 256, start + 610.0 / 250.0), 859.0);
+    // 12 samples per package
+    TimestampEstimator muse_estimator (1.0 / 256.0);
+    EXPECT_EQ (muse_estimator.get_device_clock (65535, 65536, start, 12), 65535.0 * 12);
+    EXPECT_EQ (muse_estimator.get_device_clock (0, 65536, start + 12.0 / 256.0, 12), 65536.0 * 12);
+}
+
+TEST (TimestampEstimatorTest, Update_HostClockJumpsBack_RestartFit)
+{
+    TimestampEstimator estimator (0.001);
+    double start = 1700000000.0;
+    for (int i = 0; i < 10000; i++)
+    {
+        estimator.update (i * 10.0, start + i * 0.01);
+    }
+
+    double timestamp = estimator.update (100000.0, start + 100.0 - 60.0);
+
+    EXPECT_DOUBLE_EQ (timestamp, start + 40.0);
+    EXPECT_DOUBLE_EQ (estimator.get_drift (), 0.0);
+}
+
+TEST (TimestampEstimatorTest, Update_SingleLateDelivery_ReturnPredictedTimestamp)
+{
+    TimestampEstimator estimator (0.001);
+    double start = 1700000000.0;
+    for (int i = 0; i < 10000; i++)
+    {
+        estimator.update (i * 10.0, start + i * 0.01);
+    }
+
+    double timestamp = estimator.update (100000.0, start + 100.0 + 3.0);
+
+    EXPECT_NEAR (timestamp, start + 100.0, 0.000001);
+}
+
+TEST (TimestampEstimatorTest, IsStatsDue_PackagesForAMinute_ReportOncePerInterval)
+{
+    TimestampEstimator estimator (0.004);
+    double start = 1700000000.0;
+    int num_reports = 0;
+    for (int i = 0; i < 15000; i++)
+    {
+        double host_time = start + i * 0.004;
+        estimator.update (i, host_time);
+        if (estimator.is_stats_due (host_time))
+        {
+            num_reports++;
+        }
+    }
+
+    EXPECT_EQ (num_reports, (int)(60.0 / TIMESTAMP_STATS_INTERVAL) - 1);
+    estimator.reset ();
+    EXPECT_FALSE (estimator.is_stats_due (start + 100.0));
+}
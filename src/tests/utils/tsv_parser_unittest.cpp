@@ -0,0 +1,110 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "tsv_parser.h"
+
+using namespace testing;
+
+#define TEST_TSV_FILE "tsv_parser_unittest.csv"
+
+
+TEST (TsvParserTest, ParseDouble_ValuesPrintedByStreamer_MatchStrtod)
+{
+    std::mt19937 generator (42);
+    std::uniform_real_distribution<double> distribution (-1e6, 1e6);
+    const char *formats[] = {"%lf", "%.17g", "%e"};
+    for (int i = 0; i < 10000; i++)
+    {
+        for (const char *format : formats)
+        {
+            char str[64];
+            int len = snprintf (str, sizeof (str), format, distribution (generator));
+            double value = 0.0;
+            const char *end = parse_double (str, str + len, &value);
+
+            EXPECT_EQ (end, str + len);
+            EXPECT_EQ (value, strtod (str, NULL)) << str;
+        }
+    }
+}
+
+TEST (TsvParserTest, ParseDouble_SpecialValues_FallbackToStrtod)
+{
+    const char *inputs[] = {"nan", "-inf", "12345678901234567890123", "1e-300", " +.5"};
+    for (const char *input : inputs)
+    {
+        double value = 0.0;
+        const char *end = parse_double (input, input + strlen (input), &value);
+
+        EXPECT_EQ (end, input + strlen (input)) << input;
+        if (strcmp (input, "nan") == 0)
+        {
+            EXPECT_TRUE (value != value);
+        }
+        else
+        {
+            EXPECT_EQ (value, strtod (input, NULL)) << input;
+        }
+    }
+}
+
+TEST (TsvParserTest, ParseTsvLine_DifferentSeparators_ReturnAllFields)
+{
+    double values[3];
+    const char *tsv = "1.5\t-2.000000\t3e2\t";
+    const char *csv = "1.5,-2,300.0 ";
+
+    EXPECT_EQ (parse_tsv_line (tsv, strlen (tsv), values, 3), 3);
+    EXPECT_THAT (values, ElementsAre (1.5, -2.0, 300.0));
+    EXPECT_EQ (parse_tsv_line (csv, strlen (csv), values, 3), 3);
+    EXPECT_THAT (values, ElementsAre (1.5, -2.0, 300.0));
+    EXPECT_EQ (parse_tsv_line (tsv, strlen (tsv), values, 1), 3);
+}
+
+TEST (TsvParserTest, ParseTsvLine_InvalidFields_ReturnError)
+{
+    double values[3];
+    const char *inputs[] = {"1.0\tabc\t2.0", "1.0\t\t2.0", "\t1.0"};
+    for (const char *input : inputs)
+    {
+        EXPECT_EQ (parse_tsv_line (input, strlen (input), values, 3), -1) << input;
+    }
+}
+
+TEST (TsvParserTest, NextLine_LinesLongerThanBuffer_ReturnWholeLines)
+{
+    std::string long_line (100, '1');
+    FILE *fp = fopen (TEST_TSV_FILE, "wb");
+    fprintf (fp, "a\r\n%s\n\nb", long_line.c_str ());
+    fclose (fp);
+
+    LineReader reader (8);
+    const char *line = NULL;
+    size_t len = 0;
+    std::vector<std::string> lines;
+    std::vector<long long> offsets;
+    EXPECT_TRUE (reader.open (TEST_TSV_FILE));
+    offsets.push_back (reader.tell ());
+    while (reader.next_line (&line, &len))
+    {
+        lines.push_back (std::string (line, len));
+        offsets.push_back (reader.tell ());
+    }
+    EXPECT_TRUE (reader.seek (offsets[3]));
+    EXPECT_TRUE (reader.next_line (&line, &len));
+    std::string last_line (line, len);
+    reader.close ();
+    long long num_lines = count_lines_in_file (TEST_TSV_FILE);
+    remove (TEST_TSV_FILE);
+
+    EXPECT_THAT (lines, ElementsAre ("a", long_line, "", "b"));
+    EXPECT_THAT (offsets, ElementsAre (0, 3, 104, 105, 106));
+    EXPECT_EQ (last_line, "b");
+    EXPECT_EQ (num_lines, 4);
+}
@@ -0,0 +1,353 @@
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "bin_file.h"
+#include "brainflow_constants.h"
+
+
+static bool truncate_file (const char *file_name, size_t size)
+{
+#ifdef _WIN32
+    int fd = -1;
+    if (_sopen_s (&fd, file_name, _O_RDWR | _O_BINARY, _SH_DENYNO, 0) != 0)
+    {
+        return false;
+    }
+    bool res = (_chsize_s (fd, (__int64)size) == 0);
+    _close (fd);
+    return res;
+#else
+    return (truncate (file_name, (off_t)size) == 0);
+#endif
+}
+
+static long long get_file_size (const char *file_name)
+{
+    FILE *fp = fopen (file_name, "rb");
+    if (fp == NULL)
+    {
+        return -1;
+    }
+#ifdef _WIN32
+    _fseeki64 (fp, 0, SEEK_END);
+    long long size = (long long)_ftelli64 (fp);
+#else
+    fseeko (fp, 0, SEEK_END);
+    long long size = (long long)ftello (fp);
+#endif
+    fclose (fp);
+    return size;
+}
+
+///////////////////////////////////
+///////// BinFileWriter ///////////
+///////////////////////////////////
+
+BinFileWriter::BinFileWriter ()
+{
+    fp = NULL;
+    num_rows = 0;
+}
+
+BinFileWriter::~BinFileWriter ()
+{
+    close ();
+}
+
+int BinFileWriter::open (const char *file_name, const char *file_mode, int board_id, int preset,
+    int num_rows, double sampling_rate)
+{
+    if ((fp != NULL) || (num_rows <= 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    bool append = ((strcmp (file_mode, "a") == 0) || (strcmp (file_mode, "a+") == 0));
+    if ((!append) && (strcmp (file_mode, "w") != 0) && (strcmp (file_mode, "w+") != 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    if ((append) && (get_file_size (file_name) > 0))
+    {
+        BinFileReader reader;
+        int res = reader.open (file_name);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+        if (reader.get_header ().num_rows != num_rows)
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        size_t valid_size = reader.get_valid_size ();
+        reader.close ();
+        // drop the block which was being written when previous session crashed
+        if (((long long)valid_size != get_file_size (file_name)) &&
+            (!truncate_file (file_name, valid_size)))
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        fp = fopen (file_name, "ab");
+        if (fp == NULL)
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        this->num_rows = num_rows;
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+
+    fp = fopen (file_name, "wb");
+    if (fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    BinFileHeader header;
+    memset (&header, 0, sizeof (header));
+    memcpy (header.magic, BIN_FILE_MAGIC, sizeof (header.magic));
+    header.version = BIN_FILE_VERSION;
+    header.header_size = sizeof (header);
+    header.board_id = board_id;
+    header.preset = preset;
+    header.num_rows = num_rows;
+    header.sampling_rate = sampling_rate;
+    if ((fwrite (&header, sizeof (header), 1, fp) != 1) || (fflush (fp) != 0))
+    {
+        close ();
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    this->num_rows = num_rows;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BinFileWriter::write_block (const double *data, int num_samples, int row_stride)
+{
+    if ((fp == NULL) || (data == NULL) || (num_samples <= 0) || (row_stride < num_samples))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    BinBlockHeader block_header;
+    block_header.magic = BIN_BLOCK_MAGIC;
+    block_header.num_samples = (uint32_t)num_samples;
+    bool is_written = (fwrite (&block_header, sizeof (block_header), 1, fp) == 1);
+    if (row_stride == num_samples)
+    {
+        is_written = is_written &&
+            (fwrite (data, sizeof (double), (size_t)num_rows * num_samples, fp) ==
+                (size_t)num_rows * num_samples);
+    }
+    else
+    {
+        for (int i = 0; (i < num_rows) && (is_written); i++)
+        {
+            is_written = (fwrite (data + i * row_stride, sizeof (double), num_samples, fp) ==
+                (size_t)num_samples);
+        }
+    }
+    // flush every block to lose at most one of them if the process dies
+    if ((!is_written) || (fflush (fp) != 0))
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void BinFileWriter::close ()
+{
+    if (fp != NULL)
+    {
+        fclose (fp);
+        fp = NULL;
+    }
+}
+
+///////////////////////////////////
+///////// BinFileReader ///////////
+///////////////////////////////////
+
+BinFileReader::BinFileReader ()
+{
+    mapping = NULL;
+    mapping_size = 0;
+#ifdef _WIN32
+    file_handle = INVALID_HANDLE_VALUE;
+    mapping_handle = NULL;
+#endif
+    memset (&header, 0, sizeof (header));
+    num_samples = 0;
+    valid_size = 0;
+}
+
+BinFileReader::~BinFileReader ()
+{
+    close ();
+}
+
+bool BinFileReader::is_bin_file (const char *file_name)
+{
+    FILE *fp = fopen (file_name, "rb");
+    if (fp == NULL)
+    {
+        return false;
+    }
+    char magic[8];
+    bool res = (fread (magic, 1, sizeof (magic), fp) == sizeof (magic)) &&
+        (memcmp (magic, BIN_FILE_MAGIC, sizeof (magic)) == 0);
+    fclose (fp);
+    return res;
+}
+
+int BinFileReader::open (const char *file_name)
+{
+    if (mapping != NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+#ifdef _WIN32
+    file_handle = CreateFileA (file_name, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file_handle == INVALID_HANDLE_VALUE)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    LARGE_INTEGER file_size;
+    if ((!GetFileSizeEx (file_handle, &file_size)) ||
+        (file_size.QuadPart < (LONGLONG)sizeof (BinFileHeader)))
+    {
+        close ();
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    mapping_handle = CreateFileMappingA (file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping_handle == NULL)
+    {
+        close ();
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    mapping = (const char *)MapViewOfFile (mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    if (mapping == NULL)
+    {
+        close ();
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    mapping_size = (size_t)file_size.QuadPart;
+#else
+    int fd = ::open (file_name, O_RDONLY);
+    if (fd < 0)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    struct stat file_stat;
+    if ((fstat (fd, &file_stat) != 0) || (file_stat.st_size < (off_t)sizeof (BinFileHeader)))
+    {
+        ::close (fd);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    void *addr = mmap (NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping stays valid after the descriptor is closed
+    ::close (fd);
+    if (addr == MAP_FAILED)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    mapping = (const char *)addr;
+    mapping_size = (size_t)file_stat.st_size;
+#endif
+
+    memcpy (&header, mapping, sizeof (header));
+    if ((memcmp (header.magic, BIN_FILE_MAGIC, sizeof (header.magic)) != 0) ||
+        (header.version != BIN_FILE_VERSION) || (header.header_size < sizeof (header)) ||
+        (header.header_size > mapping_size) || (header.num_rows <= 0))
+    {
+        close ();
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    size_t offset = header.header_size;
+    size_t row_size = sizeof (double) * (size_t)header.num_rows;
+    while (mapping_size - offset >= sizeof (BinBlockHeader))
+    {
+        BinBlockHeader block_header;
+        memcpy (&block_header, mapping + offset, sizeof (block_header));
+        if ((block_header.magic != BIN_BLOCK_MAGIC) || (block_header.num_samples == 0) ||
+            ((mapping_size - offset - sizeof (block_header)) / row_size <
+                block_header.num_samples))
+        {
+            break;
+        }
+        Block block;
+        block.offset = offset + sizeof (block_header);
+        block.num_samples = block_header.num_samples;
+        blocks.push_back (block);
+        num_samples += block.num_samples;
+        offset = block.offset + row_size * block.num_samples;
+    }
+    valid_size = offset;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void BinFileReader::close ()
+{
+#ifdef _WIN32
+    if (mapping != NULL)
+    {
+        UnmapViewOfFile (mapping);
+    }
+    if (mapping_handle != NULL)
+    {
+        CloseHandle (mapping_handle);
+        mapping_handle = NULL;
+    }
+    if (file_handle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle (file_handle);
+        file_handle = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (mapping != NULL)
+    {
+        munmap ((void *)mapping, mapping_size);
+    }
+#endif
+    mapping = NULL;
+    mapping_size = 0;
+    memset (&header, 0, sizeof (header));
+    blocks.clear ();
+    num_samples = 0;
+    valid_size = 0;
+}
+
+size_t BinFileReader::read (double *output, size_t max_samples)
+{
+    if ((mapping == NULL) || (output == NULL))
+    {
+        return 0;
+    }
+    size_t result_count = (max_samples < num_samples) ? max_samples : num_samples;
+    size_t col = 0;
+    for (size_t i = 0; (i < blocks.size ()) && (col < result_count); i++)
+    {
+        size_t count = blocks[i].num_samples;
+        if (count > result_count - col)
+        {
+            count = result_count - col;
+        }
+        const char *block_data = mapping + blocks[i].offset;
+        for (int row = 0; row < header.num_rows; row++)
+        {
+            memcpy (output + row * result_count + col,
+                block_data + sizeof (double) * blocks[i].num_samples * row,
+                sizeof (double) * count);
+        }
+        col += count;
+    }
+    return result_count;
+}
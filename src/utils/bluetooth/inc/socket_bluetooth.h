@@ -17,12 +17,13 @@
 #include "pipe.h"
 #endif
 
-#include <queue>
 #include <stdlib.h>
 #include <string.h>
 #include <string>
 #include <utility>
 
+#include "byte_ring.h"
+
 
 class SocketBluetooth
 {
@@ -39,7 +40,7 @@ public:
     int recv (char *data, int size);
     int bytes_available ()
     {
-        return (int)temp_buffer.size ();
+        return temp_buffer.get_size ();
     }
     int close ();
 
@@ -48,7 +49,7 @@ public:
 private:
     std::string mac_addr;
     int port;
-    std::queue<char> temp_buffer;
+    ByteRing temp_buffer;
 #ifdef _WIN32
     SOCKET socket_bt;
 #elif defined(__linux__)
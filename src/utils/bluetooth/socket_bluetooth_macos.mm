@@ -72,20 +72,16 @@ int SocketBluetooth::close()
 int SocketBluetooth::recv (char *buffer, int length)
 {
     int res = (int)pipe_pop_eager (consumer, buffer, length);
-    for (int i = 0; i < res; i++)
+    if (res > 0)
     {
-        temp_buffer.push (buffer[i]);
+        temp_buffer.reserve (temp_buffer.get_size () + res);
+        temp_buffer.push (buffer, res);
     }
-    if ((int)temp_buffer.size () < length)
+    if (temp_buffer.get_size () < length)
     {
         return 0;
     }
-    for (int i = 0; i < length; i++)
-    {
-        buffer[i] = temp_buffer.front ();
-        temp_buffer.pop ();
-    }
-    return length;
+    return temp_buffer.pop (buffer, length);
 }
 
 int SocketBluetooth::send (const char *buffer, int length)
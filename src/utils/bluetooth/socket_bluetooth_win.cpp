@@ -103,22 +103,18 @@ int SocketBluetooth::recv (char *data, int size)
         if (FD_ISSET (socket_bt, &set))
         {
             int res = ::recv (socket_bt, data, size, 0);
-            for (int i = 0; i < res; i++)
+            if (res > 0)
             {
-                temp_buffer.push (data[i]);
+                temp_buffer.reserve (temp_buffer.get_size () + res);
+                temp_buffer.push (data, res);
             }
         }
     }
-    if ((int)temp_buffer.size () < size)
+    if (temp_buffer.get_size () < size)
     {
         return 0;
     }
-    for (int i = 0; i < size; i++)
-    {
-        data[i] = temp_buffer.front ();
-        temp_buffer.pop ();
-    }
-    return size;
+    return temp_buffer.pop (data, size);
 }
 
 int SocketBluetooth::close ()
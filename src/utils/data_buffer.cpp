@@ -1,12 +1,45 @@
 #include "data_buffer.h"
 
+#include <algorithm>
 #include <new>
+#include <thread>
+#include <vector>
 
-DataBuffer::DataBuffer (int num_samples, size_t buffer_size)
+#define TRANSPOSE_BLOCK_SIZE 8
+
+
+// dst[c * dst_stride + r] = src[r * src_stride + c], processed in small tiles to keep both reads
+// and writes within a few cache lines
+static void transpose_blocked (const double *src, size_t src_stride, double *dst,
+    size_t dst_stride, size_t rows, size_t cols)
+{
+    for (size_t row_block = 0; row_block < rows; row_block += TRANSPOSE_BLOCK_SIZE)
+    {
+        size_t row_end = std::min (row_block + TRANSPOSE_BLOCK_SIZE, rows);
+        for (size_t col_block = 0; col_block < cols; col_block += TRANSPOSE_BLOCK_SIZE)
+        {
+            size_t col_end = std::min (col_block + TRANSPOSE_BLOCK_SIZE, cols);
+            for (size_t c = col_block; c < col_end; c++)
+            {
+                for (size_t r = row_block; r < row_end; r++)
+                {
+                    dst[c * dst_stride + r] = src[r * src_stride + c];
+                }
+            }
+        }
+    }
+}
+
+DataBuffer::DataBuffer (int num_samples, size_t buffer_size, bool channel_major)
 {
     this->buffer_size = buffer_size;
     this->num_samples = num_samples;
-    first_free = first_used = count = 0;
+    this->channel_major = channel_major;
+    claim_pos = 0;
+    write_pos = 0;
+    read_pos = 0;
+    pin_pos = NO_PIN;
+    num_dropped = 0;
 
     if (buffer_size == 0)
     {
@@ -35,6 +68,11 @@ bool DataBuffer::is_ready ()
     return (data != NULL);
 }
 
+bool DataBuffer::is_channel_major ()
+{
+    return channel_major;
+}
+
 void DataBuffer::add_data (double *value)
 {
     if (!is_ready ())
@@ -42,80 +80,404 @@ void DataBuffer::add_data (double *value)
         return;
     }
 
-    lock.lock ();
+    producer_lock.lock ();
 
-    if (count == 0)
+    uint64_t pos = write_pos.load (std::memory_order_relaxed);
+    // readers check claim_pos after copying to find out if they raced with this write, seq_cst
+    // pairs with acquire_view: either the view sees this claim or we see its pin
+    claim_pos.store (pos + 1, std::memory_order_seq_cst);
+    uint64_t pinned = pin_pos.load (std::memory_order_seq_cst);
+    if ((pinned != NO_PIN) && (pos >= pinned + buffer_size))
     {
-        first_used = first_free = 0;
+        claim_pos.store (pos, std::memory_order_relaxed);
+        num_dropped.fetch_add (1, std::memory_order_relaxed);
+        producer_lock.unlock ();
+        return;
     }
-    else if (first_free == first_used)
+    std::atomic_thread_fence (std::memory_order_release);
+    size_t idx = (size_t)(pos % buffer_size);
+    if (channel_major)
+    {
+        for (size_t i = 0; i < num_samples; i++)
+        {
+            data[i * buffer_size + idx] = value[i];
+        }
+    }
+    else
     {
-        first_used = next (first_used);
-        count--;
+        memcpy (this->data + idx * num_samples, value, sizeof (double) * num_samples);
     }
+    write_pos.store (pos + 1, std::memory_order_release);
 
-    memcpy (this->data + first_free * num_samples, value, sizeof (double) * num_samples);
-    first_free = next (first_free);
-    count++;
+    producer_lock.unlock ();
+}
 
-    lock.unlock ();
+void DataBuffer::add_data (const double *values, size_t count)
+{
+    if ((!is_ready ()) || (count == 0))
+    {
+        return;
+    }
+
+    producer_lock.lock ();
+
+    uint64_t pos = write_pos.load (std::memory_order_relaxed);
+    // same protocol as for a single sample, the whole block is claimed at once
+    claim_pos.store (pos + count, std::memory_order_seq_cst);
+    uint64_t pinned = pin_pos.load (std::memory_order_seq_cst);
+    size_t accepted = count;
+    if (pinned != NO_PIN)
+    {
+        uint64_t limit = pinned + buffer_size;
+        accepted = (pos >= limit) ? 0 : (size_t)std::min ((uint64_t)count, limit - pos);
+        if (accepted != count)
+        {
+            claim_pos.store (pos + accepted, std::memory_order_relaxed);
+            num_dropped.fetch_add (count - accepted, std::memory_order_relaxed);
+        }
+    }
+    std::atomic_thread_fence (std::memory_order_release);
+    uint64_t cur = pos;
+    size_t remaining = accepted;
+    const double *src = values;
+    while (remaining > 0)
+    {
+        size_t idx = (size_t)(cur % buffer_size);
+        size_t chunk = std::min (remaining, buffer_size - idx);
+        if (channel_major)
+        {
+            transpose_blocked (src, num_samples, data + idx, buffer_size, chunk, num_samples);
+        }
+        else
+        {
+            memcpy (data + idx * num_samples, src, sizeof (double) * num_samples * chunk);
+        }
+        src += chunk * num_samples;
+        cur += chunk;
+        remaining -= chunk;
+    }
+    write_pos.store (pos + accepted, std::memory_order_release);
+
+    producer_lock.unlock ();
 }
 
-void DataBuffer::get_chunk (size_t start, size_t size, double *data_buf)
+void DataBuffer::get_chunk (
+    uint64_t start, size_t size, double *data_buf, bool channel_major_output)
 {
-    if (start + size < buffer_size)
+    size_t start_idx = (size_t)(start % buffer_size);
+    size_t first_half = std::min (size, buffer_size - start_idx);
+    size_t second_half = size - first_half;
+
+    if (channel_major && channel_major_output)
     {
-        memcpy (data_buf, data + start * num_samples, size * sizeof (double) * num_samples);
+        for (size_t i = 0; i < num_samples; i++)
+        {
+            const double *channel = data + i * buffer_size;
+            memcpy (data_buf + i * size, channel + start_idx, first_half * sizeof (double));
+            if (second_half)
+            {
+                memcpy (data_buf + i * size + first_half, channel, second_half * sizeof (double));
+            }
+        }
+    }
+    else if (channel_major)
+    {
+        transpose_blocked (
+            data + start_idx, buffer_size, data_buf, num_samples, num_samples, first_half);
+        transpose_blocked (data, buffer_size, data_buf + first_half * num_samples, num_samples,
+            num_samples, second_half);
+    }
+    else if (channel_major_output)
+    {
+        transpose_blocked (
+            data + start_idx * num_samples, num_samples, data_buf, size, first_half, num_samples);
+        transpose_blocked (
+            data, num_samples, data_buf + first_half, size, second_half, num_samples);
     }
     else
     {
-        size_t first_half = buffer_size - start;
-        size_t second_half = size - first_half;
-        memcpy (data_buf, data + start * num_samples, first_half * sizeof (double) * num_samples);
         memcpy (
-            data_buf + first_half * num_samples, data, second_half * sizeof (double) * num_samples);
+            data_buf, data + start_idx * num_samples, first_half * sizeof (double) * num_samples);
+        if (second_half)
+        {
+            memcpy (data_buf + first_half * num_samples, data,
+                second_half * sizeof (double) * num_samples);
+        }
+    }
+}
+
+size_t DataBuffer::copy_validated (
+    uint64_t start, size_t size, double *data_buf, bool channel_major_output)
+{
+    get_chunk (start, size, data_buf, channel_major_output);
+    std::atomic_thread_fence (std::memory_order_acquire);
+    uint64_t claimed = claim_pos.load (std::memory_order_relaxed);
+    if (claimed <= start + buffer_size)
+    {
+        return size;
+    }
+    // producer wrapped around and overwrote the oldest samples while we were copying them
+    uint64_t overwritten = claimed - start - buffer_size;
+    if (overwritten >= size)
+    {
+        return 0;
+    }
+    size_t valid = size - (size_t)overwritten;
+    if (channel_major_output)
+    {
+        // rows are shrunk in place, destination never goes ahead of the source
+        for (size_t i = 0; i < num_samples; i++)
+        {
+            memmove (data_buf + i * valid, data_buf + i * size + (size_t)overwritten,
+                valid * sizeof (double));
+        }
+    }
+    else
+    {
+        memmove (data_buf, data_buf + (size_t)overwritten * num_samples,
+            valid * sizeof (double) * num_samples);
+    }
+    return valid;
+}
+
+size_t DataBuffer::remove_validated (
+    size_t max_count, double *data_buf, bool channel_major_output, size_t *removed_count)
+{
+    *removed_count = 0;
+    while (true)
+    {
+        // read_pos should be loaded first to guarantee that it is not ahead of write_pos
+        uint64_t first_used = read_pos.load (std::memory_order_acquire);
+        uint64_t first_free = write_pos.load (std::memory_order_acquire);
+        uint64_t start = first_used;
+        if (first_free - start > buffer_size)
+        {
+            start = first_free - buffer_size;
+        }
+        size_t result_count = max_count;
+        if (result_count > first_free - start)
+        {
+            result_count = (size_t)(first_free - start);
+        }
+        if (result_count == 0)
+        {
+            return 0;
+        }
+        size_t valid = copy_validated (start, result_count, data_buf, channel_major_output);
+        if (valid == 0)
+        {
+            continue;
+        }
+        // another consumer may have removed the same samples, try again in this case
+        if (read_pos.compare_exchange_weak (first_used, start + result_count,
+                std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            *removed_count = result_count;
+            return valid;
+        }
     }
 }
 
 // Removes data from buffer
-size_t DataBuffer::get_data (size_t max_count, double *data_buf)
+size_t DataBuffer::get_data (size_t max_count, double *data_buf, bool channel_major_output)
 {
-    lock.lock ();
-    size_t result_count = max_count;
-    if (result_count > count)
+    if ((!is_ready ()) || (max_count == 0))
     {
-        result_count = count;
+        return 0;
+    }
+
+    size_t expected_count = 0;
+    size_t count = remove_validated (max_count, data_buf, channel_major_output, &expected_count);
+    if (count == expected_count)
+    {
+        return count;
+    }
+
+    // producer lapped the copy, overwritten samples are lost anyway. Callers size their output by
+    // the number of available samples, fill it up with the next ones to keep the row stride
+    if (channel_major_output)
+    {
+        // last row first, rows only move forward
+        for (size_t i = num_samples; i > 1; i--)
+        {
+            memmove (data_buf + (i - 1) * expected_count, data_buf + (i - 1) * count,
+                count * sizeof (double));
+        }
+    }
+    std::vector<double> tail;
+    while (count < expected_count)
+    {
+        size_t remaining = expected_count - count;
+        double *dst = data_buf + count * num_samples;
+        if (channel_major_output)
+        {
+            tail.resize (remaining * num_samples);
+            dst = tail.data ();
+        }
+        size_t removed = 0;
+        size_t num_copied = remove_validated (remaining, dst, channel_major_output, &removed);
+        if (num_copied == 0)
+        {
+            // next samples are claimed but not written yet
+            if (claim_pos.load (std::memory_order_acquire) !=
+                write_pos.load (std::memory_order_acquire))
+            {
+                std::this_thread::yield ();
+                continue;
+            }
+            break;
+        }
+        if (channel_major_output)
+        {
+            for (size_t i = 0; i < num_samples; i++)
+            {
+                memcpy (data_buf + i * expected_count + count, dst + i * num_copied,
+                    num_copied * sizeof (double));
+            }
+        }
+        count += num_copied;
     }
-    if (result_count)
+    // only possible if another consumer removed the rest, shrink rows back
+    if ((count < expected_count) && (channel_major_output))
     {
-        get_chunk (first_used, result_count, data_buf);
-        first_used = (first_used + result_count) % buffer_size;
-        count -= result_count;
+        for (size_t i = 1; i < num_samples; i++)
+        {
+            memmove (data_buf + i * count, data_buf + i * expected_count, count * sizeof (double));
+        }
     }
-    lock.unlock ();
-    return result_count;
+    return count;
 }
 
 // Doesn't remove data from buffer
-size_t DataBuffer::get_current_data (size_t max_count, double *data_buf)
+size_t DataBuffer::get_current_data (
+    size_t max_count, double *data_buf, bool channel_major_output)
 {
-    lock.lock ();
-    size_t result_count = max_count;
-    if (result_count > count)
-        result_count = count;
-    if (result_count)
+    if ((!is_ready ()) || (max_count == 0))
+    {
+        return 0;
+    }
+
+    while (true)
     {
-        size_t first_return = (first_used + (count - result_count)) % buffer_size;
-        get_chunk (first_return, result_count, data_buf);
+        uint64_t first_used = read_pos.load (std::memory_order_acquire);
+        uint64_t first_free = write_pos.load (std::memory_order_acquire);
+        uint64_t count = first_free - first_used;
+        if (count > buffer_size)
+        {
+            count = buffer_size;
+        }
+        size_t result_count = max_count;
+        if (result_count > count)
+        {
+            result_count = (size_t)count;
+        }
+        if (result_count == 0)
+        {
+            return 0;
+        }
+        size_t valid = copy_validated (
+            first_free - result_count, result_count, data_buf, channel_major_output);
+        if (valid != 0)
+        {
+            return valid;
+        }
     }
-    lock.unlock ();
-    return result_count;
 }
 
 size_t DataBuffer::get_data_count ()
 {
-    lock.lock ();
-    size_t result = this->count;
-    lock.unlock ();
-    return result;
+    uint64_t first_used = read_pos.load (std::memory_order_acquire);
+    uint64_t first_free = write_pos.load (std::memory_order_acquire);
+    uint64_t count = first_free - first_used;
+    if (count > buffer_size)
+    {
+        count = buffer_size;
+    }
+    return (size_t)count;
+}
+
+size_t DataBuffer::acquire_view (size_t max_count, double **first_span, size_t *first_span_len,
+    double **second_span, size_t *second_span_len, size_t *channel_stride, size_t *sample_stride)
+{
+    if ((!is_ready ()) || (max_count == 0) || (has_view ()))
+    {
+        return 0;
+    }
+
+    while (true)
+    {
+        uint64_t first_used = read_pos.load (std::memory_order_acquire);
+        uint64_t first_free = write_pos.load (std::memory_order_acquire);
+        uint64_t start = first_used;
+        if (first_free - start > buffer_size)
+        {
+            start = first_free - buffer_size;
+        }
+        uint64_t count = first_free - start;
+        if (count > max_count)
+        {
+            count = max_count;
+        }
+        if (count == 0)
+        {
+            return 0;
+        }
+        pin_pos.store (start, std::memory_order_seq_cst);
+        // producer may have claimed slots of the oldest samples before it saw the pin, skip them.
+        // Moving the pin forward is safe since everything up to claimed is already written
+        uint64_t claimed = claim_pos.load (std::memory_order_seq_cst);
+        if (claimed > start + buffer_size)
+        {
+            uint64_t overwritten = claimed - start - buffer_size;
+            if (overwritten >= count)
+            {
+                pin_pos.store (NO_PIN, std::memory_order_release);
+                continue;
+            }
+            start += overwritten;
+            count -= overwritten;
+            pin_pos.store (start, std::memory_order_seq_cst);
+        }
+        // another consumer may have removed the same samples, try again in this case
+        if (!read_pos.compare_exchange_strong (first_used, start + count,
+                std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            pin_pos.store (NO_PIN, std::memory_order_release);
+            continue;
+        }
+
+        size_t start_idx = (size_t)(start % buffer_size);
+        size_t first_half = std::min ((size_t)count, buffer_size - start_idx);
+        *first_span_len = first_half;
+        *second_span_len = (size_t)count - first_half;
+        *second_span = data;
+        if (channel_major)
+        {
+            *first_span = data + start_idx;
+            *channel_stride = buffer_size;
+            *sample_stride = 1;
+        }
+        else
+        {
+            *first_span = data + start_idx * num_samples;
+            *channel_stride = 1;
+            *sample_stride = num_samples;
+        }
+        return (size_t)count;
+    }
+}
+
+void DataBuffer::release_view ()
+{
+    pin_pos.store (NO_PIN, std::memory_order_release);
+}
+
+bool DataBuffer::has_view ()
+{
+    return (pin_pos.load (std::memory_order_acquire) != NO_PIN);
+}
+
+uint64_t DataBuffer::reset_num_dropped ()
+{
+    return num_dropped.exchange (0, std::memory_order_relaxed);
 }
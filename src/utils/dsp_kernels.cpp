@@ -0,0 +1,789 @@
+#include <math.h>
+
+#include "dsp_kernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DSP_KERNELS_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+// msvc allows intrinsics for any instruction set without extra flags
+#define DSP_TARGET_AVX2
+#define DSP_TARGET_AVX512
+#else
+#define DSP_TARGET_AVX2 __attribute__ ((target ("avx2,fma")))
+#define DSP_TARGET_AVX512 __attribute__ ((target ("avx512f,avx2,fma")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define DSP_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+
+////////////////////////////////
+/////////// Scalar /////////////
+////////////////////////////////
+
+static double scalar_sum (const double *data, int len)
+{
+    double res = 0.0;
+    for (int i = 0; i < len; i++)
+    {
+        res += data[i];
+    }
+    return res;
+}
+
+static double scalar_index_weighted_sum (const double *data, int len)
+{
+    double res = 0.0;
+    for (int i = 0; i < len; i++)
+    {
+        res += (double)i * data[i];
+    }
+    return res;
+}
+
+static double scalar_squared_deviation_sum (const double *data, int len, double mean)
+{
+    double res = 0.0;
+    for (int i = 0; i < len; i++)
+    {
+        res += (data[i] - mean) * (data[i] - mean);
+    }
+    return res;
+}
+
+static double scalar_abs_max (const double *data, int len)
+{
+    double res = 0.0;
+    for (int i = 0; i < len; i++)
+    {
+        if (fabs (data[i]) > res)
+        {
+            res = fabs (data[i]);
+        }
+    }
+    return res;
+}
+
+static bool scalar_has_steps (const double *data, int len, double eps)
+{
+    for (int i = 1; i < len; i++)
+    {
+        if ((fabs (data[i - 1] - data[i]) > eps) && (fabs (data[i]) > eps))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void scalar_subtract_line (double *data, int len, double slope, double intercept)
+{
+    for (int i = 0; i < len; i++)
+    {
+        data[i] -= slope * (double)i + intercept;
+    }
+}
+
+static void scalar_scale (double *data, int len, double factor)
+{
+    for (int i = 0; i < len; i++)
+    {
+        data[i] *= factor;
+    }
+}
+
+static void scalar_multiply (const double *data, const double *window, double *output, int len)
+{
+    for (int i = 0; i < len; i++)
+    {
+        output[i] = data[i] * window[i];
+    }
+}
+
+static void scalar_accumulate_power (
+    const double *complex_data, int len, double factor, double *output)
+{
+    for (int i = 0; i < len; i++)
+    {
+        double re = complex_data[2 * i];
+        double im = complex_data[2 * i + 1];
+        output[i] += factor * (re * re + im * im);
+    }
+}
+
+static const DspKernels scalar_kernels = {"scalar", scalar_sum, scalar_index_weighted_sum,
+    scalar_squared_deviation_sum, scalar_abs_max, scalar_has_steps, scalar_subtract_line,
+    scalar_scale, scalar_multiply, scalar_accumulate_power};
+
+
+#ifdef DSP_KERNELS_X86
+
+////////////////////////////////
+//////////// AVX2 //////////////
+////////////////////////////////
+
+DSP_TARGET_AVX2 static double avx2_reduce_add (__m256d v)
+{
+    __m128d res = _mm_add_pd (_mm256_castpd256_pd128 (v), _mm256_extractf128_pd (v, 1));
+    res = _mm_add_sd (res, _mm_unpackhi_pd (res, res));
+    return _mm_cvtsd_f64 (res);
+}
+
+DSP_TARGET_AVX2 static double avx2_sum (const double *data, int len)
+{
+    // two accumulators hide latency of add
+    __m256d acc0 = _mm256_setzero_pd ();
+    __m256d acc1 = _mm256_setzero_pd ();
+    int i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        acc0 = _mm256_add_pd (acc0, _mm256_loadu_pd (data + i));
+        acc1 = _mm256_add_pd (acc1, _mm256_loadu_pd (data + i + 4));
+    }
+    double res = avx2_reduce_add (_mm256_add_pd (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += data[i];
+    }
+    return res;
+}
+
+DSP_TARGET_AVX2 static double avx2_index_weighted_sum (const double *data, int len)
+{
+    __m256d acc0 = _mm256_setzero_pd ();
+    __m256d acc1 = _mm256_setzero_pd ();
+    __m256d idx0 = _mm256_set_pd (3.0, 2.0, 1.0, 0.0);
+    __m256d idx1 = _mm256_set_pd (7.0, 6.0, 5.0, 4.0);
+    const __m256d step = _mm256_set1_pd (8.0);
+    int i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        acc0 = _mm256_fmadd_pd (idx0, _mm256_loadu_pd (data + i), acc0);
+        acc1 = _mm256_fmadd_pd (idx1, _mm256_loadu_pd (data + i + 4), acc1);
+        idx0 = _mm256_add_pd (idx0, step);
+        idx1 = _mm256_add_pd (idx1, step);
+    }
+    double res = avx2_reduce_add (_mm256_add_pd (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += (double)i * data[i];
+    }
+    return res;
+}
+
+DSP_TARGET_AVX2 static double avx2_squared_deviation_sum (const double *data, int len, double mean)
+{
+    __m256d acc0 = _mm256_setzero_pd ();
+    __m256d acc1 = _mm256_setzero_pd ();
+    const __m256d m = _mm256_set1_pd (mean);
+    int i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        __m256d d0 = _mm256_sub_pd (_mm256_loadu_pd (data + i), m);
+        __m256d d1 = _mm256_sub_pd (_mm256_loadu_pd (data + i + 4), m);
+        acc0 = _mm256_fmadd_pd (d0, d0, acc0);
+        acc1 = _mm256_fmadd_pd (d1, d1, acc1);
+    }
+    double res = avx2_reduce_add (_mm256_add_pd (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += (data[i] - mean) * (data[i] - mean);
+    }
+    return res;
+}
+
+DSP_TARGET_AVX2 static double avx2_abs_max (const double *data, int len)
+{
+    const __m256d sign_mask = _mm256_set1_pd (-0.0);
+    __m256d acc = _mm256_setzero_pd ();
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        acc = _mm256_max_pd (acc, _mm256_andnot_pd (sign_mask, _mm256_loadu_pd (data + i)));
+    }
+    __m128d res = _mm_max_pd (_mm256_castpd256_pd128 (acc), _mm256_extractf128_pd (acc, 1));
+    res = _mm_max_sd (res, _mm_unpackhi_pd (res, res));
+    double max_val = _mm_cvtsd_f64 (res);
+    for (; i < len; i++)
+    {
+        if (fabs (data[i]) > max_val)
+        {
+            max_val = fabs (data[i]);
+        }
+    }
+    return max_val;
+}
+
+DSP_TARGET_AVX2 static bool avx2_has_steps (const double *data, int len, double eps)
+{
+    const __m256d sign_mask = _mm256_set1_pd (-0.0);
+    const __m256d e = _mm256_set1_pd (eps);
+    int i = 1;
+    for (; i + 4 <= len; i += 4)
+    {
+        __m256d cur = _mm256_loadu_pd (data + i);
+        __m256d prev = _mm256_loadu_pd (data + i - 1);
+        __m256d diff = _mm256_andnot_pd (sign_mask, _mm256_sub_pd (prev, cur));
+        __m256d mask = _mm256_and_pd (_mm256_cmp_pd (diff, e, _CMP_GT_OQ),
+            _mm256_cmp_pd (_mm256_andnot_pd (sign_mask, cur), e, _CMP_GT_OQ));
+        if (_mm256_movemask_pd (mask) != 0)
+        {
+            return true;
+        }
+    }
+    for (; i < len; i++)
+    {
+        if ((fabs (data[i - 1] - data[i]) > eps) && (fabs (data[i]) > eps))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+DSP_TARGET_AVX2 static void avx2_subtract_line (
+    double *data, int len, double slope, double intercept)
+{
+    const __m256d s = _mm256_set1_pd (slope);
+    const __m256d b = _mm256_set1_pd (intercept);
+    const __m256d step = _mm256_set1_pd (4.0);
+    __m256d idx = _mm256_set_pd (3.0, 2.0, 1.0, 0.0);
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        // no fma here to keep the same rounding as the scalar version
+        __m256d line = _mm256_add_pd (_mm256_mul_pd (s, idx), b);
+        _mm256_storeu_pd (data + i, _mm256_sub_pd (_mm256_loadu_pd (data + i), line));
+        idx = _mm256_add_pd (idx, step);
+    }
+    for (; i < len; i++)
+    {
+        data[i] -= slope * (double)i + intercept;
+    }
+}
+
+DSP_TARGET_AVX2 static void avx2_scale (double *data, int len, double factor)
+{
+    const __m256d f = _mm256_set1_pd (factor);
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        _mm256_storeu_pd (data + i, _mm256_mul_pd (_mm256_loadu_pd (data + i), f));
+    }
+    for (; i < len; i++)
+    {
+        data[i] *= factor;
+    }
+}
+
+DSP_TARGET_AVX2 static void avx2_multiply (
+    const double *data, const double *window, double *output, int len)
+{
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        _mm256_storeu_pd (
+            output + i, _mm256_mul_pd (_mm256_loadu_pd (data + i), _mm256_loadu_pd (window + i)));
+    }
+    for (; i < len; i++)
+    {
+        output[i] = data[i] * window[i];
+    }
+}
+
+DSP_TARGET_AVX2 static void avx2_accumulate_power (
+    const double *complex_data, int len, double factor, double *output)
+{
+    const __m256d f = _mm256_set1_pd (factor);
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        __m256d c0 = _mm256_loadu_pd (complex_data + 2 * i);     // r0 i0 r1 i1
+        __m256d c1 = _mm256_loadu_pd (complex_data + 2 * i + 4); // r2 i2 r3 i3
+        // hadd gives r0^2+i0^2, r2^2+i2^2, r1^2+i1^2, r3^2+i3^2
+        __m256d power = _mm256_hadd_pd (_mm256_mul_pd (c0, c0), _mm256_mul_pd (c1, c1));
+        power = _mm256_permute4x64_pd (power, _MM_SHUFFLE (3, 1, 2, 0));
+        _mm256_storeu_pd (output + i, _mm256_add_pd (_mm256_loadu_pd (output + i),
+                                          _mm256_mul_pd (f, power)));
+    }
+    for (; i < len; i++)
+    {
+        double re = complex_data[2 * i];
+        double im = complex_data[2 * i + 1];
+        output[i] += factor * (re * re + im * im);
+    }
+}
+
+static const DspKernels avx2_kernels = {"avx2", avx2_sum, avx2_index_weighted_sum,
+    avx2_squared_deviation_sum, avx2_abs_max, avx2_has_steps, avx2_subtract_line, avx2_scale,
+    avx2_multiply, avx2_accumulate_power};
+
+
+////////////////////////////////
+/////////// AVX-512 ////////////
+////////////////////////////////
+
+DSP_TARGET_AVX512 static double avx512_sum (const double *data, int len)
+{
+    __m512d acc0 = _mm512_setzero_pd ();
+    __m512d acc1 = _mm512_setzero_pd ();
+    int i = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        acc0 = _mm512_add_pd (acc0, _mm512_loadu_pd (data + i));
+        acc1 = _mm512_add_pd (acc1, _mm512_loadu_pd (data + i + 8));
+    }
+    double res = _mm512_reduce_add_pd (_mm512_add_pd (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += data[i];
+    }
+    return res;
+}
+
+DSP_TARGET_AVX512 static double avx512_index_weighted_sum (const double *data, int len)
+{
+    __m512d acc0 = _mm512_setzero_pd ();
+    __m512d acc1 = _mm512_setzero_pd ();
+    __m512d idx0 = _mm512_set_pd (7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+    __m512d idx1 = _mm512_set_pd (15.0, 14.0, 13.0, 12.0, 11.0, 10.0, 9.0, 8.0);
+    const __m512d step = _mm512_set1_pd (16.0);
+    int i = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        acc0 = _mm512_fmadd_pd (idx0, _mm512_loadu_pd (data + i), acc0);
+        acc1 = _mm512_fmadd_pd (idx1, _mm512_loadu_pd (data + i + 8), acc1);
+        idx0 = _mm512_add_pd (idx0, step);
+        idx1 = _mm512_add_pd (idx1, step);
+    }
+    double res = _mm512_reduce_add_pd (_mm512_add_pd (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += (double)i * data[i];
+    }
+    return res;
+}
+
+DSP_TARGET_AVX512 static double avx512_squared_deviation_sum (
+    const double *data, int len, double mean)
+{
+    __m512d acc0 = _mm512_setzero_pd ();
+    __m512d acc1 = _mm512_setzero_pd ();
+    const __m512d m = _mm512_set1_pd (mean);
+    int i = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        __m512d d0 = _mm512_sub_pd (_mm512_loadu_pd (data + i), m);
+        __m512d d1 = _mm512_sub_pd (_mm512_loadu_pd (data + i + 8), m);
+        acc0 = _mm512_fmadd_pd (d0, d0, acc0);
+        acc1 = _mm512_fmadd_pd (d1, d1, acc1);
+    }
+    double res = _mm512_reduce_add_pd (_mm512_add_pd (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += (data[i] - mean) * (data[i] - mean);
+    }
+    return res;
+}
+
+DSP_TARGET_AVX512 static double avx512_abs_max (const double *data, int len)
+{
+    __m512d acc = _mm512_setzero_pd ();
+    int i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        acc = _mm512_max_pd (acc, _mm512_abs_pd (_mm512_loadu_pd (data + i)));
+    }
+    double max_val = _mm512_reduce_max_pd (acc);
+    for (; i < len; i++)
+    {
+        if (fabs (data[i]) > max_val)
+        {
+            max_val = fabs (data[i]);
+        }
+    }
+    return max_val;
+}
+
+DSP_TARGET_AVX512 static bool avx512_has_steps (const double *data, int len, double eps)
+{
+    const __m512d e = _mm512_set1_pd (eps);
+    int i = 1;
+    for (; i + 8 <= len; i += 8)
+    {
+        __m512d cur = _mm512_loadu_pd (data + i);
+        __m512d diff = _mm512_abs_pd (_mm512_sub_pd (_mm512_loadu_pd (data + i - 1), cur));
+        __mmask8 mask = _mm512_cmp_pd_mask (diff, e, _CMP_GT_OQ) &
+            _mm512_cmp_pd_mask (_mm512_abs_pd (cur), e, _CMP_GT_OQ);
+        if (mask != 0)
+        {
+            return true;
+        }
+    }
+    for (; i < len; i++)
+    {
+        if ((fabs (data[i - 1] - data[i]) > eps) && (fabs (data[i]) > eps))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+DSP_TARGET_AVX512 static void avx512_subtract_line (
+    double *data, int len, double slope, double intercept)
+{
+    const __m512d s = _mm512_set1_pd (slope);
+    const __m512d b = _mm512_set1_pd (intercept);
+    const __m512d step = _mm512_set1_pd (8.0);
+    __m512d idx = _mm512_set_pd (7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+    int i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        __m512d line = _mm512_add_pd (_mm512_mul_pd (s, idx), b);
+        _mm512_storeu_pd (data + i, _mm512_sub_pd (_mm512_loadu_pd (data + i), line));
+        idx = _mm512_add_pd (idx, step);
+    }
+    for (; i < len; i++)
+    {
+        data[i] -= slope * (double)i + intercept;
+    }
+}
+
+DSP_TARGET_AVX512 static void avx512_scale (double *data, int len, double factor)
+{
+    const __m512d f = _mm512_set1_pd (factor);
+    int i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        _mm512_storeu_pd (data + i, _mm512_mul_pd (_mm512_loadu_pd (data + i), f));
+    }
+    for (; i < len; i++)
+    {
+        data[i] *= factor;
+    }
+}
+
+DSP_TARGET_AVX512 static void avx512_multiply (
+    const double *data, const double *window, double *output, int len)
+{
+    int i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        _mm512_storeu_pd (
+            output + i, _mm512_mul_pd (_mm512_loadu_pd (data + i), _mm512_loadu_pd (window + i)));
+    }
+    for (; i < len; i++)
+    {
+        output[i] = data[i] * window[i];
+    }
+}
+
+DSP_TARGET_AVX512 static void avx512_accumulate_power (
+    const double *complex_data, int len, double factor, double *output)
+{
+    const __m512d f = _mm512_set1_pd (factor);
+    // even lanes of both inputs are real parts, odd lanes are imaginary parts
+    const __m512i re_idx = _mm512_set_epi64 (14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i im_idx = _mm512_set_epi64 (15, 13, 11, 9, 7, 5, 3, 1);
+    int i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        __m512d c0 = _mm512_loadu_pd (complex_data + 2 * i);
+        __m512d c1 = _mm512_loadu_pd (complex_data + 2 * i + 8);
+        __m512d re = _mm512_permutex2var_pd (c0, re_idx, c1);
+        __m512d im = _mm512_permutex2var_pd (c0, im_idx, c1);
+        __m512d power = _mm512_add_pd (_mm512_mul_pd (re, re), _mm512_mul_pd (im, im));
+        _mm512_storeu_pd (output + i, _mm512_add_pd (_mm512_loadu_pd (output + i),
+                                          _mm512_mul_pd (f, power)));
+    }
+    for (; i < len; i++)
+    {
+        double re = complex_data[2 * i];
+        double im = complex_data[2 * i + 1];
+        output[i] += factor * (re * re + im * im);
+    }
+}
+
+static const DspKernels avx512_kernels = {"avx512", avx512_sum, avx512_index_weighted_sum,
+    avx512_squared_deviation_sum, avx512_abs_max, avx512_has_steps, avx512_subtract_line,
+    avx512_scale, avx512_multiply, avx512_accumulate_power};
+
+
+////////////////////////////////
+////////// Dispatch ////////////
+////////////////////////////////
+
+#if defined(_MSC_VER) && !defined(__clang__)
+// checks cpuid bit in leaf 7 and that os saves registers from xcr0_mask
+static bool cpu_supports (int leaf7_ebx_bit, unsigned long long xcr0_mask)
+{
+    int info[4];
+    __cpuid (info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+    __cpuid (info, 1);
+    bool has_osxsave = ((info[2] & (1 << 27)) != 0);
+    bool has_avx = ((info[2] & (1 << 28)) != 0);
+    bool has_fma = ((info[2] & (1 << 12)) != 0);
+    if ((!has_osxsave) || (!has_avx) || (!has_fma))
+    {
+        return false;
+    }
+    if ((_xgetbv (0) & xcr0_mask) != xcr0_mask)
+    {
+        return false;
+    }
+    __cpuidex (info, 7, 0);
+    return ((info[1] & (1 << leaf7_ebx_bit)) != 0);
+}
+
+static bool cpu_supports_avx2 ()
+{
+    // xmm and ymm state
+    return cpu_supports (5, 0x6);
+}
+
+static bool cpu_supports_avx512 ()
+{
+    // xmm, ymm, opmask and zmm state
+    return cpu_supports (16, 0xE6) && cpu_supports_avx2 ();
+}
+#else
+static bool cpu_supports_avx2 ()
+{
+    __builtin_cpu_init ();
+    return __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma");
+}
+
+static bool cpu_supports_avx512 ()
+{
+    __builtin_cpu_init ();
+    return __builtin_cpu_supports ("avx512f") && cpu_supports_avx2 ();
+}
+#endif
+
+#endif // DSP_KERNELS_X86
+
+
+#ifdef DSP_KERNELS_NEON
+
+////////////////////////////////
+//////////// NEON //////////////
+////////////////////////////////
+
+static double neon_sum (const double *data, int len)
+{
+    float64x2_t acc0 = vdupq_n_f64 (0.0);
+    float64x2_t acc1 = vdupq_n_f64 (0.0);
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        acc0 = vaddq_f64 (acc0, vld1q_f64 (data + i));
+        acc1 = vaddq_f64 (acc1, vld1q_f64 (data + i + 2));
+    }
+    double res = vaddvq_f64 (vaddq_f64 (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += data[i];
+    }
+    return res;
+}
+
+static double neon_index_weighted_sum (const double *data, int len)
+{
+    const double first_idx[4] = {0.0, 1.0, 2.0, 3.0};
+    float64x2_t acc0 = vdupq_n_f64 (0.0);
+    float64x2_t acc1 = vdupq_n_f64 (0.0);
+    float64x2_t idx0 = vld1q_f64 (first_idx);
+    float64x2_t idx1 = vld1q_f64 (first_idx + 2);
+    const float64x2_t step = vdupq_n_f64 (4.0);
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        acc0 = vfmaq_f64 (acc0, idx0, vld1q_f64 (data + i));
+        acc1 = vfmaq_f64 (acc1, idx1, vld1q_f64 (data + i + 2));
+        idx0 = vaddq_f64 (idx0, step);
+        idx1 = vaddq_f64 (idx1, step);
+    }
+    double res = vaddvq_f64 (vaddq_f64 (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += (double)i * data[i];
+    }
+    return res;
+}
+
+static double neon_squared_deviation_sum (const double *data, int len, double mean)
+{
+    float64x2_t acc0 = vdupq_n_f64 (0.0);
+    float64x2_t acc1 = vdupq_n_f64 (0.0);
+    const float64x2_t m = vdupq_n_f64 (mean);
+    int i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        float64x2_t d0 = vsubq_f64 (vld1q_f64 (data + i), m);
+        float64x2_t d1 = vsubq_f64 (vld1q_f64 (data + i + 2), m);
+        acc0 = vfmaq_f64 (acc0, d0, d0);
+        acc1 = vfmaq_f64 (acc1, d1, d1);
+    }
+    double res = vaddvq_f64 (vaddq_f64 (acc0, acc1));
+    for (; i < len; i++)
+    {
+        res += (data[i] - mean) * (data[i] - mean);
+    }
+    return res;
+}
+
+static double neon_abs_max (const double *data, int len)
+{
+    float64x2_t acc = vdupq_n_f64 (0.0);
+    int i = 0;
+    for (; i + 2 <= len; i += 2)
+    {
+        acc = vmaxq_f64 (acc, vabsq_f64 (vld1q_f64 (data + i)));
+    }
+    double max_val = vmaxvq_f64 (acc);
+    for (; i < len; i++)
+    {
+        if (fabs (data[i]) > max_val)
+        {
+            max_val = fabs (data[i]);
+        }
+    }
+    return max_val;
+}
+
+static bool neon_has_steps (const double *data, int len, double eps)
+{
+    const float64x2_t e = vdupq_n_f64 (eps);
+    int i = 1;
+    for (; i + 2 <= len; i += 2)
+    {
+        float64x2_t cur = vld1q_f64 (data + i);
+        float64x2_t diff = vabdq_f64 (vld1q_f64 (data + i - 1), cur);
+        uint64x2_t mask = vandq_u64 (vcgtq_f64 (diff, e), vcgtq_f64 (vabsq_f64 (cur), e));
+        if ((vgetq_lane_u64 (mask, 0) | vgetq_lane_u64 (mask, 1)) != 0)
+        {
+            return true;
+        }
+    }
+    for (; i < len; i++)
+    {
+        if ((fabs (data[i - 1] - data[i]) > eps) && (fabs (data[i]) > eps))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void neon_subtract_line (double *data, int len, double slope, double intercept)
+{
+    const double first_idx[2] = {0.0, 1.0};
+    const float64x2_t b = vdupq_n_f64 (intercept);
+    const float64x2_t step = vdupq_n_f64 (2.0);
+    float64x2_t idx = vld1q_f64 (first_idx);
+    int i = 0;
+    for (; i + 2 <= len; i += 2)
+    {
+        float64x2_t line = vaddq_f64 (vmulq_n_f64 (idx, slope), b);
+        vst1q_f64 (data + i, vsubq_f64 (vld1q_f64 (data + i), line));
+        idx = vaddq_f64 (idx, step);
+    }
+    for (; i < len; i++)
+    {
+        data[i] -= slope * (double)i + intercept;
+    }
+}
+
+static void neon_scale (double *data, int len, double factor)
+{
+    int i = 0;
+    for (; i + 2 <= len; i += 2)
+    {
+        vst1q_f64 (data + i, vmulq_n_f64 (vld1q_f64 (data + i), factor));
+    }
+    for (; i < len; i++)
+    {
+        data[i] *= factor;
+    }
+}
+
+static void neon_multiply (const double *data, const double *window, double *output, int len)
+{
+    int i = 0;
+    for (; i + 2 <= len; i += 2)
+    {
+        vst1q_f64 (output + i, vmulq_f64 (vld1q_f64 (data + i), vld1q_f64 (window + i)));
+    }
+    for (; i < len; i++)
+    {
+        output[i] = data[i] * window[i];
+    }
+}
+
+static void neon_accumulate_power (
+    const double *complex_data, int len, double factor, double *output)
+{
+    int i = 0;
+    for (; i + 2 <= len; i += 2)
+    {
+        // deinterleaving load, val[0] has real parts and val[1] has imaginary parts
+        float64x2x2_t c = vld2q_f64 (complex_data + 2 * i);
+        float64x2_t power =
+            vaddq_f64 (vmulq_f64 (c.val[0], c.val[0]), vmulq_f64 (c.val[1], c.val[1]));
+        vst1q_f64 (output + i, vaddq_f64 (vld1q_f64 (output + i), vmulq_n_f64 (power, factor)));
+    }
+    for (; i < len; i++)
+    {
+        double re = complex_data[2 * i];
+        double im = complex_data[2 * i + 1];
+        output[i] += factor * (re * re + im * im);
+    }
+}
+
+static const DspKernels neon_kernels = {"neon", neon_sum, neon_index_weighted_sum,
+    neon_squared_deviation_sum, neon_abs_max, neon_has_steps, neon_subtract_line, neon_scale,
+    neon_multiply, neon_accumulate_power};
+
+#endif // DSP_KERNELS_NEON
+
+
+std::vector<const DspKernels *> get_available_dsp_kernels ()
+{
+    std::vector<const DspKernels *> res;
+    res.push_back (&scalar_kernels);
+#ifdef DSP_KERNELS_X86
+    if (cpu_supports_avx2 ())
+    {
+        res.push_back (&avx2_kernels);
+    }
+    if (cpu_supports_avx512 ())
+    {
+        res.push_back (&avx512_kernels);
+    }
+#endif
+#ifdef DSP_KERNELS_NEON
+    // neon is mandatory for aarch64
+    res.push_back (&neon_kernels);
+#endif
+    return res;
+}
+
+const DspKernels &get_dsp_kernels ()
+{
+    // best table goes last, static init is thread safe
+    static const DspKernels *kernels = get_available_dsp_kernels ().back ();
+    return *kernels;
+}
+
+const DspKernels &get_scalar_dsp_kernels ()
+{
+    return scalar_kernels;
+}
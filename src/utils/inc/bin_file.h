@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define BIN_FILE_VERSION 1
+#define BIN_FILE_MAGIC "BFBIN\0\0\0"
+#define BIN_BLOCK_MAGIC 0x4B4C4246 // "FBLK"
+
+// Binary recording format: BinFileHeader followed by blocks, each block is BinBlockHeader and
+// num_rows x num_samples doubles stored channel major. Values are written in native byte order, the
+// version check fails for files written on a machine with different endianness. A block is
+// considered written only when all its bytes are on disk, so a crash corrupts only the last block
+// and readers ignore it.
+#pragma pack(push, 1)
+struct BinFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    int32_t board_id;
+    int32_t preset;
+    int32_t num_rows;
+    int32_t reserved;
+    double sampling_rate;
+};
+
+struct BinBlockHeader
+{
+    uint32_t magic;
+    uint32_t num_samples;
+};
+#pragma pack(pop)
+
+class BinFileWriter
+{
+    FILE *fp;
+    int num_rows;
+
+public:
+    BinFileWriter ();
+    ~BinFileWriter ();
+
+    // mode "w" creates a new file, mode "a" appends to an existing one after dropping incomplete
+    // trailing block, num_rows must match the existing header
+    int open (const char *file_name, const char *file_mode, int board_id, int preset,
+        int num_rows, double sampling_rate);
+    // data is num_rows x num_samples matrix with row_stride between rows
+    int write_block (const double *data, int num_samples, int row_stride);
+    void close ();
+};
+
+// Maps the whole file into memory, samples are copied straight from the mapping
+class BinFileReader
+{
+    struct Block
+    {
+        size_t offset;
+        size_t num_samples;
+    };
+
+    const char *mapping;
+    size_t mapping_size;
+#ifdef _WIN32
+    void *file_handle;
+    void *mapping_handle;
+#endif
+    BinFileHeader header;
+    std::vector<Block> blocks;
+    size_t num_samples;
+    // end of the last complete block
+    size_t valid_size;
+
+public:
+    BinFileReader ();
+    ~BinFileReader ();
+
+    static bool is_bin_file (const char *file_name);
+
+    int open (const char *file_name);
+    void close ();
+
+    const BinFileHeader &get_header ()
+    {
+        return header;
+    }
+    size_t get_num_samples ()
+    {
+        return num_samples;
+    }
+    size_t get_valid_size ()
+    {
+        return valid_size;
+    }
+    // fills output as num_rows x returned_samples matrix with up to max_samples first samples
+    size_t read (double *output, size_t max_samples);
+};
@@ -75,7 +75,7 @@ static inline std::array<int, N> make_stride (const std::array<int, N> &size)
     return stride;
 }
 
-/// Class to represent NDArrays, row major order, continuous memory
+/// Class to represent NDArrays, row major order, continuous memory unless created by view()
 template <typename T, size_t Dim>
 class BrainFlowArray
 {
@@ -85,6 +85,63 @@ private:
     std::array<int, Dim> size;
     std::array<int, Dim> stride;
     T *origin;
+    bool owns_data;
+
+    // non owning constructor, use view () to call it
+    BrainFlowArray (T *ptr, const std::array<int, Dim> &size, const std::array<int, Dim> &stride)
+        : length (product (size)), size (size), stride (stride), origin (ptr), owns_data (false)
+    {
+    }
+
+    // max offset from origin plus one
+    int get_extent () const
+    {
+        if (owns_data)
+        {
+            return length;
+        }
+        if (length == 0)
+        {
+            return 0;
+        }
+        int extent = 1;
+        for (size_t i = 0; i < Dim; i++)
+        {
+            extent += (size[i] - 1) * stride[i];
+        }
+        return extent;
+    }
+
+    // row pointers are passed to methods which expect adjacent elements
+    void check_contiguous_rows () const
+    {
+        if (!has_contiguous_rows ())
+        {
+            throw BrainFlowException ("rows of this view are strided, copy it first",
+                (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+        }
+    }
+
+    // copies elements of other into contiguous row major memory
+    void copy_elements (const BrainFlowArray &other)
+    {
+        origin = new T[other.length];
+        if (other.owns_data)
+        {
+            memcpy (origin, other.origin, sizeof (T) * other.length);
+            return;
+        }
+        std::array<int, Dim> dense_stride = make_stride (other.size);
+        for (int i = 0; i < other.length; i++)
+        {
+            int offset = 0;
+            for (size_t d = 0; d < Dim; d++)
+            {
+                offset += ((i / dense_stride[d]) % other.size[d]) * other.stride[d];
+            }
+            origin[i] = other.origin[offset];
+        }
+    }
 
 public:
     friend std::ostream &operator<<<> (std::ostream &out, const BrainFlowArray<T, Dim> &array);
@@ -94,19 +151,24 @@ public:
         , size (zero_array<Dim> ())
         , stride (make_stride (zero_array<Dim> ()))
         , origin (nullptr)
+        , owns_data (true)
     {
     }
 
     ~BrainFlowArray ()
     {
-        if (origin != nullptr)
+        if ((origin != nullptr) && (owns_data))
         {
             delete[] origin;
         }
     }
 
     BrainFlowArray (const std::array<int, Dim> &size)
-        : length (product (size)), size (size), stride (make_stride (size)), origin (nullptr)
+        : length (product (size))
+        , size (size)
+        , stride (make_stride (size))
+        , origin (nullptr)
+        , owns_data (true)
     {
         origin = new T[product (size)];
         memset (origin, 0, sizeof (T) * product (size));
@@ -117,6 +179,7 @@ public:
         , size (make_array (size0))
         , stride (make_stride<1> (make_array (size0)))
         , origin (nullptr)
+        , owns_data (true)
     {
         static_assert (Dim == 1, "This function is only for BrainFlowArray<T, 1>");
         origin = new T[size0];
@@ -128,6 +191,7 @@ public:
         , size (make_array (size0, size1))
         , stride (make_stride<2> (make_array (size0, size1)))
         , origin (nullptr)
+        , owns_data (true)
     {
         static_assert (Dim == 2, "This function is only for BrainFlowArray<T, 2>");
         origin = new T[length];
@@ -139,6 +203,7 @@ public:
         , size (make_array (size0, size1, size2))
         , stride (make_stride<3> (make_array (size0, size1, size2)))
         , origin (nullptr)
+        , owns_data (true)
     {
         static_assert (Dim == 3, "This function is only for BrainFlowArray<T, 3>");
         origin = new T[length];
@@ -150,6 +215,7 @@ public:
         , size (make_array (size0))
         , stride (make_stride<1> (make_array (size0)))
         , origin (nullptr)
+        , owns_data (true)
     {
         static_assert (Dim == 1, "This function is only for BrainFlowArray<T, 1>");
         origin = new T[size0];
@@ -161,6 +227,7 @@ public:
         , size (make_array (size0, size1))
         , stride (make_stride<2> (make_array (size0, size1)))
         , origin (nullptr)
+        , owns_data (true)
     {
         static_assert (Dim == 2, "This function is only for BrainFlowArray<T, 2>");
         origin = new T[size0 * size1];
@@ -172,26 +239,39 @@ public:
         , size (make_array (size0, size1, size2))
         , stride (make_stride<3> (make_array (size0, size1, size2)))
         , origin (nullptr)
+        , owns_data (true)
     {
         static_assert (Dim == 3, "This function is only for BrainFlowArray<T, 3>");
         origin = new T[size0 * size1 * size2];
         memcpy (origin, ptr, size0 * size1 * size2 * sizeof (T));
     }
 
+    /// copy is always owning and continuous, even if other is a view
     BrainFlowArray (const BrainFlowArray &other)
-        : length (other.length), size (other.size), stride (other.stride), origin (nullptr)
+        : length (other.length)
+        , size (other.size)
+        , stride (make_stride (other.size))
+        , origin (nullptr)
+        , owns_data (true)
     {
-        origin = new T[other.length];
-        memcpy (origin, other.origin, sizeof (T) * other.length);
+        copy_elements (other);
     }
 
     const BrainFlowArray &operator= (const BrainFlowArray &other)
     {
+        if (this == &other)
+        {
+            return *this;
+        }
+        if ((origin != nullptr) && (owns_data))
+        {
+            delete[] origin;
+        }
         length = other.length;
         size = other.size;
-        stride = other.stride;
-        origin = new T[other.length];
-        memcpy (origin, other.origin, sizeof (T) * other.length);
+        stride = make_stride (other.size);
+        owns_data = true;
+        copy_elements (other);
 
         return *this;
     }
@@ -201,6 +281,7 @@ public:
         , size (std::move (other.size))
         , stride (std::move (other.stride))
         , origin (nullptr)
+        , owns_data (other.owns_data)
     {
         origin = other.origin;
         other.origin = nullptr;
@@ -213,17 +294,32 @@ public:
         length = other.length;
         size = std::move (other.size);
         stride = std::move (other.stride);
-        if (origin != nullptr)
+        if ((origin != nullptr) && (owns_data))
         {
             delete[] origin;
         }
         origin = other.origin;
+        owns_data = other.owns_data;
         other.origin = nullptr;
         other.length = 0;
         other.size = zero_array<Dim> ();
         return *this;
     }
 
+    /// wrap memory owned by somebody else without copying, element at (i0, i1, ...) is
+    /// ptr[i0 * stride[0] + i1 * stride[1] + ...], memory should outlive the view
+    static BrainFlowArray view (
+        T *ptr, const std::array<int, Dim> &size, const std::array<int, Dim> &stride)
+    {
+        return BrainFlowArray (ptr, size, stride);
+    }
+
+    /// check if array wraps memory owned by somebody else
+    bool is_view () const
+    {
+        return !owns_data;
+    }
+
     /// get size of data type
     int get_item_size () const
     {
@@ -295,7 +391,7 @@ public:
     T &at (int index0)
     {
         int idx = index0 * get_stride (0);
-        if (idx >= length)
+        if (idx >= get_extent ())
         {
             throw BrainFlowException (
                 "out of range", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
@@ -307,7 +403,7 @@ public:
     const T &at (int index0) const
     {
         int idx = index0 * get_stride (0);
-        if (idx >= length)
+        if (idx >= get_extent ())
         {
             throw BrainFlowException (
                 "out of range", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
@@ -344,7 +440,7 @@ public:
     {
         static_assert (Dim >= 2, "BrainFlowArray dimension bounds error");
         int idx = index0 * get_stride (0) + index1 * get_stride (1);
-        if (idx >= length)
+        if (idx >= get_extent ())
         {
             throw BrainFlowException (
                 "out of range", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
@@ -357,7 +453,7 @@ public:
     {
         static_assert (Dim >= 2, "BrainFlowArray dimension bounds error");
         int idx = index0 * get_stride (0) + index1 * get_stride (1);
-        if (idx >= length)
+        if (idx >= get_extent ())
         {
             throw BrainFlowException (
                 "out of range", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
@@ -382,7 +478,7 @@ public:
     {
         static_assert (Dim >= 3, "BrainFlowArray dimension bounds error");
         int idx = index0 * get_stride (0) + index1 * get_stride (1) + index2 * get_stride (2);
-        if (idx >= length)
+        if (idx >= get_extent ())
         {
             throw BrainFlowException (
                 "out of range", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
@@ -395,7 +491,7 @@ public:
     {
         static_assert (Dim >= 3, "BrainFlowArray dimension bounds error");
         int idx = index0 * get_stride (0) + index1 * get_stride (1) + index2 * get_stride (2);
-        if (idx >= length)
+        if (idx >= get_extent ())
         {
             throw BrainFlowException (
                 "out of range", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
@@ -421,9 +517,18 @@ public:
         return get_raw_ptr () == nullptr || get_length () == 0;
     }
 
-    /// use it to get pointer to row in matrix or to get pointer to matrix from 3d array
+    /// check if elements of the last dimension are adjacent in memory, false for views of
+    /// interleaved buffers
+    bool has_contiguous_rows () const
+    {
+        return (owns_data) || (length == 0) || (stride[Dim - 1] == 1);
+    }
+
+    /// use it to get pointer to row in matrix or to get pointer to matrix from 3d array, throws
+    /// for views without contiguous rows, copy them first
     T *get_address (int index0)
     {
+        check_contiguous_rows ();
         return &origin[index0 * get_stride (0)];
     }
 
@@ -431,12 +536,14 @@ public:
     T *get_address (int index0, int index1)
     {
         static_assert (Dim >= 2, "Dim should be >= 2");
+        check_contiguous_rows ();
         return &origin[index0 * get_stride (0) + index1 * get_stride (1)];
     }
 
     /// use it to get pointer to row in matrix or to get pointer to matrix from 3d array
     const T *get_address (int index0) const
     {
+        check_contiguous_rows ();
         return &origin[index0 * get_stride (0)];
     }
 
@@ -444,10 +551,11 @@ public:
     const T *get_address (int index0, int index1) const
     {
         static_assert (Dim >= 2, "Dim should be >= 2");
+        check_contiguous_rows ();
         return &origin[index0 * get_stride (0) + index1 * get_stride (1)];
     }
 
-    /// fill already preallocated buffer
+    /// fill already preallocated buffer, not supported for strided views
     void fill (T *ptr, int num)
     {
         memcpy (origin, ptr, sizeof (T) * num);
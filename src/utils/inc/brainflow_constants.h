@@ -119,6 +119,14 @@ enum class FilterTypes : int
     BESSEL_ZERO_PHASE = 5
 };
 
+enum class FilterOperations : int
+{
+    LOWPASS = 0,
+    HIGHPASS = 1,
+    BANDPASS = 2,
+    BANDSTOP = 3
+};
+
 enum class AggOperations : int
 {
     MEAN = 0,
@@ -4,6 +4,8 @@
 #include <string.h>
 #include <string>
 
+#define MAX_BRAINFLOW_NUM_THREADS 256
+
 
 inline int get_brainflow_batch_size (int default_size = 3)
 {
@@ -25,3 +27,45 @@ inline int get_brainflow_batch_size (int default_size = 3)
     }
     return size;
 }
+
+// BRAINFLOW_BUFFER_LAYOUT=channel_major keeps a separate ring for each channel, reads become a
+// memcpy per channel while producer writes become strided
+inline bool get_brainflow_channel_major_buffer (bool default_value = false)
+{
+    bool channel_major = default_value;
+    if (const char *env_p = std::getenv ("BRAINFLOW_BUFFER_LAYOUT"))
+    {
+        if (strcmp (env_p, "channel_major") == 0)
+        {
+            channel_major = true;
+        }
+        else if (strcmp (env_p, "interleaved") == 0)
+        {
+            channel_major = false;
+        }
+    }
+    return channel_major;
+}
+
+// BRAINFLOW_NUM_THREADS sets number of threads used by data handler for multichannel methods,
+// 0 means number of hardware threads
+inline int get_brainflow_num_threads (int default_value = 0)
+{
+    int num_threads = default_value;
+    if (const char *env_p = std::getenv ("BRAINFLOW_NUM_THREADS"))
+    {
+        std::string str_env = env_p;
+        try
+        {
+            int parsed_num_threads = std::stoi (str_env);
+            if ((parsed_num_threads >= 0) && (parsed_num_threads <= MAX_BRAINFLOW_NUM_THREADS))
+            {
+                num_threads = parsed_num_threads;
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+    return num_threads;
+}
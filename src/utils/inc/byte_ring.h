@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
+#define DEFAULT_BYTE_RING_CAPACITY 4096
+
+
+// Staging buffer for stream sockets which return less bytes than requested. Bytes are copied in
+// and out with at most two memcpy calls, capacity is fixed unless reserve is called. Not thread
+// safe, used by a single read thread.
+class ByteRing
+{
+    std::vector<char> buffer;
+    // index of the first buffered byte
+    int head;
+    int size;
+
+public:
+    explicit ByteRing (int capacity = DEFAULT_BYTE_RING_CAPACITY)
+        : buffer (std::max (capacity, 1)), head (0), size (0)
+    {
+    }
+
+    int get_size () const
+    {
+        return size;
+    }
+
+    int get_capacity () const
+    {
+        return (int)buffer.size ();
+    }
+
+    void clear ()
+    {
+        head = 0;
+        size = 0;
+    }
+
+    // grows capacity to at least min_capacity keeping buffered bytes, never shrinks
+    void reserve (int min_capacity)
+    {
+        int capacity = get_capacity ();
+        if (min_capacity <= capacity)
+        {
+            return;
+        }
+        std::vector<char> new_buffer (std::max (min_capacity, 2 * capacity));
+        peek (new_buffer.data (), size);
+        buffer.swap (new_buffer);
+        head = 0;
+    }
+
+    // copies up to len bytes, returns number of copied bytes which is less than len if there is
+    // not enough free space
+    int push (const void *data, int len)
+    {
+        int capacity = get_capacity ();
+        len = std::min (len, capacity - size);
+        if (len <= 0)
+        {
+            return 0;
+        }
+        int tail = (head + size) % capacity;
+        int first = std::min (len, capacity - tail);
+        memcpy (buffer.data () + tail, data, first);
+        memcpy (buffer.data (), (const char *)data + first, len - first);
+        size += len;
+        return len;
+    }
+
+    // copies up to len oldest bytes without removing them
+    int peek (void *data, int len) const
+    {
+        int capacity = get_capacity ();
+        len = std::min (len, size);
+        if (len <= 0)
+        {
+            return 0;
+        }
+        int first = std::min (len, capacity - head);
+        memcpy (data, buffer.data () + head, first);
+        memcpy ((char *)data + first, buffer.data (), len - first);
+        return len;
+    }
+
+    // moves up to len oldest bytes to data
+    int pop (void *data, int len)
+    {
+        len = peek (data, len);
+        head = (head + len) % get_capacity ();
+        size -= len;
+        if (size == 0)
+        {
+            head = 0;
+        }
+        return len;
+    }
+};
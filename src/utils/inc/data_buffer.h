@@ -1,34 +1,76 @@
 #pragma once
 
-#include "spinlock.h"
+#include <atomic>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "spinlock.h"
+
+// Ring buffer with sequence counters. Producer never waits for readers, readers copy data
+// optimistically and validate that it was not overwritten during the copy. add_data is expected to
+// be called from a single thread, concurrent producers are serialized between themselves only.
+// Data can be stored interleaved (one value set after another) or channel major (one ring per
+// channel), the last one allows to read channel major output with two memcpy calls per channel.
+// A single view can pin samples in place, producer drops new samples instead of overwriting pinned
+// ones until the view is released.
 class DataBuffer
 {
+    static const uint64_t NO_PIN = UINT64_MAX;
 
-    SpinLock lock;
     double *data;
 
     size_t buffer_size;
-    size_t first_used, first_free;
-    size_t count;
     size_t num_samples;
+    bool channel_major;
 
-    size_t next (size_t index)
-    {
-        return (index + 1) % buffer_size;
-    }
+    // total number of samples producer started to write
+    std::atomic<uint64_t> claim_pos;
+    // total number of samples which are written and visible for readers
+    std::atomic<uint64_t> write_pos;
+    // total number of samples removed by get_data
+    std::atomic<uint64_t> read_pos;
+    // position of the first sample held by a view or NO_PIN
+    std::atomic<uint64_t> pin_pos;
+    // samples dropped by producer because their slots were pinned
+    std::atomic<uint64_t> num_dropped;
+    SpinLock producer_lock;
 
-    void get_chunk (size_t start, size_t size, double *data_buf);
+    void get_chunk (uint64_t start, size_t size, double *data_buf, bool channel_major_output);
+    // copies [start, start + size) and drops oldest samples overwritten during the copy, returns
+    // number of valid samples moved to the beginning of data_buf
+    size_t copy_validated (
+        uint64_t start, size_t size, double *data_buf, bool channel_major_output);
+    // removes up to max_count oldest samples, removed_count may be bigger than the returned number
+    // of copied samples if producer overwrote some of them during the copy
+    size_t remove_validated (
+        size_t max_count, double *data_buf, bool channel_major_output, size_t *removed_count);
 
 public:
-    DataBuffer (int num_samples, size_t buffer_size);
+    DataBuffer (int num_samples, size_t buffer_size, bool channel_major = false);
     ~DataBuffer ();
 
     void add_data (double *value);
-    size_t get_data (size_t max_count, double *data_buf);
-    size_t get_current_data (size_t max_count, double *data_buf);
+    // values is count x num_samples matrix, takes producer lock once for the whole block
+    void add_data (const double *values, size_t count);
+    // if channel_major_output is true data_buf is filled as num_samples x returned_count matrix.
+    // Returns min (max_count, get_data_count ()) samples unless another consumer removes them
+    // concurrently, samples overwritten during the copy are replaced by the next ones
+    size_t get_data (size_t max_count, double *data_buf, bool channel_major_output = false);
+    size_t get_current_data (
+        size_t max_count, double *data_buf, bool channel_major_output = false);
     size_t get_data_count ();
+    // removes up to max_count oldest samples from the buffer without copying them, element (i, j)
+    // is span[i * channel_stride + j * sample_stride] where span is first_span for j below
+    // first_span_len and second_span (with j - first_span_len) otherwise. Only one view may be
+    // held at a time, it stays valid until release_view
+    size_t acquire_view (size_t max_count, double **first_span, size_t *first_span_len,
+        double **second_span, size_t *second_span_len, size_t *channel_stride,
+        size_t *sample_stride);
+    void release_view ();
+    bool has_view ();
+    // returns number of samples dropped since the previous call
+    uint64_t reset_num_dropped ();
     bool is_ready ();
+    bool is_channel_major ();
 };
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+
+// Wakes up threads waiting for new data. Producer calls notify after publishing data, it costs a
+// fence and a load while nobody waits, mutex and condition variable are touched only if there are
+// waiters. Waiters check their condition under the mutex after registering themselves, so a notify
+// which happens between the check and the sleep is never lost.
+class DataNotifier
+{
+    std::atomic<int> num_waiters;
+    std::mutex m;
+    std::condition_variable cv;
+
+public:
+    DataNotifier ()
+    {
+        num_waiters = 0;
+    }
+
+    // call after data which waiters check is published
+    void notify ()
+    {
+        // orders stores of the published data before the load of num_waiters, pairs with
+        // fetch_add in wait_for
+        std::atomic_thread_fence (std::memory_order_seq_cst);
+        if (num_waiters.load (std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lk (m);
+            cv.notify_all ();
+        }
+    }
+
+    // returns value of predicate after it became true or timeout expired
+    template <class Predicate>
+    bool wait_for (int timeout_ms, Predicate predicate)
+    {
+        num_waiters.fetch_add (1, std::memory_order_seq_cst);
+        bool res = false;
+        {
+            std::unique_lock<std::mutex> lk (m);
+            res = cv.wait_for (lk, std::chrono::milliseconds (timeout_ms), predicate);
+        }
+        num_waiters.fetch_sub (1, std::memory_order_relaxed);
+        return res;
+    }
+
+    bool has_waiters ()
+    {
+        return (num_waiters.load (std::memory_order_relaxed) > 0);
+    }
+};
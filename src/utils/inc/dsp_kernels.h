@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+
+
+// Vectorized primitives for data handler hot loops. Each instruction set provides the whole table,
+// get_dsp_kernels picks the best one supported by the cpu on first call. Scalar table is the
+// reference, vectorized sums are reordered so results match it up to rounding
+struct DspKernels
+{
+    const char *name;
+    // sum of data[i]
+    double (*sum) (const double *data, int len);
+    // sum of i * data[i]
+    double (*index_weighted_sum) (const double *data, int len);
+    // sum of (data[i] - mean)^2
+    double (*squared_deviation_sum) (const double *data, int len, double mean);
+    // max of |data[i]|, 0 for empty data
+    double (*abs_max) (const double *data, int len);
+    // true if |data[i - 1] - data[i]| > eps and |data[i]| > eps for some i
+    bool (*has_steps) (const double *data, int len, double eps);
+    // data[i] -= slope * i + intercept
+    void (*subtract_line) (double *data, int len, double slope, double intercept);
+    // data[i] *= factor
+    void (*scale) (double *data, int len, double factor);
+    // output[i] = data[i] * window[i]
+    void (*multiply) (const double *data, const double *window, double *output, int len);
+    // output[i] += factor * (re[i]^2 + im[i]^2), complex_data is re[0], im[0], re[1], im[1]...
+    void (*accumulate_power) (const double *complex_data, int len, double factor, double *output);
+};
+
+const DspKernels &get_dsp_kernels ();
+const DspKernels &get_scalar_dsp_kernels ();
+// all tables supported by the cpu, scalar one goes first
+std::vector<const DspKernels *> get_available_dsp_kernels ();
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <stdlib.h>
+
+// max length of a characteristic value in BLE
+#define DEFAULT_NOTIFICATION_MAX_SIZE 512
+#define DEFAULT_NOTIFICATION_QUEUE_SIZE 512
+
+
+// Bounded queue of raw notification payloads between several producers (BLE stack callbacks) and
+// a single consumer (board decoding thread). Producers pass host time of arrival with payload, so
+// queueing delay doesnt affect timestamps. Producers never take a lock and never wait, payload is
+// copied to a preallocated slot, if all slots are busy notification is dropped and counted. Queue
+// is created closed, notifications pushed while it is closed are dropped silently.
+class NotificationQueue
+{
+    struct Slot
+    {
+        // equals position when slot is free for producer, position + 1 when it is ready to pop
+        std::atomic<uint64_t> sequence;
+        int tag;
+        double timestamp;
+        size_t size;
+    };
+
+    Slot *slots;
+    uint8_t *payloads;
+    size_t capacity;
+    size_t max_size;
+
+    std::atomic<uint64_t> enqueue_pos;
+    // used by consumer only
+    uint64_t dequeue_pos;
+    std::atomic<uint64_t> num_overflowed;
+    std::atomic<bool> is_closed;
+    std::atomic<bool> is_consumer_waiting;
+    std::mutex consumer_mutex;
+    std::condition_variable consumer_cv;
+
+    bool has_ready_slot ();
+
+public:
+    NotificationQueue (size_t capacity = DEFAULT_NOTIFICATION_QUEUE_SIZE,
+        size_t max_size = DEFAULT_NOTIFICATION_MAX_SIZE);
+    ~NotificationQueue ();
+
+    NotificationQueue (const NotificationQueue &) = delete;
+    NotificationQueue &operator= (const NotificationQueue &) = delete;
+
+    bool is_ready ();
+    size_t get_max_size ();
+    // safe to call from several threads, payloads longer than max size are truncated, returns false
+    // if notification was dropped
+    bool push (int tag, double timestamp, const uint8_t *data, size_t size);
+    // waits up to timeout_ms for a notification, data must hold max size bytes, returns false on
+    // timeout or if queue is closed and empty
+    bool pop (int *tag, double *timestamp, uint8_t *data, size_t *size, int timeout_ms);
+    void open ();
+    // wakes up consumer, notifications which are already queued can still be popped
+    void close ();
+    uint64_t get_num_overflowed ();
+};
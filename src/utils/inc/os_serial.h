@@ -24,6 +24,7 @@ public:
     int set_custom_latency (int latency = 1);
     int flush_buffer ();
     int read_from_serial_port (void *bytes_to_read, int size);
+    int get_bytes_available ();
     int send_to_serial_port (const void *message, int length);
     int close_serial_port ();
     const char *get_port_name ()
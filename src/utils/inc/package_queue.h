@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <stdlib.h>
+
+
+enum class BackpressurePolicy : int
+{
+    DROP_OLDEST = 0,
+    DROP_NEWEST = 1,
+    BLOCK = 2
+};
+
+// Bounded queue of fixed size packages between a single producer and a single consumer. Producer
+// never takes a lock, if queue is full policy decides whether the oldest package is discarded, the
+// new package is discarded or producer waits for the consumer. Consumer takes packages in batches
+// and sleeps on a condition variable if there is nothing to take.
+class PackageQueue
+{
+    double *data;
+    size_t capacity;
+    size_t package_len;
+    BackpressurePolicy policy;
+
+    // total number of packages pushed
+    std::atomic<uint64_t> head;
+    // total number of packages removed, advanced by consumer and by producer in DROP_OLDEST mode
+    std::atomic<uint64_t> tail;
+    std::atomic<uint64_t> num_dropped;
+    std::atomic<bool> is_closed;
+    std::atomic<bool> is_consumer_waiting;
+    std::mutex consumer_mutex;
+    std::condition_variable consumer_cv;
+
+    bool write_package (const double *package);
+    void notify_consumer ();
+
+public:
+    PackageQueue (size_t package_len, size_t capacity, BackpressurePolicy policy);
+    ~PackageQueue ();
+
+    bool is_ready ();
+    // returns false if package was dropped
+    bool push (const double *package);
+    // packages is count x package_len matrix, returns number of packages which were not dropped
+    size_t push (const double *packages, size_t count);
+    // waits up to timeout_ms for packages, copies up to max_count of them to packages and removes
+    // them from the queue, returns 0 on timeout or if queue is closed and empty
+    size_t pop (double *packages, size_t max_count, int timeout_ms);
+    // wakes up waiting producer and consumer, packages pushed after close are dropped
+    void close ();
+    size_t get_size ();
+    uint64_t get_num_dropped ();
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+
+#include "serial.h"
+
+#define DEFAULT_SERIAL_FRAME_BUFFER_SIZE 4096
+// upper limit for a single read, 1024 bytes are about 30 cyton packages. If serial knows how many
+// bytes are buffered, only them or at least the rest of the current frame are requested, because
+// on windows ReadFile waits for the whole request
+#define DEFAULT_SERIAL_FRAME_READ_SIZE 1024
+
+
+enum class SerialFrameStatus : int
+{
+    FRAME_READY = 0,
+    // serial read returned nothing, caller checks keep_alive and tries again
+    NO_DATA = 1,
+    // frame has valid start byte but wrong end byte, payload is filled to log it. Reader resyncs
+    // from the byte after this start byte, so a single corrupted byte costs at most one frame
+    WRONG_END_BYTE = 2
+};
+
+// Reads serial data in bulk into a buffer and cuts it into frames, so a sample costs a fraction of
+// a read call instead of a call per byte. Frames are always contiguous in the buffer, consumed
+// bytes are moved to the front only when there is not enough free space for the next read. Used
+// by a single read thread.
+class SerialFrameReader
+{
+    Serial *serial;
+    std::vector<unsigned char> buffer;
+    // unread bytes are in [head, tail)
+    int head;
+    int tail;
+    int read_size;
+    // for delimited frames head points to the first payload byte after start byte
+    bool is_synced;
+    long long num_reads;
+
+    // returns false if serial read returned nothing, min_size bytes are requested even if serial
+    // has less of them buffered
+    bool fill (int min_size);
+
+public:
+    SerialFrameReader (Serial *serial, int buffer_size = DEFAULT_SERIAL_FRAME_BUFFER_SIZE,
+        int read_size = DEFAULT_SERIAL_FRAME_READ_SIZE);
+
+    // frame is start_byte followed by payload_size bytes, the last one must be in
+    // [end_byte_min, end_byte_max]. Start byte is not copied to payload
+    SerialFrameStatus read_frame (unsigned char start_byte, unsigned char end_byte_min,
+        unsigned char end_byte_max, int payload_size, unsigned char *payload);
+    // frames of unknown size, each one starts after start_byte and ends with end_byte followed by
+    // start_byte of the next frame. Payload includes end_byte, bytes before the first end_byte,
+    // start_byte pair are skipped. If there is no frame end in max_size bytes reader resyncs
+    SerialFrameStatus read_delimited_frame (unsigned char start_byte, unsigned char end_byte,
+        int min_size, int max_size, unsigned char *payload, int *payload_size);
+    // drops buffered bytes
+    void reset ();
+
+    long long get_num_reads ()
+    {
+        return num_reads;
+    }
+};
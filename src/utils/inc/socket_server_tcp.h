@@ -8,11 +8,12 @@
 #include <unistd.h>
 #endif
 
-#include <queue>
 #include <stdlib.h>
 #include <string.h>
 #include <thread>
 
+#include "byte_ring.h"
+
 enum class SocketServerTCPReturnCodes : int
 {
     STATUS_OK = 0,
@@ -49,7 +50,8 @@ private:
     int local_port;
     struct sockaddr_in server_addr;
     volatile struct sockaddr_in client_addr;
-    std::queue<char> temp_buffer;
+    // bytes of an incomplete chunk in recv_all_or_nothing mode
+    ByteRing temp_buffer;
     bool recv_all_or_nothing;
 
     std::thread accept_thread;
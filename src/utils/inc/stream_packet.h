@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+#define STREAM_PACKET_VERSION 2
+#define STREAM_PACKET_MAGIC 0x50534642 // "BFSP"
+// max UDP payload over IPv4
+#define STREAM_PACKET_MAX_SIZE 65507
+// timestamp_row value if there is no timestamp channel
+#define STREAM_PACKET_NO_TIMESTAMP 0xFFFF
+
+
+enum class StreamEncoding : int
+{
+    FLOAT64 = 0,
+    FLOAT32 = 1,
+    // per row scale and 24 bit integers, precision of a 24 bit ADC for the signal range
+    INT24 = 2,
+    // same quantization as INT24, differences between samples are stored as zigzag varints
+    INT24_DELTA = 3
+};
+
+enum class StreamPacketStatus : int
+{
+    OK = 0,
+    // no magic, datagram may be sent by an older streamer
+    NOT_A_PACKET = 1,
+    UNSUPPORTED_VERSION = 2,
+    INVALID_PACKET = 3
+};
+
+// Datagram of the streaming_board protocol: StreamPacketHeader, num_exact_rows uint16 indices of
+// exact rows and num_rows rows of num_samples values each. Timestamp row and exact rows are always
+// stored as float64 because float32 and int24 can not hold unix time and would turn counters and
+// markers into fractions, other rows use the encoding from the header. Values are in native byte
+// order like in the legacy protocol which sends raw doubles.
+#pragma pack(push, 1)
+struct StreamPacketHeader
+{
+    uint32_t magic;
+    uint8_t version;
+    uint8_t encoding;
+    uint8_t preset;
+    uint8_t reserved;
+    // incremented by one for each datagram of a streamer
+    uint32_t sequence;
+    uint16_t num_rows;
+    uint16_t num_samples;
+    uint16_t timestamp_row;
+    uint16_t num_exact_rows;
+};
+#pragma pack(pop)
+
+// returns false for unknown names, names are float64, float32, int24 and int24_delta
+bool parse_stream_encoding (const char *name, StreamEncoding *encoding);
+// upper bound of the datagram size for any data
+size_t get_stream_packet_max_size (
+    int num_rows, int num_samples, StreamEncoding encoding, int num_exact_rows);
+// packages is num_samples x num_rows matrix, exact_rows are stored as float64 besides the timestamp
+// row, invalid and repeated indices are skipped. Returns number of written bytes or 0 if buf_size
+// is not enough
+size_t encode_stream_packet (const double *packages, int num_rows, int num_samples,
+    int timestamp_row, const std::vector<int> &exact_rows, int preset, uint32_t sequence,
+    StreamEncoding encoding, uint8_t *buf, size_t buf_size);
+// checks magic, version and sizes, indices of exact rows are checked by decode_stream_packet
+StreamPacketStatus decode_stream_packet_header (
+    const uint8_t *buf, size_t size, StreamPacketHeader *header);
+// packages must hold num_samples x num_rows values from the header
+StreamPacketStatus decode_stream_packet (
+    const uint8_t *buf, size_t size, const StreamPacketHeader &header, double *packages);
+
+// Detects lost and reordered datagrams by sequence numbers. Reordered and duplicated datagrams are
+// rejected because samples would be pushed out of order. A big step back or several rejected
+// datagrams in a row are treated as a restart of the streamer. Counters can be read from any
+// thread.
+class StreamSequenceTracker
+{
+    bool has_sequence;
+    uint32_t expected_sequence;
+    int num_rejected_in_row;
+    std::atomic<uint64_t> num_received;
+    std::atomic<uint64_t> num_lost;
+    std::atomic<uint64_t> num_reordered;
+    std::atomic<uint64_t> num_invalid;
+
+public:
+    StreamSequenceTracker ();
+
+    // returns false if datagram should be dropped
+    bool update (uint32_t sequence);
+    // for datagrams which failed to decode
+    void add_invalid ();
+    void reset ();
+
+    // accepted datagrams
+    uint64_t get_num_received ()
+    {
+        return num_received.load (std::memory_order_relaxed);
+    }
+    // datagrams which were skipped by sequence numbers
+    uint64_t get_num_lost ()
+    {
+        return num_lost.load (std::memory_order_relaxed);
+    }
+    // late and duplicated datagrams
+    uint64_t get_num_reordered ()
+    {
+        return num_reordered.load (std::memory_order_relaxed);
+    }
+    uint64_t get_num_invalid ()
+    {
+        return num_invalid.load (std::memory_order_relaxed);
+    }
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Persistent workers for data parallel loops. parallel_for publishes a job and the calling thread
+// works on it together with the workers, every thread takes the next index from a shared counter
+// so threads which finish early keep taking work left by the slow ones. Several threads may call
+// parallel_for at the same time, calls made from inside a loop body run inline.
+class ThreadPool
+{
+    struct Job
+    {
+        const std::function<void (int)> *func;
+        int count;
+        std::atomic<int> next_index;
+        std::atomic<int> num_done;
+    };
+
+    std::vector<std::thread> workers;
+    std::mutex m;
+    // signals workers about new jobs and stop
+    std::condition_variable work_cv;
+    // signals callers about finished jobs
+    std::condition_variable done_cv;
+    // guarded by m, jobs which may have indices left
+    std::deque<std::shared_ptr<Job>> jobs;
+    bool is_stopped;
+
+    void worker_loop ();
+    void run_job (Job &job);
+
+public:
+    // num_threads includes the calling thread, 0 means number of hardware threads
+    ThreadPool (int num_threads);
+    ~ThreadPool ();
+
+    int get_num_threads ();
+    // calls func (i) for i in [0, count) and returns when all calls are done, func must not throw
+    void parallel_for (int count, const std::function<void (int)> &func);
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+// weights of old points decay with this time constant in seconds of device time
+#define DEFAULT_TIMESTAMP_TIME_CONSTANT 30.0
+// points which arrive this much earlier than predicted or stay later for a while reset the fit
+#define DEFAULT_TIMESTAMP_MAX_ERROR 1.0
+// seconds of host time between reports of drift and offset
+#define TIMESTAMP_STATS_INTERVAL 10.0
+
+
+// Maps device clock (sample counter or device timestamp) to host time. Host time when a package
+// is received is device time plus transport latency, which jitters a lot for BLE and WiFi boards.
+// Estimator fits host_time = offset + scale * device_time with exponentially weighted least
+// squares, so timestamps follow the device clock and host clock drift is tracked, but delivery
+// jitter is averaged out. Until the fit covers a few seconds, device clock is assumed to run at
+// the nominal rate. Not thread safe, each board thread or callback group has its own estimator.
+class TimestampEstimator
+{
+    // seconds of device time per unit of device clock
+    double nominal_period;
+    double time_constant;
+    double max_error;
+    // sums of weighted points, device time and host time are relative to the last added point
+    double sum_w;
+    double sum_x;
+    double sum_y;
+    double sum_xx;
+    double sum_xy;
+    // last added point, device time in seconds
+    double anchor_x;
+    double anchor_y;
+    bool has_points;
+    int num_late_points;
+    // state to unwrap package counters
+    int last_counter;
+    long long unwrapped_counter;
+    double last_counter_host_time;
+    double last_stats_time;
+
+    void add_point (double x, double y);
+    // host seconds per device second and host time at device time anchor_x
+    void get_fit (double *scale, double *intercept);
+
+public:
+    TimestampEstimator (double nominal_period = 1.0,
+        double time_constant = DEFAULT_TIMESTAMP_TIME_CONSTANT,
+        double max_error = DEFAULT_TIMESTAMP_MAX_ERROR);
+
+    // converts package counter which wraps at modulus to device clock of the first sample in this
+    // package. Counter is incremented once per samples_per_count samples, wraps during lost
+    // packages are detected using host time
+    double get_device_clock (int counter, int modulus, double host_time, int samples_per_count = 1);
+    // adds device clock of the last sample in a package and host time when the package was
+    // received, returns smoothed host time of this sample
+    double update (double device_clock, double host_time);
+    // smoothed host time of any device clock, e.g. other samples of the last package
+    double get_timestamp (double device_clock);
+    // host clock runs faster than device clock by drift, e.g. 0.0001 is 100 ppm
+    double get_drift ();
+    // estimated host time when device clock was 0
+    double get_offset ();
+    // true once per TIMESTAMP_STATS_INTERVAL seconds of host time, starting one interval after the
+    // first call
+    bool is_stats_due (double host_time);
+    void reset ();
+};
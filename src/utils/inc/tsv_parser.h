@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+
+#define DEFAULT_LINE_READER_BUFFER_SIZE (1 << 20)
+
+
+// Allocation free helpers for text files produced by write_file and file streamer. Fields are
+// separated by tabs or by commas if a line has no tabs.
+
+// parses number at the beginning of [begin, end) skipping leading spaces, returns pointer past the
+// parsed number or NULL. Numbers with up to 19 significant digits and small exponents are converted
+// exactly without strtod, everything else falls back to it
+const char *parse_double (const char *begin, const char *end, double *value);
+// returns number of fields in line or -1 if some of them is not a number, only first max_values
+// are stored in values
+int parse_tsv_line (const char *line, size_t len, double *values, int max_values);
+// number of lines in file, last line may have no line break, -1 if file cannot be opened
+long long count_lines_in_file (const char *file_name);
+
+// Reads file by large chunks and returns lines pointing into the internal buffer
+class LineReader
+{
+    FILE *fp;
+    char *buf;
+    size_t buf_size;
+    // first byte of the next line in buf
+    size_t line_start;
+    // number of bytes in buf
+    size_t data_end;
+    // file offset of buf[0]
+    long long buf_offset;
+    bool is_eof;
+
+    bool fill ();
+
+public:
+    LineReader (size_t buf_size = DEFAULT_LINE_READER_BUFFER_SIZE);
+    ~LineReader ();
+
+    bool open (const char *file_name);
+    void close ();
+    // line is valid until the next call and doesnt include line break
+    bool next_line (const char **line, size_t *len);
+    // file offset of the next line
+    long long tell ();
+    bool seek (long long offset);
+};
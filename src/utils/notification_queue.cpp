@@ -0,0 +1,171 @@
+#include <chrono>
+#include <new>
+#include <string.h>
+
+#include "notification_queue.h"
+
+
+NotificationQueue::NotificationQueue (size_t capacity, size_t max_size)
+{
+    this->capacity = capacity;
+    this->max_size = max_size;
+    enqueue_pos = 0;
+    dequeue_pos = 0;
+    num_overflowed = 0;
+    is_closed = true;
+    is_consumer_waiting = false;
+    slots = NULL;
+    payloads = NULL;
+
+    if ((capacity == 0) || (max_size == 0))
+    {
+        return;
+    }
+    try
+    {
+        slots = new Slot[capacity];
+        payloads = new uint8_t[capacity * max_size];
+    }
+    catch (const std::bad_alloc &)
+    {
+        delete[] slots;
+        slots = NULL;
+        payloads = NULL;
+        return;
+    }
+    for (size_t i = 0; i < capacity; i++)
+    {
+        slots[i].sequence.store (i, std::memory_order_relaxed);
+        slots[i].tag = 0;
+        slots[i].timestamp = 0.0;
+        slots[i].size = 0;
+    }
+}
+
+NotificationQueue::~NotificationQueue ()
+{
+    delete[] slots;
+    delete[] payloads;
+}
+
+bool NotificationQueue::is_ready ()
+{
+    return (slots != NULL);
+}
+
+size_t NotificationQueue::get_max_size ()
+{
+    return max_size;
+}
+
+bool NotificationQueue::push (int tag, double timestamp, const uint8_t *data, size_t size)
+{
+    if ((!is_ready ()) || (is_closed.load (std::memory_order_relaxed)))
+    {
+        return false;
+    }
+
+    // claim a slot, other producers move enqueue_pos concurrently
+    uint64_t pos = enqueue_pos.load (std::memory_order_relaxed);
+    Slot *slot = NULL;
+    while (true)
+    {
+        slot = &slots[pos % capacity];
+        uint64_t sequence = slot->sequence.load (std::memory_order_acquire);
+        if (sequence == pos)
+        {
+            if (enqueue_pos.compare_exchange_weak (pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < pos)
+        {
+            // consumer has not released this slot yet
+            num_overflowed.fetch_add (1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            pos = enqueue_pos.load (std::memory_order_relaxed);
+        }
+    }
+
+    if (size > max_size)
+    {
+        size = max_size;
+    }
+    memcpy (payloads + (size_t)(pos % capacity) * max_size, data, size);
+    slot->tag = tag;
+    slot->timestamp = timestamp;
+    slot->size = size;
+    slot->sequence.store (pos + 1, std::memory_order_seq_cst);
+    // consumer sets the flag before checking the slot, seq_cst pairs the two so at least one side
+    // sees the other, timeout in pop bounds the delay of a missed notification
+    if (is_consumer_waiting.load (std::memory_order_seq_cst))
+    {
+        consumer_cv.notify_one ();
+    }
+    return true;
+}
+
+bool NotificationQueue::has_ready_slot ()
+{
+    Slot *slot = &slots[dequeue_pos % capacity];
+    return (slot->sequence.load (std::memory_order_seq_cst) == dequeue_pos + 1);
+}
+
+bool NotificationQueue::pop (
+    int *tag, double *timestamp, uint8_t *data, size_t *size, int timeout_ms)
+{
+    if (!is_ready ())
+    {
+        return false;
+    }
+
+    if (!has_ready_slot ())
+    {
+        if ((is_closed.load ()) || (timeout_ms <= 0))
+        {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock (consumer_mutex);
+        is_consumer_waiting.store (true, std::memory_order_seq_cst);
+        if ((!has_ready_slot ()) && (!is_closed.load ()))
+        {
+            consumer_cv.wait_for (lock, std::chrono::milliseconds (timeout_ms));
+        }
+        is_consumer_waiting.store (false, std::memory_order_relaxed);
+        if (!has_ready_slot ())
+        {
+            return false;
+        }
+    }
+
+    Slot *slot = &slots[dequeue_pos % capacity];
+    *tag = slot->tag;
+    *timestamp = slot->timestamp;
+    *size = slot->size;
+    memcpy (data, payloads + (size_t)(dequeue_pos % capacity) * max_size, slot->size);
+    // slot is free for the producer which is one lap ahead
+    slot->sequence.store (dequeue_pos + capacity, std::memory_order_release);
+    dequeue_pos++;
+    return true;
+}
+
+void NotificationQueue::open ()
+{
+    is_closed.store (false);
+}
+
+void NotificationQueue::close ()
+{
+    is_closed.store (true);
+    std::lock_guard<std::mutex> lock (consumer_mutex);
+    consumer_cv.notify_all ();
+}
+
+uint64_t NotificationQueue::get_num_overflowed ()
+{
+    return num_overflowed.load (std::memory_order_relaxed);
+}
@@ -89,6 +89,18 @@ int OSSerial::read_from_serial_port (void *bytes_to_read, int size)
     return (int)readed;
 }
 
+int OSSerial::get_bytes_available ()
+{
+    // with ReadTotalTimeoutMultiplier ReadFile waits for all requested bytes
+    DWORD errors;
+    COMSTAT status;
+    if (!ClearCommError (this->port_descriptor, &errors, &status))
+    {
+        return -1;
+    }
+    return (int)status.cbInQue;
+}
+
 int OSSerial::send_to_serial_port (const void *message, int length)
 {
     DWORD bytes_written;
@@ -182,6 +194,12 @@ int OSSerial::read_from_serial_port (void *bytes_to_read, int size)
     return res;
 }
 
+int OSSerial::get_bytes_available ()
+{
+    // vmin is 0, read returns as soon as there are some bytes
+    return -1;
+}
+
 int OSSerial::flush_buffer ()
 {
     tcflush (this->port_descriptor, TCIOFLUSH);
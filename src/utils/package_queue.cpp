@@ -0,0 +1,190 @@
+#include <chrono>
+#include <new>
+#include <string.h>
+#include <thread>
+
+#include "package_queue.h"
+
+
+PackageQueue::PackageQueue (size_t package_len, size_t capacity, BackpressurePolicy policy)
+{
+    this->package_len = package_len;
+    this->capacity = capacity;
+    this->policy = policy;
+    head = 0;
+    tail = 0;
+    num_dropped = 0;
+    is_closed = false;
+    is_consumer_waiting = false;
+
+    if ((capacity == 0) || (package_len == 0))
+    {
+        data = NULL;
+    }
+    else
+    {
+        try
+        {
+            data = new double[capacity * package_len];
+        }
+        catch (const std::bad_alloc &)
+        {
+            data = NULL;
+        }
+    }
+}
+
+PackageQueue::~PackageQueue ()
+{
+    delete[] data;
+}
+
+bool PackageQueue::is_ready ()
+{
+    return (data != NULL);
+}
+
+bool PackageQueue::write_package (const double *package)
+{
+    if ((!is_ready ()) || (is_closed.load (std::memory_order_relaxed)))
+    {
+        num_dropped.fetch_add (1, std::memory_order_relaxed);
+        return false;
+    }
+
+    uint64_t pos = head.load (std::memory_order_relaxed);
+    while (pos - tail.load (std::memory_order_acquire) >= capacity)
+    {
+        if (policy == BackpressurePolicy::DROP_NEWEST)
+        {
+            num_dropped.fetch_add (1, std::memory_order_relaxed);
+            return false;
+        }
+        if (policy == BackpressurePolicy::DROP_OLDEST)
+        {
+            // consumer copying the oldest package will fail its own CAS and retry
+            uint64_t oldest = pos - capacity;
+            if (tail.compare_exchange_strong (
+                    oldest, oldest + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                num_dropped.fetch_add (1, std::memory_order_relaxed);
+            }
+            break;
+        }
+        // BLOCK
+        if (is_closed.load (std::memory_order_relaxed))
+        {
+            num_dropped.fetch_add (1, std::memory_order_relaxed);
+            return false;
+        }
+        consumer_cv.notify_one ();
+        std::this_thread::sleep_for (std::chrono::microseconds (100));
+    }
+
+    memcpy (data + (size_t)(pos % capacity) * package_len, package, sizeof (double) * package_len);
+    head.store (pos + 1, std::memory_order_seq_cst);
+    return true;
+}
+
+void PackageQueue::notify_consumer ()
+{
+    if (is_consumer_waiting.load (std::memory_order_seq_cst))
+    {
+        consumer_cv.notify_one ();
+    }
+}
+
+bool PackageQueue::push (const double *package)
+{
+    bool res = write_package (package);
+    notify_consumer ();
+    return res;
+}
+
+size_t PackageQueue::push (const double *packages, size_t count)
+{
+    size_t num_pushed = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (write_package (packages + i * package_len))
+        {
+            num_pushed++;
+        }
+    }
+    // consumer takes the whole batch after a single wake up
+    notify_consumer ();
+    return num_pushed;
+}
+
+size_t PackageQueue::pop (double *packages, size_t max_count, int timeout_ms)
+{
+    if ((!is_ready ()) || (max_count == 0))
+    {
+        return 0;
+    }
+
+    while (true)
+    {
+        uint64_t first = tail.load (std::memory_order_acquire);
+        uint64_t last = head.load (std::memory_order_acquire);
+        if (first == last)
+        {
+            if ((is_closed.load ()) || (timeout_ms <= 0))
+            {
+                return 0;
+            }
+            // producer checks the flag after publishing a package, seq_cst pairs the two so at
+            // least one side sees the other, timeout bounds the delay of a missed notification
+            std::unique_lock<std::mutex> lock (consumer_mutex);
+            is_consumer_waiting.store (true, std::memory_order_seq_cst);
+            if (head.load (std::memory_order_seq_cst) == first)
+            {
+                consumer_cv.wait_for (lock, std::chrono::milliseconds (timeout_ms));
+            }
+            is_consumer_waiting.store (false, std::memory_order_relaxed);
+            timeout_ms = 0;
+            continue;
+        }
+
+        size_t count = (size_t)(last - first);
+        if (count > max_count)
+        {
+            count = max_count;
+        }
+        size_t start_idx = (size_t)(first % capacity);
+        size_t first_half = count;
+        if (first_half > capacity - start_idx)
+        {
+            first_half = capacity - start_idx;
+        }
+        memcpy (
+            packages, data + start_idx * package_len, sizeof (double) * first_half * package_len);
+        memcpy (packages + first_half * package_len, data,
+            sizeof (double) * (count - first_half) * package_len);
+        // fails if producer discarded some of these packages in DROP_OLDEST mode
+        if (tail.compare_exchange_strong (
+                first, first + count, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return count;
+        }
+    }
+}
+
+void PackageQueue::close ()
+{
+    is_closed.store (true);
+    std::lock_guard<std::mutex> lock (consumer_mutex);
+    consumer_cv.notify_all ();
+}
+
+size_t PackageQueue::get_size ()
+{
+    uint64_t first = tail.load (std::memory_order_acquire);
+    uint64_t last = head.load (std::memory_order_acquire);
+    return (size_t)(last - first);
+}
+
+uint64_t PackageQueue::get_num_dropped ()
+{
+    return num_dropped.load (std::memory_order_relaxed);
+}
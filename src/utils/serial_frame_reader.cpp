@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <string.h>
+
+#include "serial_frame_reader.h"
+
+
+SerialFrameReader::SerialFrameReader (Serial *serial, int buffer_size, int read_size)
+    : buffer (std::max (buffer_size, 2))
+{
+    this->serial = serial;
+    head = 0;
+    tail = 0;
+    this->read_size = std::max (read_size, 1);
+    is_synced = false;
+    num_reads = 0;
+}
+
+void SerialFrameReader::reset ()
+{
+    head = 0;
+    tail = 0;
+    is_synced = false;
+}
+
+bool SerialFrameReader::fill (int min_size)
+{
+    int size = (int)buffer.size ();
+    if (head == tail)
+    {
+        head = 0;
+        tail = 0;
+    }
+    else if ((head > 0) && (size - tail < size / 2))
+    {
+        // callers keep frames shorter than half of the buffer, so a frame always fits after this
+        memmove (buffer.data (), buffer.data () + head, tail - head);
+        tail -= head;
+        head = 0;
+    }
+    int request = std::min (size - tail, read_size);
+    int available = serial->get_bytes_available ();
+    if (available >= 0)
+    {
+        request = std::min (request, std::max (available, std::max (min_size, 1)));
+    }
+    num_reads++;
+    int res = serial->read_from_serial_port (buffer.data () + tail, request);
+    if (res <= 0)
+    {
+        return false;
+    }
+    tail += res;
+    return true;
+}
+
+SerialFrameStatus SerialFrameReader::read_frame (unsigned char start_byte,
+    unsigned char end_byte_min, unsigned char end_byte_max, int payload_size,
+    unsigned char *payload)
+{
+    int frame_size = payload_size + 1;
+    if ((int)buffer.size () < 2 * frame_size)
+    {
+        buffer.resize (2 * frame_size);
+    }
+    while (true)
+    {
+        int missing = frame_size;
+        if (head < tail)
+        {
+            unsigned char *start = (unsigned char *)memchr (
+                buffer.data () + head, start_byte, (size_t)(tail - head));
+            if (start == NULL)
+            {
+                head = tail;
+            }
+            else
+            {
+                head = (int)(start - buffer.data ());
+                if (tail - head >= frame_size)
+                {
+                    memcpy (payload, start + 1, payload_size);
+                    unsigned char end_byte = payload[payload_size - 1];
+                    if ((end_byte < end_byte_min) || (end_byte > end_byte_max))
+                    {
+                        head++;
+                        return SerialFrameStatus::WRONG_END_BYTE;
+                    }
+                    head += frame_size;
+                    return SerialFrameStatus::FRAME_READY;
+                }
+                missing = frame_size - (tail - head);
+            }
+        }
+        if (!fill (missing))
+        {
+            return SerialFrameStatus::NO_DATA;
+        }
+    }
+}
+
+SerialFrameStatus SerialFrameReader::read_delimited_frame (unsigned char start_byte,
+    unsigned char end_byte, int min_size, int max_size, unsigned char *payload,
+    int *payload_size)
+{
+    if ((int)buffer.size () < 2 * (max_size + 2))
+    {
+        buffer.resize (2 * (max_size + 2));
+    }
+    const unsigned char *data = buffer.data ();
+    while (true)
+    {
+        if (!is_synced)
+        {
+            for (int i = head + 1; i < tail; i++)
+            {
+                if ((data[i] == start_byte) && (data[i - 1] == end_byte))
+                {
+                    head = i + 1;
+                    is_synced = true;
+                    break;
+                }
+            }
+            if ((!is_synced) && (tail - head > 1))
+            {
+                // last byte may be end_byte of the pair
+                head = tail - 1;
+            }
+        }
+        if (is_synced)
+        {
+            // frame is [head, i), where i is start byte of the next frame
+            int limit = std::min (tail, head + max_size + 1);
+            for (int i = head + std::max (min_size, 1); i < limit; i++)
+            {
+                if ((data[i] == start_byte) && (data[i - 1] == end_byte))
+                {
+                    *payload_size = i - head;
+                    memcpy (payload, data + head, *payload_size);
+                    head = i + 1;
+                    return SerialFrameStatus::FRAME_READY;
+                }
+            }
+            if (tail - head > max_size)
+            {
+                is_synced = false;
+                continue;
+            }
+        }
+        if (!fill (1))
+        {
+            return SerialFrameStatus::NO_DATA;
+        }
+        data = buffer.data ();
+    }
+}
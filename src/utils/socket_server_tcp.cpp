@@ -122,39 +122,32 @@ int SocketServerTCP::recv (void *data, int size)
     {
         return -1;
     }
-    int res = ::recv (connected_socket, (char *)data, size, 0);
+    if (!recv_all_or_nothing)
+    {
+        int res = ::recv (connected_socket, (char *)data, size, 0);
+        return (res == SOCKET_ERROR) ? -1 : res;
+    }
+    // before we used SO_RCVLOWAT but it didnt work well
+    // and we were not sure that it works correctly with timeout
+    int buffered = temp_buffer.get_size ();
+    if (buffered >= size)
+    {
+        return temp_buffer.pop (data, size);
+    }
+    // receive only missing bytes right after the place for buffered ones
+    int res = ::recv (connected_socket, (char *)data + buffered, size - buffered, 0);
     if (res == SOCKET_ERROR)
     {
         return -1;
     }
-    for (int i = 0; i < res; i++)
+    if (buffered + res < size)
     {
-        temp_buffer.push (((char *)data)[i]);
-    }
-    // before we used SO_RCVLOWAT but it didnt work well
-    // and we were not sure that it works correctly with timeout
-    if (recv_all_or_nothing)
-    {
-        if ((int)temp_buffer.size () < size)
-        {
-            return 0;
-        }
-        for (int i = 0; i < size; i++)
-        {
-            ((char *)data)[i] = temp_buffer.front ();
-            temp_buffer.pop ();
-        }
-        return size;
-    }
-    else
-    {
-        for (int i = 0; i < res; i++)
-        {
-            ((char *)data)[i] = temp_buffer.front ();
-            temp_buffer.pop ();
-        }
-        return res;
+        temp_buffer.reserve (size);
+        temp_buffer.push ((char *)data + buffered, res);
+        return 0;
     }
+    temp_buffer.pop (data, buffered);
+    return size;
 }
 
 void SocketServerTCP::close ()
@@ -285,39 +278,32 @@ int SocketServerTCP::recv (void *data, int size)
     {
         return -1;
     }
-    int res = ::recv (connected_socket, (char *)data, size, 0);
-    if (res < 0)
+    if (!recv_all_or_nothing)
     {
+        int res = ::recv (connected_socket, (char *)data, size, 0);
         return res;
     }
-    for (int i = 0; i < res; i++)
-    {
-        temp_buffer.push (((char *)data)[i]);
-    }
     // before we used SO_RCVLOWAT but it didnt work well
     // and we were not sure that it works correctly with timeout
-    if (recv_all_or_nothing)
-    {
-        if (temp_buffer.size () < size)
-        {
-            return 0;
-        }
-        for (int i = 0; i < size; i++)
-        {
-            ((char *)data)[i] = temp_buffer.front ();
-            temp_buffer.pop ();
-        }
-        return size;
-    }
-    else
-    {
-        for (int i = 0; i < res; i++)
-        {
-            ((char *)data)[i] = temp_buffer.front ();
-            temp_buffer.pop ();
-        }
+    int buffered = temp_buffer.get_size ();
+    if (buffered >= size)
+    {
+        return temp_buffer.pop (data, size);
+    }
+    // receive only missing bytes right after the place for buffered ones
+    int res = ::recv (connected_socket, (char *)data + buffered, size - buffered, 0);
+    if (res < 0)
+    {
         return res;
     }
+    if (buffered + res < size)
+    {
+        temp_buffer.reserve (size);
+        temp_buffer.push ((char *)data + buffered, res);
+        return 0;
+    }
+    temp_buffer.pop (data, buffered);
+    return size;
 }
 
 void SocketServerTCP::close ()
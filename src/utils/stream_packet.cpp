@@ -0,0 +1,387 @@
+#include <cmath>
+#include <string.h>
+
+#include "stream_packet.h"
+
+#define INT24_MAX_VALUE 8388607
+// sequence step back which is too big for reordering in a local network
+#define MAX_REORDER_DISTANCE 1024
+// streamer was restarted if this many datagrams in a row are late
+#define MAX_REJECTED_IN_ROW 8
+
+
+static bool is_float64_row (
+    int row, int timestamp_row, const std::vector<bool> &is_exact, StreamEncoding encoding)
+{
+    return ((encoding == StreamEncoding::FLOAT64) || (row == timestamp_row) || (is_exact[row]));
+}
+
+static float get_int24_scale (const double *packages, int num_rows, int num_samples, int row)
+{
+    double max_abs = 0.0;
+    for (int i = 0; i < num_samples; i++)
+    {
+        double value = std::fabs (packages[i * num_rows + row]);
+        if ((std::isfinite (value)) && (value > max_abs))
+        {
+            max_abs = value;
+        }
+    }
+    return (float)(max_abs / INT24_MAX_VALUE);
+}
+
+static int32_t quantize_int24 (double value, float scale)
+{
+    if ((scale <= 0.0f) || (!std::isfinite (value)))
+    {
+        return 0;
+    }
+    double q = std::round (value / scale);
+    if (q > INT24_MAX_VALUE)
+    {
+        return INT24_MAX_VALUE;
+    }
+    if (q < -INT24_MAX_VALUE)
+    {
+        return -INT24_MAX_VALUE;
+    }
+    return (int32_t)q;
+}
+
+static size_t write_varint (uint32_t value, uint8_t *buf)
+{
+    size_t len = 0;
+    while (value >= 0x80)
+    {
+        buf[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buf[len++] = (uint8_t)value;
+    return len;
+}
+
+static bool read_varint (const uint8_t *buf, size_t size, size_t *pos, uint32_t *value)
+{
+    *value = 0;
+    // 24 bit zigzag deltas take at most 4 bytes
+    for (int shift = 0; shift < 28; shift += 7)
+    {
+        if (*pos >= size)
+        {
+            return false;
+        }
+        uint8_t byte = buf[(*pos)++];
+        *value |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parse_stream_encoding (const char *name, StreamEncoding *encoding)
+{
+    if (strcmp (name, "float64") == 0)
+    {
+        *encoding = StreamEncoding::FLOAT64;
+    }
+    else if (strcmp (name, "float32") == 0)
+    {
+        *encoding = StreamEncoding::FLOAT32;
+    }
+    else if (strcmp (name, "int24") == 0)
+    {
+        *encoding = StreamEncoding::INT24;
+    }
+    else if (strcmp (name, "int24_delta") == 0)
+    {
+        *encoding = StreamEncoding::INT24_DELTA;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+size_t get_stream_packet_max_size (
+    int num_rows, int num_samples, StreamEncoding encoding, int num_exact_rows)
+{
+    size_t row_size = sizeof (double) * num_samples;
+    switch (encoding)
+    {
+        case StreamEncoding::FLOAT32:
+            row_size = sizeof (float) * num_samples;
+            break;
+        case StreamEncoding::INT24:
+            row_size = sizeof (float) + 3 * num_samples;
+            break;
+        case StreamEncoding::INT24_DELTA:
+            row_size = sizeof (float) + 4 * num_samples;
+            break;
+        default:
+            break;
+    }
+    // timestamp and exact rows may be larger than others
+    return sizeof (StreamPacketHeader) + sizeof (uint16_t) * num_exact_rows +
+        row_size * num_rows + sizeof (double) * num_samples * (num_exact_rows + 1);
+}
+
+size_t encode_stream_packet (const double *packages, int num_rows, int num_samples,
+    int timestamp_row, const std::vector<int> &exact_rows, int preset, uint32_t sequence,
+    StreamEncoding encoding, uint8_t *buf, size_t buf_size)
+{
+    if ((num_rows <= 0) || (num_rows >= STREAM_PACKET_NO_TIMESTAMP) || (num_samples <= 0) ||
+        (num_samples > 0xFFFF) ||
+        (buf_size < get_stream_packet_max_size (
+                        num_rows, num_samples, encoding, (int)exact_rows.size ())))
+    {
+        return 0;
+    }
+    std::vector<bool> is_exact (num_rows, false);
+    std::vector<uint16_t> exact_indices;
+    for (int row : exact_rows)
+    {
+        if ((row >= 0) && (row < num_rows) && (row != timestamp_row) && (!is_exact[row]))
+        {
+            is_exact[row] = true;
+            exact_indices.push_back ((uint16_t)row);
+        }
+    }
+
+    StreamPacketHeader header;
+    memset (&header, 0, sizeof (header));
+    header.magic = STREAM_PACKET_MAGIC;
+    header.version = STREAM_PACKET_VERSION;
+    header.encoding = (uint8_t)encoding;
+    header.preset = (uint8_t)preset;
+    header.sequence = sequence;
+    header.num_rows = (uint16_t)num_rows;
+    header.num_samples = (uint16_t)num_samples;
+    header.timestamp_row = ((timestamp_row >= 0) && (timestamp_row < num_rows)) ?
+        (uint16_t)timestamp_row :
+        (uint16_t)STREAM_PACKET_NO_TIMESTAMP;
+    header.num_exact_rows = (uint16_t)exact_indices.size ();
+    memcpy (buf, &header, sizeof (header));
+    size_t pos = sizeof (header);
+    if (!exact_indices.empty ())
+    {
+        memcpy (buf + pos, exact_indices.data (), sizeof (uint16_t) * exact_indices.size ());
+        pos += sizeof (uint16_t) * exact_indices.size ();
+    }
+
+    for (int row = 0; row < num_rows; row++)
+    {
+        if (is_float64_row (row, header.timestamp_row, is_exact, encoding))
+        {
+            for (int i = 0; i < num_samples; i++)
+            {
+                memcpy (buf + pos, &packages[i * num_rows + row], sizeof (double));
+                pos += sizeof (double);
+            }
+            continue;
+        }
+        if (encoding == StreamEncoding::FLOAT32)
+        {
+            for (int i = 0; i < num_samples; i++)
+            {
+                float value = (float)packages[i * num_rows + row];
+                memcpy (buf + pos, &value, sizeof (float));
+                pos += sizeof (float);
+            }
+            continue;
+        }
+        float scale = get_int24_scale (packages, num_rows, num_samples, row);
+        memcpy (buf + pos, &scale, sizeof (float));
+        pos += sizeof (float);
+        int32_t prev = 0;
+        for (int i = 0; i < num_samples; i++)
+        {
+            int32_t q = quantize_int24 (packages[i * num_rows + row], scale);
+            if (encoding == StreamEncoding::INT24)
+            {
+                uint32_t bits = (uint32_t)q;
+                buf[pos++] = (uint8_t)(bits & 0xFF);
+                buf[pos++] = (uint8_t)((bits >> 8) & 0xFF);
+                buf[pos++] = (uint8_t)((bits >> 16) & 0xFF);
+            }
+            else
+            {
+                int32_t delta = q - prev;
+                uint32_t zigzag = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+                pos += write_varint (zigzag, buf + pos);
+                prev = q;
+            }
+        }
+    }
+    return pos;
+}
+
+StreamPacketStatus decode_stream_packet_header (
+    const uint8_t *buf, size_t size, StreamPacketHeader *header)
+{
+    if (size < sizeof (StreamPacketHeader))
+    {
+        return StreamPacketStatus::NOT_A_PACKET;
+    }
+    memcpy (header, buf, sizeof (StreamPacketHeader));
+    if (header->magic != STREAM_PACKET_MAGIC)
+    {
+        return StreamPacketStatus::NOT_A_PACKET;
+    }
+    if (header->version != STREAM_PACKET_VERSION)
+    {
+        return StreamPacketStatus::UNSUPPORTED_VERSION;
+    }
+    if ((header->encoding > (uint8_t)StreamEncoding::INT24_DELTA) || (header->num_rows == 0) ||
+        (header->num_samples == 0) ||
+        (size - sizeof (StreamPacketHeader) < sizeof (uint16_t) * header->num_exact_rows))
+    {
+        return StreamPacketStatus::INVALID_PACKET;
+    }
+    return StreamPacketStatus::OK;
+}
+
+StreamPacketStatus decode_stream_packet (
+    const uint8_t *buf, size_t size, const StreamPacketHeader &header, double *packages)
+{
+    StreamEncoding encoding = (StreamEncoding)header.encoding;
+    int num_rows = header.num_rows;
+    int num_samples = header.num_samples;
+    size_t pos = sizeof (StreamPacketHeader);
+    if ((size < pos) || (size - pos < sizeof (uint16_t) * header.num_exact_rows))
+    {
+        return StreamPacketStatus::INVALID_PACKET;
+    }
+    std::vector<bool> is_exact (num_rows, false);
+    for (int i = 0; i < header.num_exact_rows; i++)
+    {
+        uint16_t row = 0;
+        memcpy (&row, buf + pos, sizeof (uint16_t));
+        pos += sizeof (uint16_t);
+        if ((row >= num_rows) || (is_exact[row]))
+        {
+            return StreamPacketStatus::INVALID_PACKET;
+        }
+        is_exact[row] = true;
+    }
+
+    for (int row = 0; row < num_rows; row++)
+    {
+        if (is_float64_row (row, header.timestamp_row, is_exact, encoding))
+        {
+            if (size - pos < sizeof (double) * num_samples)
+            {
+                return StreamPacketStatus::INVALID_PACKET;
+            }
+            for (int i = 0; i < num_samples; i++)
+            {
+                memcpy (&packages[i * num_rows + row], buf + pos, sizeof (double));
+                pos += sizeof (double);
+            }
+            continue;
+        }
+        if (encoding == StreamEncoding::FLOAT32)
+        {
+            if (size - pos < sizeof (float) * num_samples)
+            {
+                return StreamPacketStatus::INVALID_PACKET;
+            }
+            for (int i = 0; i < num_samples; i++)
+            {
+                float value = 0.0f;
+                memcpy (&value, buf + pos, sizeof (float));
+                packages[i * num_rows + row] = value;
+                pos += sizeof (float);
+            }
+            continue;
+        }
+        if (size - pos < sizeof (float))
+        {
+            return StreamPacketStatus::INVALID_PACKET;
+        }
+        float scale = 0.0f;
+        memcpy (&scale, buf + pos, sizeof (float));
+        pos += sizeof (float);
+        if (encoding == StreamEncoding::INT24)
+        {
+            if (size - pos < (size_t)(3 * num_samples))
+            {
+                return StreamPacketStatus::INVALID_PACKET;
+            }
+            for (int i = 0; i < num_samples; i++)
+            {
+                uint32_t bits = (uint32_t)buf[pos] | ((uint32_t)buf[pos + 1] << 8) |
+                    ((uint32_t)buf[pos + 2] << 16);
+                // sign extend
+                int32_t q = (int32_t)(bits << 8) >> 8;
+                packages[i * num_rows + row] = (double)q * scale;
+                pos += 3;
+            }
+            continue;
+        }
+        int32_t q = 0;
+        for (int i = 0; i < num_samples; i++)
+        {
+            uint32_t zigzag = 0;
+            if (!read_varint (buf, size, &pos, &zigzag))
+            {
+                return StreamPacketStatus::INVALID_PACKET;
+            }
+            int32_t delta = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+            q += delta;
+            packages[i * num_rows + row] = (double)q * scale;
+        }
+    }
+    if (pos != size)
+    {
+        return StreamPacketStatus::INVALID_PACKET;
+    }
+    return StreamPacketStatus::OK;
+}
+
+StreamSequenceTracker::StreamSequenceTracker ()
+{
+    reset ();
+}
+
+void StreamSequenceTracker::reset ()
+{
+    has_sequence = false;
+    expected_sequence = 0;
+    num_rejected_in_row = 0;
+    num_received = 0;
+    num_lost = 0;
+    num_reordered = 0;
+    num_invalid = 0;
+}
+
+void StreamSequenceTracker::add_invalid ()
+{
+    num_invalid.fetch_add (1, std::memory_order_relaxed);
+}
+
+bool StreamSequenceTracker::update (uint32_t sequence)
+{
+    if (has_sequence)
+    {
+        int32_t diff = (int32_t)(sequence - expected_sequence);
+        if ((diff < 0) && (diff >= -MAX_REORDER_DISTANCE) &&
+            (num_rejected_in_row + 1 < MAX_REJECTED_IN_ROW))
+        {
+            num_rejected_in_row++;
+            num_reordered.fetch_add (1, std::memory_order_relaxed);
+            return false;
+        }
+        if (diff > 0)
+        {
+            num_lost.fetch_add ((uint64_t)diff, std::memory_order_relaxed);
+        }
+    }
+    has_sequence = true;
+    num_rejected_in_row = 0;
+    expected_sequence = sequence + 1;
+    num_received.fetch_add (1, std::memory_order_relaxed);
+    return true;
+}
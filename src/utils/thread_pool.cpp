@@ -0,0 +1,108 @@
+#include <algorithm>
+
+#include "thread_pool.h"
+
+
+// set for pool workers, nested loops run inline instead of waiting for busy workers
+static thread_local bool is_pool_worker = false;
+
+
+ThreadPool::ThreadPool (int num_threads)
+{
+    is_stopped = false;
+    if (num_threads <= 0)
+    {
+        num_threads = (int)std::thread::hardware_concurrency ();
+    }
+    // calling thread is one of them
+    for (int i = 1; i < num_threads; i++)
+    {
+        workers.push_back (std::thread ([this] { worker_loop (); }));
+    }
+}
+
+ThreadPool::~ThreadPool ()
+{
+    {
+        std::lock_guard<std::mutex> lk (m);
+        is_stopped = true;
+    }
+    work_cv.notify_all ();
+    for (size_t i = 0; i < workers.size (); i++)
+    {
+        workers[i].join ();
+    }
+}
+
+int ThreadPool::get_num_threads ()
+{
+    return (int)workers.size () + 1;
+}
+
+void ThreadPool::parallel_for (int count, const std::function<void (int)> &func)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+    if ((workers.empty ()) || (count == 1) || (is_pool_worker))
+    {
+        for (int i = 0; i < count; i++)
+        {
+            func (i);
+        }
+        return;
+    }
+
+    std::shared_ptr<Job> job = std::make_shared<Job> ();
+    job->func = &func;
+    job->count = count;
+    job->next_index = 0;
+    job->num_done = 0;
+    {
+        std::lock_guard<std::mutex> lk (m);
+        jobs.push_back (job);
+    }
+    work_cv.notify_all ();
+
+    run_job (*job);
+
+    // job has no indices left, wait for workers which are still running the last ones
+    std::unique_lock<std::mutex> lk (m);
+    jobs.erase (std::remove (jobs.begin (), jobs.end (), job), jobs.end ());
+    done_cv.wait (lk, [&job] { return job->num_done.load () == job->count; });
+}
+
+void ThreadPool::run_job (Job &job)
+{
+    int index = 0;
+    while ((index = job.next_index.fetch_add (1)) < job.count)
+    {
+        (*job.func) (index);
+        if (job.num_done.fetch_add (1) + 1 == job.count)
+        {
+            std::lock_guard<std::mutex> lk (m);
+            done_cv.notify_all ();
+        }
+    }
+}
+
+void ThreadPool::worker_loop ()
+{
+    is_pool_worker = true;
+    std::unique_lock<std::mutex> lk (m);
+    while (true)
+    {
+        work_cv.wait (lk, [this] { return (is_stopped) || (!jobs.empty ()); });
+        if (is_stopped)
+        {
+            return;
+        }
+        std::shared_ptr<Job> job = jobs.front ();
+        lk.unlock ();
+        run_job (*job);
+        lk.lock ();
+        // job is exhausted, let other workers see the next one
+        jobs.erase (std::remove (jobs.begin (), jobs.end (), job), jobs.end ());
+    }
+}
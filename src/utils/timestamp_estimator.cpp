@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <math.h>
+
+#include "timestamp_estimator.h"
+
+// fit is used once weighted std of device time is above 1s, otherwise clock is nominal
+#define MIN_FIT_VARIANCE 1.0
+// late points are skipped as delivery delays unless there are this many in a row
+#define MAX_LATE_POINTS 10
+
+
+TimestampEstimator::TimestampEstimator (
+    double nominal_period, double time_constant, double max_error)
+{
+    this->nominal_period = nominal_period;
+    this->time_constant = time_constant;
+    this->max_error = max_error;
+    reset ();
+}
+
+void TimestampEstimator::reset ()
+{
+    sum_w = 0.0;
+    sum_x = 0.0;
+    sum_y = 0.0;
+    sum_xx = 0.0;
+    sum_xy = 0.0;
+    anchor_x = 0.0;
+    anchor_y = 0.0;
+    has_points = false;
+    num_late_points = 0;
+    last_counter = -1;
+    unwrapped_counter = 0;
+    last_counter_host_time = 0.0;
+    last_stats_time = -1.0;
+}
+
+double TimestampEstimator::get_device_clock (
+    int counter, int modulus, double host_time, int samples_per_count)
+{
+    if (last_counter < 0)
+    {
+        unwrapped_counter = counter;
+    }
+    else
+    {
+        long long delta = ((counter - last_counter) % modulus + modulus) % modulus;
+        // counter could wrap several times if packages were lost, host time tells how many
+        double counter_period = nominal_period * samples_per_count * (1.0 + get_drift ());
+        double expected = (host_time - last_counter_host_time) / counter_period;
+        long long num_wraps = (long long)floor ((expected - delta) / modulus + 0.5);
+        unwrapped_counter += delta + std::max (num_wraps, 0LL) * modulus;
+    }
+    last_counter = counter;
+    last_counter_host_time = host_time;
+    return (double)unwrapped_counter * samples_per_count;
+}
+
+double TimestampEstimator::update (double device_clock, double host_time)
+{
+    double x = device_clock * nominal_period;
+    if (has_points)
+    {
+        double mean_x = sum_x / sum_w;
+        bool is_fitted = (sum_xx / sum_w - mean_x * mean_x) >= MIN_FIT_VARIANCE;
+        if (x < anchor_x - max_error)
+        {
+            // device was restarted, small steps back are allowed for devices which send
+            // different sensors in separate packages
+            has_points = false;
+        }
+        else if (is_fitted)
+        {
+            double predicted = get_timestamp (device_clock);
+            if (host_time < predicted - max_error)
+            {
+                // package can not arrive before it was sent, host clock jumped or device changed
+                // sampling rate
+                has_points = false;
+            }
+            else if (host_time > predicted + max_error)
+            {
+                num_late_points++;
+                if (num_late_points < MAX_LATE_POINTS)
+                {
+                    return predicted;
+                }
+                has_points = false;
+            }
+        }
+    }
+    num_late_points = 0;
+    add_point (x, host_time);
+    return get_timestamp (device_clock);
+}
+
+void TimestampEstimator::add_point (double x, double y)
+{
+    if (!has_points)
+    {
+        sum_w = 1.0;
+        sum_x = 0.0;
+        sum_y = 0.0;
+        sum_xx = 0.0;
+        sum_xy = 0.0;
+        anchor_x = x;
+        anchor_y = y;
+        has_points = true;
+        return;
+    }
+    // move origin to the new point to keep sums small, it doesnt change the fit
+    double dx = x - anchor_x;
+    double dy = y - anchor_y;
+    sum_xx += sum_w * dx * dx - 2.0 * dx * sum_x;
+    sum_xy += sum_w * dx * dy - dx * sum_y - dy * sum_x;
+    sum_x -= sum_w * dx;
+    sum_y -= sum_w * dy;
+    double decay = exp (-std::max (dx, 0.0) / time_constant);
+    sum_w = sum_w * decay + 1.0;
+    sum_x *= decay;
+    sum_y *= decay;
+    sum_xx *= decay;
+    sum_xy *= decay;
+    anchor_x = x;
+    anchor_y = y;
+}
+
+void TimestampEstimator::get_fit (double *scale, double *intercept)
+{
+    double mean_x = sum_x / sum_w;
+    double mean_y = sum_y / sum_w;
+    double variance = sum_xx / sum_w - mean_x * mean_x;
+    double covariance = sum_xy / sum_w - mean_x * mean_y;
+    *scale = 1.0;
+    if ((variance >= MIN_FIT_VARIANCE) && (covariance > 0.0))
+    {
+        *scale = covariance / variance;
+    }
+    *intercept = anchor_y + mean_y - *scale * mean_x;
+}
+
+double TimestampEstimator::get_timestamp (double device_clock)
+{
+    if (!has_points)
+    {
+        return 0.0;
+    }
+    double scale = 1.0;
+    double intercept = 0.0;
+    get_fit (&scale, &intercept);
+    return intercept + scale * (device_clock * nominal_period - anchor_x);
+}
+
+double TimestampEstimator::get_drift ()
+{
+    if (!has_points)
+    {
+        return 0.0;
+    }
+    double scale = 1.0;
+    double intercept = 0.0;
+    get_fit (&scale, &intercept);
+    return scale - 1.0;
+}
+
+double TimestampEstimator::get_offset ()
+{
+    return get_timestamp (0.0);
+}
+
+bool TimestampEstimator::is_stats_due (double host_time)
+{
+    if ((last_stats_time < 0.0) || (host_time < last_stats_time))
+    {
+        last_stats_time = host_time;
+        return false;
+    }
+    if (host_time - last_stats_time < TIMESTAMP_STATS_INTERVAL)
+    {
+        return false;
+    }
+    last_stats_time = host_time;
+    return true;
+}
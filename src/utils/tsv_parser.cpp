@@ -0,0 +1,401 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include "tsv_parser.h"
+
+#define MAX_FAST_PATH_DIGITS 19
+#define MAX_FAST_PATH_EXPONENT 22
+#define MAX_EXACT_MANTISSA (1ULL << 53)
+#define MAX_FALLBACK_TOKEN_LEN 128
+
+
+// powers of 10 which are exact in double
+static const double exact_powers_of_ten[MAX_FAST_PATH_EXPONENT + 1] = {1e0, 1e1, 1e2, 1e3, 1e4,
+    1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+    1e22};
+
+static inline bool is_digit (char c)
+{
+    return ((c >= '0') && (c <= '9'));
+}
+
+// tab is a separator and never skipped
+static inline bool is_space (char c)
+{
+    return ((c == ' ') || (c == '\r') || (c == '\n') || (c == '\v') || (c == '\f'));
+}
+
+static bool is_blank (const char *begin, const char *end)
+{
+    for (const char *p = begin; p < end; p++)
+    {
+        if (!is_space (*p))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// nan, inf, hex floats and numbers which need more than 64 bits of mantissa
+static const char *parse_double_fallback (const char *begin, const char *end, double *value)
+{
+    char c = *begin;
+    if ((c == '+') || (c == '-'))
+    {
+        if (begin + 1 == end)
+        {
+            return NULL;
+        }
+        c = begin[1];
+    }
+    // strtod skips whitespaces including separators, reject them here
+    if ((!is_digit (c)) && (c != '.') && (c != 'n') && (c != 'N') && (c != 'i') && (c != 'I'))
+    {
+        return NULL;
+    }
+    size_t len = (size_t)(end - begin);
+    char token[MAX_FALLBACK_TOKEN_LEN];
+    std::string long_token;
+    const char *str = token;
+    if (len < MAX_FALLBACK_TOKEN_LEN)
+    {
+        memcpy (token, begin, len);
+        token[len] = '\0';
+    }
+    else
+    {
+        long_token.assign (begin, len);
+        str = long_token.c_str ();
+    }
+    char *str_end = NULL;
+    double res = strtod (str, &str_end);
+    if (str_end == str)
+    {
+        return NULL;
+    }
+    *value = res;
+    return begin + (str_end - str);
+}
+
+const char *parse_double (const char *begin, const char *end, double *value)
+{
+    const char *p = begin;
+    while ((p < end) && (is_space (*p)))
+    {
+        p++;
+    }
+    if (p == end)
+    {
+        return NULL;
+    }
+    const char *number_start = p;
+    bool negative = false;
+    if ((*p == '-') || (*p == '+'))
+    {
+        negative = (*p == '-');
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    bool is_truncated = false;
+    for (; (p < end) && (is_digit (*p)); p++)
+    {
+        has_digits = true;
+        if (num_digits < MAX_FAST_PATH_DIGITS)
+        {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            num_digits += (mantissa != 0);
+        }
+        else
+        {
+            is_truncated = true;
+            exponent++;
+        }
+    }
+    if ((p < end) && (*p == '.'))
+    {
+        p++;
+        for (; (p < end) && (is_digit (*p)); p++)
+        {
+            has_digits = true;
+            if (num_digits < MAX_FAST_PATH_DIGITS)
+            {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                num_digits += (mantissa != 0);
+                exponent--;
+            }
+            else
+            {
+                is_truncated = true;
+            }
+        }
+    }
+    if (!has_digits)
+    {
+        return parse_double_fallback (number_start, end, value);
+    }
+    // exponent is a part of the number only if it has digits
+    if ((p < end) && ((*p == 'e') || (*p == 'E')))
+    {
+        const char *exp_p = p + 1;
+        bool exp_negative = false;
+        if ((exp_p < end) && ((*exp_p == '-') || (*exp_p == '+')))
+        {
+            exp_negative = (*exp_p == '-');
+            exp_p++;
+        }
+        if ((exp_p < end) && (is_digit (*exp_p)))
+        {
+            int exp_value = 0;
+            for (; (exp_p < end) && (is_digit (*exp_p)); exp_p++)
+            {
+                if (exp_value < 100000)
+                {
+                    exp_value = exp_value * 10 + (*exp_p - '0');
+                }
+            }
+            exponent += exp_negative ? -exp_value : exp_value;
+            p = exp_p;
+        }
+    }
+
+    // both mantissa and power of ten are exact, single multiplication or division rounds correctly
+    if ((!is_truncated) && (mantissa <= MAX_EXACT_MANTISSA) &&
+        (exponent >= -MAX_FAST_PATH_EXPONENT) && (exponent <= MAX_FAST_PATH_EXPONENT))
+    {
+        double res = (double)mantissa;
+        if (exponent < 0)
+        {
+            res /= exact_powers_of_ten[-exponent];
+        }
+        else
+        {
+            res *= exact_powers_of_ten[exponent];
+        }
+        *value = negative ? -res : res;
+        return p;
+    }
+    return parse_double_fallback (number_start, end, value);
+}
+
+int parse_tsv_line (const char *line, size_t len, double *values, int max_values)
+{
+    const char *end = line + len;
+    char sep = (memchr (line, '\t', len) != NULL) ? '\t' : ',';
+    int num_values = 0;
+    const char *p = line;
+    while (p < end)
+    {
+        double value = 0.0;
+        const char *value_end = parse_double (p, end, &value);
+        if (value_end == NULL)
+        {
+            // trailing separator is not a field
+            if (is_blank (p, end))
+            {
+                break;
+            }
+            return -1;
+        }
+        if (num_values < max_values)
+        {
+            values[num_values] = value;
+        }
+        num_values++;
+        // like std::stod ignore everything between the number and the next separator
+        if ((value_end == end) || (*value_end != sep))
+        {
+            value_end = (const char *)memchr (value_end, sep, (size_t)(end - value_end));
+            if (value_end == NULL)
+            {
+                break;
+            }
+        }
+        p = value_end + 1;
+        if ((p < end) && (*p == sep))
+        {
+            return -1;
+        }
+    }
+    return num_values;
+}
+
+long long count_lines_in_file (const char *file_name)
+{
+    FILE *fp = fopen (file_name, "rb");
+    if (fp == NULL)
+    {
+        return -1;
+    }
+    char *buf = new char[DEFAULT_LINE_READER_BUFFER_SIZE];
+    long long num_lines = 0;
+    char last_char = '\n';
+    size_t bytes_read = 0;
+    while ((bytes_read = fread (buf, 1, DEFAULT_LINE_READER_BUFFER_SIZE, fp)) > 0)
+    {
+        const char *p = buf;
+        const char *end = buf + bytes_read;
+        while ((p = (const char *)memchr (p, '\n', (size_t)(end - p))) != NULL)
+        {
+            num_lines++;
+            p++;
+        }
+        last_char = buf[bytes_read - 1];
+    }
+    if (last_char != '\n')
+    {
+        num_lines++;
+    }
+    delete[] buf;
+    fclose (fp);
+    return num_lines;
+}
+
+///////////////////////////////////
+////////// LineReader /////////////
+///////////////////////////////////
+
+LineReader::LineReader (size_t buf_size)
+{
+    fp = NULL;
+    this->buf_size = (buf_size > 0) ? buf_size : DEFAULT_LINE_READER_BUFFER_SIZE;
+    buf = NULL;
+    line_start = 0;
+    data_end = 0;
+    buf_offset = 0;
+    is_eof = false;
+}
+
+LineReader::~LineReader ()
+{
+    close ();
+}
+
+bool LineReader::open (const char *file_name)
+{
+    close ();
+    fp = fopen (file_name, "rb");
+    if (fp == NULL)
+    {
+        return false;
+    }
+    buf = new char[buf_size];
+    return true;
+}
+
+void LineReader::close ()
+{
+    if (fp != NULL)
+    {
+        fclose (fp);
+        fp = NULL;
+    }
+    delete[] buf;
+    buf = NULL;
+    line_start = 0;
+    data_end = 0;
+    buf_offset = 0;
+    is_eof = false;
+}
+
+bool LineReader::fill ()
+{
+    if (line_start > 0)
+    {
+        memmove (buf, buf + line_start, data_end - line_start);
+        buf_offset += (long long)line_start;
+        data_end -= line_start;
+        line_start = 0;
+    }
+    // line doesnt fit into the buffer
+    if (data_end == buf_size)
+    {
+        char *new_buf = new char[buf_size * 2];
+        memcpy (new_buf, buf, data_end);
+        delete[] buf;
+        buf = new_buf;
+        buf_size *= 2;
+    }
+    size_t bytes_read = fread (buf + data_end, 1, buf_size - data_end, fp);
+    data_end += bytes_read;
+    if (bytes_read == 0)
+    {
+        is_eof = true;
+    }
+    return (bytes_read > 0);
+}
+
+bool LineReader::next_line (const char **line, size_t *len)
+{
+    if (fp == NULL)
+    {
+        return false;
+    }
+    size_t search_start = line_start;
+    while (true)
+    {
+        const char *line_end =
+            (const char *)memchr (buf + search_start, '\n', data_end - search_start);
+        if ((line_end == NULL) && (is_eof))
+        {
+            if (line_start == data_end)
+            {
+                return false;
+            }
+            line_end = buf + data_end;
+        }
+        if (line_end != NULL)
+        {
+            *line = buf + line_start;
+            *len = (size_t)(line_end - *line);
+            line_start = (line_end == buf + data_end) ? data_end : (size_t)(line_end - buf) + 1;
+            if ((*len > 0) && ((*line)[*len - 1] == '\r'))
+            {
+                (*len)--;
+            }
+            return true;
+        }
+        // dont scan bytes which are already checked
+        size_t checked = data_end - line_start;
+        fill ();
+        search_start = line_start + checked;
+    }
+}
+
+long long LineReader::tell ()
+{
+    return buf_offset + (long long)line_start;
+}
+
+bool LineReader::seek (long long offset)
+{
+    if (fp == NULL)
+    {
+        return false;
+    }
+    if ((offset >= buf_offset) && (offset <= buf_offset + (long long)data_end))
+    {
+        line_start = (size_t)(offset - buf_offset);
+        return true;
+    }
+#ifdef _WIN32
+    int res = _fseeki64 (fp, offset, SEEK_SET);
+#else
+    int res = fseeko (fp, (off_t)offset, SEEK_SET);
+#endif
+    if (res != 0)
+    {
+        return false;
+    }
+    buf_offset = offset;
+    line_start = 0;
+    data_end = 0;
+    is_eof = false;
+    return true;
+}
@@ -34,11 +34,22 @@ void visushrink (double *signal, int N, int J, const char *wname, const char *me
 void sureshrink (double *signal, int N, int J, const char *wname, const char *method,
     const char *ext, const char *thresh, const char *level, double *denoised);
 
+// same as above for a transform object created by the caller with wt_init, it may be reused
+void visushrink_wt (wt_object wt, double *signal, const char *thresh, const char *level,
+    double *denoised);
+
+void sureshrink_wt (wt_object wt, double *signal, const char *thresh, const char *level,
+    double *denoised);
+
 void modwtshrink (double *signal, int N, int J, const char *wname, const char *cmethod,
     const char *ext, const char *thresh, double *denoised);
 
 void denoise (denoise_object obj, double *signal, double *denoised);
 
+// dwt and swt denoising with a transform object created by the caller, it must match N, J,
+// wavelet, method and extension of obj
+void denoise_wt (denoise_object obj, wt_object wt, double *signal, double *denoised);
+
 void setDenoiseMethod (denoise_object obj, const char *dmethod);
 
 void setDenoiseWTMethod (denoise_object obj, const char *wmethod);
@@ -29,31 +29,18 @@ denoise_object denoise_init (int length, int J, const char *wname)
     return obj;
 }
 
-void visushrink (double *signal, int N, int J, const char *wname, const char *method,
-    const char *ext, const char *thresh, const char *level, double *denoised)
+// transform object is created and freed by the caller, so it can be reused between calls
+void visushrink_wt (wt_object wt, double *signal, const char *thresh, const char *level,
+    double *denoised)
 {
-    int filt_len, iter, i, dlen, dwt_len, sgn, MaxIter, it;
+    int iter, i, dlen, dwt_len, sgn, it, J;
     double sigma, td, tmp;
-    wave_object wave;
-    wt_object wt;
     double *dout, *lnoise;
+    const char *method = wt->method;
 
-    wave = wave_init (wname);
-
-    filt_len = wave->filtlength;
-
-    MaxIter = (int)(log ((double)N / ((double)filt_len - 1.0)) / log (2.0));
-
-    if (J > MaxIter)
-    {
-        wave_free (wave);
-        throw std::runtime_error ("to small buffer size for this wavelet");
-    }
-
-    wt = wt_init (wave, method, N, J);
+    J = wt->J;
     if (!strcmp (method, "dwt"))
     {
-        setDWTExtension (wt, ext);
         dwt (wt, signal);
     }
     else if (!strcmp (method, "swt"))
@@ -62,8 +49,6 @@ void visushrink (double *signal, int N, int J, const char *wname, const char *me
     }
     else
     {
-        wave_free (wave);
-        wt_free (wt);
         throw std::runtime_error ("unsupported wavelet method");
     }
 
@@ -112,8 +97,6 @@ void visushrink (double *signal, int N, int J, const char *wname, const char *me
     {
         free (dout);
         free (lnoise);
-        wave_free (wave);
-        wt_free (wt);
         throw std::runtime_error ("acceptable noise extimation values are first and all");
     }
 
@@ -166,36 +149,46 @@ void visushrink (double *signal, int N, int J, const char *wname, const char *me
 
     free (dout);
     free (lnoise);
-    wave_free (wave);
-    wt_free (wt);
 }
 
-void sureshrink (double *signal, int N, int J, const char *wname, const char *method,
+void visushrink (double *signal, int N, int J, const char *wname, const char *method,
     const char *ext, const char *thresh, const char *level, double *denoised)
 {
-    int filt_len, i, it, len, dlen, dwt_len, min_index, sgn, MaxIter, iter;
-    double sigma, norm, td, tv, te, ct, thr, temp, x_sum;
-    wave_object wave;
-    wt_object wt;
-    double *dout, *risk, *dsum, *lnoise;
-
-    wave = wave_init (wname);
-
-    filt_len = wave->filtlength;
-
-    MaxIter = (int)(log ((double)N / ((double)filt_len - 1.0)) / log (2.0));
-    // Depends on J
-    if (J > MaxIter)
+    wave_object wave = wave_init (wname);
+    wt_object wt = NULL;
+    try
+    {
+        wt = wt_init (wave, method, N, J);
+        if (!strcmp (method, "dwt"))
+        {
+            setDWTExtension (wt, ext);
+        }
+        visushrink_wt (wt, signal, thresh, level, denoised);
+    }
+    catch (...)
     {
         wave_free (wave);
-        throw std::runtime_error ("not enough data points for this wavelet");
+        if (wt)
+        {
+            wt_free (wt);
+        }
+        throw;
     }
+    wave_free (wave);
+    wt_free (wt);
+}
 
-    wt = wt_init (wave, method, N, J);
+void sureshrink_wt (wt_object wt, double *signal, const char *thresh, const char *level,
+    double *denoised)
+{
+    int i, it, len, dlen, dwt_len, min_index, sgn, iter, J;
+    double sigma, norm, td, tv, te, ct, thr, temp, x_sum;
+    double *dout, *risk, *dsum, *lnoise;
+    const char *method = wt->method;
 
+    J = wt->J;
     if (!strcmp (method, "dwt"))
     {
-        setDWTExtension (wt, ext);
         dwt (wt, signal);
     }
     else if (!strcmp (method, "swt"))
@@ -204,8 +197,6 @@ void sureshrink (double *signal, int N, int J, const char *wname, const char *me
     }
     else
     {
-        wave_free (wave);
-        wt_free (wt);
         throw std::runtime_error ("unsupported wavelet type");
     }
 
@@ -257,8 +248,6 @@ void sureshrink (double *signal, int N, int J, const char *wname, const char *me
         free (risk);
         free (dsum);
         free (lnoise);
-        wave_free (wave);
-        wt_free (wt);
         throw std::runtime_error ("wrong noise estimation level value");
     }
 
@@ -360,6 +349,31 @@ void sureshrink (double *signal, int N, int J, const char *wname, const char *me
     free (dsum);
     free (risk);
     free (lnoise);
+}
+
+void sureshrink (double *signal, int N, int J, const char *wname, const char *method,
+    const char *ext, const char *thresh, const char *level, double *denoised)
+{
+    wave_object wave = wave_init (wname);
+    wt_object wt = NULL;
+    try
+    {
+        wt = wt_init (wave, method, N, J);
+        if (!strcmp (method, "dwt"))
+        {
+            setDWTExtension (wt, ext);
+        }
+        sureshrink_wt (wt, signal, thresh, level, denoised);
+    }
+    catch (...)
+    {
+        wave_free (wave);
+        if (wt)
+        {
+            wt_free (wt);
+        }
+        throw;
+    }
     wave_free (wave);
     wt_free (wt);
 }
@@ -524,6 +538,31 @@ void denoise (denoise_object obj, double *signal, double *denoised)
     }
 }
 
+void denoise_wt (denoise_object obj, wt_object wt, double *signal, double *denoised)
+{
+    if ((wt->siglength != obj->N) || (wt->J != obj->J) || (strcmp (wt->method, obj->wmethod)) ||
+        (strcmp (wt->wave->wname, obj->wname)))
+    {
+        throw std::runtime_error ("transform object doesnt match denoising parameters");
+    }
+    if (!strcmp (obj->wmethod, "dwt") && strcmp (wt->ext, obj->ext))
+    {
+        throw std::runtime_error ("transform object doesnt match denoising parameters");
+    }
+    if (!strcmp (obj->dmethod, "sureshrink"))
+    {
+        sureshrink_wt (wt, signal, obj->thresh, obj->level, denoised);
+    }
+    else if (!strcmp (obj->dmethod, "visushrink"))
+    {
+        visushrink_wt (wt, signal, obj->thresh, obj->level, denoised);
+    }
+    else
+    {
+        throw std::runtime_error ("unsupported denoising method");
+    }
+}
+
 void setDenoiseMethod (denoise_object obj, const char *dmethod)
 {
     if (!strcmp (dmethod, "sureshrink"))
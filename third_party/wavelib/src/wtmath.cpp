@@ -3,6 +3,41 @@ Copyright (c) 2018, Rafat Hussain
 */
 #include "wtmath.h"
 
+// filters len taps which end at inp, boundary checks are done by the caller. Sums are accumulated
+// in the same order as in the general loops below, so results dont depend on the path
+static inline void dwt_stride_inner (const double *inp, const double *lpd, const double *hpd,
+    int len, int istride, double *cA, double *cD)
+{
+    double sum_a = 0.0;
+    double sum_d = 0.0;
+    for (int l = 0; l < len; ++l)
+    {
+        double x = inp[-l * istride];
+        sum_a += lpd[l] * x;
+        sum_d += hpd[l] * x;
+    }
+    *cA = sum_a;
+    *cD = sum_d;
+}
+
+// upsamples and filters half_len coefficients which end at cA and cD
+static inline void idwt_stride_inner (const double *cA, const double *cD, const double *lpr,
+    const double *hpr, int half_len, int istride, double *even, double *odd)
+{
+    double sum_even = 0.0;
+    double sum_odd = 0.0;
+    for (int l = 0; l < half_len; ++l)
+    {
+        int t = 2 * l;
+        double a = cA[-l * istride];
+        double d = cD[-l * istride];
+        sum_even += lpr[t] * a + hpr[t] * d;
+        sum_odd += lpr[t + 1] * a + hpr[t + 1] * d;
+    }
+    *even = sum_even;
+    *odd = sum_odd;
+}
+
 void dwt_per_stride (double *inp, int N, double *lpd, double *hpd, int lpd_len, double *cA,
     int len_cA, double *cD, int istride, int ostride)
 {
@@ -16,6 +51,12 @@ void dwt_per_stride (double *inp, int N, double *lpd, double *hpd, int lpd_len,
     {
         t = 2 * i + l2;
         os = i * ostride;
+        if ((t - len_avg + 1 >= 0) && (t < N))
+        {
+            // all taps are inside of the signal, no wrapping
+            dwt_stride_inner (inp + t * istride, lpd, hpd, len_avg, istride, cA + os, cD + os);
+            continue;
+        }
         cA[os] = 0.0;
         cD[os] = 0.0;
         for (l = 0; l < len_avg; ++l)
@@ -89,6 +130,12 @@ void dwt_sym_stride (double *inp, int N, double *lpd, double *hpd, int lpd_len,
     {
         t = 2 * i + 1;
         os = i * ostride;
+        if ((t - len_avg + 1 >= 0) && (t < N))
+        {
+            // all taps are inside of the signal, no reflection
+            dwt_stride_inner (inp + t * istride, lpd, hpd, len_avg, istride, cA + os, cD + os);
+            continue;
+        }
         cA[os] = 0.0;
         cD[os] = 0.0;
         for (l = 0; l < len_avg; ++l)
@@ -232,6 +279,13 @@ void idwt_per_stride (double *cA, int len_cA, double *cD, double *lpr, double *h
         n += 2;
         ms = m * ostride;
         ns = n * ostride;
+        if ((i - l2 + 1 >= 0) && (i < len_cA))
+        {
+            // all coefficients are inside of the arrays, no wrapping
+            idwt_stride_inner (cA + i * istride, cD + i * istride, lpr, hpr, l2, istride, X + ms,
+                X + ns);
+            continue;
+        }
         X[ms] = 0.0;
         X[ns] = 0.0;
         for (l = 0; l < l2; ++l)
@@ -275,6 +329,12 @@ void idwt_sym_stride (double *cA, int len_cA, double *cD, double *lpr, double *h
         n += 2;
         ms = m * ostride;
         ns = n * ostride;
+        if ((i - len_avg / 2 + 1 >= 0) && (i < len_cA))
+        {
+            idwt_stride_inner (cA + i * istride, cD + i * istride, lpr, hpr, len_avg / 2, istride,
+                X + ms, X + ns);
+            continue;
+        }
         X[ms] = 0.0;
         X[ns] = 0.0;
         for (l = 0; l < len_avg / 2; ++l)
@@ -0,0 +1,170 @@
+import argparse
+import json
+import os
+import re
+import sys
+
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+DEFAULT_INPUT = os.path.join(ROOT_DIR, 'src', 'board_controller', 'brainflow_boards.jsonc')
+DEFAULT_OUTPUT = os.path.join(ROOT_DIR, 'src', 'board_controller', 'brainflow_boards.cpp')
+
+# order of presets matches BrainFlowPresets enum
+PRESETS = ['default', 'auxiliary', 'ancillary']
+# order of fields matches BoardPresetDescr struct
+INT_FIELDS = ['sampling_rate', 'package_num_channel', 'timestamp_channel', 'marker_channel',
+              'battery_channel', 'num_rows']
+STRING_FIELDS = ['eeg_names']
+CHANNEL_FIELDS = ['eeg_channels', 'emg_channels', 'ecg_channels', 'eog_channels', 'eda_channels',
+                  'ppg_channels', 'optical_channels', 'accel_channels', 'rotation_channels',
+                  'analog_channels', 'gyro_channels', 'other_channels', 'temperature_channels',
+                  'resistance_channels', 'magnetometer_channels']
+
+
+def strip_comments(text):
+    # comments start with // outside of strings and last till the end of line
+    lines = []
+    for line in text.splitlines():
+        in_string = False
+        cut = len(line)
+        for i, c in enumerate(line):
+            if c == '"' and (i == 0 or line[i - 1] != '\\'):
+                in_string = not in_string
+            elif not in_string and line.startswith('//', i):
+                cut = i
+                break
+        lines.append(line[:cut])
+    return '\n'.join(lines)
+
+
+def load_boards(file_name):
+    with open(file_name) as f:
+        boards = json.loads(strip_comments(f.read()))
+    result = dict()
+    for board_id, presets in boards.items():
+        if not re.match(r'^-?\d+$', board_id):
+            raise ValueError('invalid board id %s' % board_id)
+        if 'default' not in presets:
+            raise ValueError('board %s has no default preset' % board_id)
+        for preset, descr in presets.items():
+            if preset not in PRESETS:
+                raise ValueError('board %s has unknown preset %s' % (board_id, preset))
+            if not isinstance(descr.get('name'), str):
+                raise ValueError('board %s preset %s has no name' % (board_id, preset))
+            for key, value in descr.items():
+                if key in INT_FIELDS:
+                    valid = isinstance(value, int) and value >= 0
+                elif key in STRING_FIELDS or key == 'name':
+                    valid = isinstance(value, str)
+                elif key in CHANNEL_FIELDS:
+                    valid = isinstance(value, list) and len(value) > 0 and all(
+                        isinstance(x, int) and x >= 0 for x in value)
+                else:
+                    raise ValueError('board %s preset %s has unknown field %s' % (board_id, preset, key))
+                if not valid:
+                    raise ValueError('board %s preset %s has invalid value for %s' % (board_id, preset, key))
+        result[int(board_id)] = presets
+    return result
+
+
+def c_string(value):
+    return json.dumps(value)
+
+
+def array_name(board_id, preset, field):
+    prefix = ('board_m%d' % -board_id) if board_id < 0 else ('board_%d' % board_id)
+    return '%s_%s_%s' % (prefix, preset, field)
+
+
+def generate(boards):
+    min_id = min(boards.keys())
+    max_id = max(boards.keys())
+    out = list()
+    out.append('// Generated by tools/generate_board_descr.py from brainflow_boards.jsonc, do not edit')
+    out.append('')
+    out.append('#include <stddef.h>')
+    out.append('')
+    out.append('#include "brainflow_boards.h"')
+    out.append('')
+    out.append('#define MIN_BOARD_ID %d' % min_id)
+    out.append('#define NUM_BOARD_IDS %d' % (max_id - min_id + 1))
+    out.append('')
+    out.append('// clang-format off')
+    out.append('')
+    for board_id in sorted(boards.keys()):
+        for preset in PRESETS:
+            descr = boards[board_id].get(preset)
+            if descr is None:
+                continue
+            for field in CHANNEL_FIELDS:
+                if field in descr:
+                    out.append('static constexpr int %s[] = {%s};' % (
+                        array_name(board_id, preset, field), ', '.join(str(x) for x in descr[field])))
+    out.append('')
+    out.append('static constexpr BoardPresetDescr board_descr_table[NUM_BOARD_IDS][BOARD_DESCR_NUM_PRESETS] = {')
+    for board_id in range(min_id, max_id + 1):
+        presets = boards.get(board_id)
+        if presets is None:
+            out.append('    // %d' % board_id)
+        else:
+            out.append('    // %d %s' % (board_id, presets['default']['name']))
+        out.append('    {')
+        for preset in PRESETS:
+            descr = None if presets is None else presets.get(preset)
+            values = list()
+            if descr is None:
+                values.append('NULL')
+                values.extend(['BOARD_DESCR_NO_VALUE'] * len(INT_FIELDS))
+                values.extend(['NULL'] * len(STRING_FIELDS))
+                values.extend(['{NULL, 0}'] * len(CHANNEL_FIELDS))
+            else:
+                values.append(c_string(descr['name']))
+                for field in INT_FIELDS:
+                    values.append(str(descr[field]) if field in descr else 'BOARD_DESCR_NO_VALUE')
+                for field in STRING_FIELDS:
+                    values.append(c_string(descr[field]) if field in descr else 'NULL')
+                for field in CHANNEL_FIELDS:
+                    if field in descr:
+                        values.append('{%s, %d}' % (array_name(board_id, preset, field), len(descr[field])))
+                    else:
+                        values.append('{NULL, 0}')
+            out.append('        {%s},' % ', '.join(values))
+        out.append('    },')
+    out.append('};')
+    out.append('')
+    out.append('// clang-format on')
+    out.append('')
+    out.append('const BoardPresetDescr *get_board_preset_descr (int board_id, int preset)')
+    out.append('{')
+    out.append('    if ((board_id < MIN_BOARD_ID) || (board_id >= MIN_BOARD_ID + NUM_BOARD_IDS) || (preset < 0) ||')
+    out.append('        (preset >= BOARD_DESCR_NUM_PRESETS))')
+    out.append('    {')
+    out.append('        return NULL;')
+    out.append('    }')
+    out.append('    const BoardPresetDescr *descr = &board_descr_table[board_id - MIN_BOARD_ID][preset];')
+    out.append('    return (descr->name == NULL) ? NULL : descr;')
+    out.append('}')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--input', type=str, help='board descriptors', default=DEFAULT_INPUT)
+    parser.add_argument('--output', type=str, help='generated source file', default=DEFAULT_OUTPUT)
+    parser.add_argument('--check', action='store_true',
+                        help='dont write anything, fail if output is not up to date')
+    args = parser.parse_args()
+
+    source = generate(load_boards(args.input))
+    if args.check:
+        with open(args.output) as f:
+            if f.read() != source:
+                print('%s is outdated, run %s' % (args.output, os.path.basename(__file__)))
+                sys.exit(1)
+        return
+    with open(args.output, 'w') as f:
+        f.write(source)
+
+
+if __name__ == '__main__':
+    main()